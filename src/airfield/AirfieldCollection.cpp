@@ -32,12 +32,7 @@ namespace UKControllerPlugin {
                 throw std::out_of_range("Airfield not found");
             }
 
-            auto iterator = std::find_if(this->airfieldMap.begin(), this->airfieldMap.end(),
-                [icao](std::pair<std::string, const std::unique_ptr<Airfield> &> airfield) -> bool {
-
-                return airfield.second->GetIcao().compare(icao) == 0;
-            });
-
+            auto iterator = this->airfieldMap.find(icao);
             if (iterator == this->airfieldMap.end()) {
                 throw std::out_of_range("Airfield not found");
             }
@@ -11,6 +11,12 @@ namespace UKControllerPlugin {
         class AirfieldCollection
         {
             public:
+                // Public type definitions for iterating the airfields
+                typedef std::map<std::string, std::unique_ptr<UKControllerPlugin::Airfield::Airfield>> AirfieldMap;
+                typedef AirfieldMap::const_iterator const_iterator;
+                const_iterator cbegin(void) const { return airfieldMap.cbegin(); }
+                const_iterator cend(void) const { return airfieldMap.cend(); }
+
                 void AddAirfield(std::unique_ptr<UKControllerPlugin::Airfield::Airfield> airfield);
                 const Airfield & FetchAirfieldByIcao(std::string icao) const;
                 size_t GetSize(void) const;
@@ -18,7 +24,7 @@ namespace UKControllerPlugin {
                 bool IsHomeAirfield(std::string icao) const;
 
                 // A map of ICAO code to airfield.
-                std::map<std::string, std::unique_ptr<UKControllerPlugin::Airfield::Airfield>> airfieldMap;
+                AirfieldMap airfieldMap;
         };
     }  // namespace Airfield
 }  // namespace UKControllerPlugin
@@ -2,10 +2,12 @@
 #include "airfield/AirfieldOwnershipManager.h"
 #include "airfield/AirfieldCollection.h"
 #include "airfield/Airfield.h"
+#include "airfield/AirfieldOwnershipSnapshot.h"
 #include "controller/ActiveCallsignCollection.h"
 
 using UKControllerPlugin::Airfield::AirfieldCollection;
 using UKControllerPlugin::Airfield::Airfield;
+using UKControllerPlugin::Airfield::AirfieldOwnershipSnapshot;
 using UKControllerPlugin::Controller::ActiveCallsignCollection;
 using UKControllerPlugin::Controller::ActiveCallsign;
 using UKControllerPlugin::Controller::ControllerPosition;
@@ -20,7 +22,8 @@ namespace UKControllerPlugin {
             : airfields(airfields),
             activeCallsigns(activeCallsigns),
             notFoundControllerPosition("", 199.998, "XXX", {}),
-            notFoundCallsign("", "", this->notFoundControllerPosition)
+            notFoundCallsign("", "", this->notFoundControllerPosition),
+            snapshot(std::make_shared<const AirfieldOwnershipSnapshot>())
         {
 
         }
@@ -51,12 +54,177 @@ namespace UKControllerPlugin {
             return this->ownershipMap.count(icao) > 0;
         }
 
+        /*
+            Compiles the ownership precedence of the airfields into position bitmasks. Positions are
+            numbered so that, as far as possible, every airfield lists them in increasing order. This is
+            a topological sort of the "comes before" relationships in each airfield's precedence,
+            preferring positions in the order they're first seen. Positions caught in a cycle go on the
+            end, and any airfield whose precedence doesn't increase is marked as not ordered.
+
+            Airfields aren't expected to change once loaded, but if any are added we compile from scratch.
+        */
+        void AirfieldOwnershipManager::CompilePrecedence(void)
+        {
+            if (this->compiledAirfields.size() == this->airfields.GetSize()) {
+                return;
+            }
+
+            this->compiledAirfields.clear();
+            this->airfieldIds.clear();
+            std::unordered_map<std::string, int> seenIds;
+            std::vector<std::string> seenPositions;
+            std::vector<std::set<int>> successors;
+            std::vector<int> predecessorCounts;
+            for (
+                AirfieldCollection::const_iterator it = this->airfields.cbegin();
+                it != this->airfields.cend();
+                ++it
+            ) {
+                CompiledAirfield compiled{ it->first, {}, true };
+                std::vector<std::string> precedence = it->second->GetOwnershipPresedence();
+                for (std::vector<std::string>::iterator position = precedence.begin();
+                    position != precedence.end();
+                    ++position
+                ) {
+                    auto seen = seenIds.insert({ *position, static_cast<int>(seenPositions.size()) });
+                    if (seen.second) {
+                        seenPositions.push_back(*position);
+                        successors.push_back({});
+                        predecessorCounts.push_back(0);
+                    }
+
+                    int seenId = seen.first->second;
+                    if (
+                        !compiled.precedence.empty() &&
+                        compiled.precedence.back() != seenId &&
+                        successors[compiled.precedence.back()].insert(seenId).second
+                    ) {
+                        predecessorCounts[seenId]++;
+                    }
+                    compiled.precedence.push_back(seenId);
+                }
+
+                this->airfieldIds[it->first] = this->compiledAirfields.size();
+                this->compiledAirfields.push_back(std::move(compiled));
+            }
+
+            std::priority_queue<int, std::vector<int>, std::greater<int>> ready;
+            for (size_t seenId = 0; seenId < seenPositions.size(); seenId++) {
+                if (predecessorCounts[seenId] == 0) {
+                    ready.push(seenId);
+                }
+            }
+
+            std::vector<int> positionOrder(seenPositions.size(), -1);
+            int nextPositionId = 0;
+            while (!ready.empty()) {
+                int seenId = ready.top();
+                ready.pop();
+                positionOrder[seenId] = nextPositionId++;
+                for (std::set<int>::const_iterator it = successors[seenId].cbegin();
+                    it != successors[seenId].cend();
+                    ++it
+                ) {
+                    if (--predecessorCounts[*it] == 0) {
+                        ready.push(*it);
+                    }
+                }
+            }
+
+            this->positionCallsigns.assign(seenPositions.size(), "");
+            this->positionIds.clear();
+            for (size_t seenId = 0; seenId < seenPositions.size(); seenId++) {
+                if (positionOrder[seenId] == -1) {
+                    positionOrder[seenId] = nextPositionId++;
+                }
+
+                this->positionCallsigns[positionOrder[seenId]] = seenPositions[seenId];
+                this->positionIds[seenPositions[seenId]] = positionOrder[seenId];
+            }
+
+            this->maskWords = (seenPositions.size() + 63) / 64;
+            this->precedenceMasks.assign(this->compiledAirfields.size() * this->maskWords, 0);
+            this->positionAirfields.assign(seenPositions.size(), {});
+            for (size_t airfieldId = 0; airfieldId < this->compiledAirfields.size(); airfieldId++) {
+                CompiledAirfield & airfield = this->compiledAirfields[airfieldId];
+                unsigned long long * mask = &this->precedenceMasks[airfieldId * this->maskWords];
+                int previousId = -1;
+                for (std::vector<int>::iterator position = airfield.precedence.begin();
+                    position != airfield.precedence.end();
+                    ++position
+                ) {
+                    *position = positionOrder[*position];
+                    airfield.ordered = airfield.ordered && *position > previousId;
+                    previousId = *position;
+                    mask[*position / 64] |= 1ULL << (*position % 64);
+
+                    std::vector<int> & dependents = this->positionAirfields[*position];
+                    if (dependents.empty() || dependents.back() != airfieldId) {
+                        dependents.push_back(airfieldId);
+                    }
+                }
+            }
+
+            this->activePositions.assign(this->maskWords, 0);
+            this->activePositionsSynced = false;
+            this->compiledOwners.assign(this->compiledAirfields.size(), -2);
+        }
+
+        /*
+            Returns the index of the lowest set bit in a word, which must not be zero.
+        */
+        int AirfieldOwnershipManager::FindFirstSet(unsigned long long word)
+        {
+            static const int deBruijnPositions[64] = {
+                0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4,
+                62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+                63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+                46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6
+            };
+
+            return deBruijnPositions[((word & (0 - word)) * 0x03F79D71B4CB0A89ULL) >> 58];
+        }
+
+        /*
+            Returns the id of the position that should own an airfield, or -1 if nobody should.
+        */
+        int AirfieldOwnershipManager::FindOwnerPosition(int airfieldId) const
+        {
+            const CompiledAirfield & airfield = this->compiledAirfields[airfieldId];
+            if (!airfield.ordered) {
+                for (std::vector<int>::const_iterator it = airfield.precedence.cbegin();
+                    it != airfield.precedence.cend();
+                    ++it
+                ) {
+                    if (this->PositionIdActive(*it)) {
+                        return *it;
+                    }
+                }
+
+                return -1;
+            }
+
+            const unsigned long long * mask = &this->precedenceMasks[airfieldId * this->maskWords];
+            for (size_t word = 0; word < this->maskWords; word++) {
+                unsigned long long candidates = mask[word] & this->activePositions[word];
+                if (candidates != 0) {
+                    return word * 64 + this->FindFirstSet(candidates);
+                }
+            }
+
+            return -1;
+        }
+
         /*
             Sets no owner on all airfields.
         */
         void AirfieldOwnershipManager::Flush(void)
         {
             this->ownershipMap.clear();
+            this->ownedAirfields.clear();
+            std::fill(this->compiledOwners.begin(), this->compiledOwners.end(), -2);
+            this->snapshotStale = true;
+            this->PublishSnapshot();
         }
 
         /*
@@ -72,7 +240,7 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Returns a set of the airfields owned by a given contrroller.
+            Returns a set of the airfields owned by a given contrroller, ordered by ICAO.
         */
         std::vector<Airfield> AirfieldOwnershipManager::GetOwnedAirfields(std::string callsign) const
         {
@@ -82,62 +250,216 @@ namespace UKControllerPlugin {
                 return ownedAirfields;
             }
 
-            for (
-                std::map<std::string, std::unique_ptr<ActiveCallsign>>::const_iterator it = this->ownershipMap.cbegin();
-                it != this->ownershipMap.cend();
-                ++it
-            ) {
-                if (*it->second == this->activeCallsigns.GetCallsign(callsign)) {
-                    ownedAirfields.push_back(this->airfields.FetchAirfieldByIcao(it->first));
-                }
+            auto owned = this->ownedAirfields.equal_range(callsign);
+            for (auto it = owned.first; it != owned.second; ++it) {
+                ownedAirfields.push_back(this->airfields.FetchAirfieldByIcao(it->second));
             }
 
+            std::sort(
+                ownedAirfields.begin(),
+                ownedAirfields.end(),
+                [](const Airfield & first, const Airfield & second) -> bool {
+                    return first.GetIcao() < second.GetIcao();
+                }
+            );
             return ownedAirfields;
         }
 
+        /*
+            Returns the most recently published snapshot of airfield ownership. Safe to call from any thread.
+        */
+        std::shared_ptr<const AirfieldOwnershipSnapshot> AirfieldOwnershipManager::GetSnapshot(void) const
+        {
+            return std::atomic_load(&this->snapshot);
+        }
+
+        /*
+            Returns true if the position with the given id is active.
+        */
+        bool AirfieldOwnershipManager::PositionIdActive(int positionId) const
+        {
+            return (this->activePositions[positionId / 64] & (1ULL << (positionId % 64))) != 0;
+        }
+
+        /*
+            Publishes a copy of the ownership for readers on other threads, if it has changed.
+        */
+        void AirfieldOwnershipManager::PublishSnapshot(void)
+        {
+            if (!this->snapshotStale) {
+                return;
+            }
+
+            std::atomic_store(
+                &this->snapshot,
+                std::shared_ptr<const AirfieldOwnershipSnapshot>(
+                    std::make_shared<AirfieldOwnershipSnapshot>(this->ownershipMap)
+                )
+            );
+            this->snapshotStale = false;
+        }
+
+        /*
+            Recomputes every airfield's owner in one pass over the precedence masks.
+        */
+        void AirfieldOwnershipManager::RefreshAllOwners(void)
+        {
+            this->CompilePrecedence();
+            this->SyncActivePositions();
+            for (size_t airfieldId = 0; airfieldId < this->compiledAirfields.size(); airfieldId++) {
+                this->RefreshCompiledOwner(airfieldId);
+            }
+            this->PublishSnapshot();
+        }
+
+        /*
+            Updates the owner of a compiled airfield, taking the lead callsign of the first position
+            in its precedence that is active.
+        */
+        void AirfieldOwnershipManager::RefreshCompiledOwner(int airfieldId)
+        {
+            const CompiledAirfield & airfield = this->compiledAirfields[airfieldId];
+            int owner = this->FindOwnerPosition(airfieldId);
+            if (owner == this->compiledOwners[airfieldId]) {
+                return;
+            }
+
+            this->compiledOwners[airfieldId] = owner;
+            if (owner == -1) {
+                // We can't find an owner, so set no owner.
+                this->RemoveOwner(airfield.icao);
+                return;
+            }
+
+            this->SetOwner(
+                airfield.icao,
+                this->activeCallsigns.GetLeadCallsignForPosition(this->positionCallsigns[owner])
+            );
+        }
+
         /*
             Updates the owner of a given airfield.
         */
         void AirfieldOwnershipManager::RefreshOwner(std::string icao)
         {
-            std::vector<std::string> topdownOrder;
-            try {
-                topdownOrder = this->airfields.FetchAirfieldByIcao(icao).GetOwnershipPresedence();
-            }
-            catch (std::out_of_range) {
+            this->CompilePrecedence();
+            auto airfield = this->airfieldIds.find(icao);
+            if (airfield == this->airfieldIds.cend()) {
                 // Nothing we can do if we can't find the airfield.
                 return;
             }
 
-            // Loop through the topdown order
-            for (std::vector<std::string>::iterator it = topdownOrder.begin(); it != topdownOrder.end(); ++it) {
+            this->SyncActivePositions();
+            this->RefreshCompiledOwner(airfield->second);
+            this->PublishSnapshot();
+        }
 
-                // If nobody is covering the position, don't count it, otherwise, take the lead callsign
-                if (!this->activeCallsigns.PositionActive(*it)) {
-                    continue;
+        /*
+            Updates the owners of all the airfields that have a given position in their precedence.
+        */
+        void AirfieldOwnershipManager::RefreshOwnersForPosition(const std::string & normalisedCallsign)
+        {
+            this->CompilePrecedence();
+            auto position = this->positionIds.find(normalisedCallsign);
+            if (position == this->positionIds.cend()) {
+                return;
+            }
+
+            this->SyncActivePositions();
+            for (std::vector<int>::const_iterator it = this->positionAirfields[position->second].cbegin();
+                it != this->positionAirfields[position->second].cend();
+                ++it
+            ) {
+                this->RefreshCompiledOwner(*it);
+            }
+            this->PublishSnapshot();
+        }
+
+        /*
+            Removes an airfield from those owned by a given callsign.
+        */
+        void AirfieldOwnershipManager::RemoveOwnedAirfield(const std::string & callsign, const std::string & icao)
+        {
+            auto owned = this->ownedAirfields.equal_range(callsign);
+            for (auto it = owned.first; it != owned.second; ++it) {
+                if (it->second == icao) {
+                    this->ownedAirfields.erase(it);
+                    return;
                 }
+            }
+        }
 
-                // Only log when positions have changed hands
-                bool needsLog = this->ownershipMap.count(icao) == 0 ||
-                    this->ownershipMap.at(icao)->GetCallsign() !=
-                    this->activeCallsigns.GetLeadCallsignForPosition(*it).GetCallsign();
+        /*
+            Removes the owner of an airfield, if it has one.
+        */
+        void AirfieldOwnershipManager::RemoveOwner(const std::string & icao)
+        {
+            auto owner = this->ownershipMap.find(icao);
+            if (owner == this->ownershipMap.end()) {
+                return;
+            }
 
-                this->ownershipMap[icao] = std::make_unique<ActiveCallsign>(
-                    this->activeCallsigns.GetLeadCallsignForPosition(*it)
-                );
+            this->RemoveOwnedAirfield(owner->second->GetCallsign(), icao);
+            LogInfo("Airfield " + icao + " is no longer managed by any controller");
+            this->ownershipMap.erase(owner);
+            this->snapshotStale = true;
+        }
 
-                if (needsLog) {
-                    LogInfo(
-                        "Airfield " + icao + " is now managed by " +
-                        this->ownershipMap.find(icao)->second->GetCallsign()
-                    );
+        /*
+            Sets the owner of an airfield, moving it between owners in the owned airfields map.
+        */
+        void AirfieldOwnershipManager::SetOwner(const std::string & icao, const ActiveCallsign & owner)
+        {
+            auto current = this->ownershipMap.find(icao);
+            if (current != this->ownershipMap.end() && current->second->GetCallsign() == owner.GetCallsign()) {
+                // Only take a new copy if the controller has changed, most refreshes leave the owner as it was
+                if (
+                    current->second->GetControllerName() != owner.GetControllerName() ||
+                    &current->second->GetNormalisedPosition() != &owner.GetNormalisedPosition()
+                ) {
+                    current->second = std::make_unique<ActiveCallsign>(owner);
+                    this->snapshotStale = true;
                 }
                 return;
             }
 
-            // We can't find an owner, so set no owner.
-            LogInfo("Airfield " + icao + " is no longer managed by any controller");
-            this->ownershipMap.erase(icao);
+            // Only log when positions have changed hands
+            if (current != this->ownershipMap.end()) {
+                this->RemoveOwnedAirfield(current->second->GetCallsign(), icao);
+            }
+
+            this->ownershipMap[icao] = std::make_unique<ActiveCallsign>(owner);
+            this->ownedAirfields.insert({ owner.GetCallsign(), icao });
+            this->snapshotStale = true;
+            LogInfo("Airfield " + icao + " is now managed by " + owner.GetCallsign());
+        }
+
+        /*
+            Rebuilds the set of active positions, if the active callsigns have changed since it was last built.
+        */
+        void AirfieldOwnershipManager::SyncActivePositions(void)
+        {
+            if (this->activePositionsSynced && this->activeGeneration == this->activeCallsigns.GetGeneration()) {
+                return;
+            }
+
+            std::fill(this->activePositions.begin(), this->activePositions.end(), 0);
+            for (
+                ActiveCallsignCollection::const_iterator it = this->activeCallsigns.cbegin();
+                it != this->activeCallsigns.cend();
+                ++it
+            ) {
+                auto position = this->positionIds.find(it->first);
+                if (it->second.empty() || position == this->positionIds.cend()) {
+                    continue;
+                }
+
+                this->activePositions[position->second / 64] |= 1ULL << (position->second % 64);
+            }
+
+            std::fill(this->compiledOwners.begin(), this->compiledOwners.end(), -2);
+            this->activeGeneration = this->activeCallsigns.GetGeneration();
+            this->activePositionsSynced = true;
         }
     }  // namespace Airfield
 }  // namespace UKControllerPlugin
@@ -16,6 +16,7 @@ namespace UKControllerPlugin {
         // More forward declarations
         class AirfieldCollection;
         class Airfield;
+        class AirfieldOwnershipSnapshot;
         // END
 
         /*
@@ -23,6 +24,20 @@ namespace UKControllerPlugin {
             to determine whether or not the client should be setting initial altitudes or
             requesting squawks. Naturally, there are server side checks for this too,
             but nobody likes a hammered server.
+
+            Each airfield's ownership precedence is compiled into a bitmask of position ids, along
+            with a reverse index of which airfields depend on each position. Position ids are
+            numbered in top-down order, so that the owner of an airfield is the lowest set bit of its
+            mask ANDed with the set of active positions. The few airfields whose precedence can't
+            be reconciled with the common order are walked in order instead, still against the
+            active position bits.
+
+            When a position comes online or goes offline, only the airfields that list it are
+            refreshed. A map of owner callsign to airfields is kept up to date as owners change,
+            so that finding the airfields a controller owns doesn't involve looking at every airfield.
+
+            After any refresh that changes an owner, a read-only snapshot of the ownership is published
+            for readers that aren't on the EuroScope thread.
         */
         class AirfieldOwnershipManager
         {
@@ -40,13 +55,39 @@ namespace UKControllerPlugin {
                 void Flush(void);
                 const UKControllerPlugin::Controller::ActiveCallsign & GetOwner(std::string icao) const;
                 std::vector<UKControllerPlugin::Airfield::Airfield> GetOwnedAirfields(std::string callsign) const;
+                std::shared_ptr<const UKControllerPlugin::Airfield::AirfieldOwnershipSnapshot> GetSnapshot(void) const;
+                void RefreshAllOwners(void);
                 void RefreshOwner(std::string icao);
+                void RefreshOwnersForPosition(const std::string & normalisedCallsign);
 
                 // A callsign to return when a lookup is done but the callsign cant be found
                 const UKControllerPlugin::Controller::ActiveCallsign notFoundCallsign;
 
             private:
 
+                // An airfield with its ownership precedence compiled into position ids
+                typedef struct CompiledAirfield {
+                    std::string icao;
+                    std::vector<int> precedence;
+
+                    // Whether the position ids increase in precedence order, so the mask can be used
+                    bool ordered;
+                } CompiledAirfield;
+
+                void CompilePrecedence(void);
+                static int FindFirstSet(unsigned long long word);
+                int FindOwnerPosition(int airfieldId) const;
+                bool PositionIdActive(int positionId) const;
+                void PublishSnapshot(void);
+                void RefreshCompiledOwner(int airfieldId);
+                void RemoveOwnedAirfield(const std::string & callsign, const std::string & icao);
+                void RemoveOwner(const std::string & icao);
+                void SetOwner(
+                    const std::string & icao,
+                    const UKControllerPlugin::Controller::ActiveCallsign & owner
+                );
+                void SyncActivePositions(void);
+
                 // A controller position to return when a lookup is done but the callsign cant be found
                 const UKControllerPlugin::Controller::ControllerPosition notFoundControllerPosition;
 
@@ -56,8 +97,54 @@ namespace UKControllerPlugin {
                 // Collection of all airfields
                 const UKControllerPlugin::Airfield::AirfieldCollection & airfields;
 
-                // Map of callsign to ownership
-                std::map<std::string, std::unique_ptr<UKControllerPlugin::Controller::ActiveCallsign>> ownershipMap;
+                // Map of airfield to owner
+                std::unordered_map<
+                    std::string,
+                    std::unique_ptr<UKControllerPlugin::Controller::ActiveCallsign>
+                > ownershipMap;
+
+                // The airfields owned by each owner callsign
+                std::unordered_multimap<std::string, std::string> ownedAirfields;
+
+                // Airfields, with their compiled ownership precedence
+                std::vector<CompiledAirfield> compiledAirfields;
+
+                // Airfield index in the compiled airfields, by ICAO
+                std::unordered_map<std::string, int> airfieldIds;
+
+                // Position callsigns, by position id
+                std::vector<std::string> positionCallsigns;
+
+                // Position ids, by callsign
+                std::unordered_map<std::string, int> positionIds;
+
+                // The airfields that list each position in their precedence, by position id
+                std::vector<std::vector<int>> positionAirfields;
+
+                // The number of 64 bit words in each position bitmask
+                size_t maskWords = 0;
+
+                // The precedence mask for each airfield, maskWords at a time
+                std::vector<unsigned long long> precedenceMasks;
+
+                // The positions that are active
+                std::vector<unsigned long long> activePositions;
+
+                // The generation of the active callsigns that the active positions were built from
+                unsigned int activeGeneration = 0;
+
+                // Whether the active positions have been built since the precedence was compiled
+                bool activePositionsSynced = false;
+
+                // The position id that each airfield was last given an owner from, while the active positions
+                // haven't changed. -1 for no owner and -2 if it needs working out again.
+                std::vector<int> compiledOwners;
+
+                // Whether the ownership has changed since the last snapshot was published
+                bool snapshotStale = false;
+
+                // The most recently published snapshot, only to be accessed atomically
+                std::shared_ptr<const UKControllerPlugin::Airfield::AirfieldOwnershipSnapshot> snapshot;
         };
     }  // namespace Airfield
 }  // namespace UKControllerPlugin
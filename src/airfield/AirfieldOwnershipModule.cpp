@@ -3,14 +3,17 @@
 #include "bootstrap/PersistenceContainer.h"
 #include "plugin/UKPlugin.h"
 #include "massevent/MassEvent.h"
+#include "massevent/MassEventStatisticsCommand.h"
 #include "airfield/ControllerAirfieldOwnershipHandler.h"
 #include "controller/ControllerPositionCollectionFactory.h"
 #include "dependency/DependencyCache.h"
 #include "controller/ControllerStatusEventHandlerCollection.h"
 #include "controller/ControllerPositionCollection.h"
+#include "timedevent/TimedEventCollection.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::EventHandler::MassEvent;
+using UKControllerPlugin::EventHandler::MassEventStatisticsCommand;
 using UKControllerPlugin::Airfield::ControllerAirfieldOwnershipHandler;
 using UKControllerPlugin::Controller::ControllerPositionCollectionFactory;
 using UKControllerPlugin::Dependency::DependencyCache;
@@ -22,7 +25,7 @@ namespace UKControllerPlugin {
             PersistenceContainer & persistence,
             const DependencyCache & dependency
         ) {
-            MassEvent mass(
+            std::shared_ptr<MassEvent> mass = std::make_shared<MassEvent>(
                 *persistence.plugin,
                 persistence.initialAltitudeEvents,
                 *persistence.flightplans,
@@ -35,7 +38,7 @@ namespace UKControllerPlugin {
                     *persistence.controllerPositions,
                     *persistence.airfieldOwnership,
                     *persistence.activeCallsigns,
-                    mass,
+                    *mass,
                     *persistence.userMessager
                 )
             );
@@ -43,6 +46,10 @@ namespace UKControllerPlugin {
             // Add the handlers to the collections.
             persistence.controllerHandler->RegisterHandler(airfieldOwnership);
             persistence.commandHandlers->RegisterHandler(airfieldOwnership);
+            persistence.commandHandlers->RegisterHandler(
+                std::make_shared<MassEventStatisticsCommand>(*mass, *persistence.userMessager)
+            );
+            persistence.timedHandler->RegisterEvent(mass, MassEvent::timedEventFrequency);
         }
     }  // namespace Airfield
 }  // namespace UKControllerPlugin
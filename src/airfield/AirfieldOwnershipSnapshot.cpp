@@ -0,0 +1,52 @@
+#include "pch/stdafx.h"
+#include "airfield/AirfieldOwnershipSnapshot.h"
+
+using UKControllerPlugin::Controller::ActiveCallsign;
+
+namespace UKControllerPlugin {
+    namespace Airfield {
+
+        AirfieldOwnershipSnapshot::AirfieldOwnershipSnapshot(void)
+        {
+
+        }
+
+        AirfieldOwnershipSnapshot::AirfieldOwnershipSnapshot(
+            const std::unordered_map<std::string, std::unique_ptr<ActiveCallsign>> & owners
+        ) {
+            for (auto it = owners.cbegin(); it != owners.cend(); ++it) {
+                this->owners.emplace(it->first, *it->second);
+            }
+        }
+
+        /*
+            Returns true if the airfield had an owner.
+        */
+        bool AirfieldOwnershipSnapshot::AirfieldHasOwner(const std::string & icao) const
+        {
+            return this->owners.count(icao) != 0;
+        }
+
+        /*
+            Returns true if an airfield was owned by the given controller.
+        */
+        bool AirfieldOwnershipSnapshot::AirfieldOwnedBy(const std::string & icao, const ActiveCallsign & position) const
+        {
+            auto owner = this->owners.find(icao);
+            return owner != this->owners.cend() && owner->second == position;
+        }
+
+        /*
+            Returns the owner of an airfield. Throws an exception if it had no owner.
+        */
+        const ActiveCallsign & AirfieldOwnershipSnapshot::GetOwner(const std::string & icao) const
+        {
+            auto owner = this->owners.find(icao);
+            if (owner == this->owners.cend()) {
+                throw std::out_of_range("Airfield has no owner");
+            }
+
+            return owner->second;
+        }
+    }  // namespace Airfield
+}  // namespace UKControllerPlugin
@@ -0,0 +1,36 @@
+#pragma once
+#include "controller/ActiveCallsign.h"
+
+namespace UKControllerPlugin {
+    namespace Airfield {
+
+        /*
+            A read-only copy of who owned each airfield at a point in time.
+
+            The AirfieldOwnershipManager publishes a new one of these whenever ownership changes, so
+            that ownership can be read from any thread without locking.
+        */
+        class AirfieldOwnershipSnapshot
+        {
+            public:
+                AirfieldOwnershipSnapshot(void);
+                explicit AirfieldOwnershipSnapshot(
+                    const std::unordered_map<
+                        std::string,
+                        std::unique_ptr<UKControllerPlugin::Controller::ActiveCallsign>
+                    > & owners
+                );
+                bool AirfieldHasOwner(const std::string & icao) const;
+                bool AirfieldOwnedBy(
+                    const std::string & icao,
+                    const UKControllerPlugin::Controller::ActiveCallsign & position
+                ) const;
+                const UKControllerPlugin::Controller::ActiveCallsign & GetOwner(const std::string & icao) const;
+
+            private:
+
+                // Airfield ICAO to the callsign that owned it
+                std::unordered_map<std::string, UKControllerPlugin::Controller::ActiveCallsign> owners;
+        };
+    }  // namespace Airfield
+}  // namespace UKControllerPlugin
@@ -31,7 +31,7 @@ namespace UKControllerPlugin {
             const ControllerPositionCollection & controllers,
             UKControllerPlugin::Airfield::AirfieldOwnershipManager & airfieldOwnership,
             ActiveCallsignCollection & activeCallsigns,
-            const MassEvent massEventHandler,
+            MassEvent & massEventHandler,
             UserMessager & userMessager
         )
             : activeCallsigns(activeCallsigns),
@@ -43,6 +43,31 @@ namespace UKControllerPlugin {
 
         }
 
+        /*
+            Adds a controller to the active callsigns, covering the position they've been matched to.
+        */
+        void ControllerAirfieldOwnershipHandler::ActivateCallsign(
+            EuroScopeCControllerInterface & callsign,
+            const ControllerPosition & matchedPos
+        ) {
+            if (callsign.IsCurrentUser()) {
+                LogInfo(
+                    "The current user, with callsign " + callsign.GetCallsign() +
+                    ", has been marked as active, covering " + matchedPos.GetCallsign()
+                );
+                this->activeCallsigns.AddUserCallsign(
+                    ActiveCallsign(callsign.GetCallsign(), callsign.GetControllerName(), matchedPos)
+                );
+            } else {
+                LogInfo(
+                    callsign.GetCallsign() + " has been marked as active, covering " + matchedPos.GetCallsign()
+                );
+                this->activeCallsigns.AddCallsign(
+                    ActiveCallsign(callsign.GetCallsign(), callsign.GetControllerName(), matchedPos)
+                );
+            }
+        }
+
         /*
             Called when a controller disconnects from the network - remove from the active callsign list.
         */
@@ -86,12 +111,8 @@ namespace UKControllerPlugin {
             }
 
             // Perform a match based on frequency and facility to find the canonical position
-            ControllerPositionParser parser;
             try {
-                this->SetupPosition(controller, this->controllers.FetchPositionByFacilityAndFrequency(
-                    parser.ParseFacilityFromCallsign(controller.GetCallsign()),
-                    controller.GetFrequency()
-                ));
+                this->SetupPosition(controller, this->MatchPosition(controller));
             }
             catch (std::out_of_range) {
                 // No position at all, so nothing we can do.
@@ -100,14 +121,83 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Loops through each of the airfields in the topdown order and refresh who owns them.
+            Called when the plugin loads, with every controller that is already online. This does the same
+            as a controller update for each of them, but ownership is only worked out once all the positions
+            are known, and the mass events only run once, after that. The active callsigns are changed in one
+            batch, so their snapshot is only published once.
+        */
+        void ControllerAirfieldOwnershipHandler::InitialControllerLoadEvent(
+            const std::vector<std::shared_ptr<EuroScopeCControllerInterface>> & controllers
+        ) {
+            bool userActivated = false;
+            {
+                ActiveCallsignCollection::Batch batch(this->activeCallsigns);
+                for (
+                    std::vector<std::shared_ptr<EuroScopeCControllerInterface>>::const_iterator it =
+                        controllers.cbegin();
+                    it != controllers.cend();
+                    ++it
+                ) {
+                    EuroScopeCControllerInterface & controller = **it;
+                    bool callsignActive = this->activeCallsigns.CallsignActive(controller.GetCallsign());
+                    bool frequencyActive = controller.HasActiveFrequency();
+
+                    if (callsignActive && frequencyActive) {
+                        continue;
+                    }
+
+                    if (callsignActive) {
+                        LogInfo(controller.GetCallsign() + " has disconnected or unset their primary frequency");
+                        this->activeCallsigns.RemoveCallsign(
+                            this->activeCallsigns.GetCallsign(controller.GetCallsign())
+                        );
+                        continue;
+                    }
+
+                    if (!frequencyActive) {
+                        continue;
+                    }
+
+                    try {
+                        this->ActivateCallsign(controller, this->MatchPosition(controller));
+                        userActivated = userActivated || controller.IsCurrentUser();
+                    }
+                    catch (std::out_of_range) {
+                        // No position at all, so nothing we can do.
+                        continue;
+                    }
+                }
+            }
+
+            this->airfieldOwnership.RefreshAllOwners();
+            LogInfo("Airfield ownership loaded for " + std::to_string(controllers.size()) + " controllers");
+
+            if (userActivated) {
+                this->massEventHandler.SetAllInitialAltitudes();
+                this->massEventHandler.SetAllSquawks();
+            }
+        }
+
+        /*
+            Finds the controller position that a controller is logged in as, based on facility and frequency.
+            Throws an exception if there's no match.
+        */
+        const ControllerPosition & ControllerAirfieldOwnershipHandler::MatchPosition(
+            EuroScopeCControllerInterface & controller
+        ) const {
+            ControllerPositionParser parser;
+            return this->controllers.FetchPositionByFacilityAndFrequency(
+                parser.ParseFacilityFromCallsign(controller.GetCallsign()),
+                controller.GetFrequency()
+            );
+        }
+
+        /*
+            Refresh who owns each of the airfields that the position is part of the topdown order for.
         */
         void ControllerAirfieldOwnershipHandler::ProcessAffectedAirfields(const ControllerPosition & controller)
         {
-            std::vector<std::string> topDown = controller.GetTopdown();
-            for (std::vector<std::string>::iterator it = topDown.begin(); it != topDown.end(); ++it) {
-                this->airfieldOwnership.RefreshOwner(*it);
-            }
+            this->airfieldOwnership.RefreshOwnersForPosition(controller.GetCallsign());
         }
 
         /*
@@ -157,23 +247,7 @@ namespace UKControllerPlugin {
             EuroScopeCControllerInterface & callsign,
             const ControllerPosition & matchedPos
         ) {
-            // Add to the active callsign collection.
-            if (callsign.IsCurrentUser()) {
-                LogInfo(
-                    "The current user, with callsign " + callsign.GetCallsign() +
-                    ", has been marked as active, covering " + matchedPos.GetCallsign()
-                );
-                this->activeCallsigns.AddUserCallsign(
-                    ActiveCallsign(callsign.GetCallsign(), callsign.GetControllerName(), matchedPos)
-                );
-            } else {
-                LogInfo(
-                    callsign.GetCallsign() + " has been marked as active, covering " + matchedPos.GetCallsign()
-                );
-                this->activeCallsigns.AddCallsign(
-                    ActiveCallsign(callsign.GetCallsign(), callsign.GetControllerName(), matchedPos)
-                );
-            }
+            this->ActivateCallsign(callsign, matchedPos);
 
             // Work out who owns what airfields.
             this->ProcessAffectedAirfields(matchedPos);
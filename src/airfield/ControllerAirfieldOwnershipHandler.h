@@ -45,18 +45,29 @@ namespace UKControllerPlugin {
                     const UKControllerPlugin::Controller::ControllerPositionCollection & controllers,
                     UKControllerPlugin::Airfield::AirfieldOwnershipManager & airfieldOwnership,
                     UKControllerPlugin::Controller::ActiveCallsignCollection & activeCallsigns,
-                    UKControllerPlugin::EventHandler::MassEvent massEventHandler,
+                    UKControllerPlugin::EventHandler::MassEvent & massEventHandler,
                     UKControllerPlugin::Message::UserMessager & userMessager
                 );
                 void ControllerUpdateEvent(UKControllerPlugin::Euroscope::EuroScopeCControllerInterface & controller);
                 void ControllerDisconnectEvent(
                     UKControllerPlugin::Euroscope::EuroScopeCControllerInterface & controller
                 );
+                void InitialControllerLoadEvent(
+                    const std::vector<std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCControllerInterface>>
+                        & controllers
+                );
                 bool ProcessCommand(std::string command);
                 void SelfDisconnectEvent(void);
 
             private:
 
+                void ActivateCallsign(
+                    UKControllerPlugin::Euroscope::EuroScopeCControllerInterface & callsign,
+                    const UKControllerPlugin::Controller::ControllerPosition & matchedPos
+                );
+                const UKControllerPlugin::Controller::ControllerPosition & MatchPosition(
+                    UKControllerPlugin::Euroscope::EuroScopeCControllerInterface & controller
+                ) const;
                 void SetupPosition(
                     UKControllerPlugin::Euroscope::EuroScopeCControllerInterface & callsign,
                     const UKControllerPlugin::Controller::ControllerPosition & matchedPos
@@ -75,7 +86,7 @@ namespace UKControllerPlugin {
                 UKControllerPlugin::Airfield::AirfieldOwnershipManager & airfieldOwnership;
 
                 // Mass event handlers
-                UKControllerPlugin::EventHandler::MassEvent massEventHandler;
+                UKControllerPlugin::EventHandler::MassEvent & massEventHandler;
 
                 // For sending user messages
                 UKControllerPlugin::Message::UserMessager & userMessager;
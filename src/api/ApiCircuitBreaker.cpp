@@ -0,0 +1,123 @@
+#include "pch/stdafx.h"
+#include "api/ApiCircuitBreaker.h"
+
+using UKControllerPlugin::Api::ApiEndpointCircuit;
+
+namespace UKControllerPlugin {
+    namespace Api {
+
+        const std::chrono::seconds ApiCircuitBreaker::defaultOpenDuration = std::chrono::seconds(30);
+
+        ApiCircuitBreaker::ApiCircuitBreaker(unsigned int failureThreshold, std::chrono::seconds openDuration)
+            : failureThreshold(failureThreshold), openDuration(openDuration)
+        {
+
+        }
+
+        /*
+            Returns whether a request to the endpoint class should be sent. If the circuit is open
+            and it's time to test recovery, the caller becomes the probe.
+        */
+        bool ApiCircuitBreaker::AllowRequest(const std::string & endpoint)
+        {
+            std::lock_guard<std::mutex> lock(this->circuitLock);
+            auto circuit = this->circuits.find(endpoint);
+            if (circuit == this->circuits.cend() || !circuit->second.open) {
+                return true;
+            }
+
+            if (
+                circuit->second.probeInFlight ||
+                std::chrono::steady_clock::now() - circuit->second.openedAt < this->openDuration
+            ) {
+                return false;
+            }
+
+            circuit->second.probeInFlight = true;
+            LogInfo("Sending probe request to API endpoint " + endpoint);
+            return true;
+        }
+
+        /*
+            Returns how many requests to the endpoint class have failed in a row.
+        */
+        unsigned int ApiCircuitBreaker::CountConsecutiveFailures(const std::string & endpoint)
+        {
+            std::lock_guard<std::mutex> lock(this->circuitLock);
+            auto circuit = this->circuits.find(endpoint);
+            return circuit == this->circuits.cend() ? 0 : circuit->second.consecutiveFailures;
+        }
+
+        /*
+            Works out the endpoint class for a URI, the host and the first part of the path.
+        */
+        std::string ApiCircuitBreaker::GetEndpointClass(const std::string & uri)
+        {
+            size_t hostStart = uri.find("://");
+            hostStart = hostStart == std::string::npos ? 0 : hostStart + 3;
+
+            size_t pathStart = uri.find('/', hostStart);
+            if (pathStart == std::string::npos) {
+                return uri.substr(hostStart);
+            }
+
+            size_t pathEnd = uri.find_first_of("/?#", pathStart + 1);
+            return uri.substr(hostStart, pathEnd == std::string::npos ? std::string::npos : pathEnd - hostStart);
+        }
+
+        /*
+            Returns whether requests to the endpoint class are currently being refused.
+        */
+        bool ApiCircuitBreaker::IsOpen(const std::string & endpoint)
+        {
+            std::lock_guard<std::mutex> lock(this->circuitLock);
+            auto circuit = this->circuits.find(endpoint);
+            return circuit != this->circuits.cend() && circuit->second.open;
+        }
+
+        /*
+            Records a failed request, opening the circuit if there have been enough in a row. A failed
+            probe keeps the circuit open for another open duration.
+        */
+        void ApiCircuitBreaker::RecordFailure(const std::string & endpoint)
+        {
+            std::lock_guard<std::mutex> lock(this->circuitLock);
+            ApiEndpointCircuit & circuit = this->circuits[endpoint];
+            circuit.consecutiveFailures++;
+
+            if (circuit.open) {
+                circuit.openedAt = std::chrono::steady_clock::now();
+                circuit.probeInFlight = false;
+                return;
+            }
+
+            if (circuit.consecutiveFailures >= this->failureThreshold) {
+                circuit.open = true;
+                circuit.openedAt = std::chrono::steady_clock::now();
+                circuit.probeInFlight = false;
+                LogWarning(
+                    "API endpoint " + endpoint + " has failed " + std::to_string(circuit.consecutiveFailures) +
+                        " times in a row, failing requests until it recovers"
+                );
+            }
+        }
+
+        /*
+            Records a successful request, closing the circuit if it was open.
+        */
+        void ApiCircuitBreaker::RecordSuccess(const std::string & endpoint)
+        {
+            std::lock_guard<std::mutex> lock(this->circuitLock);
+            auto circuit = this->circuits.find(endpoint);
+            if (circuit == this->circuits.cend()) {
+                return;
+            }
+
+            if (circuit->second.open) {
+                LogInfo("API endpoint " + endpoint + " has recovered");
+            }
+
+            this->circuits.erase(circuit);
+        }
+    }  // namespace Api
+}  // namespace UKControllerPlugin
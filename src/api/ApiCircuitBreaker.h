@@ -0,0 +1,49 @@
+#pragma once
+#include "api/ApiEndpointCircuit.h"
+
+namespace UKControllerPlugin {
+    namespace Api {
+
+        /*
+            Stops requests being sent to parts of the API that are down, so that callers don't all wait
+            for the request timeout before finding out.
+
+            Endpoints are grouped into classes by host and the first part of the path, so squawk assignments
+            can fail independently of holds or minimum stack levels. Once enough requests to a class have failed
+            in a row, the circuit opens and requests are refused straight away. After the open duration, a
+            single probe request is let through. If it succeeds the circuit closes, otherwise it stays open
+            for another open duration.
+        */
+        class ApiCircuitBreaker
+        {
+            public:
+                ApiCircuitBreaker(unsigned int failureThreshold, std::chrono::seconds openDuration);
+                bool AllowRequest(const std::string & endpoint);
+                unsigned int CountConsecutiveFailures(const std::string & endpoint);
+                static std::string GetEndpointClass(const std::string & uri);
+                bool IsOpen(const std::string & endpoint);
+                void RecordFailure(const std::string & endpoint);
+                void RecordSuccess(const std::string & endpoint);
+
+                // How many failures in a row open the circuit, by default
+                static const unsigned int defaultFailureThreshold = 3;
+
+                // How long the circuit stays open before a probe is sent, by default
+                static const std::chrono::seconds defaultOpenDuration;
+
+            private:
+
+                // How many failures in a row open the circuit
+                const unsigned int failureThreshold;
+
+                // How long the circuit stays open before a probe is sent
+                const std::chrono::seconds openDuration;
+
+                // The circuits, by endpoint class
+                std::map<std::string, UKControllerPlugin::Api::ApiEndpointCircuit> circuits;
+
+                // Protects the circuits
+                std::mutex circuitLock;
+        };
+    }  // namespace Api
+}  // namespace UKControllerPlugin
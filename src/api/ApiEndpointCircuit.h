@@ -0,0 +1,23 @@
+#pragma once
+#include "pch/stdafx.h"
+
+namespace UKControllerPlugin {
+    namespace Api {
+        /*
+            The state of the circuit breaker for one class of API endpoint.
+        */
+        typedef struct ApiEndpointCircuit {
+            // How many requests in a row have failed
+            unsigned int consecutiveFailures = 0;
+
+            // Whether requests are currently being failed without being sent
+            bool open = false;
+
+            // When the circuit last opened
+            std::chrono::steady_clock::time_point openedAt;
+
+            // Whether a probe request has been let through to test recovery
+            bool probeInFlight = false;
+        } ApiEndpointCircuit;
+    }  // namespace Api
+}  // namespace UKControllerPlugin
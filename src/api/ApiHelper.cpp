@@ -10,6 +10,10 @@
 #include "squawk/SquawkValidator.h"
 #include "windows/WinApiInterface.h"
 #include "api/RemoteFileManifestFactory.h"
+#include "api/ApiHttpCache.h"
+#include "api/ApiCircuitBreaker.h"
+#include "api/ApiUnavailableException.h"
+#include "api/ApiRequestCollapser.h"
 
 using UKControllerPlugin::Api::ApiException;
 using UKControllerPlugin::Curl::CurlResponse;
@@ -24,6 +28,10 @@ using UKControllerPlugin::Windows::WinApiInterface;
 using UKControllerPlugin::Api::RemoteFileManifestFactory;
 using UKControllerPlugin::Squawk::ApiSquawkAllocation;
 using UKControllerPlugin::Dependency::DependencyData;
+using UKControllerPlugin::Api::ApiHttpCache;
+using UKControllerPlugin::Api::ApiCircuitBreaker;
+using UKControllerPlugin::Api::ApiUnavailableException;
+using UKControllerPlugin::Api::ApiRequestCollapser;
 
 namespace UKControllerPlugin {
     namespace Api {
@@ -32,7 +40,25 @@ namespace UKControllerPlugin {
             CurlInterface & curlApi,
             ApiRequestBuilder requestBuilder,
             WinApiInterface & winApi
-        ) : curlApi(curlApi), requestBuilder(requestBuilder), winApi(winApi)
+        ) : ApiHelper(curlApi, requestBuilder, winApi, ApiCircuitBreaker::defaultOpenDuration)
+        {
+
+        }
+
+        ApiHelper::ApiHelper(
+            CurlInterface & curlApi,
+            ApiRequestBuilder requestBuilder,
+            WinApiInterface & winApi,
+            std::chrono::seconds circuitOpenDuration
+        ) : curlApi(curlApi), requestBuilder(requestBuilder), winApi(winApi),
+            httpCache(std::make_shared<ApiHttpCache>(winApi)),
+            circuitBreaker(
+                std::make_shared<ApiCircuitBreaker>(
+                    ApiCircuitBreaker::defaultFailureThreshold,
+                    circuitOpenDuration
+                )
+            ),
+            requestCollapser(std::make_shared<ApiRequestCollapser>())
         {
 
         }
@@ -42,40 +68,216 @@ namespace UKControllerPlugin {
         */
         ApiResponse ApiHelper::MakeApiRequest(const CurlRequest request) const
         {
-            CurlResponse response = this->curlApi.MakeCurlRequest(request);
+            return this->ProcessApiResponse(request, this->SendRequest(request));
+        }
+
+        /*
+            Sends a request. GET requests don't change anything, so if an identical one is already in
+            flight, wait for its response rather than sending another.
+        */
+        CurlResponse ApiHelper::SendRequest(const CurlRequest & request) const
+        {
+            if (request.GetMethod() != CurlRequest::METHOD_GET) {
+                return this->SendThroughCircuitBreaker(request);
+            }
+
+            return this->requestCollapser->Send(
+                request,
+                [this, &request]() { return this->SendThroughCircuitBreaker(request); }
+            );
+        }
+
+        /*
+            Sends a request, as long as the circuit breaker allows it, and records whether the API
+            managed to respond. If there's a receiver, the body is streamed to it. Otherwise it's made
+            asynchronously and waited on, so that it shares connections with everything else in flight.
+
+            If making the request throws, that's recorded as a failure too. Otherwise a probe request that
+            threw would leave the circuit waiting for it forever.
+        */
+        CurlResponse ApiHelper::SendThroughCircuitBreaker(
+            const CurlRequest & request,
+            std::function<bool(const char *, size_t)> receiver
+        ) const {
+            const std::string endpoint = ApiCircuitBreaker::GetEndpointClass(request.GetUri());
+            if (!this->circuitBreaker->AllowRequest(endpoint)) {
+                throw ApiUnavailableException("Not sending request to " + endpoint + ", it is unavailable");
+            }
+
+            std::optional<CurlResponse> response;
+            try {
+                response.emplace(
+                    receiver
+                        ? this->curlApi.StreamCurlRequest(request, receiver)
+                        : this->curlApi.MakeCurlRequestAsync(request).get()
+                );
+            } catch (...) {
+                this->circuitBreaker->RecordFailure(endpoint);
+                throw;
+            }
+
+            ApiHelper::RecordResponse(*this->circuitBreaker, endpoint, *response);
+            return *response;
+        }
+
+        /*
+            Sends a squawk request, as long as the circuit breaker allows it, without waiting for the
+            response. The callbacks don't touch the helper, so it doesn't matter if it's gone by the
+            time the response arrives.
+        */
+        void ApiHelper::SendSquawkRequestAsync(
+            const CurlRequest request,
+            std::string callsign,
+            std::function<void(ApiSquawkAllocation)> onAllocated,
+            std::function<void(std::string)> onFailed
+        ) const {
+            const std::string endpoint = ApiCircuitBreaker::GetEndpointClass(request.GetUri());
+            if (!this->circuitBreaker->AllowRequest(endpoint)) {
+                onFailed(ApiUnavailableException("Not sending request to " + endpoint + ", it is unavailable").what());
+                return;
+            }
+
+            // The response may be handled before the request is even handed over, so keep track of whether
+            // it's been dealt with, to know whether a throw is a failure to send or came from a callback.
+            std::shared_ptr<ApiCircuitBreaker> circuitBreaker = this->circuitBreaker;
+            std::shared_ptr<std::atomic<bool>> recorded = std::make_shared<std::atomic<bool>>(false);
+            try {
+                this->curlApi.MakeCurlRequestAsync(
+                    request,
+                    [request, callsign, endpoint, circuitBreaker, recorded, onAllocated, onFailed](
+                        CurlResponse response
+                    ) {
+                        recorded->store(true);
+                        ApiHelper::RecordResponse(*circuitBreaker, endpoint, response);
+
+                        std::optional<ApiSquawkAllocation> allocation;
+                        try {
+                            allocation.emplace(
+                                ApiHelper::ProcessSquawkResponse(
+                                    ApiHelper::ProcessApiResponse(request, response),
+                                    callsign
+                                )
+                            );
+                        } catch (ApiException exception) {
+                            onFailed(exception.what());
+                            return;
+                        }
+
+                        onAllocated(*allocation);
+                    }
+                );
+            } catch (...) {
+                if (recorded->exchange(true)) {
+                    throw;
+                }
+
+                circuitBreaker->RecordFailure(endpoint);
+                onFailed("Unable to send request to " + endpoint);
+            }
+        }
+
+        /*
+            Records whether the API managed to respond. Client errors such as 404 still mean the API is up.
+        */
+        void ApiHelper::RecordResponse(
+            ApiCircuitBreaker & circuitBreaker,
+            const std::string & endpoint,
+            const CurlResponse & response
+        ) {
+            if (response.IsCurlError() || response.GetStatusCode() >= STATUS_SERVER_ERROR) {
+                circuitBreaker.RecordFailure(endpoint);
+            } else {
+                circuitBreaker.RecordSuccess(endpoint);
+            }
+        }
+
+        /*
+            Makes a request to the API for something that doesn't change often. If we've got a copy
+            of the response from before, the server only needs to tell us it's not changed and we
+            use the copy from disk. The copy is also used if that part of the API is unavailable.
+        */
+        ApiResponse ApiHelper::MakeCachedApiRequest(const CurlRequest request) const
+        {
+            const std::string uri = request.GetUri();
+            CurlRequest conditionalRequest = request;
+            if (this->httpCache->AddConditionalHeaders(conditionalRequest)) {
+                std::optional<CurlResponse> response;
+                try {
+                    response.emplace(this->SendRequest(conditionalRequest));
+                } catch (ApiUnavailableException) {
+                    std::optional<std::string> cachedBody = this->httpCache->GetCachedBody(uri);
+                    if (!cachedBody) {
+                        throw;
+                    }
+
+                    LogInfo("API unavailable, using cached response for " + uri);
+                    return ApiResponseFactory::Create(CurlResponse(*cachedBody, false, this->STATUS_OK));
+                }
+
+                if (!response->IsCurlError() && response->GetStatusCode() == this->STATUS_NOT_MODIFIED) {
+                    std::optional<std::string> cachedBody = this->httpCache->GetCachedBody(uri);
+                    if (cachedBody) {
+                        return ApiResponseFactory::Create(CurlResponse(*cachedBody, false, this->STATUS_OK));
+                    }
+
+                    // The server thinks we have it, but we don't, so ask again properly.
+                    LogWarning("Cached API response missing for " + uri + ", requesting again");
+                    this->httpCache->Forget(uri);
+                } else {
+                    ApiResponse apiResponse = this->ProcessApiResponse(conditionalRequest, *response);
+                    if (response->GetStatusCode() == this->STATUS_OK) {
+                        this->httpCache->Store(uri, *response);
+                    }
+                    return apiResponse;
+                }
+            }
+
+            CurlResponse response = this->SendRequest(request);
+            ApiResponse apiResponse = this->ProcessApiResponse(request, response);
+            if (response.GetStatusCode() == this->STATUS_OK) {
+                this->httpCache->Store(uri, response);
+            }
 
+            return apiResponse;
+        }
+
+        /*
+            Checks the response from the API, throwing if it isn't a success.
+        */
+        ApiResponse ApiHelper::ProcessApiResponse(const CurlRequest & request, const CurlResponse & response)
+        {
             if (response.IsCurlError()) {
                 LogError("cURL error when making API request, route: " + std::string(request.GetUri()));
                 throw ApiException("ApiException when calling " + std::string(request.GetUri()));
             }
 
-            if (response.GetStatusCode() == this->STATUS_SERVER_ERROR ||
-                response.GetStatusCode() == this->STATUS_SERVICE_UNAVAILBLE) {
+            if (response.GetStatusCode() == STATUS_SERVER_ERROR ||
+                response.GetStatusCode() == STATUS_SERVICE_UNAVAILBLE) {
                 LogError("Internal server error when calling " + std::string(request.GetUri()));
                 throw ApiException("ApiException, internal server error");
             }
 
-            if (response.GetStatusCode() == this->STATUS_UNAUTHORISED ||
-                response.GetStatusCode() == this->STATUS_FORBIDDEN) {
+            if (response.GetStatusCode() == STATUS_UNAUTHORISED ||
+                response.GetStatusCode() == STATUS_FORBIDDEN) {
                 LogError("The API returned unauthorised when calling " + std::string(request.GetUri()));
                 throw ApiNotAuthorisedException("The API returned 401 or 403");
             }
 
-            if (response.GetStatusCode() == this->STATUS_BAD_REQUEST) {
+            if (response.GetStatusCode() == STATUS_BAD_REQUEST) {
                 LogError("The API responed with bad request when calling " + std::string(request.GetUri()));
                 throw ApiException("The API returned 400");
             }
 
-            if (response.GetStatusCode() == this->STATUS_NOT_FOUND) {
+            if (response.GetStatusCode() == STATUS_NOT_FOUND) {
                 throw ApiNotFoundException("The API returned 404 for " + std::string(request.GetUri()));
             }
 
             // These are the only codes the API should be sending on success
             if (
-                response.GetStatusCode() != this->STATUS_CREATED &&
-                response.GetStatusCode() != this->STATUS_NO_CONTENT &&
-                response.GetStatusCode() != this->STATUS_OK &&
-                response.GetStatusCode() != this->STATUS_TEAPOT
+                response.GetStatusCode() != STATUS_CREATED &&
+                response.GetStatusCode() != STATUS_NO_CONTENT &&
+                response.GetStatusCode() != STATUS_OK &&
+                response.GetStatusCode() != STATUS_TEAPOT
             ) {
                 LogError("Unknown API response occured, HTTP status was " + std::to_string(response.GetStatusCode()));
                 throw ApiException("Unknown response");
@@ -84,7 +286,7 @@ namespace UKControllerPlugin {
             return ApiResponseFactory::Create(response);
         }
 
-        ApiSquawkAllocation ApiHelper::ProcessSquawkResponse(const ApiResponse response, std::string callsign) const
+        ApiSquawkAllocation ApiHelper::ProcessSquawkResponse(const ApiResponse response, std::string callsign)
         {
             nlohmann::json responseJson = response.GetRawData();
 
@@ -140,6 +342,42 @@ namespace UKControllerPlugin {
             );
         }
 
+        /*
+            Creates or updates a general squawk assignment, calling back once the API has responded.
+        */
+        void ApiHelper::CreateGeneralSquawkAssignmentAsync(
+            std::string callsign,
+            std::string origin,
+            std::string destination,
+            std::function<void(ApiSquawkAllocation)> onAllocated,
+            std::function<void(std::string)> onFailed
+        ) const {
+            this->SendSquawkRequestAsync(
+                this->requestBuilder.BuildGeneralSquawkAssignmentRequest(callsign, origin, destination),
+                callsign,
+                onAllocated,
+                onFailed
+            );
+        }
+
+        /*
+            Creates or updates a local squawk assignment, calling back once the API has responded.
+        */
+        void ApiHelper::CreateLocalSquawkAssignmentAsync(
+            std::string callsign,
+            std::string unit,
+            std::string flightRules,
+            std::function<void(ApiSquawkAllocation)> onAllocated,
+            std::function<void(std::string)> onFailed
+        ) const {
+            this->SendSquawkRequestAsync(
+                this->requestBuilder.BuildLocalSquawkAssignmentRequest(callsign, unit, flightRules),
+                callsign,
+                onAllocated,
+                onFailed
+            );
+        }
+
         /*
             Authorise connection to a websocket channel and return the authorisation code.
         */
@@ -165,6 +403,14 @@ namespace UKControllerPlugin {
                 this->STATUS_TEAPOT;
         }
 
+        /*
+            Returns how many GET requests were collapsed onto an identical one already in flight.
+        */
+        unsigned long long ApiHelper::CountCollapsedRequests(void) const
+        {
+            return this->requestCollapser->CountCollapsed();
+        }
+
         /*
             De allocate a squawk from a given aircraft.
         */
@@ -181,18 +427,10 @@ namespace UKControllerPlugin {
             RemoteFileManifestFactory manifestFactory(this->winApi);
 
             return manifestFactory.CreateFromData(
-                this->MakeApiRequest(this->requestBuilder.BuildDependencyListRequest()).GetRawData()
+                this->MakeCachedApiRequest(this->requestBuilder.BuildDependencyListRequest()).GetRawData()
             );
         }
 
-        /*
-            Fetches the file at the given URI.
-        */
-        std::string ApiHelper::FetchRemoteFile(std::string uri) const
-        {
-            return this->MakeApiRequest(this->requestBuilder.BuildRemoteFileRequest(uri)).GetRawData().dump();
-        }
-
         /*
             Get any currently assigned squawk for the aircraft
         */
@@ -259,7 +497,7 @@ namespace UKControllerPlugin {
         */
         nlohmann::json ApiHelper::GetDependency(DependencyData dependency) const
         {
-            return this->MakeApiRequest(this->requestBuilder.BuildDependencyRequest(dependency)).GetRawData();
+            return this->MakeCachedApiRequest(this->requestBuilder.BuildDependencyRequest(dependency)).GetRawData();
         }
 
         /*
@@ -329,5 +567,29 @@ namespace UKControllerPlugin {
         {
             this->requestBuilder.SetApiDomain(domain);
         }
+
+        /*
+            Fetches the file at the given URI, handing it to the receiver as it arrives. The file isn't
+            parsed or cached here, the receiver gets it exactly as the server sent it.
+        */
+        void ApiHelper::StreamRemoteFile(std::string uri, std::function<bool(const char *, size_t)> receiver) const
+        {
+            CurlRequest request = this->requestBuilder.BuildRemoteFileRequest(uri);
+            CurlResponse response = this->SendThroughCircuitBreaker(request, receiver);
+
+            if (response.IsCurlError()) {
+                LogError("cURL error when streaming remote file, route: " + uri);
+                throw ApiException("ApiException when calling " + uri);
+            }
+
+            if (response.GetStatusCode() == this->STATUS_NOT_FOUND) {
+                throw ApiNotFoundException("The API returned 404 for " + uri);
+            }
+
+            if (response.GetStatusCode() != this->STATUS_OK) {
+                LogError("Unable to stream remote file, HTTP status was " + std::to_string(response.GetStatusCode()));
+                throw ApiException("Unknown response");
+            }
+        }
     }  // namespace Api
 }  // namespace UKControllerPlugin
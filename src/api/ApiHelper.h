@@ -6,9 +6,15 @@
 #include "hold/HoldProfile.h"
 
 namespace UKControllerPlugin {
+    namespace Api {
+        class ApiCircuitBreaker;
+        class ApiHttpCache;
+        class ApiRequestCollapser;
+    }  // namespace Api
     namespace Curl {
         class CurlInterface;
         class CurlRequest;
+        class CurlResponse;
     }  // namespace Curl
     namespace Windows {
         class WinApiInterface;
@@ -20,6 +26,13 @@ namespace UKControllerPlugin {
 
         /*
             A class for making requests to the UKCP API.
+
+            Requests go through a circuit breaker, so that if part of the API is down, callers find out straight
+            away with an ApiUnavailableException rather than each waiting for the request to time out. Identical
+            GET requests made at the same time are collapsed onto one network call.
+
+            Squawk assignments can be created without waiting for the response. The callbacks for these are
+            run on whichever thread CURL completes the request, so they mustn't make API requests themselves.
         */
         class ApiHelper : public UKControllerPlugin::Api::ApiInterface
         {
@@ -29,6 +42,12 @@ namespace UKControllerPlugin {
                     UKControllerPlugin::Api::ApiRequestBuilder requestBuilder,
                     UKControllerPlugin::Windows::WinApiInterface & winApi
                 );
+                ApiHelper(
+                    UKControllerPlugin::Curl::CurlInterface & curlApi,
+                    UKControllerPlugin::Api::ApiRequestBuilder requestBuilder,
+                    UKControllerPlugin::Windows::WinApiInterface & winApi,
+                    std::chrono::seconds circuitOpenDuration
+                );
 
                 UKControllerPlugin::Squawk::ApiSquawkAllocation CreateGeneralSquawkAssignment(
                     std::string callsign,
@@ -40,11 +59,25 @@ namespace UKControllerPlugin {
                     std::string unit,
                     std::string flightRules
                 ) const override;
+                void CreateGeneralSquawkAssignmentAsync(
+                    std::string callsign,
+                    std::string origin,
+                    std::string destination,
+                    std::function<void(UKControllerPlugin::Squawk::ApiSquawkAllocation)> onAllocated,
+                    std::function<void(std::string)> onFailed
+                ) const override;
+                void CreateLocalSquawkAssignmentAsync(
+                    std::string callsign,
+                    std::string unit,
+                    std::string flightRules,
+                    std::function<void(UKControllerPlugin::Squawk::ApiSquawkAllocation)> onAllocated,
+                    std::function<void(std::string)> onFailed
+                ) const override;
                 std::string AuthoriseWebsocketChannel(std::string socketId, std::string channel) const override;
                 bool CheckApiAuthorisation(void) const override;
+                unsigned long long CountCollapsedRequests(void) const;
                 void DeleteSquawkAssignment(std::string callsign) const override;
                 UKControllerPlugin::Api::RemoteFileManifest FetchDependencyManifest(void) const override;
-                std::string FetchRemoteFile(std::string uri) const override;
                 UKControllerPlugin::Squawk::ApiSquawkAllocation GetAssignedSquawk(std::string callsign) const override;
                 std::string GetApiDomain(void) const override;
                 std::string GetApiKey(void) const override;
@@ -65,11 +98,16 @@ namespace UKControllerPlugin {
                 int UpdateCheck(std::string version) const override;
                 void SetApiKey(std::string key) override;
                 void SetApiDomain(std::string domain) override;
+                void StreamRemoteFile(
+                    std::string uri,
+                    std::function<bool(const char *, size_t)> receiver
+                ) const override;
 
                 // The HTTP status codes that may be returned by the API
                 static const uint64_t STATUS_OK = 200L;
                 static const uint64_t STATUS_CREATED = 201L;
                 static const uint64_t STATUS_NO_CONTENT = 204L;
+                static const uint64_t STATUS_NOT_MODIFIED = 304L;
                 static const uint64_t STATUS_BAD_REQUEST = 400L;
                 static const uint64_t STATUS_UNAUTHORISED = 401L;
                 static const uint64_t STATUS_FORBIDDEN = 403L;
@@ -83,11 +121,35 @@ namespace UKControllerPlugin {
                 ApiResponse MakeApiRequest(
                     const UKControllerPlugin::Curl::CurlRequest request
                 ) const;
-
-                UKControllerPlugin::Squawk::ApiSquawkAllocation ProcessSquawkResponse(
+                ApiResponse MakeCachedApiRequest(
+                    const UKControllerPlugin::Curl::CurlRequest request
+                ) const;
+                UKControllerPlugin::Curl::CurlResponse SendRequest(
+                    const UKControllerPlugin::Curl::CurlRequest & request
+                ) const;
+                UKControllerPlugin::Curl::CurlResponse SendThroughCircuitBreaker(
+                    const UKControllerPlugin::Curl::CurlRequest & request,
+                    std::function<bool(const char *, size_t)> receiver = nullptr
+                ) const;
+                void SendSquawkRequestAsync(
+                    const UKControllerPlugin::Curl::CurlRequest request,
+                    std::string callsign,
+                    std::function<void(UKControllerPlugin::Squawk::ApiSquawkAllocation)> onAllocated,
+                    std::function<void(std::string)> onFailed
+                ) const;
+                static ApiResponse ProcessApiResponse(
+                    const UKControllerPlugin::Curl::CurlRequest & request,
+                    const UKControllerPlugin::Curl::CurlResponse & response
+                );
+                static UKControllerPlugin::Squawk::ApiSquawkAllocation ProcessSquawkResponse(
                     const ApiResponse response,
                     std::string callsign
-                ) const;
+                );
+                static void RecordResponse(
+                    UKControllerPlugin::Api::ApiCircuitBreaker & circuitBreaker,
+                    const std::string & endpoint,
+                    const UKControllerPlugin::Curl::CurlResponse & response
+                );
 
                 // For doing things on the filesystem, if we really need to
                 UKControllerPlugin::Windows::WinApiInterface & winApi;
@@ -97,6 +159,15 @@ namespace UKControllerPlugin {
 
                 // An interface to the Curl library.
                 UKControllerPlugin::Curl::CurlInterface & curlApi;
+
+                // Cached responses for requests that are likely not to change
+                std::shared_ptr<UKControllerPlugin::Api::ApiHttpCache> httpCache;
+
+                // Stops requests being sent to parts of the API that are down
+                std::shared_ptr<UKControllerPlugin::Api::ApiCircuitBreaker> circuitBreaker;
+
+                // Collapses identical GET requests that are in flight at the same time
+                std::shared_ptr<UKControllerPlugin::Api::ApiRequestCollapser> requestCollapser;
         };
     }  // namespace Api
 }  // namespace UKControllerPlugin
@@ -0,0 +1,214 @@
+#include "pch/stdafx.h"
+#include "api/ApiHttpCache.h"
+#include "curl/CurlRequest.h"
+#include "curl/CurlResponse.h"
+#include "windows/WinApiInterface.h"
+
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPlugin::Windows::WinApiInterface;
+
+namespace UKControllerPlugin {
+    namespace Api {
+
+        const std::string ApiHttpCache::CACHE_FOLDER = "cache/api";
+
+        const std::string ApiHttpCache::INDEX_FILE = "cache/api/index.json";
+
+        const std::string ApiHttpCache::TEMPORARY_FILE_SUFFIX = ".tmp";
+
+        ApiHttpCache::ApiHttpCache(WinApiInterface & winApi)
+            : winApi(winApi)
+        {
+
+        }
+
+        /*
+            If we have a cached response for the request, add the validators so the server can tell us
+            if it's changed. Returns true if any were added.
+        */
+        bool ApiHttpCache::AddConditionalHeaders(CurlRequest & request)
+        {
+            std::lock_guard<std::mutex> lock(this->cacheLock);
+            this->LoadIndex();
+
+            auto entry = this->index.find(request.GetUri());
+            if (entry == this->index.end()) {
+                return false;
+            }
+
+            bool added = false;
+            if (entry->at("etag").is_string() && entry->at("etag").get<std::string>() != "") {
+                request.AddHeader("If-None-Match", entry->at("etag").get<std::string>());
+                added = true;
+            }
+
+            if (entry->at("last_modified").is_string() && entry->at("last_modified").get<std::string>() != "") {
+                request.AddHeader("If-Modified-Since", entry->at("last_modified").get<std::string>());
+                added = true;
+            }
+
+            return added;
+        }
+
+        /*
+            Returns how many responses are cached.
+        */
+        size_t ApiHttpCache::CountEntries(void)
+        {
+            std::lock_guard<std::mutex> lock(this->cacheLock);
+            this->LoadIndex();
+            return this->index.size();
+        }
+
+        /*
+            Forget about the cached response for a URI, so the next request for it is unconditional.
+        */
+        void ApiHttpCache::Forget(const std::string & uri)
+        {
+            std::lock_guard<std::mutex> lock(this->cacheLock);
+            this->LoadIndex();
+
+            if (this->index.erase(uri) != 0) {
+                this->SaveIndex();
+            }
+        }
+
+        /*
+            Returns the cached body for a URI, if there is one and it can be read.
+        */
+        std::optional<std::string> ApiHttpCache::GetCachedBody(const std::string & uri)
+        {
+            std::lock_guard<std::mutex> lock(this->cacheLock);
+            this->LoadIndex();
+
+            if (this->index.find(uri) == this->index.end()) {
+                return std::nullopt;
+            }
+
+            std::string filename = ApiHttpCache::CACHE_FOLDER + "/" + ApiHttpCache::GetBodyFilename(uri);
+            try {
+                if (!this->winApi.FileExists(filename)) {
+                    return std::nullopt;
+                }
+
+                return this->winApi.ReadFromBinaryFile(filename);
+            } catch (...) {
+                LogWarning("Unable to read cached API response for " + uri);
+                return std::nullopt;
+            }
+        }
+
+        /*
+            Each body is stored in a file named after a hash of its URI. FNV-1a is used so that the
+            name stays the same between builds.
+        */
+        std::string ApiHttpCache::GetBodyFilename(const std::string & uri)
+        {
+            uint64_t hash = 14695981039346656037ULL;
+            for (unsigned char character : uri) {
+                hash ^= character;
+                hash *= 1099511628211ULL;
+            }
+
+            const char * digits = "0123456789abcdef";
+            std::string filename(16, '0');
+            for (int i = 15; i >= 0; i--) {
+                filename[i] = digits[hash & 0xF];
+                hash >>= 4;
+            }
+
+            return filename + ".cache";
+        }
+
+        /*
+            Loads the index from disk the first time it's needed. If it can't be read, start again.
+        */
+        void ApiHttpCache::LoadIndex(void)
+        {
+            if (this->indexLoaded) {
+                return;
+            }
+
+            this->indexLoaded = true;
+            this->index = nlohmann::json::object();
+            try {
+                if (!this->winApi.FileExists(ApiHttpCache::INDEX_FILE)) {
+                    return;
+                }
+
+                nlohmann::json loaded = nlohmann::json::parse(this->winApi.ReadFromFile(ApiHttpCache::INDEX_FILE));
+                if (!loaded.is_object()) {
+                    return;
+                }
+
+                for (nlohmann::json::const_iterator it = loaded.cbegin(); it != loaded.cend(); ++it) {
+                    if (
+                        it->is_object() &&
+                        it->count("etag") && it->at("etag").is_string() &&
+                        it->count("last_modified") && it->at("last_modified").is_string()
+                    ) {
+                        this->index[it.key()] = *it;
+                    }
+                }
+            } catch (...) {
+                LogWarning("Unable to load API cache index, starting afresh");
+            }
+        }
+
+        /*
+            Writes the index back to disk.
+        */
+        void ApiHttpCache::SaveIndex(void)
+        {
+            try {
+                this->winApi.WriteToFile(ApiHttpCache::INDEX_FILE, this->index.dump(), true);
+            } catch (...) {
+                LogError("Unable to write API cache index");
+            }
+        }
+
+        /*
+            Stores a successful response, if it came with something we can validate it against later.
+            Responses without validators can't be checked, so anything cached for the URI is forgotten.
+
+            The body is written as it was received to a temporary file, then moved over the old one. The
+            index is only updated once it's in place.
+        */
+        void ApiHttpCache::Store(const std::string & uri, const CurlResponse & response)
+        {
+            std::lock_guard<std::mutex> lock(this->cacheLock);
+            this->LoadIndex();
+
+            std::string etag = response.GetHeader("ETag");
+            std::string lastModified = response.GetHeader("Last-Modified");
+            if (etag == "" && lastModified == "") {
+                if (this->index.erase(uri) != 0) {
+                    this->SaveIndex();
+                }
+                return;
+            }
+
+            const std::string filename = ApiHttpCache::CACHE_FOLDER + "/" + ApiHttpCache::GetBodyFilename(uri);
+            const std::string temporaryFile = filename + ApiHttpCache::TEMPORARY_FILE_SUFFIX;
+            bool stored;
+            try {
+                this->winApi.CreateLocalFolderRecursive(ApiHttpCache::CACHE_FOLDER);
+                this->winApi.WriteToBinaryFile(temporaryFile, response.GetResponse(), true);
+                stored = this->winApi.MoveGivenFile(temporaryFile, filename);
+            } catch (...) {
+                stored = false;
+            }
+
+            if (!stored) {
+                LogError("Unable to write cached API response for " + uri);
+                this->index.erase(uri);
+                this->SaveIndex();
+                return;
+            }
+
+            this->index[uri] = { {"etag", etag}, {"last_modified", lastModified} };
+            this->SaveIndex();
+        }
+    }  // namespace Api
+}  // namespace UKControllerPlugin
@@ -0,0 +1,66 @@
+#pragma once
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Curl {
+        class CurlRequest;
+        class CurlResponse;
+    }  // namespace Curl
+    namespace Windows {
+        class WinApiInterface;
+    }  // namespace Windows
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace Api {
+
+        /*
+            A local cache of API responses, so that data that hasn't changed doesn't need downloading again.
+
+            For each URI, the ETag and Last-Modified validators the server sent are kept in an index, with
+            the response body stored alongside it on disk. When the same URI is requested again, the
+            validators are sent as If-None-Match and If-Modified-Since, so that the server can respond
+            with 304 Not Modified and the body can be read from disk instead.
+
+            Bodies are written to a temporary file and moved into place before the index is updated, so the
+            index never points at a body that's only partly written.
+        */
+        class ApiHttpCache
+        {
+            public:
+                explicit ApiHttpCache(UKControllerPlugin::Windows::WinApiInterface & winApi);
+                bool AddConditionalHeaders(UKControllerPlugin::Curl::CurlRequest & request);
+                size_t CountEntries(void);
+                void Forget(const std::string & uri);
+                std::optional<std::string> GetCachedBody(const std::string & uri);
+                void Store(const std::string & uri, const UKControllerPlugin::Curl::CurlResponse & response);
+
+                // The folder that cached responses live in
+                static const std::string CACHE_FOLDER;
+
+                // The index of cached responses
+                static const std::string INDEX_FILE;
+
+                // Added to a body's file name whilst it's being written
+                static const std::string TEMPORARY_FILE_SUFFIX;
+
+            private:
+                static std::string GetBodyFilename(const std::string & uri);
+                void LoadIndex(void);
+                void SaveIndex(void);
+
+                // For reading and writing the cache
+                UKControllerPlugin::Windows::WinApiInterface & winApi;
+
+                // The cached validators, by URI
+                nlohmann::json index;
+
+                // Whether the index has been loaded from disk yet
+                bool indexLoaded = false;
+
+                // Protects the index
+                std::mutex cacheLock;
+        };
+    }  // namespace Api
+}  // namespace UKControllerPlugin
@@ -1,4 +1,5 @@
 #pragma once
+#include "api/ApiException.h"
 #include "api/RemoteFileManifest.h"
 #include "squawk/ApiSquawkAllocation.h"
 #include "dependency/DependencyData.h"
@@ -8,6 +9,10 @@ namespace UKControllerPlugin {
 
         /**
          * An abstract class for the web API.
+         *
+         * Squawk assignments can also be created asynchronously, calling back with the allocation or the reason
+         * it failed. By default these just make the request there and then, implementations that can do better
+         * should override them.
          */
         class ApiInterface
         {
@@ -22,11 +27,44 @@ namespace UKControllerPlugin {
                     std::string unit,
                     std::string flightRules
                 ) const = 0;
+                virtual void CreateGeneralSquawkAssignmentAsync(
+                    std::string callsign,
+                    std::string origin,
+                    std::string destination,
+                    std::function<void(UKControllerPlugin::Squawk::ApiSquawkAllocation)> onAllocated,
+                    std::function<void(std::string)> onFailed
+                ) const {
+                    std::optional<UKControllerPlugin::Squawk::ApiSquawkAllocation> allocation;
+                    try {
+                        allocation.emplace(this->CreateGeneralSquawkAssignment(callsign, origin, destination));
+                    } catch (UKControllerPlugin::Api::ApiException exception) {
+                        onFailed(exception.what());
+                        return;
+                    }
+
+                    onAllocated(*allocation);
+                }
+                virtual void CreateLocalSquawkAssignmentAsync(
+                    std::string callsign,
+                    std::string unit,
+                    std::string flightRules,
+                    std::function<void(UKControllerPlugin::Squawk::ApiSquawkAllocation)> onAllocated,
+                    std::function<void(std::string)> onFailed
+                ) const {
+                    std::optional<UKControllerPlugin::Squawk::ApiSquawkAllocation> allocation;
+                    try {
+                        allocation.emplace(this->CreateLocalSquawkAssignment(callsign, unit, flightRules));
+                    } catch (UKControllerPlugin::Api::ApiException exception) {
+                        onFailed(exception.what());
+                        return;
+                    }
+
+                    onAllocated(*allocation);
+                }
                 virtual std::string AuthoriseWebsocketChannel(std::string socketId, std::string channel) const = 0;
                 virtual bool CheckApiAuthorisation(void) const = 0;
                 virtual void DeleteSquawkAssignment(std::string callsign) const = 0;
                 virtual UKControllerPlugin::Api::RemoteFileManifest FetchDependencyManifest(void) const = 0;
-                virtual std::string FetchRemoteFile(std::string uri) const = 0;
                 virtual UKControllerPlugin::Squawk::ApiSquawkAllocation GetAssignedSquawk(
                     std::string callsign
                 ) const = 0;
@@ -49,6 +87,10 @@ namespace UKControllerPlugin {
                 virtual int UpdateCheck(std::string version) const = 0;
                 virtual void SetApiKey(std::string key) = 0;
                 virtual void SetApiDomain(std::string domain) = 0;
+                virtual void StreamRemoteFile(
+                    std::string uri,
+                    std::function<bool(const char *, size_t)> receiver
+                ) const = 0;
 
                 // Codes returned after an update check
                 static const int UPDATE_UP_TO_DATE = 0;
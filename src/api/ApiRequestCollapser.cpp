@@ -0,0 +1,92 @@
+#include "pch/stdafx.h"
+#include "api/ApiRequestCollapser.h"
+#include "curl/CurlRequest.h"
+
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+
+namespace UKControllerPlugin {
+    namespace Api {
+
+        /*
+            Returns how many requests have been collapsed onto another.
+        */
+        unsigned long long ApiRequestCollapser::CountCollapsed(void) const
+        {
+            return this->collapsed;
+        }
+
+        /*
+            Returns how many distinct requests are currently being sent.
+        */
+        size_t ApiRequestCollapser::CountInFlight(void)
+        {
+            std::lock_guard<std::mutex> lock(this->inFlightLock);
+            return this->inFlight.size();
+        }
+
+        /*
+            Returns how many requests have actually been sent.
+        */
+        unsigned long long ApiRequestCollapser::CountSent(void) const
+        {
+            return this->sent;
+        }
+
+        /*
+            Builds the key that identical requests share. The headers and body are hashed, as the
+            body may be large.
+        */
+        std::string ApiRequestCollapser::GetRequestKey(const CurlRequest & request)
+        {
+            std::string content = request.GetBody();
+            for (CurlRequest::const_iterator it = request.cbegin(); it != request.cend(); ++it) {
+                content += "\n" + it->first + ": " + it->second;
+            }
+
+            std::stringstream key;
+            key << request.GetMethod() << " " << request.GetUri() << " " << std::hex
+                << std::hash<std::string>()(content);
+            return key.str();
+        }
+
+        /*
+            Sends the request, or waits for an identical one that's already in flight.
+        */
+        CurlResponse ApiRequestCollapser::Send(const CurlRequest & request, std::function<CurlResponse(void)> send)
+        {
+            const std::string key = ApiRequestCollapser::GetRequestKey(request);
+            std::promise<CurlResponse> response;
+            std::shared_future<CurlResponse> existing;
+            {
+                std::lock_guard<std::mutex> lock(this->inFlightLock);
+                auto inFlightRequest = this->inFlight.find(key);
+                if (inFlightRequest == this->inFlight.cend()) {
+                    this->inFlight[key] = response.get_future().share();
+                } else {
+                    existing = inFlightRequest->second;
+                }
+            }
+
+            // Someone else is already sending it, so wait for theirs.
+            if (existing.valid()) {
+                this->collapsed++;
+                return existing.get();
+            }
+
+            this->sent++;
+            try {
+                CurlResponse result = send();
+                response.set_value(result);
+                std::lock_guard<std::mutex> lock(this->inFlightLock);
+                this->inFlight.erase(key);
+                return result;
+            } catch (...) {
+                response.set_exception(std::current_exception());
+                std::lock_guard<std::mutex> lock(this->inFlightLock);
+                this->inFlight.erase(key);
+                throw;
+            }
+        }
+    }  // namespace Api
+}  // namespace UKControllerPlugin
@@ -0,0 +1,49 @@
+#pragma once
+#include "curl/CurlResponse.h"
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Curl {
+        class CurlRequest;
+    }  // namespace Curl
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace Api {
+
+        /*
+            Collapses identical requests that are in flight at the same time onto a single network call.
+
+            The first caller for a request sends it, anyone else asking for the same thing before it completes
+            waits for that response instead of sending their own. If sending throws, every waiter gets the
+            exception. Requests are identical if they have the same method, URI, headers and body.
+        */
+        class ApiRequestCollapser
+        {
+            public:
+                unsigned long long CountCollapsed(void) const;
+                size_t CountInFlight(void);
+                unsigned long long CountSent(void) const;
+                static std::string GetRequestKey(const UKControllerPlugin::Curl::CurlRequest & request);
+                UKControllerPlugin::Curl::CurlResponse Send(
+                    const UKControllerPlugin::Curl::CurlRequest & request,
+                    std::function<UKControllerPlugin::Curl::CurlResponse(void)> send
+                );
+
+            private:
+
+                // The requests currently being sent, by key
+                std::map<std::string, std::shared_future<UKControllerPlugin::Curl::CurlResponse>> inFlight;
+
+                // Protects the in flight requests
+                std::mutex inFlightLock;
+
+                // How many requests waited on another instead of being sent
+                std::atomic<unsigned long long> collapsed = 0;
+
+                // How many requests were actually sent
+                std::atomic<unsigned long long> sent = 0;
+        };
+    }  // namespace Api
+}  // namespace UKControllerPlugin
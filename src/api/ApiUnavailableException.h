@@ -0,0 +1,17 @@
+#pragma once
+#include "api/ApiException.h"
+
+namespace UKControllerPlugin {
+    namespace Api {
+        /*
+            Custom exception for when a request isn't sent, because the API has been failing and
+            the circuit breaker is open.
+        */
+        class ApiUnavailableException : public ApiException
+        {
+            public:
+                ApiUnavailableException::ApiUnavailableException(std::string message)
+                    : ApiException("ApiUnavailableException: " + message) {}
+        };
+    }  // namespace Api
+}  // namespace UKControllerPlugin
@@ -2,6 +2,7 @@
 #include "bootstrap/EventHandlerCollectionBootstrap.h"
 #include "bootstrap/PersistenceContainer.h"
 #include "tag/TagItemCollection.h"
+#include "tag/TagItemCacheEventHandler.h"
 #include "euroscope/RadarTargetEventHandlerCollection.h"
 #include "euroscope/RunwayDialogAwareCollection.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
@@ -16,6 +17,7 @@
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Tag::TagItemCollection;
+using UKControllerPlugin::Tag::TagItemCacheEventHandler;
 using UKControllerPlugin::Euroscope::RadarTargetEventHandlerCollection;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
 using UKControllerPlugin::Controller::ControllerStatusEventHandlerCollection;
@@ -48,6 +50,13 @@ namespace UKControllerPlugin {
             persistence.runwayDialogEventHandlers.reset(new RunwayDialogAwareCollection);
 
             persistence.timedHandler->RegisterEvent(persistence.deferredHandlers, 3);
+
+            // Keep cached tag items up to date
+            std::shared_ptr<TagItemCacheEventHandler> tagCacheHandler = std::make_shared<TagItemCacheEventHandler>(
+                persistence.tagHandler->GetCache()
+            );
+            persistence.flightplanHandler->RegisterHandler(tagCacheHandler);
+            persistence.userSettingHandlers->RegisterHandler(tagCacheHandler);
         }
     }  // namespace Bootstrap
 }  // namespace UKControllerPlugin
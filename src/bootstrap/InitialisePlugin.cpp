@@ -40,6 +40,7 @@
 #include "datablock/DatablockBoostrap.h"
 #include "websocket/WebsocketBootstrap.h"
 #include "sectorfile/SectorFileBootstrap.h"
+#include "tag/TagItemStatisticsBootstrap.h"
 
 using UKControllerPlugin::Api::ApiAuthChecker;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
@@ -74,6 +75,7 @@ using UKControllerPlugin::Datablock::EstimatedDepartureTimeBootstrap;
 using UKControllerPlugin::Dependency::DependencyProviderInterface;
 using UKControllerPlugin::Dependency::GetDependencyProvider;
 using UKControllerPlugin::Euroscope::GeneralSettingsConfigurationBootstrap;
+using UKControllerPlugin::Tag::TagItemStatisticsBootstrap;
 
 namespace UKControllerPlugin {
 
@@ -114,6 +116,7 @@ namespace UKControllerPlugin {
     {
         // Shut down the container.;
         this->container->taskRunner.reset();
+        this->container->intentionCodeTaskRunner.reset();
         this->container.reset();
 
         // Shut down GDI
@@ -208,6 +211,7 @@ namespace UKControllerPlugin {
         UKControllerPlugin::Wake::BootstrapPlugin(*this->container, dependencyCache);
         LoginModule::BootstrapPlugin(*this->container);
         UserMessagerBootstrap::BootstrapPlugin(*this->container);
+        TagItemStatisticsBootstrap::BootstrapPlugin(*this->container);
         DeferredEventBootstrap(*this->container->timedHandler);
         SectorFile::BootstrapPlugin(*this->container);
 
@@ -229,7 +233,7 @@ namespace UKControllerPlugin {
             InitialAltitudeModule::BootstrapPlugin(dependencyCache, *this->container);
         }
 
-        IntentionCodeModule::BootstrapPlugin(*this->container);
+        IntentionCodeModule::BootstrapPlugin(*dependencyProvider, *this->container);
         HistoryTrailModule::BootstrapPlugin(*this->container);
         CountdownModule::BootstrapPlugin(*this->container);
         MinStackModule::BootstrapPlugin(
@@ -2,17 +2,20 @@
 #include "controller/ActiveCallsignCollection.h"
 #include "euroscope/EuroScopeCControllerInterface.h"
 #include "controller/ActiveCallsign.h"
+#include "controller/ActiveCallsignSnapshot.h"
 #include "controller/ControllerPosition.h"
 
 using UKControllerPlugin::Euroscope::EuroScopeCControllerInterface;
 using UKControllerPlugin::Controller::ActiveCallsign;
 using UKControllerPlugin::Controller::ControllerPosition;
+using UKControllerPlugin::Controller::ActiveCallsignSnapshot;
 
 namespace UKControllerPlugin {
     namespace Controller {
 
 
         ActiveCallsignCollection::ActiveCallsignCollection(void)
+            : snapshot(std::make_shared<const ActiveCallsignSnapshot>())
         {
 
         }
@@ -30,6 +33,8 @@ namespace UKControllerPlugin {
             this->activeCallsigns[controller.GetCallsign()] =
                 this->activePositions[controller.GetNormalisedPosition().GetCallsign()]
                 .insert(controller).first;
+            this->generation++;
+            this->PublishSnapshot();
         }
 
         /*
@@ -49,6 +54,17 @@ namespace UKControllerPlugin {
                 .insert(controller).first;
             this->activeCallsigns[controller.GetCallsign()] = this->userCallsign;
             this->userActive = true;
+            this->generation++;
+            this->PublishSnapshot();
+        }
+
+        /*
+            Start a batch of changes. No snapshots are published until every batch that has begun
+            has ended.
+        */
+        void ActiveCallsignCollection::BeginBatch(void)
+        {
+            this->batchDepth++;
         }
 
         /*
@@ -59,6 +75,21 @@ namespace UKControllerPlugin {
             return this->activeCallsigns.count(callsign) != 0;
         }
 
+        /*
+            End a batch of changes, publishing a snapshot if it was the last batch and anything changed.
+        */
+        void ActiveCallsignCollection::EndBatch(void)
+        {
+            if (this->batchDepth == 0) {
+                return;
+            }
+
+            this->batchDepth--;
+            if (this->batchDepth == 0 && this->snapshotStale) {
+                this->PublishSnapshot();
+            }
+        }
+
         /*
             Flushes the entire collection. Sad times.
         */
@@ -67,6 +98,8 @@ namespace UKControllerPlugin {
             this->activeCallsigns.clear();
             this->activePositions.clear();
             this->userActive = false;
+            this->generation++;
+            this->PublishSnapshot();
         }
 
         int ActiveCallsignCollection::GetNumberActiveCallsigns() const
@@ -91,6 +124,23 @@ namespace UKControllerPlugin {
             return *this->activeCallsigns.find(callsign)->second;
         }
 
+        /*
+            Returns a number that changes every time the active callsigns change, so that anything
+            derived from them can tell when it needs rebuilding.
+        */
+        unsigned int ActiveCallsignCollection::GetGeneration(void) const
+        {
+            return this->generation;
+        }
+
+        /*
+            Returns the most recently published snapshot of the active callsigns. Safe to call from any thread.
+        */
+        std::shared_ptr<const ActiveCallsignSnapshot> ActiveCallsignCollection::GetSnapshot(void) const
+        {
+            return std::atomic_load(&this->snapshot);
+        }
+
         /*
             Returns the "lead" callsign for a given position.
         */
@@ -124,6 +174,24 @@ namespace UKControllerPlugin {
                 this->activePositions.find(normalisedCallsign)->second.size() != 0;
         }
 
+        /*
+            Takes a copy of the current state and publishes it for readers on other threads, unless a batch
+            is in progress, in which case it's published when the batch ends.
+        */
+        void ActiveCallsignCollection::PublishSnapshot(void)
+        {
+            if (this->batchDepth != 0) {
+                this->snapshotStale = true;
+                return;
+            }
+
+            this->snapshotStale = false;
+            std::atomic_store(
+                &this->snapshot,
+                std::shared_ptr<const ActiveCallsignSnapshot>(std::make_shared<ActiveCallsignSnapshot>(*this))
+            );
+        }
+
         /*
             Removes a callsign from the active lists.
         */
@@ -147,6 +215,8 @@ namespace UKControllerPlugin {
                 controller.GetNormalisedPosition().GetCallsign()
             )->second.erase(callsign->second);
             this->activeCallsigns.erase(callsign);
+            this->generation++;
+            this->PublishSnapshot();
         }
 
         /*
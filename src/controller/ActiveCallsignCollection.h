@@ -6,23 +6,59 @@ namespace UKControllerPlugin {
 
 // Forward declaration
 class ActiveCallsign;
+class ActiveCallsignSnapshot;
 // END
 
 /*
     Class that maps connected callsigns to UK controller positions and determines
     priority order.
+
+    The collection itself should only be used on the EuroScope thread. Every change publishes
+    a new read-only snapshot, which may be read from any thread. Changes made during a batch
+    only publish one snapshot, when the batch ends.
 */
 class ActiveCallsignCollection
 {
     public:
+        // Public type definitions for iterating the active positions
+        typedef std::map<std::string, std::set<UKControllerPlugin::Controller::ActiveCallsign>> PositionMap;
+        typedef PositionMap::const_iterator const_iterator;
+        const_iterator cbegin(void) const { return activePositions.cbegin(); }
+        const_iterator cend(void) const { return activePositions.cend(); }
+
+        /*
+            Batches the changes made to the collection while it's in scope.
+        */
+        class Batch
+        {
+            public:
+                explicit Batch(ActiveCallsignCollection & collection)
+                    : collection(collection)
+                {
+                    this->collection.BeginBatch();
+                }
+
+                ~Batch(void)
+                {
+                    this->collection.EndBatch();
+                }
+
+            private:
+                ActiveCallsignCollection & collection;
+        };
+
         ActiveCallsignCollection(void);
         void AddCallsign(UKControllerPlugin::Controller::ActiveCallsign controller);
         void AddUserCallsign(UKControllerPlugin::Controller::ActiveCallsign controller);
+        void BeginBatch(void);
         bool CallsignActive(std::string callsign) const;
+        void EndBatch(void);
         void Flush(void);
         int GetNumberActiveCallsigns() const;
         int GetNumberActivePositions() const;
         UKControllerPlugin::Controller::ActiveCallsign GetCallsign(std::string callsign) const;
+        unsigned int GetGeneration(void) const;
+        std::shared_ptr<const UKControllerPlugin::Controller::ActiveCallsignSnapshot> GetSnapshot(void) const;
         UKControllerPlugin::Controller::ActiveCallsign GetLeadCallsignForPosition(
             std::string normalisedCallsign
         ) const;
@@ -33,17 +69,31 @@ class ActiveCallsignCollection
 
     private:
 
+        void PublishSnapshot(void);
+
         // Whether or not the user is active.
-        bool userActive;
+        bool userActive = false;
+
+        // Incremented every time a callsign is added or removed
+        unsigned int generation = 0;
+
+        // How many batches have begun and not yet ended
+        unsigned int batchDepth = 0;
+
+        // Whether the collection has changed during the current batch
+        bool snapshotStale = false;
 
         // Set of normalised callsign to callsigns actively taking that position. Self ordering.
-        std::map<std::string, std::set<UKControllerPlugin::Controller::ActiveCallsign>> activePositions;
+        PositionMap activePositions;
 
         // A map of raw callsign to active position - for easier access when we just want to know who's online
         std::map<std::string, std::set<UKControllerPlugin::Controller::ActiveCallsign>::iterator> activeCallsigns;
 
         // The callsign for the logged in user, if set.
         std::set<UKControllerPlugin::Controller::ActiveCallsign>::iterator userCallsign;
+
+        // The most recently published snapshot, only to be accessed atomically
+        std::shared_ptr<const UKControllerPlugin::Controller::ActiveCallsignSnapshot> snapshot;
 };
 
 }  // namespace Controller
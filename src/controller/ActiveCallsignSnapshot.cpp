@@ -0,0 +1,102 @@
+#include "pch/stdafx.h"
+#include "controller/ActiveCallsignSnapshot.h"
+#include "controller/ActiveCallsignCollection.h"
+
+using UKControllerPlugin::Controller::ActiveCallsign;
+using UKControllerPlugin::Controller::ActiveCallsignCollection;
+
+namespace UKControllerPlugin {
+    namespace Controller {
+
+        ActiveCallsignSnapshot::ActiveCallsignSnapshot(void)
+            : generation(0)
+        {
+
+        }
+
+        ActiveCallsignSnapshot::ActiveCallsignSnapshot(const ActiveCallsignCollection & activeCallsigns)
+            : generation(activeCallsigns.GetGeneration())
+        {
+            for (
+                ActiveCallsignCollection::const_iterator it = activeCallsigns.cbegin();
+                it != activeCallsigns.cend();
+                ++it
+            ) {
+                if (it->second.empty()) {
+                    continue;
+                }
+
+                this->leadCallsigns.emplace(it->first, *it->second.cbegin());
+                for (
+                    std::set<ActiveCallsign>::const_iterator callsign = it->second.cbegin();
+                    callsign != it->second.cend();
+                    ++callsign
+                ) {
+                    this->callsigns.insert(callsign->GetCallsign());
+                }
+            }
+
+            if (activeCallsigns.UserHasCallsign()) {
+                this->userCallsign = std::make_unique<ActiveCallsign>(activeCallsigns.GetUserCallsign());
+            }
+        }
+
+        /*
+            Returns true if a callsign was active.
+        */
+        bool ActiveCallsignSnapshot::CallsignActive(const std::string & callsign) const
+        {
+            return this->callsigns.count(callsign) != 0;
+        }
+
+        /*
+            Returns the generation of the collection that this snapshot was taken from.
+        */
+        unsigned int ActiveCallsignSnapshot::GetGeneration(void) const
+        {
+            return this->generation;
+        }
+
+        /*
+            Returns the "lead" callsign for a given position. Throws an exception if the position wasn't active.
+        */
+        const ActiveCallsign & ActiveCallsignSnapshot::GetLeadCallsignForPosition(
+            const std::string & normalisedCallsign
+        ) const {
+            auto position = this->leadCallsigns.find(normalisedCallsign);
+            if (position == this->leadCallsigns.cend()) {
+                throw std::out_of_range("Position not found");
+            }
+
+            return position->second;
+        }
+
+        /*
+            Returns the users active callsign. Throws exception if not found.
+        */
+        const ActiveCallsign & ActiveCallsignSnapshot::GetUserCallsign(void) const
+        {
+            if (!this->userCallsign) {
+                throw std::out_of_range("User has no callsign.");
+            }
+
+            return *this->userCallsign;
+        }
+
+        /*
+            Returns whether or not a position had an active callsign.
+        */
+        bool ActiveCallsignSnapshot::PositionActive(const std::string & normalisedCallsign) const
+        {
+            return this->leadCallsigns.count(normalisedCallsign) != 0;
+        }
+
+        /*
+            Returns true if the user had an active callsign.
+        */
+        bool ActiveCallsignSnapshot::UserHasCallsign(void) const
+        {
+            return this->userCallsign != nullptr;
+        }
+    }  // namespace Controller
+}  // namespace UKControllerPlugin
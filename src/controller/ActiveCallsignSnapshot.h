@@ -0,0 +1,53 @@
+#pragma once
+#include "controller/ActiveCallsign.h"
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Controller {
+        class ActiveCallsignCollection;
+    }  // namespace Controller
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace Controller {
+
+        /*
+            A read-only copy of the active callsigns at a point in time.
+
+            The ActiveCallsignCollection publishes a new one of these every time it changes, so anything
+            that isn't on the EuroScope thread can take hold of the current snapshot and read from it
+            without worrying about the collection changing underneath it.
+        */
+        class ActiveCallsignSnapshot
+        {
+            public:
+                ActiveCallsignSnapshot(void);
+                explicit ActiveCallsignSnapshot(
+                    const UKControllerPlugin::Controller::ActiveCallsignCollection & activeCallsigns
+                );
+                bool CallsignActive(const std::string & callsign) const;
+                unsigned int GetGeneration(void) const;
+                const UKControllerPlugin::Controller::ActiveCallsign & GetLeadCallsignForPosition(
+                    const std::string & normalisedCallsign
+                ) const;
+                const UKControllerPlugin::Controller::ActiveCallsign & GetUserCallsign(void) const;
+                bool PositionActive(const std::string & normalisedCallsign) const;
+                bool UserHasCallsign(void) const;
+
+            private:
+
+                // The generation of the collection that the snapshot was taken from
+                const unsigned int generation;
+
+                // The callsigns that were active
+                std::set<std::string> callsigns;
+
+                // The lead callsign of each active position
+                std::map<std::string, UKControllerPlugin::Controller::ActiveCallsign> leadCallsigns;
+
+                // The users callsign, if they had one
+                std::unique_ptr<UKControllerPlugin::Controller::ActiveCallsign> userCallsign;
+        };
+    }  // namespace Controller
+}  // namespace UKControllerPlugin
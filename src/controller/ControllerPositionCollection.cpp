@@ -13,7 +13,26 @@ namespace UKControllerPlugin {
         */
         bool ControllerPositionCollection::AddPosition(std::unique_ptr<ControllerPosition> position)
         {
-            return this->positions.insert({ position->GetCallsign(), std::move(position) }).second;
+            const std::string callsign = position->GetCallsign();
+            const ControllerPosition * indexed = position.get();
+            if (!this->positions.insert({ callsign, std::move(position) }).second) {
+                return false;
+            }
+
+            std::vector<FrequencyIndexEntry> & entries =
+                this->frequencyIndex[this->FrequencyToKilohertz(indexed->GetFrequency())];
+            entries.insert(
+                std::upper_bound(
+                    entries.begin(),
+                    entries.end(),
+                    callsign,
+                    [](const std::string & callsign, const FrequencyIndexEntry & entry) -> bool {
+                        return callsign < entry.callsign;
+                    }
+                ),
+                { callsign, callsign.substr(0, callsign.find('_')), indexed }
+            );
+            return true;
         }
 
         /*
@@ -44,21 +63,43 @@ namespace UKControllerPlugin {
                 throw std::out_of_range("Position not found.");
             }
 
-            // Iterate through the positions and try to match.
-            auto position = std::find_if(this->positions.begin(), this->positions.end(),
-                [facility, frequency]
-                (std::pair<std::string, const std::unique_ptr<ControllerPosition> &> position) -> bool {
+            // Frequency matching is done to 4dp, because floating points. Anything within tolerance is
+            // at most 1kHz away once rounded, so check the neighbouring frequencies too. If more than
+            // one position matches, the first by callsign wins.
+            const int kilohertz = this->FrequencyToKilohertz(frequency);
+            const FrequencyIndexEntry * match = nullptr;
+            for (int candidate = kilohertz - 1; candidate <= kilohertz + 1; candidate++) {
+                auto entries = this->frequencyIndex.find(candidate);
+                if (entries == this->frequencyIndex.cend()) {
+                    continue;
+                }
 
-                // Frequency matching is done to 4dp, because floating points.
-                return fabs(frequency - position.second->GetFrequency()) < 0.001 &&
-                    position.first.substr(0, position.first.find('_')).compare(facility) == 0;
-            });
+                for (const FrequencyIndexEntry & entry : entries->second) {
+                    if (
+                        entry.facility == facility &&
+                        fabs(frequency - entry.position->GetFrequency()) < 0.001
+                    ) {
+                        if (match == nullptr || entry.callsign < match->callsign) {
+                            match = &entry;
+                        }
+                        break;
+                    }
+                }
+            }
 
-            if (position == this->positions.end()) {
+            if (match == nullptr) {
                 throw std::out_of_range("Position not found.");
             }
 
-            return *position->second;
+            return *match->position;
+        }
+
+        /*
+            Converts a frequency in MHz to the nearest kHz, for use in the frequency index.
+        */
+        int ControllerPositionCollection::FrequencyToKilohertz(double frequency)
+        {
+            return static_cast<int>(std::lround(frequency * 1000));
         }
 
         /*
@@ -10,6 +10,10 @@ namespace UKControllerPlugin {
         /*
             A collection of all the UK Controller Positions, which can be searched
             to retrieve a specific controller position.
+
+            Positions are also indexed by their frequency in kHz as they're added, so that
+            matching a controller by facility and frequency only looks at the handful of positions
+            that are near to the same frequency.
         */
         class ControllerPositionCollection
         {
@@ -22,9 +26,22 @@ namespace UKControllerPlugin {
             ) const;
             size_t GetSize(void) const;
         private:
-            std::map<std::string, std::unique_ptr<ControllerPosition>> positions;
+
+            // A position in the frequency index
+            typedef struct FrequencyIndexEntry {
+                std::string callsign;
+                std::string facility;
+                const ControllerPosition * position;
+            } FrequencyIndexEntry;
+
+            static int FrequencyToKilohertz(double frequency);
             bool IsPossibleAirfieldPosition(std::string facility) const;
             bool IsPossibleAreaPosition(std::string facility) const;
+
+            std::map<std::string, std::unique_ptr<ControllerPosition>> positions;
+
+            // Positions by frequency in kHz, ordered by callsign
+            std::unordered_map<int, std::vector<FrequencyIndexEntry>> frequencyIndex;
         };
     }  // namespace Controller
 }  // namespace UKControllerPlugin
@@ -2,11 +2,13 @@
 #include "controller/ControllerPositionCollectionFactory.h"
 #include "controller/ControllerPositionCollection.h"
 #include "controller/ControllerPosition.h"
+#include "controller/ControllerPositionDecoder.h"
 #include "dependency/DependencyCache.h"
 #include "helper/HelperFunctions.h"
 
 using UKControllerPlugin::Dependency::DependencyCache;
 using UKControllerPlugin::HelperFunctions;
+using UKControllerPlugin::Controller::ControllerPositionDecoder;
 
 namespace UKControllerPlugin {
     namespace Controller {
@@ -14,43 +16,28 @@ namespace UKControllerPlugin {
         // Initilise the required dependency constant
         const std::string ControllerPositionCollectionFactory::requiredDependency = "controller-positions.json";
 
+        /*
+            Create the collection, decoding each position as the dependency is parsed.
+        */
         std::unique_ptr<ControllerPositionCollection> ControllerPositionCollectionFactory::Create(
             const DependencyCache & dependency
         ) {
             std::unique_ptr<ControllerPositionCollection> collection(new ControllerPositionCollection);
-            nlohmann::json controllerPositions;
             try {
-                controllerPositions = nlohmann::json::parse(
-                    dependency.GetDependency(ControllerPositionCollectionFactory::requiredDependency)
-                );
+                ControllerPositionDecoder decoder(*collection);
+                if (
+                    !nlohmann::json::sax_parse(
+                        dependency.GetDependency(ControllerPositionCollectionFactory::requiredDependency),
+                        &decoder
+                    )
+                ) {
+                    // If something goes wrong, we cant do anything, return an empty collection.
+                    return std::unique_ptr<ControllerPositionCollection>(new ControllerPositionCollection);
+                }
             } catch (...) {
-                // If something goes wrong, we cant do anything, return the empty collection.
+                // If something goes wrong, we cant do anything, return an empty collection.
                 LogError("Unable to load controller positions, dependency data invalid");
-                return collection;
-            }
-
-            for (nlohmann::json::iterator posIt = controllerPositions.begin();
-                posIt != controllerPositions.end();
-                posIt++
-            ) {
-
-                // Missing data, skip this position.
-                if (!posIt.value()["frequency"].is_number_float() || !posIt.value()["top-down"].is_array()) {
-                    continue;
-                }
-
-                std::string callsign = posIt.key();
-                std::string posType = callsign.substr(callsign.size() - 3, callsign.size());
-                double frequency = posIt.value()["frequency"];
-
-                try {
-                    collection->AddPosition(std::unique_ptr<ControllerPosition>(
-                        new ControllerPosition(callsign, frequency, posType, posIt.value()["top-down"])
-                    ));
-                } catch (std::invalid_argument) {
-                    LogError("Failed adding position " + callsign + " to controller collection");
-                    // Do nothing if something goes wrong.
-                }
+                return std::unique_ptr<ControllerPositionCollection>(new ControllerPositionCollection);
             }
 
             LogInfo(
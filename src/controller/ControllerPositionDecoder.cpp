@@ -0,0 +1,164 @@
+#include "pch/stdafx.h"
+#include "controller/ControllerPositionDecoder.h"
+#include "controller/ControllerPositionCollection.h"
+#include "controller/ControllerPosition.h"
+
+using UKControllerPlugin::Controller::ControllerPosition;
+using UKControllerPlugin::Controller::ControllerPositionCollection;
+
+namespace UKControllerPlugin {
+    namespace Controller {
+
+        ControllerPositionDecoder::ControllerPositionDecoder(ControllerPositionCollection & collection)
+            : collection(collection)
+        {
+
+        }
+
+        /*
+            Adds the position that has just been decoded, if it has everything it needs.
+        */
+        void ControllerPositionDecoder::AddPosition(void)
+        {
+            if (!this->valid || !this->hasFrequency || !this->hasTopDown || this->callsign.size() < 3) {
+                return;
+            }
+
+            std::string posType = this->callsign.substr(this->callsign.size() - 3, this->callsign.size());
+            try {
+                this->collection.AddPosition(std::unique_ptr<ControllerPosition>(
+                    new ControllerPosition(this->callsign, this->frequency, posType, std::move(this->topDown))
+                ));
+            } catch (std::invalid_argument) {
+                LogError("Failed adding position " + this->callsign + " to controller collection");
+            }
+        }
+
+        /*
+            A value that the position can't use has been found. At the top level, the file isn't the
+            object we expect so stop. Otherwise, if it's the position itself, a frequency or an airfield
+            in the top-down, the position is skipped.
+        */
+        bool ControllerPositionDecoder::InvalidValue(void)
+        {
+            if (this->depth == 0) {
+                return false;
+            }
+
+            if (
+                this->depth == 1 ||
+                (this->depth == 2 && (this->field == "frequency" || this->field == "top-down")) ||
+                (this->depth == 3 && this->field == "top-down")
+            ) {
+                this->valid = false;
+            }
+
+            return true;
+        }
+
+        bool ControllerPositionDecoder::null()
+        {
+            return this->InvalidValue();
+        }
+
+        bool ControllerPositionDecoder::boolean(bool val)
+        {
+            return this->InvalidValue();
+        }
+
+        bool ControllerPositionDecoder::number_integer(number_integer_t val)
+        {
+            return this->InvalidValue();
+        }
+
+        bool ControllerPositionDecoder::number_unsigned(number_unsigned_t val)
+        {
+            return this->InvalidValue();
+        }
+
+        bool ControllerPositionDecoder::number_float(number_float_t val, const string_t & s)
+        {
+            if (this->depth != 2 || this->field != "frequency") {
+                return this->InvalidValue();
+            }
+
+            this->frequency = val;
+            this->hasFrequency = true;
+            return true;
+        }
+
+        bool ControllerPositionDecoder::string(string_t & val)
+        {
+            if (this->depth != 3 || this->field != "top-down") {
+                return this->InvalidValue();
+            }
+
+            this->topDown.push_back(val);
+            return true;
+        }
+
+        bool ControllerPositionDecoder::start_object(std::size_t elements)
+        {
+            if (this->depth >= 2 && !this->InvalidValue()) {
+                return false;
+            }
+
+            this->depth++;
+            return true;
+        }
+
+        bool ControllerPositionDecoder::key(string_t & val)
+        {
+            if (this->depth == 1) {
+                this->callsign = val;
+                this->field = "";
+                this->frequency = 0.0;
+                this->topDown.clear();
+                this->hasFrequency = false;
+                this->hasTopDown = false;
+                this->valid = true;
+            } else if (this->depth == 2) {
+                this->field = val;
+            }
+
+            return true;
+        }
+
+        bool ControllerPositionDecoder::end_object()
+        {
+            this->depth--;
+            if (this->depth == 1) {
+                this->AddPosition();
+            }
+
+            return true;
+        }
+
+        bool ControllerPositionDecoder::start_array(std::size_t elements)
+        {
+            if (this->depth == 2 && this->field == "top-down") {
+                this->hasTopDown = true;
+            } else if (!this->InvalidValue()) {
+                return false;
+            }
+
+            this->depth++;
+            return true;
+        }
+
+        bool ControllerPositionDecoder::end_array()
+        {
+            this->depth--;
+            return true;
+        }
+
+        bool ControllerPositionDecoder::parse_error(
+            std::size_t position,
+            const std::string & lastToken,
+            const nlohmann::detail::exception & ex
+        ) {
+            LogError("Unable to load controller positions, dependency data invalid: " + std::string(ex.what()));
+            return false;
+        }
+    }  // namespace Controller
+}  // namespace UKControllerPlugin
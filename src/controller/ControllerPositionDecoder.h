@@ -0,0 +1,66 @@
+#pragma once
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Controller {
+        class ControllerPositionCollection;
+    }  // namespace Controller
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace Controller {
+
+        /*
+            Decodes the controller positions dependency straight into a collection as the JSON is parsed,
+            without building a document for the whole file first.
+
+            The file is an object of callsign to position. A position needs a floating point frequency and
+            a top-down array of airfields, otherwise it's skipped. Any other fields are ignored.
+        */
+        class ControllerPositionDecoder : public nlohmann::json_sax<nlohmann::json>
+        {
+            public:
+                explicit ControllerPositionDecoder(
+                    UKControllerPlugin::Controller::ControllerPositionCollection & collection
+                );
+                bool null() override;
+                bool boolean(bool val) override;
+                bool number_integer(number_integer_t val) override;
+                bool number_unsigned(number_unsigned_t val) override;
+                bool number_float(number_float_t val, const string_t & s) override;
+                bool string(string_t & val) override;
+                bool start_object(std::size_t elements) override;
+                bool key(string_t & val) override;
+                bool end_object() override;
+                bool start_array(std::size_t elements) override;
+                bool end_array() override;
+                bool parse_error(
+                    std::size_t position,
+                    const std::string & lastToken,
+                    const nlohmann::detail::exception & ex
+                ) override;
+
+            private:
+                void AddPosition(void);
+                bool InvalidValue(void);
+
+                // Where the positions go
+                UKControllerPlugin::Controller::ControllerPositionCollection & collection;
+
+                // How far into nested objects and arrays we are
+                unsigned int depth = 0;
+
+                // The field of the position currently being decoded
+                std::string field;
+
+                // The position currently being decoded
+                std::string callsign;
+                double frequency = 0.0;
+                std::vector<std::string> topDown;
+                bool hasFrequency = false;
+                bool hasTopDown = false;
+                bool valid = true;
+        };
+    }  // namespace Controller
+}  // namespace UKControllerPlugin
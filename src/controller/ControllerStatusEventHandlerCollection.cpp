@@ -46,6 +46,22 @@ namespace UKControllerPlugin {
             return this->eventHandlers.size();
         }
 
+        /*
+            Called once when the plugin loads, with every controller that is already online.
+        */
+        void ControllerStatusEventHandlerCollection::InitialControllerLoadEvent(
+            const std::vector<std::shared_ptr<EuroScopeCControllerInterface>> & controllers
+        ) const {
+            for (
+                std::vector<std::shared_ptr<ControllerStatusEventHandlerInterface>>::const_iterator it =
+                    this->eventHandlers.begin();
+                it != this->eventHandlers.end();
+                ++it
+            ) {
+                (*it)->InitialControllerLoadEvent(controllers);
+            }
+        }
+
         /*
             Adds an event handler to the collection.
         */
@@ -28,6 +28,10 @@ class ControllerStatusEventHandlerCollection
             UKControllerPlugin::Euroscope::EuroScopeCControllerInterface & controller
         ) const;
         int CountHandlers(void) const;
+        void InitialControllerLoadEvent(
+            const std::vector<std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCControllerInterface>>
+                & controllers
+        ) const;
         void RegisterHandler(
             std::shared_ptr <UKControllerPlugin::Controller::ControllerStatusEventHandlerInterface> handler
         );
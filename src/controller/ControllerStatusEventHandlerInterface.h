@@ -25,6 +25,10 @@ namespace UKControllerPlugin {
                 virtual void ControllerDisconnectEvent(
                     UKControllerPlugin::Euroscope::EuroScopeCControllerInterface & controller
                 ) = 0;
+                virtual void InitialControllerLoadEvent(
+                    const std::vector<std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCControllerInterface>>
+                        & controllers
+                ) = 0;
                 virtual void SelfDisconnectEvent(void) = 0;
         };
     }  // namespace Controller
@@ -5,62 +5,243 @@
 
 using UKControllerPlugin::Curl::CurlRequest;
 using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPlugin::Curl::CurlHandlePool;
+using UKControllerPlugin::Curl::CurlReceiveBuffer;
 
 namespace UKControllerPlugin {
     namespace Curl {
 
+        CurlApi::CurlApi(void)
+            : handles(CurlHandlePool::defaultMaxHandlesPerHost), multi(CurlHandlePool::defaultMaxHandlesPerHost)
+        {
+
+        }
+
+        CurlApi::CurlApi(size_t maxHandlesPerHost)
+            : handles(maxHandlesPerHost), multi(maxHandlesPerHost)
+        {
+
+        }
+
         /*
-            Performs a CURL request to the specified URL with the specified post params.
+            Builds the list of headers for a request. The caller is responsible for freeing it
+            once the request is done.
         */
-        UKControllerPlugin::Curl::CurlResponse CurlApi::MakeCurlRequest(const CurlRequest & request) {
-            CURL * curlObject;
-            CURLcode result;
-            struct curl_slist *curlHeaders = NULL;
-
-            // Set CURL params.
-            curlObject = curl_easy_init();
-            curl_easy_setopt(curlObject, CURLOPT_URL, request.GetUri());
-            curl_easy_setopt(curlObject, CURLOPT_CUSTOMREQUEST, request.GetMethod());
-
-            // Add headers
-            if (request.cbegin() != request.cend()) {
-                for (CurlRequest::HttpHeaders::const_iterator it = request.cbegin(); it != request.cend(); ++it) {
-                    curlHeaders = curl_slist_append(curlHeaders, std::string(it->first + ": " + it->second).c_str());
+        curl_slist * CurlApi::BuildHeaders(const CurlRequest & request)
+        {
+            struct curl_slist * headers = NULL;
+            for (CurlRequest::HttpHeaders::const_iterator it = request.cbegin(); it != request.cend(); ++it) {
+                headers = curl_slist_append(headers, std::string(it->first + ": " + it->second).c_str());
+            }
+
+            return headers;
+        }
+
+        /*
+            Creates a successful response with the headers that were received.
+        */
+        CurlResponse CurlApi::CreateResponse(
+            std::string body,
+            uint64_t statusCode,
+            const CurlRequest::HttpHeaders & responseHeaders
+        ) {
+            CurlResponse response(body, false, statusCode);
+            for (
+                CurlRequest::HttpHeaders::const_iterator it = responseHeaders.cbegin();
+                it != responseHeaders.cend();
+                ++it
+            ) {
+                response.AddHeader(it->first, it->second);
+            }
+
+            return response;
+        }
+
+        /*
+            Works out how big the body is going to be from the response headers, so the buffer can
+            be reserved before any of it arrives. Content-Length is the size on the wire, so if the body
+            is compressed, allow for it growing once decoded. Returns 0 if there's no way of knowing.
+        */
+        size_t CurlApi::GetExpectedBodySize(const CurlRequest::HttpHeaders & responseHeaders)
+        {
+            auto contentLength = responseHeaders.find("content-length");
+            if (contentLength == responseHeaders.cend()) {
+                return 0;
+            }
+
+            unsigned long long length;
+            try {
+                length = std::stoull(contentLength->second);
+            } catch (...) {
+                return 0;
+            }
+
+            auto contentEncoding = responseHeaders.find("content-encoding");
+            if (contentEncoding != responseHeaders.cend() && contentEncoding->second != "identity") {
+                length = length > CurlApi::maxBodyReservation
+                    ? CurlApi::maxBodyReservation
+                    : length * CurlApi::compressedExpansionRatio;
+            }
+
+            return length > CurlApi::maxBodyReservation ? CurlApi::maxBodyReservation : static_cast<size_t>(length);
+        }
+
+        /*
+            Called by Curl for each response header line. If a redirect is followed, there's more than
+            one set of headers, so start again whenever a status line comes in. The blank line at the end
+            of the headers is when the body buffer gets reserved.
+        */
+        size_t CurlApi::HeaderFunction(char * buffer, size_t size, size_t nitems, void * received)
+        {
+            CurlReceiveBuffer & buffers = *reinterpret_cast<CurlReceiveBuffer *>(received);
+            CurlRequest::HttpHeaders & headers = buffers.headers;
+            std::string line(buffer, size * nitems);
+
+            if (line.compare(0, 5, "HTTP/") == 0) {
+                headers.clear();
+                return size * nitems;
+            }
+
+            if (line == "\r\n" || line == "\n") {
+                if (!buffers.receiver) {
+                    buffers.body.reserve(CurlApi::GetExpectedBodySize(headers));
                 }
-                curl_easy_setopt(curlObject, CURLOPT_HTTPHEADER, curlHeaders);
+                return size * nitems;
             }
 
-            curl_easy_setopt(curlObject, CURLOPT_POSTFIELDS, request.GetBody());
+            size_t separator = line.find(':');
+            if (separator == std::string::npos) {
+                return size * nitems;
+            }
+
+            std::string key = line.substr(0, separator);
+            std::transform(key.begin(), key.end(), key.begin(), ::tolower);
 
-            std::string outBuffer;
-            curl_easy_setopt(curlObject, CURLOPT_FOLLOWLOCATION, 1L);
-            curl_easy_setopt(curlObject, CURLOPT_TIMEOUT, 3);
-            curl_easy_setopt(curlObject, CURLOPT_WRITEDATA, &outBuffer);
-            curl_easy_setopt(curlObject, CURLOPT_WRITEFUNCTION, &CurlApi::WriteFunction);
+            size_t valueStart = line.find_first_not_of(" \t", separator + 1);
+            size_t valueEnd = line.find_last_not_of(" \t\r\n");
+            headers[key] = valueStart == std::string::npos || valueEnd < valueStart
+                ? ""
+                : line.substr(valueStart, valueEnd - valueStart + 1);
 
-            result = curl_easy_perform(curlObject);
+            return size * nitems;
+        }
+
+        /*
+            Performs a CURL request to the specified URL with the specified post params.
+        */
+        UKControllerPlugin::Curl::CurlResponse CurlApi::MakeCurlRequest(const CurlRequest & request) {
+            return this->PerformRequest(request, nullptr);
+        }
 
-            // If we get an error, then throw an exception.
+        /*
+            Performs a CURL request, keeping the body in the response unless there's a receiver to
+            take it as it arrives.
+        */
+        CurlResponse CurlApi::PerformRequest(
+            const CurlRequest & request,
+            std::function<bool(const char *, size_t)> receiver
+        ) {
+            // Take a handle from the pool, making sure it goes back whatever happens.
+            const std::string host = CurlHandlePool::GetHost(request.GetUri());
+            std::unique_ptr<CURL, std::function<void(CURL *)>> curlObject(
+                this->handles.AcquireHandle(host),
+                [this, &host](CURL * handle) { this->handles.ReleaseHandle(host, handle); }
+            );
+
+            // Headers need to live until the request is done.
+            std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> curlHeaders(
+                CurlApi::BuildHeaders(request),
+                &curl_slist_free_all
+            );
+
+            CurlReceiveBuffer received;
+            received.receiver = receiver;
+            CurlApi::SetRequestOptions(curlObject.get(), request, curlHeaders.get(), received);
+
+            CURLcode result = curl_easy_perform(curlObject.get());
+
+            // If we get an error, then return an error response.
             if (result != CURLE_OK) {
                 return CurlResponse("", true, -1);
             }
 
-            // Save a copy of the output buffer and clear the buffer, then clean up.
-            uint64_t responseCode = 0;
-            curl_easy_getinfo(curlObject, CURLINFO_RESPONSE_CODE, &responseCode);
-            curl_easy_cleanup(curlObject);
+            long responseCode = 0;
+            curl_easy_getinfo(curlObject.get(), CURLINFO_RESPONSE_CODE, &responseCode);
+            return CurlApi::CreateResponse(received.body, responseCode, received.headers);
+        }
+
+        /*
+            Hands the request to the multi engine, returning a future for the response.
+        */
+        std::future<CurlResponse> CurlApi::MakeCurlRequestAsync(const CurlRequest & request)
+        {
+            return this->multi.Submit(request);
+        }
+
+        /*
+            Hands the request to the multi engine, which calls back on its own thread once it's done.
+        */
+        void CurlApi::MakeCurlRequestAsync(const CurlRequest & request, std::function<void(CurlResponse)> callback)
+        {
+            this->multi.Submit(request, callback);
+        }
+
+        /*
+            Sets all the options for a request on a handle. The headers and receive buffer need to
+            live until the request is done.
+
+            An empty accept encoding asks for every encoding this build of Curl can decode (gzip, and brotli
+            where it's built in), and has Curl decode the body as it streams in.
+        */
+        void CurlApi::SetRequestOptions(
+            CURL * handle,
+            const CurlRequest & request,
+            curl_slist * headers,
+            CurlReceiveBuffer & received
+        ) {
+            curl_easy_setopt(handle, CURLOPT_URL, request.GetUri());
+            curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, request.GetMethod());
+
+            if (headers) {
+                curl_easy_setopt(handle, CURLOPT_HTTPHEADER, headers);
+            }
+
+            curl_easy_setopt(handle, CURLOPT_POSTFIELDS, request.GetBody());
+            curl_easy_setopt(handle, CURLOPT_FOLLOWLOCATION, 1L);
+            curl_easy_setopt(handle, CURLOPT_TIMEOUT, 3);
+            curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+            curl_easy_setopt(handle, CURLOPT_ACCEPT_ENCODING, "");
+            curl_easy_setopt(handle, CURLOPT_WRITEDATA, &received);
+            curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, &CurlApi::WriteFunction);
+            curl_easy_setopt(handle, CURLOPT_HEADERDATA, &received);
+            curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, &CurlApi::HeaderFunction);
+        }
 
-            return CurlResponse(outBuffer, false, responseCode);
+        /*
+            Performs a CURL request, handing the body to the receiver as it arrives. The response
+            has the status and headers, but no body.
+        */
+        CurlResponse CurlApi::StreamCurlRequest(
+            const CurlRequest & request,
+            std::function<bool(const char *, size_t)> receiver
+        ) {
+            return this->PerformRequest(request, receiver);
         }
 
         /*
             This function is called by Curl once it has received data to
-            add a null terminator and store the data in the correct place.
+            add a null terminator and store the data in the correct place. If the receiver
+            doesn't want any more, returning less than was given stops the transfer.
         */
-        size_t CurlApi::WriteFunction(void *contents, size_t size, size_t nmemb, void *outString)
+        size_t CurlApi::WriteFunction(void *contents, size_t size, size_t nmemb, void *received)
         {
+            CurlReceiveBuffer & buffers = *reinterpret_cast<CurlReceiveBuffer *>(received);
+            if (buffers.receiver) {
+                return buffers.receiver(reinterpret_cast<char *>(contents), size * nmemb) ? size * nmemb : 0;
+            }
+
             // For Curl, we should assume that the data is not null terminated, so add a null terminator on the end
-            ((std::string*)outString)->append(reinterpret_cast<char*>(contents) + '\0', size * nmemb);
+            buffers.body.append(reinterpret_cast<char*>(contents) + '\0', size * nmemb);
             return size * nmemb;
         }
     }  // namespace Curl
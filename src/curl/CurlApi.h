@@ -1,20 +1,74 @@
 #pragma once
 #include "curl/CurlInterface.h"
+#include "curl/CurlHandlePool.h"
+#include "curl/CurlMultiEngine.h"
+#include "curl/CurlReceiveBuffer.h"
+#include "curl/CurlRequest.h"
 
 namespace UKControllerPlugin {
     namespace Curl {
         /*
             An API to the CURL library, for sending CURL requests to third parties.
+
+            Handles are pooled between requests so that connections and TLS sessions can be reused.
+            Asynchronous requests are run by a multi engine on its own thread. Responses may be compressed
+            on the wire, Curl decodes them as they arrive. Streamed requests hand each decoded piece of the
+            body straight to the receiver.
         */
         class CurlApi : public CurlInterface
         {
             public:
+                CurlApi(void);
+                explicit CurlApi(size_t maxHandlesPerHost);
+                static curl_slist * BuildHeaders(const UKControllerPlugin::Curl::CurlRequest & request);
+                static UKControllerPlugin::Curl::CurlResponse CreateResponse(
+                    std::string body,
+                    uint64_t statusCode,
+                    const UKControllerPlugin::Curl::CurlRequest::HttpHeaders & responseHeaders
+                );
                 UKControllerPlugin::Curl::CurlResponse MakeCurlRequest(
                     const UKControllerPlugin::Curl::CurlRequest & request
+                ) override;
+                std::future<UKControllerPlugin::Curl::CurlResponse> MakeCurlRequestAsync(
+                    const UKControllerPlugin::Curl::CurlRequest & request
+                ) override;
+                void MakeCurlRequestAsync(
+                    const UKControllerPlugin::Curl::CurlRequest & request,
+                    std::function<void(UKControllerPlugin::Curl::CurlResponse)> callback
+                ) override;
+                static size_t GetExpectedBodySize(
+                    const UKControllerPlugin::Curl::CurlRequest::HttpHeaders & responseHeaders
                 );
+                static void SetRequestOptions(
+                    CURL * handle,
+                    const UKControllerPlugin::Curl::CurlRequest & request,
+                    curl_slist * headers,
+                    UKControllerPlugin::Curl::CurlReceiveBuffer & received
+                );
+                UKControllerPlugin::Curl::CurlResponse StreamCurlRequest(
+                    const UKControllerPlugin::Curl::CurlRequest & request,
+                    std::function<bool(const char *, size_t)> receiver
+                ) override;
+
+                // Roughly how much bigger a compressed body gets once it's decoded
+                static const size_t compressedExpansionRatio = 4;
+
+                // The most that will be reserved for a body up front, whatever the headers say
+                static const size_t maxBodyReservation = 16 * 1024 * 1024;
 
             private:
-                static size_t WriteFunction(void *ptr, size_t size, size_t nmemb, void * notused);
+                static size_t HeaderFunction(char * buffer, size_t size, size_t nitems, void * received);
+                UKControllerPlugin::Curl::CurlResponse PerformRequest(
+                    const UKControllerPlugin::Curl::CurlRequest & request,
+                    std::function<bool(const char *, size_t)> receiver
+                );
+                static size_t WriteFunction(void *ptr, size_t size, size_t nmemb, void * received);
+
+                // Handles that are kept between requests
+                UKControllerPlugin::Curl::CurlHandlePool handles;
+
+                // Runs the asynchronous requests
+                UKControllerPlugin::Curl::CurlMultiEngine multi;
             };
     }  // namespace Curl
 }  // namespace UKControllerPlugin
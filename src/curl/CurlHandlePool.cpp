@@ -0,0 +1,135 @@
+#include "pch/stdafx.h"
+#include "curl/CurlHandlePool.h"
+
+namespace UKControllerPlugin {
+    namespace Curl {
+
+        CurlHandlePool::CurlHandlePool(size_t maxHandlesPerHost)
+            : maxHandlesPerHost(maxHandlesPerHost > 0 ? maxHandlesPerHost : 1)
+        {
+            this->share = curl_share_init();
+            curl_share_setopt(this->share, CURLSHOPT_LOCKFUNC, &CurlHandlePool::LockShare);
+            curl_share_setopt(this->share, CURLSHOPT_UNLOCKFUNC, &CurlHandlePool::UnlockShare);
+            curl_share_setopt(this->share, CURLSHOPT_USERDATA, this);
+            curl_share_setopt(this->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+            curl_share_setopt(this->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        }
+
+        /*
+            Clean up all the idle handles, then the share. Any handle still in use at this point
+            has been lost to a request that never finished, so there's nothing we can do about it.
+        */
+        CurlHandlePool::~CurlHandlePool(void)
+        {
+            for (
+                std::map<std::string, std::vector<CURL *>>::const_iterator host = this->idleHandles.cbegin();
+                host != this->idleHandles.cend();
+                ++host
+            ) {
+                for (CURL * handle : host->second) {
+                    curl_easy_cleanup(handle);
+                }
+            }
+
+            curl_share_cleanup(this->share);
+        }
+
+        /*
+            Returns a handle for making a request to the given host, waiting for one to be released if the
+            host is at its limit. Idle handles for the host are preferred, as they may still be connected.
+            The handle has all of its options reset, apart from using the share.
+        */
+        CURL * CurlHandlePool::AcquireHandle(const std::string & host)
+        {
+            std::unique_lock<std::mutex> lock(this->poolLock);
+            this->handleReleased.wait(lock, [this, &host] {
+                return this->activeHandles[host] < this->maxHandlesPerHost;
+            });
+            this->activeHandles[host]++;
+
+            std::vector<CURL *> & idle = this->idleHandles[host];
+            if (!idle.empty()) {
+                CURL * handle = idle.back();
+                idle.pop_back();
+                return handle;
+            }
+
+            lock.unlock();
+            CURL * handle = curl_easy_init();
+            if (!handle) {
+                this->ReleaseHandle(host, nullptr);
+                throw std::runtime_error("Unable to create CURL handle");
+            }
+
+            curl_easy_setopt(handle, CURLOPT_SHARE, this->share);
+            return handle;
+        }
+
+        /*
+            Returns how many handles are currently in use for the host.
+        */
+        size_t CurlHandlePool::CountActiveHandles(const std::string & host) const
+        {
+            std::lock_guard<std::mutex> lock(this->poolLock);
+            auto active = this->activeHandles.find(host);
+            return active == this->activeHandles.cend() ? 0 : active->second;
+        }
+
+        /*
+            Returns how many handles are waiting to be reused for the host.
+        */
+        size_t CurlHandlePool::CountIdleHandles(const std::string & host) const
+        {
+            std::lock_guard<std::mutex> lock(this->poolLock);
+            auto idle = this->idleHandles.find(host);
+            return idle == this->idleHandles.cend() ? 0 : idle->second.size();
+        }
+
+        /*
+            Returns the scheme, host and port part of a URI, which is what connections are made to.
+        */
+        std::string CurlHandlePool::GetHost(const std::string & uri)
+        {
+            size_t hostStart = uri.find("://");
+            hostStart = hostStart == std::string::npos ? 0 : hostStart + 3;
+
+            size_t hostEnd = uri.find_first_of("/?#", hostStart);
+            std::string host = uri.substr(0, hostEnd);
+            std::transform(host.begin(), host.end(), host.begin(), ::tolower);
+            return host;
+        }
+
+        void CurlHandlePool::LockShare(CURL * handle, curl_lock_data data, curl_lock_access access, void * pool)
+        {
+            reinterpret_cast<CurlHandlePool *>(pool)->shareLocks[data].lock();
+        }
+
+        /*
+            Puts a handle back into the pool once a request is done with it. The options are reset here so
+            that nothing from the last request leaks into the next, which keeps any live connections and
+            the share. Null handles just give up the slot.
+        */
+        void CurlHandlePool::ReleaseHandle(const std::string & host, CURL * handle)
+        {
+            if (handle) {
+                curl_easy_reset(handle);
+                curl_easy_setopt(handle, CURLOPT_SHARE, this->share);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(this->poolLock);
+                this->activeHandles[host]--;
+                if (handle) {
+                    this->idleHandles[host].push_back(handle);
+                }
+            }
+
+            this->handleReleased.notify_all();
+        }
+
+        void CurlHandlePool::UnlockShare(CURL * handle, curl_lock_data data, void * pool)
+        {
+            reinterpret_cast<CurlHandlePool *>(pool)->shareLocks[data].unlock();
+        }
+    }  // namespace Curl
+}  // namespace UKControllerPlugin
@@ -0,0 +1,56 @@
+#pragma once
+#include "curl/curl.h"
+
+namespace UKControllerPlugin {
+    namespace Curl {
+
+        /*
+            Keeps hold of CURL easy handles between requests, so that connections that are still alive
+            can be reused rather than paying for the DNS lookup and TCP and TLS handshakes every time.
+
+            Idle handles are kept per host, as that's where their connections go. All handles share
+            a DNS and TLS session cache, so even a fresh handle can resume a TLS session. The number of
+            handles in use for any one host is limited, with anyone else wanting one waiting until
+            a handle is released.
+        */
+        class CurlHandlePool
+        {
+            public:
+                explicit CurlHandlePool(size_t maxHandlesPerHost);
+                ~CurlHandlePool(void);
+                CURL * AcquireHandle(const std::string & host);
+                size_t CountActiveHandles(const std::string & host) const;
+                size_t CountIdleHandles(const std::string & host) const;
+                static std::string GetHost(const std::string & uri);
+                void ReleaseHandle(const std::string & host, CURL * handle);
+
+                // The default number of handles that may be in use for any one host
+                static const size_t defaultMaxHandlesPerHost = 4;
+
+            private:
+                static void LockShare(CURL * handle, curl_lock_data data, curl_lock_access access, void * pool);
+                static void UnlockShare(CURL * handle, curl_lock_data data, void * pool);
+
+                // The most handles that may be in use for any one host
+                const size_t maxHandlesPerHost;
+
+                // The DNS and TLS session cache shared between handles
+                CURLSH * share;
+
+                // Locks for each type of data in the share
+                std::mutex shareLocks[CURL_LOCK_DATA_LAST];
+
+                // Protects the handle maps
+                mutable std::mutex poolLock;
+
+                // Signalled when a handle is released
+                std::condition_variable handleReleased;
+
+                // Handles not currently in use, by host
+                std::map<std::string, std::vector<CURL *>> idleHandles;
+
+                // How many handles are in use, by host
+                std::map<std::string, size_t> activeHandles;
+        };
+    }  // namespace Curl
+}  // namespace UKControllerPlugin
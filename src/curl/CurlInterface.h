@@ -15,6 +15,13 @@ namespace UKControllerPlugin {
 
         /*
             Interface to the libcurl library.
+
+            Requests can also be made asynchronously, either by waiting on a future or by being called
+            back when they complete. By default these just make the request there and then, implementations
+            that can do better should override them.
+
+            Requests can also be streamed, with the body handed to a receiver as it arrives rather than being
+            kept in the response. By default the receiver gets the whole body in one go.
         */
         class CurlInterface
         {
@@ -22,7 +29,38 @@ namespace UKControllerPlugin {
                 virtual UKControllerPlugin::Curl::CurlResponse MakeCurlRequest(
                     const UKControllerPlugin::Curl::CurlRequest & request
                 ) = 0;
-                ~CurlInterface(void) {}  // namespace Curl
+
+                virtual std::future<UKControllerPlugin::Curl::CurlResponse> MakeCurlRequestAsync(
+                    const UKControllerPlugin::Curl::CurlRequest & request
+                ) {
+                    std::promise<UKControllerPlugin::Curl::CurlResponse> response;
+                    response.set_value(this->MakeCurlRequest(request));
+                    return response.get_future();
+                }
+
+                virtual void MakeCurlRequestAsync(
+                    const UKControllerPlugin::Curl::CurlRequest & request,
+                    std::function<void(UKControllerPlugin::Curl::CurlResponse)> callback
+                ) {
+                    callback(this->MakeCurlRequest(request));
+                }
+
+                virtual UKControllerPlugin::Curl::CurlResponse StreamCurlRequest(
+                    const UKControllerPlugin::Curl::CurlRequest & request,
+                    std::function<bool(const char *, size_t)> receiver
+                ) {
+                    UKControllerPlugin::Curl::CurlResponse response = this->MakeCurlRequest(request);
+                    if (response.IsCurlError()) {
+                        return response;
+                    }
+
+                    std::string body = response.GetResponse();
+                    return receiver(body.c_str(), body.size())
+                        ? response
+                        : UKControllerPlugin::Curl::CurlResponse("", true, -1);
+                }
+
+                virtual ~CurlInterface(void) {}
 
         };
     }  // namespace Curl
@@ -0,0 +1,304 @@
+#include "pch/stdafx.h"
+#include "curl/CurlMultiEngine.h"
+#include "curl/CurlApi.h"
+
+using UKControllerPlugin::Curl::CurlApi;
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPlugin::Curl::CurlTransfer;
+
+namespace UKControllerPlugin {
+    namespace Curl {
+
+        CurlMultiEngine::CurlMultiEngine(size_t maxConnectionsPerHost)
+        {
+            // Makes sure sockets are available before the wakeup socket is created
+            curl_global_init(CURL_GLOBAL_ALL);
+            this->CreateWakeSocket();
+
+            this->multi = curl_multi_init();
+            curl_multi_setopt(this->multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+            curl_multi_setopt(this->multi, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(maxConnectionsPerHost));
+
+            // Everything happens on the event loop, so the share doesn't need locking.
+            this->share = curl_share_init();
+            curl_share_setopt(this->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
+            this->loop = std::thread(&CurlMultiEngine::Run, this);
+        }
+
+        /*
+            Stop the event loop. Anything that hasn't completed by now gets an error response.
+        */
+        CurlMultiEngine::~CurlMultiEngine(void)
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->queueLock);
+                this->running = false;
+            }
+            this->transferQueued.notify_all();
+            this->Wake();
+            this->loop.join();
+
+            for (auto it = this->runningTransfers.begin(); it != this->runningTransfers.end(); ++it) {
+                curl_multi_remove_handle(this->multi, it->first);
+                curl_easy_cleanup(it->first);
+                this->CompleteTransfer(std::move(it->second), CurlResponse("", true, -1));
+            }
+
+            for (auto it = this->queuedTransfers.begin(); it != this->queuedTransfers.end(); ++it) {
+                this->CompleteTransfer(std::move(*it), CurlResponse("", true, -1));
+            }
+
+            for (CURL * handle : this->idleHandles) {
+                curl_easy_cleanup(handle);
+            }
+
+            curl_multi_cleanup(this->multi);
+            curl_share_cleanup(this->share);
+
+            if (this->wakeSocket != CURL_SOCKET_BAD) {
+                closesocket(this->wakeSocket);
+            }
+            curl_global_cleanup();
+        }
+
+        /*
+            Hand the response to whoever is waiting for it. A callback that throws shouldn't take
+            the event loop down with it.
+        */
+        void CurlMultiEngine::CompleteTransfer(std::unique_ptr<CurlTransfer> transfer, CurlResponse response)
+        {
+            this->transferCount--;
+            if (!transfer->callback) {
+                transfer->response.set_value(response);
+                return;
+            }
+
+            try {
+                transfer->callback(response);
+            } catch (std::exception & exception) {
+                LogError("Exception in CURL completion callback: " + std::string(exception.what()));
+            } catch (...) {
+                LogError("Unknown exception in CURL completion callback");
+            }
+        }
+
+        /*
+            Creates a non-blocking UDP socket on the loopback interface and connects it to itself, so that
+            anything sent to it can be read straight back by the event loop. If that fails, the loop falls
+            back to polling.
+        */
+        void CurlMultiEngine::CreateWakeSocket(void)
+        {
+            curl_socket_t wake = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            if (wake == CURL_SOCKET_BAD) {
+                LogWarning("Unable to create CURL wakeup socket, falling back to polling");
+                return;
+            }
+
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = 0;
+            socklen_t addressLength = sizeof(address);
+            unsigned long nonBlocking = 1;
+
+            if (
+                bind(wake, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+                getsockname(wake, reinterpret_cast<sockaddr *>(&address), &addressLength) != 0 ||
+                connect(wake, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+                ioctlsocket(wake, FIONBIO, &nonBlocking) != 0
+            ) {
+                LogWarning("Unable to set up CURL wakeup socket, falling back to polling");
+                closesocket(wake);
+                return;
+            }
+
+            this->wakeSocket = wake;
+        }
+
+        /*
+            Returns how many transfers are queued or running.
+        */
+        size_t CurlMultiEngine::CountTransfers(void) const
+        {
+            return this->transferCount;
+        }
+
+        /*
+            Picks up any transfers that have completed, hands out their responses and puts
+            their handles back to be reused.
+        */
+        void CurlMultiEngine::FinishTransfers(void)
+        {
+            int messagesLeft;
+            CURLMsg * message;
+            while ((message = curl_multi_info_read(this->multi, &messagesLeft))) {
+                if (message->msg != CURLMSG_DONE) {
+                    continue;
+                }
+
+                CURL * handle = message->easy_handle;
+                CURLcode result = message->data.result;
+                curl_multi_remove_handle(this->multi, handle);
+
+                auto running = this->runningTransfers.find(handle);
+                std::unique_ptr<CurlTransfer> transfer = std::move(running->second);
+                this->runningTransfers.erase(running);
+
+                long responseCode = 0;
+                curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &responseCode);
+                curl_easy_reset(handle);
+                this->idleHandles.push_back(handle);
+
+                CurlResponse response = result == CURLE_OK
+                    ? CurlApi::CreateResponse(transfer->received.body, responseCode, transfer->received.headers)
+                    : CurlResponse("", true, -1);
+                this->CompleteTransfer(std::move(transfer), response);
+            }
+        }
+
+        /*
+            Adds a transfer to the queue and wakes up the event loop.
+        */
+        void CurlMultiEngine::QueueTransfer(std::unique_ptr<CurlTransfer> transfer)
+        {
+            this->transferCount++;
+            {
+                std::lock_guard<std::mutex> lock(this->queueLock);
+                if (this->running) {
+                    this->queuedTransfers.push_back(std::move(transfer));
+                }
+            }
+
+            if (transfer) {
+                this->CompleteTransfer(std::move(transfer), CurlResponse("", true, -1));
+                return;
+            }
+
+            this->transferQueued.notify_one();
+            this->Wake();
+        }
+
+        /*
+            The event loop. When there's nothing to do, it sleeps until something is queued. Otherwise
+            it starts anything new, lets CURL get on with the transfers and collects the ones that are done.
+        */
+        void CurlMultiEngine::Run(void)
+        {
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(this->queueLock);
+                    this->transferQueued.wait(lock, [this] {
+                        return !this->running || !this->queuedTransfers.empty() || !this->runningTransfers.empty();
+                    });
+
+                    if (!this->running) {
+                        return;
+                    }
+                }
+
+                this->StartTransfers();
+
+                int stillRunning = 0;
+                curl_multi_perform(this->multi, &stillRunning);
+                this->FinishTransfers();
+
+                if (stillRunning == 0) {
+                    continue;
+                }
+
+                if (this->wakeSocket == CURL_SOCKET_BAD) {
+                    curl_multi_wait(this->multi, NULL, 0, this->fallbackPollTimeout, NULL);
+                    continue;
+                }
+
+                curl_waitfd wake = { this->wakeSocket, CURL_WAIT_POLLIN, 0 };
+                curl_multi_wait(this->multi, &wake, 1, this->pollTimeout, NULL);
+
+                // Throw away the wakeups, whatever woke the loop it'll look at the queue next time round
+                char wakeups[16];
+                while (recv(this->wakeSocket, wakeups, sizeof(wakeups), 0) > 0) {}
+            }
+        }
+
+        /*
+            Starts anything that's been queued since the last time round the loop.
+        */
+        void CurlMultiEngine::StartTransfers(void)
+        {
+            std::vector<std::unique_ptr<CurlTransfer>> toStart;
+            {
+                std::lock_guard<std::mutex> lock(this->queueLock);
+                toStart.swap(this->queuedTransfers);
+            }
+
+            for (auto it = toStart.begin(); it != toStart.end(); ++it) {
+                CURL * handle;
+                if (this->idleHandles.empty()) {
+                    handle = curl_easy_init();
+                } else {
+                    handle = this->idleHandles.back();
+                    this->idleHandles.pop_back();
+                }
+
+                if (!handle) {
+                    this->CompleteTransfer(std::move(*it), CurlResponse("", true, -1));
+                    continue;
+                }
+
+                CurlTransfer & transfer = **it;
+                transfer.headers.reset(CurlApi::BuildHeaders(transfer.request));
+                CurlApi::SetRequestOptions(
+                    handle,
+                    transfer.request,
+                    transfer.headers.get(),
+                    transfer.received
+                );
+                curl_easy_setopt(handle, CURLOPT_SHARE, this->share);
+                curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+                curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+
+                this->runningTransfers[handle] = std::move(*it);
+                curl_multi_add_handle(this->multi, handle);
+            }
+        }
+
+        /*
+            Wakes the event loop if it's waiting on the transfers.
+        */
+        void CurlMultiEngine::Wake(void)
+        {
+            if (this->wakeSocket != CURL_SOCKET_BAD) {
+                const char wakeup = 1;
+                send(this->wakeSocket, &wakeup, 1, 0);
+            }
+        }
+
+        /*
+            Submits a request, returning a future for the response.
+        */
+        std::future<CurlResponse> CurlMultiEngine::Submit(const CurlRequest & request)
+        {
+            std::unique_ptr<CurlTransfer> transfer(
+                new CurlTransfer{ request, { nullptr, &curl_slist_free_all }, {}, {}, nullptr }
+            );
+            std::future<CurlResponse> response = transfer->response.get_future();
+            this->QueueTransfer(std::move(transfer));
+            return response;
+        }
+
+        /*
+            Submits a request, calling the callback on the event loop thread when it completes.
+        */
+        void CurlMultiEngine::Submit(const CurlRequest & request, std::function<void(CurlResponse)> callback)
+        {
+            this->QueueTransfer(
+                std::unique_ptr<CurlTransfer>(
+                    new CurlTransfer{ request, { nullptr, &curl_slist_free_all }, {}, {}, callback }
+                )
+            );
+        }
+    }  // namespace Curl
+}  // namespace UKControllerPlugin
@@ -0,0 +1,88 @@
+#pragma once
+#include "curl/CurlTransfer.h"
+
+namespace UKControllerPlugin {
+    namespace Curl {
+
+        /*
+            Runs CURL requests asynchronously on a single thread, using a CURL multi handle.
+
+            Requests can be submitted from any thread, they're picked up by the event loop and run
+            alongside each other, so how many requests are in flight doesn't depend on how many threads
+            there are. Where the server supports it, requests to the same host are multiplexed over
+            one HTTP/2 connection. Otherwise connections per host are limited, with CURL queueing the rest.
+
+            Completion callbacks are run on the event loop thread, so they should be quick and mustn't wait
+            on other requests.
+
+            The version of CURL we have doesn't have curl_multi_wakeup, so the loop watches a loopback UDP socket
+            that's connected to itself alongside the transfers. Queueing a transfer sends a byte to it, which
+            wakes the loop straight away rather than leaving the request until the poll times out.
+        */
+        class CurlMultiEngine
+        {
+            public:
+                explicit CurlMultiEngine(size_t maxConnectionsPerHost);
+                ~CurlMultiEngine(void);
+                size_t CountTransfers(void) const;
+                std::future<UKControllerPlugin::Curl::CurlResponse> Submit(
+                    const UKControllerPlugin::Curl::CurlRequest & request
+                );
+                void Submit(
+                    const UKControllerPlugin::Curl::CurlRequest & request,
+                    std::function<void(UKControllerPlugin::Curl::CurlResponse)> callback
+                );
+
+                // How long to wait for activity on the transfers, in ms. New transfers wake the loop early.
+                static const int pollTimeout = 1000;
+
+                // How long to wait if the wakeup socket couldn't be created, in ms
+                static const int fallbackPollTimeout = 10;
+
+            private:
+                void CreateWakeSocket(void);
+                void CompleteTransfer(
+                    std::unique_ptr<UKControllerPlugin::Curl::CurlTransfer> transfer,
+                    UKControllerPlugin::Curl::CurlResponse response
+                );
+                void FinishTransfers(void);
+                void QueueTransfer(std::unique_ptr<UKControllerPlugin::Curl::CurlTransfer> transfer);
+                void Run(void);
+                void StartTransfers(void);
+                void Wake(void);
+
+                // Wakes the event loop when something is queued, connected to itself
+                curl_socket_t wakeSocket = CURL_SOCKET_BAD;
+
+                // The multi handle that drives everything
+                CURLM * multi;
+
+                // The DNS and TLS session cache for all the handles
+                CURLSH * share;
+
+                // Transfers waiting to be started by the event loop
+                std::vector<std::unique_ptr<UKControllerPlugin::Curl::CurlTransfer>> queuedTransfers;
+
+                // Transfers that are running, by their handle. Only touched by the event loop.
+                std::map<CURL *, std::unique_ptr<UKControllerPlugin::Curl::CurlTransfer>> runningTransfers;
+
+                // Handles that can be reused. Only touched by the event loop.
+                std::vector<CURL *> idleHandles;
+
+                // Protects the queue and the running flag
+                mutable std::mutex queueLock;
+
+                // Signalled when something is queued, or it's time to stop
+                std::condition_variable transferQueued;
+
+                // How many transfers are queued or running
+                std::atomic<size_t> transferCount = 0;
+
+                // Whether the event loop should keep going
+                bool running = true;
+
+                // The event loop
+                std::thread loop;
+        };
+    }  // namespace Curl
+}  // namespace UKControllerPlugin
@@ -0,0 +1,24 @@
+#pragma once
+#include "pch/stdafx.h"
+#include "curl/CurlRequest.h"
+
+namespace UKControllerPlugin {
+    namespace Curl {
+        /*
+            Where Curl writes a response as it comes in. The headers are kept alongside the body,
+            so that the body can be sized from them before any of it arrives.
+
+            If there's a receiver, the body is handed to it a piece at a time instead of being kept.
+        */
+        typedef struct CurlReceiveBuffer {
+            // The response body, after any content encoding has been decoded
+            std::string body;
+
+            // The response headers, keyed by lowercased name
+            UKControllerPlugin::Curl::CurlRequest::HttpHeaders headers;
+
+            // Takes the body as it arrives, returning false to abort the transfer
+            std::function<bool(const char *, size_t)> receiver;
+        } CurlReceiveBuffer;
+    }  // namespace Curl
+}  // namespace UKControllerPlugin
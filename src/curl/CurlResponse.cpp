@@ -11,6 +11,25 @@ namespace UKControllerPlugin {
             this->curlError = curlError;
         }
 
+        /*
+            Adds a response header. Header names aren't case sensitive, so they're stored in lowercase.
+        */
+        void CurlResponse::AddHeader(std::string key, std::string value)
+        {
+            std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+            this->headers[key] = value;
+        }
+
+        /*
+            Returns the value of a response header, or an empty string if it wasn't sent.
+        */
+        std::string CurlResponse::GetHeader(std::string key) const
+        {
+            std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+            auto header = this->headers.find(key);
+            return header == this->headers.cend() ? "" : header->second;
+        }
+
         /*
             Returns the response.
         */
@@ -27,6 +46,15 @@ namespace UKControllerPlugin {
             return this->statusCode;
         }
 
+        /*
+            Returns true if the response has the given header.
+        */
+        bool CurlResponse::HasHeader(std::string key) const
+        {
+            std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+            return this->headers.count(key) != 0;
+        }
+
         /*
             Returns true if there's a curl error.
         */
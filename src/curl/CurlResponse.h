@@ -11,8 +11,11 @@ namespace UKControllerPlugin {
 
             public:
                 CurlResponse(std::string response, bool curlError, uint64_t statusCode);
+                void AddHeader(std::string key, std::string value);
+                std::string GetHeader(std::string key) const;
                 std::string GetResponse(void) const;
                 uint64_t GetStatusCode(void) const;
+                bool HasHeader(std::string key) const;
                 bool IsCurlError(void) const;
                 bool StatusOk(void) const;
 
@@ -27,6 +30,9 @@ namespace UKControllerPlugin {
                 // Whether or not there was an error in cURL.
                 bool curlError;
 
+                // The response headers, names are lowercase
+                std::map<std::string, std::string> headers;
+
                 // Ok
                 const uint64_t okStatus = 200;
 
@@ -0,0 +1,31 @@
+#pragma once
+#include "pch/stdafx.h"
+#include "curl/CurlReceiveBuffer.h"
+#include "curl/CurlRequest.h"
+#include "curl/CurlResponse.h"
+#include "curl/curl.h"
+
+namespace UKControllerPlugin {
+    namespace Curl {
+        /*
+            A request that has been handed to the multi engine, along with everything that has to live
+            until it completes.
+        */
+        typedef struct CurlTransfer {
+            // The request, the handle points at its URI and body
+            UKControllerPlugin::Curl::CurlRequest request;
+
+            // The headers for the request
+            std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> headers;
+
+            // Where the response is written
+            UKControllerPlugin::Curl::CurlReceiveBuffer received;
+
+            // Fulfilled when the transfer completes, if a future was asked for
+            std::promise<UKControllerPlugin::Curl::CurlResponse> response;
+
+            // Called when the transfer completes, if a callback was given
+            std::function<void(UKControllerPlugin::Curl::CurlResponse)> callback;
+        } CurlTransfer;
+    }  // namespace Curl
+}  // namespace UKControllerPlugin
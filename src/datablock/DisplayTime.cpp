@@ -35,6 +35,31 @@ namespace UKControllerPlugin {
             return date::format(this->timeFormat, tp);
         }
 
+        /*
+            Writes the zulu representation of a time point into a buffer, in the same format
+            as FromTimePoint, but without building any strings along the way. Nothing is written
+            if the buffer is too small.
+        */
+        void DisplayTime::WriteTimePoint(
+            std::chrono::system_clock::time_point tp,
+            char * buffer,
+            size_t size
+        ) const {
+            if (size < 6) {
+                return;
+            }
+
+            const auto time = date::make_time(tp - date::floor<date::days>(tp));
+            const int hours = static_cast<int>(time.hours().count());
+            const int minutes = static_cast<int>(time.minutes().count());
+            buffer[0] = static_cast<char>('0' + hours / 10);
+            buffer[1] = static_cast<char>('0' + hours % 10);
+            buffer[2] = ':';
+            buffer[3] = static_cast<char>('0' + minutes / 10);
+            buffer[4] = static_cast<char>('0' + minutes % 10);
+            buffer[5] = '\0';
+        }
+
         /*
             Handle the fact that user settings have been updated
         */
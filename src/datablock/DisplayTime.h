@@ -15,7 +15,8 @@ namespace UKControllerPlugin {
                 std::string FromTimestamp(time_t time) const;
                 std::string FromSystemTime(void) const;
                 std::string FromTimePoint(std::chrono::system_clock::time_point tp) const;
-                inline std::string GetUnknownTimeFormat(void) const
+                void WriteTimePoint(std::chrono::system_clock::time_point tp, char * buffer, size_t size) const;
+                inline const std::string & GetUnknownTimeFormat(void) const
                 {
                     return this->useBlankTimeForUnknown
                         ? this->unknownTimeFormatBlank
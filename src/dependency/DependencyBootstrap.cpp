@@ -2,6 +2,7 @@
 #include "dependency/DependencyBootstrap.h"
 #include "api/ApiInterface.h"
 #include "api/RemoteFileManifest.h"
+#include "api/RemoteFile.h"
 #include "api/RemoteFileManifestFactory.h"
 #include "dependency/LocalFileUpdater.h"
 #include "dependency/DependencyCacheFactory.h"
@@ -9,6 +10,7 @@
 #include "windows/WinApiInterface.h"
 
 using UKControllerPlugin::Api::RemoteFileManifest;
+using UKControllerPlugin::Api::RemoteFile;
 using UKControllerPlugin::Api::RemoteFileManifestFactory;
 using UKControllerPlugin::Dependency::LocalFileUpdater;
 using UKControllerPlugin::Dependency::DependencyCache;
@@ -25,6 +27,7 @@ namespace UKControllerPlugin {
 
         /*
             Bootstrap the dependency cache. Get all the dependencies from the server and create the cache.
+            Each file is loaded into the cache as soon as it's up to date, whilst the rest are still downloading.
         */
         UKControllerPlugin::Dependency::DependencyCache DependencyBootstrap::Bootstrap(
             ApiInterface & api,
@@ -32,11 +35,17 @@ namespace UKControllerPlugin {
             CurlInterface & curl
         ) {
             RemoteFileManifest manifest;
+            DependencyCache cache;
             try {
                 manifest = api.FetchDependencyManifest();
                 windows.WriteToFile(DependencyBootstrap::manifestFile, manifest.ToJsonString(), true);
                 LocalFileUpdater updater(windows, api);
-                updater.UpdateLocalFilesFromManifest(manifest);
+                updater.UpdateLocalFilesFromManifest(
+                    manifest,
+                    [&cache, &windows](const RemoteFile & file) {
+                        DependencyCacheFactory::AddFile(cache, "dependencies", file, windows);
+                    }
+                );
             } catch (ApiException e) {
                 // Nothing
             }
@@ -49,7 +58,9 @@ namespace UKControllerPlugin {
                 manifest = factory.CreateFromLocalFile(DependencyBootstrap::manifestFile);
             }
 
-            return *DependencyCacheFactory::Create("dependencies", manifest, windows);
+            // Pick up anything that couldn't be updated, but is still there from before.
+            DependencyCacheFactory::AddFiles(cache, "dependencies", manifest, windows);
+            return cache;
         }
     }  // namespace Bootstrap
 }  // namespace UKControllerPlugin
@@ -3,14 +3,48 @@
 #include "dependency/DependencyCache.h"
 #include "windows/WinApi.h"
 #include "api/RemoteFileManifest.h"
+#include "api/RemoteFile.h"
 
 using UKControllerPlugin::Api::RemoteFileManifest;
+using UKControllerPlugin::Api::RemoteFile;
 using UKControllerPlugin::Dependency::DependencyCache;
 using UKControllerPlugin::Windows::WinApiInterface;
 
 namespace UKControllerPlugin {
     namespace Dependency {
 
+        /*
+            Adds a file from the local filesystem to the cache, if it's there and not already cached.
+        */
+        void DependencyCacheFactory::AddFile(
+            DependencyCache & cache,
+            std::string dependencyFolder,
+            const RemoteFile & file,
+            WinApiInterface & winApi
+        ) {
+            try {
+                if (!cache.HasDependency(file.filename) && winApi.FileExists(dependencyFolder + "/" + file.filename)) {
+                    cache.AddDependency(file.filename, winApi.ReadFromFile(dependencyFolder + "/" + file.filename));
+                }
+            } catch (std::ifstream::failure) {
+
+            }
+        }
+
+        /*
+            Adds every file in the manifest that's on the local filesystem and not already cached.
+        */
+        void DependencyCacheFactory::AddFiles(
+            DependencyCache & cache,
+            std::string dependencyFolder,
+            const RemoteFileManifest & manifest,
+            WinApiInterface & winApi
+        ) {
+            for (RemoteFileManifest::const_iterator it = manifest.cbegin(); it != manifest.cend(); ++it) {
+                DependencyCacheFactory::AddFile(cache, dependencyFolder, *it, winApi);
+            }
+        }
+
         /*
             Creates the dependency cache from files on the local filesystem and the remote server.
             If the remote file is different, downloads it and saves it locally.
@@ -21,21 +55,7 @@ namespace UKControllerPlugin {
             UKControllerPlugin::Windows::WinApiInterface & winApi
         ) {
             std::unique_ptr<DependencyCache> cache(new DependencyCache);
-
-            // Loop the files in the manifest.
-            for (RemoteFileManifest::const_iterator it = manifest.cbegin(); it != manifest.cend(); ++it) {
-                try {
-                    if (
-                        winApi.FileExists(dependencyFolder + "/" + it->filename) && !cache->HasDependency(it->filename)
-                    ) {
-                        cache->AddDependency(it->filename, winApi.ReadFromFile(dependencyFolder + "/" + it->filename));
-                    }
-                } catch (std::ifstream::failure) {
-
-                }
-
-            }
-
+            DependencyCacheFactory::AddFiles(*cache, dependencyFolder, manifest, winApi);
             return cache;
         }
     }  // namespace Dependency
@@ -8,6 +8,7 @@ namespace UKControllerPlugin {
 
     namespace Api {
         class RemoteFileManifest;
+        struct RemoteFile;
     }  // namespace Api
 }  // namespace UKControllerPlugin
 
@@ -28,10 +29,25 @@ namespace UKControllerPlugin {
         /*
             Builds a dependency cache of file data, from both the remote
             server and the local directories.
+
+            Files can also be added to a cache one at a time, so that loading them can start as soon as
+            each one has been updated.
         */
         class DependencyCacheFactory
         {
             public:
+                static void AddFile(
+                    UKControllerPlugin::Dependency::DependencyCache & cache,
+                    std::string dependencyFolder,
+                    const UKControllerPlugin::Api::RemoteFile & file,
+                    UKControllerPlugin::Windows::WinApiInterface & winApi
+                );
+                static void AddFiles(
+                    UKControllerPlugin::Dependency::DependencyCache & cache,
+                    std::string dependencyFolder,
+                    const UKControllerPlugin::Api::RemoteFileManifest & manifest,
+                    UKControllerPlugin::Windows::WinApiInterface & winApi
+                );
                 static std::unique_ptr<UKControllerPlugin::Dependency::DependencyCache> Create(
                     std::string dependencyFolder,
                     const UKControllerPlugin::Api::RemoteFileManifest & manifest,
@@ -21,5 +21,36 @@ namespace UKControllerPlugin {
             "hold/profile",
             "[]"_json
         };
+
+        // Intention codes, the default is the set of airfields that have always had their own codes
+        const DependencyData DependencyConfig::intentionCodes {
+            "dependencies/intention-codes.json",
+            "intention-code",
+            R"([
+                {"airfield_prefix": "EG", "use_airfield_suffix": true},
+                {"airfields": ["EINN"], "code": "NN"},
+                {
+                    "airfields": ["EBBR", "EBCI", "EBAW", "EBKT", "EBMB", "EBCV", "EBLG"],
+                    "via": "KOK",
+                    "code": "EB"
+                },
+                {"airfields": ["EIDW", "EIME", "EIWT", "EINC", "EITM", "EITT"], "code": "DW"},
+                {
+                    "airfields": [
+                        "EHAM", "EHEH", "EHLE", "EHSB", "EHYB", "EHVK", "EHMZ", "EHBD",
+                        "EHBK", "EHKD", "EHRD", "EHVB", "EHWO", "EHGR", "EHSE", "EHDP"
+                    ],
+                    "via": "KOK",
+                    "code": "AS"
+                },
+                {
+                    "airfields": [
+                        "EHAM", "EHEH", "EHLE", "EHSB", "EHYB", "EHVK", "EHMZ", "EHBD",
+                        "EHBK", "EHKD", "EHRD", "EHVB", "EHWO", "EHGR", "EHSE", "EHDP"
+                    ],
+                    "code": "AM"
+                }
+            ])"_json
+        };
     }  // namespace Dependency
 }  // namespace UKControllerPlugin
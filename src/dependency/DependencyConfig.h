@@ -13,6 +13,9 @@ namespace UKControllerPlugin {
             static const DependencyData holds;
             static const DependencyData holdProfiles;
 
+            // Intention codes
+            static const DependencyData intentionCodes;
+
         } DependencyConfig;
     }  // namespace Dependency
 }  // namespace UKControllerPlugin
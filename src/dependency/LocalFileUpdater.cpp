@@ -6,6 +6,7 @@
 #include "api/ApiInterface.h"
 #include "api/ApiException.h"
 #include "api/ApiNotFoundException.h"
+#include "dependency/Md5Hash.h"
 
 using UKControllerPlugin::Api::RemoteFileManifest;
 using UKControllerPlugin::Windows::WinApiInterface;
@@ -14,6 +15,7 @@ using UKControllerPlugin::Api::RemoteFile;
 using UKControllerPlugin::Api::ApiInterface;
 using UKControllerPlugin::Api::ApiException;
 using UKControllerPlugin::Api::ApiNotFoundException;
+using UKControllerPlugin::Dependency::Md5Hash;
 
 namespace UKControllerPlugin {
     namespace Dependency {
@@ -22,10 +24,20 @@ namespace UKControllerPlugin {
 
         const std::string LocalFileUpdater::HASH_FILE = "dependencies/filehash.json";
 
+        const std::string LocalFileUpdater::DOWNLOAD_SUFFIX = ".download";
+
         LocalFileUpdater::LocalFileUpdater(
             WinApiInterface & winApi,
             const ApiInterface & webApi
-        ) : winApi(winApi), webApi(webApi)
+        ) : winApi(winApi), webApi(webApi), maxConcurrentDownloads(LocalFileUpdater::defaultMaxConcurrentDownloads)
+        {
+        }
+
+        LocalFileUpdater::LocalFileUpdater(
+            WinApiInterface & winApi,
+            const ApiInterface & webApi,
+            size_t maxConcurrentDownloads
+        ) : winApi(winApi), webApi(webApi), maxConcurrentDownloads(maxConcurrentDownloads)
         {
         }
 
@@ -33,6 +45,18 @@ namespace UKControllerPlugin {
         void LocalFileUpdater::UpdateLocalFilesFromManifest(
             const RemoteFileManifest & manifest
         ) {
+            this->UpdateLocalFilesFromManifest(manifest, nullptr);
+        }
+
+        /*
+            Brings the local files up to date with the manifest. The file ready callback is called for
+            each file that is up to date, either because it already was or because it's been downloaded.
+            It may be called from any of the download threads, but only one at a time.
+        */
+        void LocalFileUpdater::UpdateLocalFilesFromManifest(
+            const RemoteFileManifest & manifest,
+            std::function<void(const RemoteFile &)> fileReady
+        ) {
 
             // If we can't create the dependency folder, stop.
             if (!this->winApi.CreateFolder(LocalFileUpdater::DEPENDENCY_FOLDER)) {
@@ -42,22 +66,77 @@ namespace UKControllerPlugin {
 
             nlohmann::json hashCache = this->LoadFileHashCache();
             std::map<std::string, std::string> newHashCache;
+            std::vector<RemoteFile> upToDateFiles;
+            std::vector<RemoteFile> outdatedFiles;
 
-            // Download new or outdated files, whilst keeping the hash cache up to date.
             for (RemoteFileManifest::const_iterator it = manifest.cbegin(); it != manifest.cend(); ++it) {
 
                 // If the file doesn't exist, or is outdated
                 if (!this->winApi.FileExists(LocalFileUpdater::DEPENDENCY_FOLDER + "/" + it->filename) ||
                     !this->FileMatchesRemote(hashCache, *it)
                 ) {
+                    outdatedFiles.push_back(*it);
+                } else {
+                    upToDateFiles.push_back(*it);
+                }
+            }
+
+            // Keeps the hash cache up to date and tells the caller, one file at a time.
+            std::mutex updateLock;
+            auto fileUpdated = [&updateLock, &newHashCache, &fileReady](const RemoteFile & file) {
+                std::lock_guard<std::mutex> lock(updateLock);
+                newHashCache[file.filename] = file.hash;
+
+                if (!fileReady) {
+                    return;
+                }
+
+                try {
+                    fileReady(file);
+                } catch (...) {
+                    LogError("Unable to process updated dependency file " + file.filename);
+                }
+            };
+
+            // Each download thread takes the next outdated file until there are none left.
+            std::atomic<size_t> nextDownload = 0;
+            auto downloadFiles = [this, &outdatedFiles, &nextDownload, &fileUpdated]() {
+                for (size_t i = nextDownload++; i < outdatedFiles.size(); i = nextDownload++) {
                     // We only want to add the new file to the md5 cache if it successfully downloads.
-                    LogInfo("Downloading dependency file " + it->filename);
-                    if (this->FetchFileFromRemoteServer(it->uri, it->filename)) {
-                        newHashCache[it->filename] = it->hash;
+                    LogInfo("Downloading dependency file " + outdatedFiles[i].filename);
+                    if (this->FetchFileFromRemoteServer(outdatedFiles[i])) {
+                        fileUpdated(outdatedFiles[i]);
                     }
-                } else {
-                    newHashCache[it->filename] = it->hash;
                 }
+            };
+
+            // The threads use things on this stack, so whatever happens they have to finish before it unwinds.
+            std::vector<std::thread> downloadThreads;
+            try {
+                size_t threadCount = std::min(this->maxConcurrentDownloads, outdatedFiles.size());
+                for (size_t i = 0; i < threadCount; i++) {
+                    downloadThreads.push_back(std::thread(downloadFiles));
+                }
+
+                // Whilst the downloads are going, deal with the files we already have.
+                for (
+                    std::vector<RemoteFile>::const_iterator it = upToDateFiles.cbegin();
+                    it != upToDateFiles.cend();
+                    ++it
+                ) {
+                    fileUpdated(*it);
+                }
+            } catch (...) {
+                // Don't start any more downloads, just wait for the ones in progress.
+                nextDownload = outdatedFiles.size();
+                for (std::thread & thread : downloadThreads) {
+                    thread.join();
+                }
+                throw;
+            }
+
+            for (std::vector<std::thread>::iterator it = downloadThreads.begin(); it != downloadThreads.end(); ++it) {
+                it->join();
             }
 
             // Write the hash cache to disk.
@@ -69,22 +148,50 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Downloads a remote file from the server.
+            Downloads a remote file from the server, hashing it as it arrives. If the hash matches the manifest,
+            it's written next to the real file and then moved over it. A download that fails part way leaves
+            the old file alone, anything left over is overwritten next time.
         */
-        bool LocalFileUpdater::FetchFileFromRemoteServer(std::string uri, std::string filename)
+        bool LocalFileUpdater::FetchFileFromRemoteServer(const RemoteFile & file)
         {
-            // Write the file to disk and return false if it fails.
+            Md5Hash hash;
+            std::string fileData;
             try {
-                std::string fileData = this->webApi.FetchRemoteFile(uri);
-                this->winApi.WriteToFile(LocalFileUpdater::DEPENDENCY_FOLDER + "/" + filename, fileData, true);
+                this->webApi.StreamRemoteFile(
+                    file.uri,
+                    [&hash, &fileData](const char * data, size_t length) {
+                        hash.Update(data, length);
+                        fileData.append(data, length);
+                        return true;
+                    }
+                );
             } catch (ApiNotFoundException notFound) {
-                LogError("File download returned not found: " + filename + "(" + uri + ")");
+                LogError("File download returned not found: " + file.filename + "(" + file.uri + ")");
                 return false;
             } catch (ApiException apiException) {
-                LogError("File download returned error: " + filename + "(" + uri + ")");
+                LogError("File download returned error: " + file.filename + "(" + file.uri + ")");
                 return false;
             } catch (...) {
-                LogError("Unknown error when downloading file: " + filename + "(" + uri + ")");
+                LogError("Unknown error when downloading file: " + file.filename + "(" + file.uri + ")");
+                return false;
+            }
+
+            if (!Md5Hash::Matches(hash.Finalise(), file.hash)) {
+                LogError("File download does not match manifest hash: " + file.filename + "(" + file.uri + ")");
+                return false;
+            }
+
+            // Write the file to disk and return false if it fails.
+            const std::string filePath = LocalFileUpdater::DEPENDENCY_FOLDER + "/" + file.filename;
+            try {
+                this->winApi.WriteToBinaryFile(filePath + LocalFileUpdater::DOWNLOAD_SUFFIX, fileData, true);
+            } catch (...) {
+                LogError("Unable to write downloaded file: " + file.filename);
+                return false;
+            }
+
+            if (!this->winApi.MoveGivenFile(filePath + LocalFileUpdater::DOWNLOAD_SUFFIX, filePath)) {
+                LogError("Unable to move downloaded file into place: " + file.filename);
                 return false;
             }
 
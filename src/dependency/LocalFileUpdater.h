@@ -21,6 +21,11 @@ namespace UKControllerPlugin {
 
         /*
             Class for updating local files, based on a manifest file.
+
+            Files that are out of date are downloaded a few at a time, each on its own thread. As a file
+            arrives it's hashed and checked against the manifest, then written alongside the real file and
+            moved into place, so a failed or partial download never replaces a good copy. Whoever is
+            updating the files can be told as each one is ready, rather than waiting for all of them.
         */
         class LocalFileUpdater
         {
@@ -29,10 +34,19 @@ namespace UKControllerPlugin {
                     UKControllerPlugin::Windows::WinApiInterface & winApi,
                     const UKControllerPlugin::Api::ApiInterface & webApi
                 );
+                LocalFileUpdater(
+                    UKControllerPlugin::Windows::WinApiInterface & winApi,
+                    const UKControllerPlugin::Api::ApiInterface & webApi,
+                    size_t maxConcurrentDownloads
+                );
 
                 void UpdateLocalFilesFromManifest(
                     const UKControllerPlugin::Api::RemoteFileManifest & manifest
                 );
+                void UpdateLocalFilesFromManifest(
+                    const UKControllerPlugin::Api::RemoteFileManifest & manifest,
+                    std::function<void(const UKControllerPlugin::Api::RemoteFile &)> fileReady
+                );
 
                 // The folder our dependencies are stored in
                 static const std::string DEPENDENCY_FOLDER;
@@ -40,8 +54,14 @@ namespace UKControllerPlugin {
                 // The name of the file where hashes are cached
                 static const std::string HASH_FILE;
 
+                // Added to the name of a file whilst it's being downloaded
+                static const std::string DOWNLOAD_SUFFIX;
+
+                // The default number of files that are downloaded at once
+                static const size_t defaultMaxConcurrentDownloads = 4;
+
             private:
-                bool FetchFileFromRemoteServer(std::string uri, std::string filename);
+                bool FetchFileFromRemoteServer(const UKControllerPlugin::Api::RemoteFile & file);
                 bool FileMatchesRemote(nlohmann::json hashCache, const UKControllerPlugin::Api::RemoteFile & remote);
                 nlohmann::json LoadFileHashCache(void);
 
@@ -50,6 +70,9 @@ namespace UKControllerPlugin {
 
                 // An interface to cURL
                 const UKControllerPlugin::Api::ApiInterface & webApi;
+
+                // The most files that are downloaded at once
+                const size_t maxConcurrentDownloads;
         };
     }  // namespace Dependency
 }  // namespace UKControllerPlugin
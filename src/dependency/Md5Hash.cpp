@@ -0,0 +1,158 @@
+#include "pch/stdafx.h"
+#include "dependency/Md5Hash.h"
+
+namespace UKControllerPlugin {
+    namespace Dependency {
+
+        // Per-round shift amounts, from RFC 1321
+        static const uint32_t shifts[64] = {
+            7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+            5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+            4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+            6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+        };
+
+        // The integer part of abs(sin(i + 1)) * 2^32, from RFC 1321
+        static const uint32_t constants[64] = {
+            0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+            0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+            0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+            0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+            0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+            0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+            0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+            0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+        };
+
+        Md5Hash::Md5Hash(void)
+            : state{ 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 }
+        {
+
+        }
+
+        /*
+            Pads out the data and returns the hash as lowercase hex, the same as the API gives it.
+            The hash can't be updated any more afterwards.
+        */
+        std::string Md5Hash::Finalise(void)
+        {
+            const uint64_t bits = this->length * 8;
+            const unsigned char padding = 0x80;
+            this->Update(reinterpret_cast<const char *>(&padding), 1);
+
+            const char zero = 0;
+            while (this->buffered != 56) {
+                this->Update(&zero, 1);
+            }
+
+            unsigned char bitLength[8];
+            for (int i = 0; i < 8; i++) {
+                bitLength[i] = static_cast<unsigned char>(bits >> (8 * i));
+            }
+            this->Update(reinterpret_cast<const char *>(bitLength), 8);
+
+            std::stringstream hash;
+            hash << std::hex << std::setfill('0');
+            for (int i = 0; i < 16; i++) {
+                hash << std::setw(2) << ((this->state[i / 4] >> (8 * (i % 4))) & 0xff);
+            }
+
+            return hash.str();
+        }
+
+        /*
+            Returns true if two hex hashes are the same, whatever case they're in.
+        */
+        bool Md5Hash::Matches(const std::string & hash, const std::string & expected)
+        {
+            return hash.size() == expected.size() && std::equal(
+                hash.cbegin(),
+                hash.cend(),
+                expected.cbegin(),
+                [](char first, char second) { return ::tolower(first) == ::tolower(second); }
+            );
+        }
+
+        /*
+            Runs a 64 byte block through the hash.
+        */
+        void Md5Hash::ProcessBlock(const unsigned char * block)
+        {
+            uint32_t words[16];
+            for (int i = 0; i < 16; i++) {
+                words[i] = static_cast<uint32_t>(block[i * 4]) |
+                    (static_cast<uint32_t>(block[i * 4 + 1]) << 8) |
+                    (static_cast<uint32_t>(block[i * 4 + 2]) << 16) |
+                    (static_cast<uint32_t>(block[i * 4 + 3]) << 24);
+            }
+
+            uint32_t a = this->state[0];
+            uint32_t b = this->state[1];
+            uint32_t c = this->state[2];
+            uint32_t d = this->state[3];
+
+            for (int i = 0; i < 64; i++) {
+                uint32_t mixed;
+                int word;
+                if (i < 16) {
+                    mixed = (b & c) | (~b & d);
+                    word = i;
+                } else if (i < 32) {
+                    mixed = (d & b) | (~d & c);
+                    word = (5 * i + 1) % 16;
+                } else if (i < 48) {
+                    mixed = b ^ c ^ d;
+                    word = (3 * i + 5) % 16;
+                } else {
+                    mixed = c ^ (b | ~d);
+                    word = (7 * i) % 16;
+                }
+
+                mixed += a + constants[i] + words[word];
+                a = d;
+                d = c;
+                c = b;
+                b += (mixed << shifts[i]) | (mixed >> (32 - shifts[i]));
+            }
+
+            this->state[0] += a;
+            this->state[1] += b;
+            this->state[2] += c;
+            this->state[3] += d;
+        }
+
+        /*
+            Adds some more data to the hash. Whole blocks are hashed straight from the data, anything
+            left over waits in the buffer for the next piece.
+        */
+        void Md5Hash::Update(const char * data, size_t length)
+        {
+            const unsigned char * bytes = reinterpret_cast<const unsigned char *>(data);
+            this->length += length;
+
+            if (this->buffered > 0) {
+                size_t needed = std::min(length, sizeof(this->buffer) - this->buffered);
+                std::memcpy(this->buffer + this->buffered, bytes, needed);
+                this->buffered += needed;
+                bytes += needed;
+                length -= needed;
+
+                if (this->buffered < sizeof(this->buffer)) {
+                    return;
+                }
+
+                this->ProcessBlock(this->buffer);
+                this->buffered = 0;
+            }
+
+            while (length >= sizeof(this->buffer)) {
+                this->ProcessBlock(bytes);
+                bytes += sizeof(this->buffer);
+                length -= sizeof(this->buffer);
+            }
+
+            std::memcpy(this->buffer, bytes, length);
+            this->buffered = length;
+        }
+    }  // namespace Dependency
+}  // namespace UKControllerPlugin
@@ -0,0 +1,34 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Dependency {
+
+        /*
+            Works out the MD5 hash of some data, a piece at a time, so that a file can be hashed as it's
+            downloaded rather than once it's all arrived. The dependency manifest gives the MD5 of every file.
+        */
+        class Md5Hash
+        {
+            public:
+                Md5Hash(void);
+                std::string Finalise(void);
+                static bool Matches(const std::string & hash, const std::string & expected);
+                void Update(const char * data, size_t length);
+
+            private:
+                void ProcessBlock(const unsigned char * block);
+
+                // The running state of the hash
+                uint32_t state[4];
+
+                // Data that doesn't yet fill a whole block
+                unsigned char buffer[64];
+
+                // How many bytes are waiting in the buffer
+                size_t buffered = 0;
+
+                // How many bytes have been hashed in total
+                uint64_t length = 0;
+        };
+    }  // namespace Dependency
+}  // namespace UKControllerPlugin
@@ -1,14 +1,17 @@
 #include "pch/stdafx.h"
 #include "flightplan/FlightplanStorageBootstrap.h"
 #include "flightplan/StoredFlightplanEventHandler.h"
+#include "flightplan/StoredFlightplanJournal.h"
 
 using UKControllerPlugin::Flightplan::StoredFlightplanEventHandler;
+using UKControllerPlugin::Flightplan::StoredFlightplanJournal;
 
 namespace UKControllerPlugin {
     namespace Flightplan {
 
         /*
-            Bootstraps the event handler surrounding storage of flightplans.
+            Bootstraps the event handler surrounding storage of flightplans. Flightplans stored on disk
+            are restored here, before the initial flightplan load from EuroScope.
         */
         void FlightplanStorageBootstrap::BootstrapPlugin(
             const UKControllerPlugin::Bootstrap::PersistenceContainer & container
@@ -19,6 +22,15 @@ namespace UKControllerPlugin {
 
             container.flightplanHandler->RegisterHandler(handler);
             container.timedHandler->RegisterEvent(handler, FlightplanStorageBootstrap::timedEventFrequency);
+
+            std::shared_ptr<StoredFlightplanJournal> journal = std::make_shared<StoredFlightplanJournal>(
+                *container.windows,
+                *container.flightplans
+            );
+            journal->Load();
+
+            container.flightplanHandler->RegisterHandler(journal);
+            container.timedHandler->RegisterEvent(journal, StoredFlightplanJournal::timedEventFrequency);
         }
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
@@ -15,20 +15,7 @@ namespace UKControllerPlugin {
             const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & euroscopePlan
         ) :timeout(this->defaultTime)
         {
-            this->callsign = euroscopePlan.GetCallsign();
-            this->origin = euroscopePlan.GetOrigin();
-            this->destination = euroscopePlan.GetDestination();
-            this->assignedSquawk = euroscopePlan.HasAssignedSquawk() ? euroscopePlan.GetAssignedSquawk()
-                : StoredFlightplan::noSquawkAllocated;
-            std::chrono::system_clock::time_point edt = HelperFunctions::GetTimeFromNumberString(
-                euroscopePlan.GetExpectedDepartureTime()
-            );
-
-            if (edt != (std::chrono::system_clock::time_point::max)()) {
-                this->expectedOffBlockTime = edt - std::chrono::minutes(15);
-            } else {
-                this->expectedOffBlockTime = edt;
-            }
+            this->Update(euroscopePlan);
         }
 
         StoredFlightplan::StoredFlightplan(std::string callsign, std::string origin, std::string destination)
@@ -40,6 +27,14 @@ namespace UKControllerPlugin {
             this->assignedSquawk = StoredFlightplan::noSquawkAllocated;
         }
 
+        /*
+            Clears the record of which fields have changed.
+        */
+        void StoredFlightplan::ClearChangedFields(void)
+        {
+            this->changedFields = 0;
+        }
+
         /*
             Returns the actual off block time of the flightplan.
         */
@@ -56,6 +51,14 @@ namespace UKControllerPlugin {
             return this->callsign;
         }
 
+        /*
+            Returns the flags for the fields that have changed since they were last cleared.
+        */
+        unsigned int StoredFlightplan::GetChangedFields(void) const
+        {
+            return this->changedFields;
+        }
+
         /*
             Returns the destination.
         */
@@ -104,6 +107,14 @@ namespace UKControllerPlugin {
             return this->timeout;
         }
 
+        /*
+            Returns true if any of the given fields have changed since they were last cleared.
+        */
+        bool StoredFlightplan::HasChanged(unsigned int fields) const
+        {
+            return (this->changedFields & fields) != 0;
+        }
+
         /*
             Returns whether or not the plugin has assigned a squawk for this aircraft.
         */
@@ -126,7 +137,7 @@ namespace UKControllerPlugin {
         */
         void StoredFlightplan::SetActualOffBlockTime(std::chrono::system_clock::time_point time)
         {
-            this->actualOffBlockTime = time;
+            this->UpdateField(this->actualOffBlockTime, time, this->actualOffBlockTimeField);
         }
 
         /*
@@ -134,7 +145,7 @@ namespace UKControllerPlugin {
         */
         void StoredFlightplan::SetCallsign(std::string callsign)
         {
-            this->callsign = callsign;
+            this->UpdateField(this->callsign, callsign, this->callsignField);
         }
 
         /*
@@ -142,7 +153,7 @@ namespace UKControllerPlugin {
         */
         void StoredFlightplan::SetDestination(std::string destination)
         {
-            this->destination = destination;
+            this->UpdateField(this->destination, destination, this->destinationField);
         }
 
         /*
@@ -150,7 +161,15 @@ namespace UKControllerPlugin {
         */
         void StoredFlightplan::SetEstimatedDepartureTime(std::chrono::system_clock::time_point time)
         {
-            this->estimatedDepartureTime = time;
+            this->UpdateField(this->estimatedDepartureTime, time, this->estimatedDepartureTimeField);
+        }
+
+        /*
+            Set the expected off block time
+        */
+        void StoredFlightplan::SetExpectedOffBlockTime(std::chrono::system_clock::time_point time)
+        {
+            this->UpdateField(this->expectedOffBlockTime, time, this->expectedOffBlockTimeField);
         }
 
         /*
@@ -158,7 +177,7 @@ namespace UKControllerPlugin {
         */
         void StoredFlightplan::SetOrigin(std::string origin)
         {
-            this->origin = origin;
+            this->UpdateField(this->origin, origin, this->originField);
         }
 
         /*
@@ -166,7 +185,7 @@ namespace UKControllerPlugin {
         */
         void StoredFlightplan::SetPreviouslyAssignedSquawk(std::string squawk)
         {
-            this->assignedSquawk = squawk;
+            this->UpdateField(this->assignedSquawk, squawk, this->squawkField);
         }
 
         /*
@@ -185,6 +204,68 @@ namespace UKControllerPlugin {
             this->timeout = this->defaultTime;
         }
 
+        /*
+            Updates the flightplan from EuroScope in place, only touching the fields that have actually
+            changed. Returns the flags for the fields changed by this update.
+        */
+        unsigned int StoredFlightplan::Update(
+            const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & euroscopePlan
+        ) {
+            const unsigned int previouslyChanged = this->changedFields;
+            this->changedFields = 0;
+
+            this->UpdateField(this->callsign, euroscopePlan.GetCallsign(), this->callsignField);
+            this->UpdateField(this->origin, euroscopePlan.GetOrigin(), this->originField);
+            this->UpdateField(this->destination, euroscopePlan.GetDestination(), this->destinationField);
+            this->UpdateField(
+                this->assignedSquawk,
+                euroscopePlan.HasAssignedSquawk() ? euroscopePlan.GetAssignedSquawk() : this->noSquawkAllocated,
+                this->squawkField
+            );
+
+            std::chrono::system_clock::time_point edt = HelperFunctions::GetTimeFromNumberString(
+                euroscopePlan.GetExpectedDepartureTime()
+            );
+            this->UpdateField(
+                this->expectedOffBlockTime,
+                edt != (std::chrono::system_clock::time_point::max)() ? edt - std::chrono::minutes(15) : edt,
+                this->expectedOffBlockTimeField
+            );
+
+            const unsigned int updated = this->changedFields;
+            this->changedFields |= previouslyChanged;
+            return updated;
+        }
+
+        /*
+            Updates a string field if it's different, flagging it as changed.
+        */
+        void StoredFlightplan::UpdateField(std::string & field, const std::string & value, unsigned int flag)
+        {
+            if (field == value) {
+                return;
+            }
+
+            field.assign(value);
+            this->changedFields |= flag;
+        }
+
+        /*
+            Updates a time field if it's different, flagging it as changed.
+        */
+        void StoredFlightplan::UpdateField(
+            std::chrono::system_clock::time_point & field,
+            std::chrono::system_clock::time_point value,
+            unsigned int flag
+        ) {
+            if (field == value) {
+                return;
+            }
+
+            field = value;
+            this->changedFields |= flag;
+        }
+
         /*
             Returns true only if the callsign, origin and destination match.
         */
@@ -229,9 +310,9 @@ namespace UKControllerPlugin {
         void StoredFlightplan::operator=(
             const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & euroscopePlan
         ) {
-            this->callsign = euroscopePlan.GetCallsign();
-            this->origin = euroscopePlan.GetOrigin();
-            this->destination = euroscopePlan.GetDestination();
+            this->UpdateField(this->callsign, euroscopePlan.GetCallsign(), this->callsignField);
+            this->UpdateField(this->origin, euroscopePlan.GetOrigin(), this->originField);
+            this->UpdateField(this->destination, euroscopePlan.GetDestination(), this->destinationField);
         }
 
         /*
@@ -246,6 +327,8 @@ namespace UKControllerPlugin {
             this->assignedSquawk = flightplan.assignedSquawk;
             this->expectedOffBlockTime = flightplan.expectedOffBlockTime;
             this->estimatedDepartureTime = flightplan.estimatedDepartureTime;
+            this->actualOffBlockTime = flightplan.actualOffBlockTime;
+            this->changedFields = flightplan.changedFields;
         }
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
@@ -10,6 +10,9 @@ namespace UKControllerPlugin {
             just enough to perform functions such as squawk assignment - and also to provide
             a copy for retention if an aircraft logs off. Unlike EuroScopes flightplans, this can persist
             outside the scope of a single function call.
+
+            Each field that changes is flagged, so that anything interested can see what changed in the
+            most recent update without comparing against a copy.
         */
         class StoredFlightplan
         {
@@ -18,24 +21,29 @@ namespace UKControllerPlugin {
                     const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & euroscopePlan
                 );
                 StoredFlightplan(std::string callsign, std::string origin, std::string destination);
+                void ClearChangedFields(void);
                 std::chrono::system_clock::time_point GetActualOffBlockTime(void) const;
                 std::string GetCallsign(void) const;
+                unsigned int GetChangedFields(void) const;
                 std::string GetDestination(void) const;
                 std::chrono::system_clock::time_point GetEstimatedDepartureTime(void) const;
                 std::chrono::system_clock::time_point GetExpectedOffBlockTime(void) const;
                 std::string GetOrigin(void) const;
                 std::string GetPreviouslyAssignedSquawk(void) const;
                 std::time_t GetTimeout(void) const;
+                bool HasChanged(unsigned int fields) const;
                 bool HasPreviouslyAssignedSquawk(void) const;
                 bool HasTimedOut(void) const;
                 void SetActualOffBlockTime(std::chrono::system_clock::time_point time);
                 void SetCallsign(std::string callsign);
                 void SetDestination(std::string destination);
                 void SetEstimatedDepartureTime(std::chrono::system_clock::time_point time);
+                void SetExpectedOffBlockTime(std::chrono::system_clock::time_point time);
                 void SetOrigin(std::string origin);
                 void SetPreviouslyAssignedSquawk(std::string squawk);
                 void SetTimeout(int offset);
                 void ResetTimeout(void);
+                unsigned int Update(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & euroscopePlan);
                 bool operator==(const StoredFlightplan & compare) const;
                 bool operator==(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & compare) const;
                 bool operator!=(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & compare) const;
@@ -49,8 +57,24 @@ namespace UKControllerPlugin {
                 // Default time, when no timeout is set.
                 const std::time_t defaultTime = 0;
 
+                // Flags for each field that can change
+                static const unsigned int callsignField = 1;
+                static const unsigned int originField = 2;
+                static const unsigned int destinationField = 4;
+                static const unsigned int squawkField = 8;
+                static const unsigned int expectedOffBlockTimeField = 16;
+                static const unsigned int estimatedDepartureTimeField = 32;
+                static const unsigned int actualOffBlockTimeField = 64;
+
             private:
 
+                void UpdateField(std::string & field, const std::string & value, unsigned int flag);
+                void UpdateField(
+                    std::chrono::system_clock::time_point & field,
+                    std::chrono::system_clock::time_point value,
+                    unsigned int flag
+                );
+
                 // The callsign for the aircraft
                 std::string callsign;
 
@@ -77,6 +101,9 @@ namespace UKControllerPlugin {
                 // The time at which the aircraft was reported to have left the blocks
                 std::chrono::system_clock::time_point actualOffBlockTime =
                     (std::chrono::system_clock::time_point::max)();
+
+                // The fields that have changed since they were last cleared
+                unsigned int changedFields = 0;
         };
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
@@ -11,66 +11,204 @@ using UKControllerPlugin::Flightplan::StoredFlightplan;
 namespace UKControllerPlugin {
     namespace Flightplan {
 
-        StoredFlightplan & StoredFlightplanCollection::GetFlightplanForCallsign(std::string callsign) const
+        /*
+            Add a plan's timeout to the heap, if it has one.
+        */
+        void StoredFlightplanCollection::AddTimeout(int callsignId)
+        {
+            const StoredFlightplan & plan = *this->GetRecord(callsignId);
+            if (plan.GetTimeout() == plan.defaultTime) {
+                return;
+            }
+
+            this->timeouts.push({plan.GetTimeout(), callsignId});
+        }
+
+        /*
+            Get a callsign id for a new flightplan, reusing a free one if there is one and allocating
+            a new slab if required.
+        */
+        int StoredFlightplanCollection::AllocateCallsignId(void)
+        {
+            if (!this->freeCallsignIds.empty()) {
+                int callsignId = this->freeCallsignIds.back();
+                this->freeCallsignIds.pop_back();
+                return callsignId;
+            }
+
+            if (static_cast<size_t>(this->nextCallsignId) == this->slabs.size() * this->slabSize) {
+                this->slabs.push_back(
+                    std::make_unique<std::optional<StoredFlightplan>[]>(this->slabSize)
+                );
+            }
+
+            return this->nextCallsignId++;
+        }
+
+        /*
+            Returns the number of stored flightplans.
+        */
+        size_t StoredFlightplanCollection::CountPlans(void) const
+        {
+            return this->flightplans.size();
+        }
+
+        /*
+            Returns the callsign id for a stored flightplan, or noCallsignId if there isn't one.
+        */
+        int StoredFlightplanCollection::GetCallsignId(const std::string & callsign) const
+        {
+            auto callsignId = this->callsignIds.find(callsign);
+            return callsignId == this->callsignIds.cend() ? this->noCallsignId : callsignId->second;
+        }
+
+        /*
+            Returns the flightplan with the given callsign id.
+        */
+        StoredFlightplan & StoredFlightplanCollection::GetFlightplanById(int callsignId) const
+        {
+            if (callsignId < 0 || callsignId >= this->nextCallsignId || !this->GetRecord(callsignId)) {
+                LogError("Attempted to reference flightplan with id " + std::to_string(callsignId));
+                throw std::out_of_range("Flightplan with id " + std::to_string(callsignId) + " not found.");
+            }
+
+            return *this->GetRecord(callsignId);
+        }
+
+        StoredFlightplan & StoredFlightplanCollection::GetFlightplanForCallsign(const std::string & callsign) const
         {
-            if (!this->HasFlightplanForCallsign(callsign)) {
+            int callsignId = this->GetCallsignId(callsign);
+            if (callsignId == this->noCallsignId) {
                 LogError("Attempted to reference flightplan for " + callsign + ", which is not stored");
                 throw std::out_of_range("Flightplan for " + callsign + " not found.");
             }
 
-            return *this->flightplans.find(callsign)->second;
+            return *this->GetRecord(callsignId);
+        }
+
+        /*
+            Returns the slab record for a callsign id.
+        */
+        std::optional<StoredFlightplan> & StoredFlightplanCollection::GetRecord(int callsignId) const
+        {
+            return this->slabs[callsignId / this->slabSize][callsignId % this->slabSize];
         }
 
         /*
             Returns true if we have a flightplan for a given callsign.
         */
-        bool StoredFlightplanCollection::HasFlightplanForCallsign(std::string callsign) const
+        bool StoredFlightplanCollection::HasFlightplanForCallsign(const std::string & callsign) const
         {
-            return this->flightplans.find(callsign) != this->flightplans.cend();
+            return this->callsignIds.find(callsign) != this->callsignIds.cend();
+        }
+
+        /*
+            Index a newly stored plan by its callsign.
+        */
+        StoredFlightplan & StoredFlightplanCollection::IndexPlan(const std::string & callsign, int callsignId)
+        {
+            LogInfo("Now tracking flightplan data for " + callsign);
+            StoredFlightplan & storedPlan = *this->GetRecord(callsignId);
+            this->callsignIds[callsign] = callsignId;
+            this->flightplans[callsign] = &storedPlan;
+            return storedPlan;
+        }
+
+        /*
+            Removes a plan, freeing up its callsign id.
+        */
+        void StoredFlightplanCollection::RemovePlan(FlightplanMap::iterator plan)
+        {
+            auto callsignId = this->callsignIds.find(plan->first);
+            this->GetRecord(callsignId->second).reset();
+            this->freeCallsignIds.push_back(callsignId->second);
+            this->callsignIds.erase(callsignId);
+            this->flightplans.erase(plan);
         }
 
         /*
             Removes a plan for a given callsign, if it exists.
         */
-        void StoredFlightplanCollection::RemovePlanByCallsign(std::string callsign)
+        void StoredFlightplanCollection::RemovePlanByCallsign(const std::string & callsign)
         {
-            std::map<std::string, std::unique_ptr<StoredFlightplan>>::iterator plan = this->flightplans.find(callsign);
+            FlightplanMap::iterator plan = this->flightplans.find(callsign);
 
             if (plan != this->flightplans.end()) {
-                this->flightplans.erase(plan);
+                this->RemovePlan(plan);
             }
         }
 
         /*
-            Removes all plans that are deemed to have timed out.
+            Removes all plans that are deemed to have timed out. Heap entries for plans that have since been
+            removed, or whose timeout has been reset or changed, are discarded.
         */
         void StoredFlightplanCollection::RemoveTimedOutPlans()
         {
-            for (
-                std::map<std::string, std::unique_ptr<StoredFlightplan>>::iterator it = this->flightplans.begin();
-                it != this->flightplans.end();
-            ) {
-                if (it->second->HasTimedOut()) {
-                    LogInfo("Stored flightplan for " + it->second->GetCallsign() + " has timed out");
-                    this->flightplans.erase(it++);
-                } else {
-                    ++it;
+            const std::time_t now = time(0);
+            while (!this->timeouts.empty() && this->timeouts.top().expiry < now) {
+                const PlanTimeout timeout = this->timeouts.top();
+                this->timeouts.pop();
+
+                const std::optional<StoredFlightplan> & record = this->GetRecord(timeout.callsignId);
+                if (!record || record->GetTimeout() != timeout.expiry) {
+                    continue;
                 }
+
+                LogInfo("Stored flightplan for " + record->GetCallsign() + " has timed out");
+                this->RemovePlan(this->flightplans.find(record->GetCallsign()));
             }
         }
 
+        /*
+            Sets the timeout for a plan, if it exists.
+        */
+        void StoredFlightplanCollection::SetPlanTimeout(const std::string & callsign, int offset)
+        {
+            int callsignId = this->GetCallsignId(callsign);
+            if (callsignId == this->noCallsignId) {
+                return;
+            }
+
+            this->GetRecord(callsignId)->SetTimeout(offset);
+            this->AddTimeout(callsignId);
+        }
+
+        /*
+            Updates a plan in place from EuroScope, or adds it if it doesn't exist. Afterwards, the
+            plan's changed fields are those that changed in this update.
+        */
+        StoredFlightplan & StoredFlightplanCollection::UpdatePlan(const EuroScopeCFlightPlanInterface & flightplan)
+        {
+            const std::string callsign = flightplan.GetCallsign();
+            int callsignId = this->GetCallsignId(callsign);
+            if (callsignId != this->noCallsignId) {
+                StoredFlightplan & storedPlan = *this->GetRecord(callsignId);
+                storedPlan.ClearChangedFields();
+                storedPlan.Update(flightplan);
+                return storedPlan;
+            }
+
+            callsignId = this->AllocateCallsignId();
+            this->GetRecord(callsignId).emplace(flightplan);
+            return this->IndexPlan(callsign, callsignId);
+        }
+
         /*
             Updates a plan in the collection, or adds it if doesn't exist.
         */
         void StoredFlightplanCollection::UpdatePlan(StoredFlightplan flightplan)
         {
-            if (!this->HasFlightplanForCallsign(flightplan.GetCallsign())) {
-                LogInfo("Now tracking flightplan data for " + flightplan.GetCallsign());
-                this->flightplans[flightplan.GetCallsign()] = std::make_unique<StoredFlightplan>(flightplan);
-                return;
+            const std::string callsign = flightplan.GetCallsign();
+            int callsignId = this->GetCallsignId(callsign);
+            if (callsignId != this->noCallsignId) {
+                *this->GetRecord(callsignId) = flightplan;
+            } else {
+                callsignId = this->AllocateCallsignId();
+                this->GetRecord(callsignId).emplace(flightplan);
+                this->IndexPlan(callsign, callsignId);
             }
 
-            *this->flightplans[flightplan.GetCallsign()] = flightplan;
+            this->AddTimeout(callsignId);
         }
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
@@ -7,12 +7,21 @@ namespace Flightplan {
 /*
     A collection of (local) flightplan objects. Also provides functions
     as to when the flightplan is to be invalidated.
+
+    Flightplans are allocated in fixed size slabs, so that they never move once stored, and each
+    is given a callsign id that can be used to look it up directly. Ids are reused once a flightplan
+    is removed. Updates from EuroScope are applied to the stored flightplan in place.
+
+    Timeouts are kept in a min-heap ordered by expiry, so that removing timed out plans only has to
+    look at the plans that have actually expired. Entries aren't removed from the heap when a plan
+    reconnects, they are discarded when they reach the top if the plan's timeout no longer matches.
+    Timeouts must therefore be set using SetPlanTimeout rather than on the plan itself.
 */
 class StoredFlightplanCollection
 {
     public:
         // Public type definitions for a custom iterator over the class.
-        typedef std::map<std::string, std::unique_ptr<UKControllerPlugin::Flightplan::StoredFlightplan>> FlightplanMap;
+        typedef std::map<std::string, UKControllerPlugin::Flightplan::StoredFlightplan *> FlightplanMap;
         typedef FlightplanMap::iterator iterator;
         typedef FlightplanMap::const_iterator const_iterator;
         iterator begin(void) { return flightplans.begin(); }
@@ -20,16 +29,63 @@ class StoredFlightplanCollection
         const_iterator cbegin() const { return flightplans.cbegin(); }
         const_iterator cend() const { return flightplans.cend(); }
 
-        UKControllerPlugin::Flightplan::StoredFlightplan & GetFlightplanForCallsign(std::string callsign) const;
-        bool HasFlightplanForCallsign(std::string callsign) const;
+        size_t CountPlans(void) const;
+        int GetCallsignId(const std::string & callsign) const;
+        UKControllerPlugin::Flightplan::StoredFlightplan & GetFlightplanById(int callsignId) const;
+        UKControllerPlugin::Flightplan::StoredFlightplan & GetFlightplanForCallsign(
+            const std::string & callsign
+        ) const;
+        bool HasFlightplanForCallsign(const std::string & callsign) const;
         void RemoveTimedOutPlans(void);
-        void RemovePlanByCallsign(std::string callsign);
+        void RemovePlanByCallsign(const std::string & callsign);
+        void SetPlanTimeout(const std::string & callsign, int offset);
+        UKControllerPlugin::Flightplan::StoredFlightplan & UpdatePlan(
+            const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightplan
+        );
         void UpdatePlan(StoredFlightplan flightplan);
 
+        // The id returned when there is no flightplan for a callsign
+        static const int noCallsignId = -1;
+
+        // The number of flightplans in each slab
+        static const size_t slabSize = 128;
+
     private:
 
-        // Storage for the flightplans - plus iterators
+        // A flightplan timeout in the heap
+        typedef struct PlanTimeout {
+            std::time_t expiry;
+            int callsignId;
+
+            bool operator>(const PlanTimeout & compare) const
+            {
+                return this->expiry > compare.expiry;
+            }
+        } PlanTimeout;
+
+        void AddTimeout(int callsignId);
+        int AllocateCallsignId(void);
+        std::optional<UKControllerPlugin::Flightplan::StoredFlightplan> & GetRecord(int callsignId) const;
+        UKControllerPlugin::Flightplan::StoredFlightplan & IndexPlan(const std::string & callsign, int callsignId);
+        void RemovePlan(FlightplanMap::iterator plan);
+
+        // Slabs of flightplan records, indexed by callsign id
+        std::vector<std::unique_ptr<std::optional<UKControllerPlugin::Flightplan::StoredFlightplan>[]>> slabs;
+
+        // Callsign ids that are free to be reused
+        std::vector<int> freeCallsignIds;
+
+        // The next callsign id that has never been used
+        int nextCallsignId = 0;
+
+        // Callsign ids by callsign
+        std::unordered_map<std::string, int> callsignIds;
+
+        // The stored flightplans, ordered by callsign
         FlightplanMap flightplans;
+
+        // Flightplan timeouts, soonest first
+        std::priority_queue<PlanTimeout, std::vector<PlanTimeout>, std::greater<PlanTimeout>> timeouts;
 };
 
 }  // namespace Flightplan
@@ -32,10 +32,8 @@ namespace UKControllerPlugin {
             EuroScopeCFlightPlanInterface & euroscopeFlightplan,
             EuroScopeCRadarTargetInterface & radarTarget
         ) {
-            this->storedFlightplans.UpdatePlan(StoredFlightplan(euroscopeFlightplan));
-
-            // Reset anything to do with timeout.
-            this->storedFlightplans.GetFlightplanForCallsign(euroscopeFlightplan.GetCallsign()).ResetTimeout();
+            // Update in place and reset anything to do with timeout.
+            this->storedFlightplans.UpdatePlan(euroscopeFlightplan).ResetTimeout();
         }
 
         /*
@@ -44,13 +42,7 @@ namespace UKControllerPlugin {
         void StoredFlightplanEventHandler::FlightPlanDisconnectEvent(
             EuroScopeCFlightPlanInterface & euroscopeFlightplan
         ) {
-            if (!this->storedFlightplans.HasFlightplanForCallsign(euroscopeFlightplan.GetCallsign())) {
-                return;
-            }
-
-            this->storedFlightplans.GetFlightplanForCallsign(
-                euroscopeFlightplan.GetCallsign()
-            ).SetTimeout(this->flightplanTimeout);
+            this->storedFlightplans.SetPlanTimeout(euroscopeFlightplan.GetCallsign(), this->flightplanTimeout);
         }
 
         /*
@@ -0,0 +1,383 @@
+#include "pch/stdafx.h"
+#include "flightplan/StoredFlightplanJournal.h"
+#include "flightplan/StoredFlightplan.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+#include "euroscope/EuroScopeCRadarTargetInterface.h"
+#include "windows/WinApiInterface.h"
+
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+using UKControllerPlugin::Windows::WinApiInterface;
+
+namespace UKControllerPlugin {
+    namespace Flightplan {
+
+        const std::string StoredFlightplanJournal::journalFile = "flightplans/journal.bin";
+        const std::string StoredFlightplanJournal::snapshotFiles[2] = {
+            "flightplans/snapshot-0.bin",
+            "flightplans/snapshot-1.bin"
+        };
+        const std::string StoredFlightplanJournal::temporaryFileSuffix = ".tmp";
+        const std::string StoredFlightplanJournal::journalHeader = "UKFJ";
+        const std::string StoredFlightplanJournal::snapshotHeader = "UKFS";
+
+        StoredFlightplanJournal::StoredFlightplanJournal(
+            WinApiInterface & winApi,
+            StoredFlightplanCollection & storedFlightplans
+        ) : winApi(winApi), storedFlightplans(storedFlightplans)
+        {
+
+        }
+
+        /*
+            Writes every stored flightplan into a new snapshot and starts a fresh journal on top of it.
+            The snapshot is written before the journal is reset, so if we crash in between, the old
+            snapshot and journal are still intact. If the snapshot can't be put in place, the journal
+            is left alone and we try again next time.
+        */
+        void StoredFlightplanJournal::Compact(void)
+        {
+            const long long nextGeneration = this->generation + 1;
+            std::map<std::string, std::string> records;
+
+            std::string snapshot = this->snapshotHeader + this->EncodeInteger(nextGeneration);
+            for (
+                StoredFlightplanCollection::const_iterator it = this->storedFlightplans.cbegin();
+                it != this->storedFlightplans.cend();
+                ++it
+            ) {
+                std::string record = this->EncodePlan(*it->second);
+                snapshot += record;
+                records[it->first] = std::move(record);
+            }
+            snapshot += this->snapshotHeader;
+
+            if (!this->ReplaceFile(this->snapshotFiles[nextGeneration % 2], snapshot)) {
+                LogError("Failed to write stored flightplan snapshot " + std::to_string(nextGeneration));
+                return;
+            }
+
+            this->generation = nextGeneration;
+            this->journaledRecords = std::move(records);
+            this->changedCallsigns.clear();
+
+            // Anything appended to the old journal would be ignored on load, so compact again next time
+            if (!this->ReplaceFile(this->journalFile, this->journalHeader + this->EncodeInteger(this->generation))) {
+                LogError("Failed to start a new stored flightplan journal");
+                this->journalRecordCount = this->compactionThreshold;
+                return;
+            }
+
+            this->journalRecordCount = 0;
+        }
+
+        /*
+            A controller has changed something on the flightplan, so it may need journaling.
+        */
+        void StoredFlightplanJournal::ControllerFlightPlanDataEvent(
+            EuroScopeCFlightPlanInterface & flightPlan,
+            int dataType
+        ) {
+            this->changedCallsigns.insert(flightPlan.GetCallsign());
+        }
+
+        /*
+            Encodes an integer as 8 bytes, little endian.
+        */
+        std::string StoredFlightplanJournal::EncodeInteger(long long value)
+        {
+            std::string encoded(8, '\0');
+            unsigned long long bits = static_cast<unsigned long long>(value);
+            for (int i = 0; i < 8; i++) {
+                encoded[i] = static_cast<char>((bits >> (i * 8)) & 0xFF);
+            }
+
+            return encoded;
+        }
+
+        /*
+            Encodes the full state of a flightplan as a record.
+        */
+        std::string StoredFlightplanJournal::EncodePlan(const StoredFlightplan & plan)
+        {
+            return std::string(1, static_cast<char>(StoredFlightplanJournal::planRecord)) +
+                EncodeString(plan.GetCallsign()) +
+                EncodeString(plan.GetOrigin()) +
+                EncodeString(plan.GetDestination()) +
+                EncodeString(plan.GetPreviouslyAssignedSquawk()) +
+                EncodeInteger(plan.GetTimeout()) +
+                EncodeInteger(plan.GetExpectedOffBlockTime().time_since_epoch().count()) +
+                EncodeInteger(plan.GetEstimatedDepartureTime().time_since_epoch().count()) +
+                EncodeInteger(plan.GetActualOffBlockTime().time_since_epoch().count());
+        }
+
+        /*
+            Encodes the removal of a flightplan as a record.
+        */
+        std::string StoredFlightplanJournal::EncodeRemoval(const std::string & callsign)
+        {
+            return std::string(1, static_cast<char>(StoredFlightplanJournal::removalRecord)) +
+                EncodeString(callsign);
+        }
+
+        /*
+            Encodes a string, prefixed by its length. None of the strings we store come anywhere near
+            the 255 character limit.
+        */
+        std::string StoredFlightplanJournal::EncodeString(const std::string & value)
+        {
+            std::string truncated = value.substr(0, 255);
+            return std::string(1, static_cast<char>(truncated.size())) + truncated;
+        }
+
+        void StoredFlightplanJournal::FlightPlanEvent(
+            EuroScopeCFlightPlanInterface & flightPlan,
+            EuroScopeCRadarTargetInterface & radarTarget
+        ) {
+            this->changedCallsigns.insert(flightPlan.GetCallsign());
+        }
+
+        void StoredFlightplanJournal::FlightPlanDisconnectEvent(EuroScopeCFlightPlanInterface & flightPlan)
+        {
+            this->changedCallsigns.insert(flightPlan.GetCallsign());
+        }
+
+        /*
+            Returns the number of records written to the journal since the last snapshot.
+        */
+        size_t StoredFlightplanJournal::GetJournalRecordCount(void) const
+        {
+            return this->journalRecordCount;
+        }
+
+        /*
+            Restores the stored flightplans from the most recent complete snapshot and the journal that
+            follows it, then compacts them into a fresh snapshot. Restored flightplans that don't have
+            a timeout are given one, so that they're removed if EuroScope doesn't tell us they're still
+            around. Returns the number of flightplans restored.
+        */
+        size_t StoredFlightplanJournal::Load(void)
+        {
+            std::string snapshots[2];
+            long long generations[2] = { 0, 0 };
+            int newestSnapshot = -1;
+            for (int slot = 0; slot < 2; slot++) {
+                snapshots[slot] = this->winApi.ReadFromBinaryFile(this->snapshotFiles[slot]);
+                if (
+                    this->ReadSnapshotGeneration(snapshots[slot], generations[slot]) &&
+                    (newestSnapshot == -1 || generations[slot] > generations[newestSnapshot])
+                ) {
+                    newestSnapshot = slot;
+                }
+            }
+
+            if (newestSnapshot != -1) {
+                this->generation = generations[newestSnapshot];
+                const std::string & snapshot = snapshots[newestSnapshot];
+                this->ReadRecords(
+                    snapshot.substr(0, snapshot.size() - this->snapshotHeader.size()),
+                    this->snapshotHeader.size() + 8
+                );
+            }
+
+            std::string journal = this->winApi.ReadFromBinaryFile(this->journalFile);
+            size_t position = this->journalHeader.size();
+            long long journalGeneration;
+            if (
+                journal.compare(0, this->journalHeader.size(), this->journalHeader) == 0 &&
+                this->ReadInteger(journal, position, journalGeneration) &&
+                journalGeneration == this->generation
+            ) {
+                this->ReadRecords(journal, position);
+            }
+
+            for (
+                StoredFlightplanCollection::const_iterator it = this->storedFlightplans.cbegin();
+                it != this->storedFlightplans.cend();
+                ++it
+            ) {
+                if (it->second->GetTimeout() == it->second->defaultTime) {
+                    this->storedFlightplans.SetPlanTimeout(it->first, this->restoredPlanTimeout);
+                }
+            }
+            this->storedFlightplans.RemoveTimedOutPlans();
+
+            size_t restored = this->storedFlightplans.CountPlans();
+            LogInfo("Restored " + std::to_string(restored) + " stored flightplans from disk");
+            this->Compact();
+            return restored;
+        }
+
+        /*
+            Reads a single byte.
+        */
+        bool StoredFlightplanJournal::ReadByte(const std::string & data, size_t & position, unsigned char & value)
+        {
+            if (position + 1 > data.size()) {
+                return false;
+            }
+
+            value = static_cast<unsigned char>(data[position++]);
+            return true;
+        }
+
+        /*
+            Reads an integer encoded by EncodeInteger.
+        */
+        bool StoredFlightplanJournal::ReadInteger(const std::string & data, size_t & position, long long & value)
+        {
+            if (position + 8 > data.size()) {
+                return false;
+            }
+
+            unsigned long long bits = 0;
+            for (int i = 0; i < 8; i++) {
+                bits |= static_cast<unsigned long long>(static_cast<unsigned char>(data[position + i])) << (i * 8);
+            }
+
+            position += 8;
+            value = static_cast<long long>(bits);
+            return true;
+        }
+
+        /*
+            Applies the records from the given position onwards to the stored flightplans. Stops at the first
+            record that's incomplete, which is what's left if we crashed part way through writing it.
+            Returns the number of records applied.
+        */
+        size_t StoredFlightplanJournal::ReadRecords(const std::string & records, size_t position)
+        {
+            size_t applied = 0;
+            unsigned char type;
+            std::string callsign;
+            while (this->ReadByte(records, position, type) && this->ReadString(records, position, callsign)) {
+                if (type == this->removalRecord) {
+                    this->storedFlightplans.RemovePlanByCallsign(callsign);
+                    applied++;
+                    continue;
+                }
+
+                std::string origin;
+                std::string destination;
+                std::string squawk;
+                long long timeout;
+                long long expectedOffBlockTime;
+                long long estimatedDepartureTime;
+                long long actualOffBlockTime;
+                if (
+                    type != this->planRecord ||
+                    !this->ReadString(records, position, origin) ||
+                    !this->ReadString(records, position, destination) ||
+                    !this->ReadString(records, position, squawk) ||
+                    !this->ReadInteger(records, position, timeout) ||
+                    !this->ReadInteger(records, position, expectedOffBlockTime) ||
+                    !this->ReadInteger(records, position, estimatedDepartureTime) ||
+                    !this->ReadInteger(records, position, actualOffBlockTime)
+                ) {
+                    LogWarning("Stopped reading stored flightplans at an incomplete record for " + callsign);
+                    break;
+                }
+
+                StoredFlightplan plan(callsign, origin, destination);
+                plan.SetPreviouslyAssignedSquawk(squawk);
+                plan.SetExpectedOffBlockTime(
+                    std::chrono::system_clock::time_point(std::chrono::system_clock::duration(expectedOffBlockTime))
+                );
+                plan.SetEstimatedDepartureTime(
+                    std::chrono::system_clock::time_point(std::chrono::system_clock::duration(estimatedDepartureTime))
+                );
+                plan.SetActualOffBlockTime(
+                    std::chrono::system_clock::time_point(std::chrono::system_clock::duration(actualOffBlockTime))
+                );
+                if (timeout != plan.defaultTime) {
+                    plan.SetTimeout(static_cast<int>(timeout - time(0)));
+                }
+
+                this->storedFlightplans.UpdatePlan(plan);
+                applied++;
+            }
+
+            return applied;
+        }
+
+        /*
+            Checks that a snapshot was written in full and, if so, reads its generation.
+        */
+        bool StoredFlightplanJournal::ReadSnapshotGeneration(const std::string & data, long long & generation)
+        {
+            size_t position = snapshotHeader.size();
+            return data.size() >= snapshotHeader.size() * 2 + 8 &&
+                data.compare(0, snapshotHeader.size(), snapshotHeader) == 0 &&
+                data.compare(data.size() - snapshotHeader.size(), snapshotHeader.size(), snapshotHeader) == 0 &&
+                ReadInteger(data, position, generation);
+        }
+
+        /*
+            Writes a file to a temporary file alongside it, then moves it into place. Returns false if
+            the move failed, in which case the original file is untouched.
+        */
+        bool StoredFlightplanJournal::ReplaceFile(const std::string & filename, const std::string & data)
+        {
+            const std::string temporaryFile = filename + this->temporaryFileSuffix;
+            this->winApi.WriteToBinaryFile(temporaryFile, data, true);
+            return this->winApi.MoveGivenFile(temporaryFile, filename);
+        }
+
+        /*
+            Reads a string encoded by EncodeString.
+        */
+        bool StoredFlightplanJournal::ReadString(const std::string & data, size_t & position, std::string & value)
+        {
+            unsigned char length;
+            if (!ReadByte(data, position, length) || position + length > data.size()) {
+                return false;
+            }
+
+            value = data.substr(position, length);
+            position += length;
+            return true;
+        }
+
+        /*
+            Appends a record to the journal for every flightplan that has changed since it was last journaled,
+            and compacts the journal if it's got too long.
+        */
+        void StoredFlightplanJournal::TimedEventTrigger(void)
+        {
+            std::string records;
+            for (std::set<std::string>::const_iterator it = this->changedCallsigns.cbegin();
+                it != this->changedCallsigns.cend();
+                ++it
+            ) {
+                std::map<std::string, std::string>::iterator journaled = this->journaledRecords.find(*it);
+                if (!this->storedFlightplans.HasFlightplanForCallsign(*it)) {
+                    if (journaled != this->journaledRecords.end()) {
+                        records += this->EncodeRemoval(*it);
+                        this->journaledRecords.erase(journaled);
+                        this->journalRecordCount++;
+                    }
+                    continue;
+                }
+
+                std::string record = this->EncodePlan(this->storedFlightplans.GetFlightplanForCallsign(*it));
+                if (journaled != this->journaledRecords.end() && journaled->second == record) {
+                    continue;
+                }
+
+                records += record;
+                this->journaledRecords[*it] = std::move(record);
+                this->journalRecordCount++;
+            }
+            this->changedCallsigns.clear();
+
+            if (!records.empty()) {
+                this->winApi.WriteToBinaryFile(this->journalFile, records, false);
+            }
+
+            if (this->journalRecordCount >= this->compactionThreshold) {
+                this->Compact();
+            }
+        }
+    }  // namespace Flightplan
+}  // namespace UKControllerPlugin
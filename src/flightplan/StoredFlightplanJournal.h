@@ -0,0 +1,117 @@
+#pragma once
+#include "timedevent/AbstractTimedEvent.h"
+#include "flightplan/FlightPlanEventHandlerInterface.h"
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Euroscope {
+        class EuroScopeCFlightPlanInterface;
+        class EuroScopeCRadarTargetInterface;
+    }  // namespace Euroscope
+    namespace Flightplan {
+        class StoredFlightplan;
+        class StoredFlightplanCollection;
+    }  // namespace Flightplan
+    namespace Windows {
+        class WinApiInterface;
+    }  // namespace Windows
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace Flightplan {
+
+        /*
+            Keeps a copy of the stored flightplans on disk, so that things like previously assigned squawks
+            survive EuroScope or the plugin being restarted.
+
+            Changes are appended to a journal every time the timed event triggers. Once the journal gets
+            long enough, it is compacted into a binary snapshot. Snapshots alternate between two files and
+            carry a generation number, so that a snapshot that was only partly written is ignored in favour
+            of the previous one. The journal records which generation it follows on from, so it's only
+            replayed on top of the snapshot it was written against. Snapshots and fresh journals are written
+            to a temporary file and moved into place, so a crash mid-write never leaves a torn file behind.
+        */
+        class StoredFlightplanJournal : public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface,
+            public UKControllerPlugin::TimedEvent::AbstractTimedEvent
+        {
+            public:
+                StoredFlightplanJournal(
+                    UKControllerPlugin::Windows::WinApiInterface & winApi,
+                    UKControllerPlugin::Flightplan::StoredFlightplanCollection & storedFlightplans
+                );
+                void Compact(void);
+                void ControllerFlightPlanDataEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    int dataType
+                );
+                void FlightPlanEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+                );
+                void FlightPlanDisconnectEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
+                );
+                size_t GetJournalRecordCount(void) const;
+                size_t Load(void);
+                void TimedEventTrigger(void);
+
+                // The journal file
+                static const std::string journalFile;
+
+                // The two snapshot files
+                static const std::string snapshotFiles[2];
+
+                // Added to a file name whilst the file is being written
+                static const std::string temporaryFileSuffix;
+
+                // How many journal records are allowed before compacting into a snapshot
+                static const size_t compactionThreshold = 1000;
+
+                // The timeout to give restored flightplans, until EuroScope tells us they're still connected
+                static const int restoredPlanTimeout = 600;
+
+                // How often the timed event should be triggered
+                static const int timedEventFrequency = 10;
+
+            private:
+
+                static std::string EncodeInteger(long long value);
+                static std::string EncodePlan(const UKControllerPlugin::Flightplan::StoredFlightplan & plan);
+                static std::string EncodeRemoval(const std::string & callsign);
+                static std::string EncodeString(const std::string & value);
+                static bool ReadByte(const std::string & data, size_t & position, unsigned char & value);
+                static bool ReadInteger(const std::string & data, size_t & position, long long & value);
+                size_t ReadRecords(const std::string & records, size_t position);
+                static bool ReadString(const std::string & data, size_t & position, std::string & value);
+                static bool ReadSnapshotGeneration(const std::string & data, long long & generation);
+                bool ReplaceFile(const std::string & filename, const std::string & data);
+
+                // For reading and writing the files
+                UKControllerPlugin::Windows::WinApiInterface & winApi;
+
+                // The flightplans being journaled
+                UKControllerPlugin::Flightplan::StoredFlightplanCollection & storedFlightplans;
+
+                // Callsigns that may have changed since the last time the journal was written
+                std::set<std::string> changedCallsigns;
+
+                // The most recently journaled record for each callsign
+                std::map<std::string, std::string> journaledRecords;
+
+                // The number of records in the journal since the last snapshot
+                size_t journalRecordCount = 0;
+
+                // The generation of the most recent snapshot
+                long long generation = 0;
+
+                // File headers
+                static const std::string journalHeader;
+                static const std::string snapshotHeader;
+
+                // Record types
+                static const unsigned char planRecord = 1;
+                static const unsigned char removalRecord = 2;
+        };
+    }  // namespace Flightplan
+}  // namespace UKControllerPlugin
@@ -80,5 +80,28 @@ namespace UKControllerPlugin {
 
             return "H" + hold->GetHoldParameters().fix;
         }
+
+        /*
+            Write the hold that the aircraft is in into the tag item, prefixed with H.
+        */
+        bool HoldEventHandler::WriteTagItemData(
+            EuroScopeCFlightPlanInterface & flightPlan,
+            EuroScopeCRadarTargetInterface & radarTarget,
+            char itemData[16]
+        ) {
+            ManagedHold * const hold = this->holdManager.GetAircraftHold(flightPlan.GetCallsign());
+            if (!hold) {
+                return this->CopyItemData(this->noHold, itemData);
+            }
+
+            const std::string & fix = hold->GetHoldParameters().fix;
+            if (fix.size() > this->itemDataSize - 2) {
+                return false;
+            }
+
+            itemData[0] = 'H';
+            memcpy(itemData + 1, fix.c_str(), fix.size() + 1);
+            return true;
+        }
     }  // namespace Hold
 }  // namespace UKControllerPlugin
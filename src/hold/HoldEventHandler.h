@@ -3,7 +3,7 @@
 #include "flightplan/FlightPlanEventHandlerInterface.h"
 #include "radarscreen/ConfigurableDisplayInterface.h"
 #include "command/CommandHandlerInterface.h"
-#include "tag/TagItemInterface.h"
+#include "tag/TagItemWriterInterface.h"
 
 namespace UKControllerPlugin {
     namespace Euroscope {
@@ -23,7 +23,7 @@ namespace UKControllerPlugin {
         */
         class HoldEventHandler : public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface,
             public UKControllerPlugin::TimedEvent::AbstractTimedEvent,
-            public UKControllerPlugin::Tag::TagItemInterface
+            public UKControllerPlugin::Tag::TagItemWriterInterface
         {
             public:
                 // Inherited via FlightPlanEventHandlerInterface
@@ -47,12 +47,17 @@ namespace UKControllerPlugin {
                 // Inherited via AbstractTimedEvent
                 void TimedEventTrigger(void) override;
 
-                // Inherited via TagItemInterface
+                // Inherited via TagItemWriterInterface
                 std::string GetTagItemDescription(void) const override;
                 std::string GetTagItemData(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
                     UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
                 ) override;
+                bool WriteTagItemData(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+                    char itemData[16]
+                ) override;
 
 
                 // The string to display when an aircraft is not holding
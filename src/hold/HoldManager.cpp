@@ -3,16 +3,25 @@
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
 #include "euroscope/EuroscopePluginLoopbackInterface.h"
+#include "tag/TagItemCache.h"
 #include "HoldManager.h"
 
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
+using UKControllerPlugin::Tag::TagItemCache;
 
 namespace UKControllerPlugin {
     namespace Hold {
 
         HoldManager::HoldManager()
+            : tagItemCache(nullptr)
+        {
+
+        }
+
+        HoldManager::HoldManager(TagItemCache & tagItemCache)
+            : tagItemCache(&tagItemCache)
         {
 
         }
@@ -64,6 +73,10 @@ namespace UKControllerPlugin {
                 }
             );
             this->holdingAircraft[flightplan.GetCallsign()] = managedHold->first;
+
+            if (this->tagItemCache != nullptr) {
+                this->tagItemCache->InvalidateAircraft(flightplan.GetCallsign());
+            }
         }
 
         /*
@@ -112,6 +125,10 @@ namespace UKControllerPlugin {
 
             this->holdData[aircraft->second]->RemoveHoldingAircraft(aircraft->first);
             this->holdingAircraft.erase(aircraft);
+
+            if (this->tagItemCache != nullptr) {
+                this->tagItemCache->InvalidateAircraft(callsign);
+            }
         }
 
         /*
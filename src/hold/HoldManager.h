@@ -12,6 +12,9 @@ namespace UKControllerPlugin {
         class EuroScopeCFlightPlanInterface;
         class EuroScopeCRadarTargetInterface;
     }  // namespace Euroscope
+    namespace Tag {
+        class TagItemCache;
+    }  // namespace Tag
 }  // namespace UKControllerPlugin
 
 namespace UKControllerPlugin {
@@ -25,6 +28,7 @@ namespace UKControllerPlugin {
             public:
 
                 HoldManager(void);
+                explicit HoldManager(UKControllerPlugin::Tag::TagItemCache & tagItemCache);
                 void AddHold(UKControllerPlugin::Hold::ManagedHold hold);
                 void AddAircraftToHold(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightplan,
@@ -44,6 +48,9 @@ namespace UKControllerPlugin {
 
             private:
 
+                // Cached tag items to invalidate when an aircraft enters or leaves a hold, may be null
+                UKControllerPlugin::Tag::TagItemCache * const tagItemCache;
+
                 // A map of aircraft callsign -> hold id
                 std::map<std::string, unsigned int> holdingAircraft;
 
@@ -13,7 +13,7 @@ namespace UKControllerPlugin {
         */
         std::unique_ptr<HoldManager> CreateHoldManager(nlohmann::json data, const PersistenceContainer & container)
         {
-            std::unique_ptr<HoldManager> holdManager = std::make_unique<HoldManager>();
+            std::unique_ptr<HoldManager> holdManager = std::make_unique<HoldManager>(container.tagHandler->GetCache());
 
             // If not object, nothing to do
             if (!data.is_array()) {
@@ -163,7 +163,7 @@ namespace UKControllerPlugin {
 
             container.flightplanHandler->RegisterHandler(eventHandler);
             container.timedHandler->RegisterEvent(eventHandler, timedEventFrequency);
-            container.tagHandler->RegisterTagItem(selectedHoldTagItemId, eventHandler);
+            container.tagHandler->RegisterCachedTagItem(selectedHoldTagItemId, eventHandler);
 
             // If there aren't any holds, tell the user this explicitly
             if (container.holdManager->CountHolds() == 0) {
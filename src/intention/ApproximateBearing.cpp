@@ -0,0 +1,42 @@
+#include "pch/stdafx.h"
+#include "intention/ApproximateBearing.h"
+
+namespace UKControllerPlugin {
+    namespace IntentionCode {
+
+        /*
+            Returns an approximation of the initial great-circle bearing from one position to another,
+            in degrees from 0 to 360.
+
+            This is the usual great-circle bearing formula with the difference in longitude treated as
+            small (sin x = x, cos x = 1 - x^2 / 2), which saves most of the trigonometry. For the legs
+            between consecutive route points, it is within half a degree of the true bearing.
+        */
+        double ApproximateBearing(const EuroScopePlugIn::CPosition & from, const EuroScopePlugIn::CPosition & to)
+        {
+            const double degreesToRadians = 0.017453292519943295;
+            const double radiansToDegrees = 57.29577951308232;
+
+            double fromLatitude = from.m_Latitude * degreesToRadians;
+            double toLatitude = to.m_Latitude * degreesToRadians;
+            double longitudeDifference = to.m_Longitude - from.m_Longitude;
+
+            // Take the short way round the antimeridian
+            if (longitudeDifference > 180.0) {
+                longitudeDifference -= 360.0;
+            } else if (longitudeDifference < -180.0) {
+                longitudeDifference += 360.0;
+            }
+            longitudeDifference *= degreesToRadians;
+
+            double cosToLatitude = std::cos(toLatitude);
+            double bearing = std::atan2(
+                longitudeDifference * cosToLatitude,
+                (toLatitude - fromLatitude) +
+                    std::sin(fromLatitude) * cosToLatitude * longitudeDifference * longitudeDifference / 2.0
+            ) * radiansToDegrees;
+
+            return bearing < 0.0 ? bearing + 360.0 : bearing;
+        }
+    }  // namespace IntentionCode
+}  // namespace UKControllerPlugin
@@ -0,0 +1,10 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace IntentionCode {
+        double ApproximateBearing(
+            const EuroScopePlugIn::CPosition & from,
+            const EuroScopePlugIn::CPosition & to
+        );
+    }  // namespace IntentionCode
+}  // namespace UKControllerPlugin
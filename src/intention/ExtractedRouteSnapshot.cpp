@@ -0,0 +1,105 @@
+#include "pch/stdafx.h"
+#include "intention/ExtractedRouteSnapshot.h"
+
+using UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface;
+
+namespace UKControllerPlugin {
+    namespace IntentionCode {
+
+        /*
+            An empty route, for when the route isn't needed.
+        */
+        ExtractedRouteSnapshot::ExtractedRouteSnapshot(void)
+            : EuroscopeExtractedRouteInterface(EuroScopePlugIn::CFlightPlanExtractedRoute()),
+            assignedIndex(noDirect), calculatedIndex(-1)
+        {
+
+        }
+
+        /*
+            Copy everything we need from the route.
+        */
+        ExtractedRouteSnapshot::ExtractedRouteSnapshot(EuroscopeExtractedRouteInterface & route)
+            : EuroscopeExtractedRouteInterface(EuroScopePlugIn::CFlightPlanExtractedRoute()),
+            assignedIndex(route.GetPointsAssignedIndex()), calculatedIndex(route.GetPointsCalculatedIndex())
+        {
+            const int pointsNumber = route.GetPointsNumber();
+            this->pointNames.reserve(pointsNumber);
+            this->pointPositions.reserve(pointsNumber);
+            this->pointDistances.reserve(pointsNumber);
+
+            for (int i = 0; i < pointsNumber; i++) {
+                this->pointNames.push_back(route.GetPointName(i));
+                this->pointPositions.push_back(route.GetPointPosition(i));
+                this->pointDistances.push_back(route.GetPointDistanceInMinutes(i));
+            }
+        }
+
+        /*
+            Copy the name of every point, but only copy the position and time for the points that need
+            the detail, along with the position of the point after each. The other points are given
+            a default position and a time of zero.
+        */
+        ExtractedRouteSnapshot::ExtractedRouteSnapshot(
+            EuroscopeExtractedRouteInterface & route,
+            const std::function<bool(const char *)> & pointNeedsDetail
+        )
+            : EuroscopeExtractedRouteInterface(EuroScopePlugIn::CFlightPlanExtractedRoute()),
+            assignedIndex(route.GetPointsAssignedIndex()), calculatedIndex(route.GetPointsCalculatedIndex())
+        {
+            const int pointsNumber = route.GetPointsNumber();
+            this->pointNames.reserve(pointsNumber);
+            this->pointPositions.resize(pointsNumber);
+            this->pointDistances.resize(pointsNumber, 0);
+
+            for (int i = 0; i < pointsNumber; i++) {
+                const char * pointName = route.GetPointName(i);
+                this->pointNames.push_back(pointName);
+                if (!pointNeedsDetail(pointName)) {
+                    continue;
+                }
+
+                this->pointPositions[i] = route.GetPointPosition(i);
+                this->pointDistances[i] = route.GetPointDistanceInMinutes(i);
+                if (i + 1 < pointsNumber) {
+                    this->pointPositions[i + 1] = route.GetPointPosition(i + 1);
+                }
+            }
+        }
+
+        int ExtractedRouteSnapshot::GetPointDistanceInMinutes(int index)
+        {
+            return this->IndexValid(index) ? this->pointDistances[index] : this->pointPassed;
+        }
+
+        int ExtractedRouteSnapshot::GetPointsAssignedIndex(void)
+        {
+            return this->assignedIndex;
+        }
+
+        int ExtractedRouteSnapshot::GetPointsCalculatedIndex(void)
+        {
+            return this->calculatedIndex;
+        }
+
+        int ExtractedRouteSnapshot::GetPointsNumber(void)
+        {
+            return static_cast<int>(this->pointNames.size());
+        }
+
+        const char * ExtractedRouteSnapshot::GetPointName(int index)
+        {
+            return this->IndexValid(index) ? this->pointNames[index].c_str() : "";
+        }
+
+        EuroScopePlugIn::CPosition ExtractedRouteSnapshot::GetPointPosition(int index)
+        {
+            return this->IndexValid(index) ? this->pointPositions[index] : EuroScopePlugIn::CPosition();
+        }
+
+        bool ExtractedRouteSnapshot::IndexValid(int index) const
+        {
+            return index >= 0 && index < static_cast<int>(this->pointNames.size());
+        }
+    }  // namespace IntentionCode
+}  // namespace UKControllerPlugin
@@ -0,0 +1,49 @@
+#pragma once
+#include "euroscope/EuroscopeExtractedRouteInterface.h"
+
+namespace UKControllerPlugin {
+    namespace IntentionCode {
+
+        /*
+            A copy of an extracted route, taken on the EuroScope thread, so that the route
+            can be used to generate intention codes on another thread without calling back into
+            EuroScope.
+        */
+        class ExtractedRouteSnapshot : public UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface
+        {
+            public:
+                ExtractedRouteSnapshot(void);
+                explicit ExtractedRouteSnapshot(
+                    UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route
+                );
+                ExtractedRouteSnapshot(
+                    UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route,
+                    const std::function<bool(const char *)> & pointNeedsDetail
+                );
+                int GetPointDistanceInMinutes(int index) override;
+                int GetPointsAssignedIndex(void) override;
+                int GetPointsCalculatedIndex(void) override;
+                int GetPointsNumber(void) override;
+                const char * GetPointName(int index) override;
+                EuroScopePlugIn::CPosition GetPointPosition(int index) override;
+
+            private:
+                bool IndexValid(int index) const;
+
+                // The names of the points on the route
+                std::vector<std::string> pointNames;
+
+                // The position of each point
+                std::vector<EuroScopePlugIn::CPosition> pointPositions;
+
+                // The time to each point, in minutes
+                std::vector<int> pointDistances;
+
+                // The point the aircraft has been assigned direct to
+                int assignedIndex;
+
+                // The point the aircraft is closest to
+                int calculatedIndex;
+        };
+    }  // namespace IntentionCode
+}  // namespace UKControllerPlugin
@@ -3,68 +3,146 @@
 #include "euroscope/EuroscopeExtractedRouteInterface.h"
 
 using UKControllerPlugin::IntentionCode::IntentionCodeData;
+using UKControllerPlugin::IntentionCode::RouteFingerprint;
 using UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface;
 
 namespace UKControllerPlugin {
     namespace IntentionCode {
 
+        IntentionCodeCache::IntentionCodeCache(void)
+        {
+
+        }
+
         /*
             Gets an intention code for a given aircraft.
         */
-        std::string IntentionCodeCache::GetIntentionCodeForAircraft(std::string callsign) const
+        const std::string & IntentionCodeCache::GetIntentionCodeForAircraft(const std::string & callsign) const
         {
-            if (this->intentionCodeMap.count(callsign) == 0) {
-                return "--";
+            auto code = this->intentionCodeMap.find(callsign);
+            if (code == this->intentionCodeMap.cend()) {
+                return this->defaultCode;
+            }
+
+            return code->second.data.intentionCode;
+        }
+
+        /*
+            Builds a fingerprint of the route. The exit point name is only hashed if there is an exit point
+            on the route.
+        */
+        RouteFingerprint IntentionCodeCache::GetRouteFingerprint(
+            EuroscopeExtractedRouteInterface & route,
+            int exitPointIndex
+        ) const {
+            int pointsNumber = route.GetPointsNumber();
+            size_t exitPointHash = 0;
+            if (exitPointIndex >= 0 && exitPointIndex < pointsNumber) {
+                const char * exitPointName = route.GetPointName(exitPointIndex);
+                exitPointHash = std::hash<std::string>()(exitPointName == nullptr ? "" : exitPointName);
             }
 
-            return this->intentionCodeMap.at(callsign).intentionCode;
+            return RouteFingerprint(
+                pointsNumber,
+                route.GetPointsAssignedIndex(),
+                route.GetPointsCalculatedIndex(),
+                exitPointHash
+            );
+        }
+
+        /*
+            Returns true if the aircraft has a cached code that depends on an exit point, so the code
+            will need checking as the aircraft moves.
+        */
+        bool IntentionCodeCache::HasExitPointForAircraft(const std::string & callsign) const
+        {
+            auto cached = this->intentionCodeMap.find(callsign);
+            return cached != this->intentionCodeMap.cend() && cached->second.data.exitPointValid;
         }
 
         /*
             Returns true or false depending on whether we have an intention code cached.
         */
-        bool IntentionCodeCache::HasIntentionCodeForAircraft(std::string callsign) const
+        bool IntentionCodeCache::HasIntentionCodeForAircraft(const std::string & callsign) const
         {
             return this->intentionCodeMap.count(callsign) > 0;
         }
 
         /*
             Returns true if the intention code is still valid.
+
+            If the route fingerprint matches the one the code was last validated against, nothing that
+            could invalidate the code has changed and no further route inspection is required.
         */
-        bool IntentionCodeCache::IntentionCodeValid(std::string callsign, EuroscopeExtractedRouteInterface & route)
-        {
-            if (!this->HasIntentionCodeForAircraft(callsign)) {
+        bool IntentionCodeCache::IntentionCodeValid(
+            const std::string & callsign,
+            EuroscopeExtractedRouteInterface & route
+        ) {
+            auto cached = this->intentionCodeMap.find(callsign);
+            if (cached == this->intentionCodeMap.end()) {
                 return false;
             }
 
-            // If they don't have an exit point, or they're cleared direct beyond it but aren't yet close.
-            if (this->intentionCodeMap[callsign].exitPointValid == false ||
-                (route.GetPointsAssignedIndex() > this->intentionCodeMap[callsign].exitPointIndex &&
-                    route.GetPointsCalculatedIndex() <= this->intentionCodeMap[callsign].exitPointIndex)
-                ) {
+            // If they don't have an exit point, the code won't change until the flightplan does.
+            if (cached->second.data.exitPointValid == false) {
                 return true;
             }
 
-            // If they've passed their exit point, then the intention code is no longer valid.
-            if (route.GetPointDistanceInMinutes(
-                this->intentionCodeMap[callsign].exitPointIndex) == this->exitPointPassed
-            ) {
+            RouteFingerprint fingerprint = this->GetRouteFingerprint(route, cached->second.data.exitPointIndex);
+            if (fingerprint == cached->second.fingerprint) {
+                return true;
+            }
+
+            if (!this->RouteStillExits(cached->second, fingerprint, route)) {
                 return false;
             }
 
+            // Only trust the fingerprint whilst the aircraft is clearly short of the exit point
+            if (fingerprint.calculatedIndex < cached->second.data.exitPointIndex) {
+                cached->second.fingerprint = fingerprint;
+            }
+
             return true;
         }
 
+        /*
+            Does the full check of whether the aircraft is still going to use its exit point.
+        */
+        bool IntentionCodeCache::RouteStillExits(
+            const CachedIntentionCode & cached,
+            const RouteFingerprint & fingerprint,
+            EuroscopeExtractedRouteInterface & route
+        ) const {
+            const IntentionCodeData & data = cached.data;
+
+            // The exit point has moved or changed since the code was generated, so the code needs regenerating.
+            if (
+                data.exitPointIndex >= fingerprint.pointsNumber ||
+                fingerprint.exitPointHash == 0 ||
+                fingerprint.exitPointHash != data.exitPointHash
+            ) {
+                return false;
+            }
+
+            // If they're cleared direct beyond it but aren't yet close.
+            if (fingerprint.assignedIndex > data.exitPointIndex && fingerprint.calculatedIndex <= data.exitPointIndex) {
+                return true;
+            }
+
+            // If they've passed their exit point, then the intention code is no longer valid.
+            return route.GetPointDistanceInMinutes(data.exitPointIndex) != this->exitPointPassed;
+        }
+
         /*
             Registers an aircraft with the cache.
         */
-        void IntentionCodeCache::RegisterAircraft(std::string callsign, IntentionCodeData intentionCode)
+        void IntentionCodeCache::RegisterAircraft(const std::string & callsign, IntentionCodeData intentionCode)
         {
             if (this->intentionCodeMap.count(callsign) != 0) {
                 return;
             }
 
-            this->intentionCodeMap[callsign] =  intentionCode;
+            this->intentionCodeMap[callsign] = {intentionCode, RouteFingerprint()};
         }
 
         /*
@@ -78,12 +156,8 @@ namespace UKControllerPlugin {
         /*
             Unregisters an aircraft with the intention code cache.
         */
-        void IntentionCodeCache::UnregisterAircraft(std::string callsign)
+        void IntentionCodeCache::UnregisterAircraft(const std::string & callsign)
         {
-            if (this->intentionCodeMap.count(callsign) == 0) {
-                return;
-            }
-
             this->intentionCodeMap.erase(callsign);
         }
     }  // namespace IntentionCode
@@ -1,5 +1,6 @@
 #pragma once
 #include "intention/IntentionCodeData.h"
+#include "intention/RouteFingerprint.h"
 
 // Forward declare
 namespace UKControllerPlugin {
@@ -15,19 +16,28 @@ namespace UKControllerPlugin {
         /*
             A cache that maps aircraft callsign to intention code so we don't
             have to work it out every single tag call.
+
+            Each entry remembers a fingerprint of the route it was last validated against,
+            so that if nothing about the route has changed, the code can be revalidated
+            with a handful of integer comparisons.
         */
         class IntentionCodeCache
         {
             public:
+                IntentionCodeCache(void);
                 bool IntentionCodeValid(
-                    std::string callsign,
+                    const std::string & callsign,
                     UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route
                 );
-                std::string GetIntentionCodeForAircraft(std::string callsign) const;
-                bool HasIntentionCodeForAircraft(std::string callsign) const;
-                void RegisterAircraft(std::string callsign, UKControllerPlugin::IntentionCode::IntentionCodeData);
+                const std::string & GetIntentionCodeForAircraft(const std::string & callsign) const;
+                bool HasExitPointForAircraft(const std::string & callsign) const;
+                bool HasIntentionCodeForAircraft(const std::string & callsign) const;
+                void RegisterAircraft(
+                    const std::string & callsign,
+                    UKControllerPlugin::IntentionCode::IntentionCodeData
+                );
                 size_t TotalCached(void) const;
-                void UnregisterAircraft(std::string callsign);
+                void UnregisterAircraft(const std::string & callsign);
 
                 // The default intention code if we cant resolve something better
                 const std::string defaultCode = "--";
@@ -37,8 +47,24 @@ namespace UKControllerPlugin {
 
 
             private:
-                std::map<std::string, UKControllerPlugin::IntentionCode::IntentionCodeData> intentionCodeMap;
 
+                // A cached intention code, along with the route fingerprint it was last validated against.
+                typedef struct CachedIntentionCode {
+                    UKControllerPlugin::IntentionCode::IntentionCodeData data;
+                    UKControllerPlugin::IntentionCode::RouteFingerprint fingerprint;
+                } CachedIntentionCode;
+
+                UKControllerPlugin::IntentionCode::RouteFingerprint GetRouteFingerprint(
+                    UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route,
+                    int exitPointIndex
+                ) const;
+                bool RouteStillExits(
+                    const CachedIntentionCode & cached,
+                    const UKControllerPlugin::IntentionCode::RouteFingerprint & fingerprint,
+                    UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route
+                ) const;
+
+                std::unordered_map<std::string, CachedIntentionCode> intentionCodeMap;
         };
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
@@ -9,13 +9,19 @@ namespace UKControllerPlugin {
         typedef struct IntentionCodeData {
 
             IntentionCodeData(void)
-                : intentionCode("--"), exitPointIndex(-1), exitPointValid(false)
+                : intentionCode("--"), exitPointIndex(-1), exitPointValid(false), exitPointHash(0)
             {
 
             }
 
-            IntentionCodeData(std::string intentionCode, bool exitPointValid, int exitPointIndex)
-                : intentionCode(intentionCode), exitPointValid(exitPointValid), exitPointIndex(exitPointIndex)
+            IntentionCodeData(
+                std::string intentionCode,
+                bool exitPointValid,
+                int exitPointIndex,
+                size_t exitPointHash = 0
+            )
+                : intentionCode(intentionCode), exitPointValid(exitPointValid), exitPointIndex(exitPointIndex),
+                exitPointHash(exitPointHash)
             {
 
             };
@@ -28,6 +34,9 @@ namespace UKControllerPlugin {
 
             // The index on the extracted route at which the aircraft leaves the FIR
             int exitPointIndex;
+
+            // A hash of the name of the exit point the code was generated for
+            size_t exitPointHash;
         } IntentionCodeData;
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
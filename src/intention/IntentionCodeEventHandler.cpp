@@ -4,20 +4,28 @@
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
 #include "intention/IntentionCodeData.h"
 #include "euroscope/EuroscopeExtractedRouteInterface.h"
+#include "task/TaskRunnerInterface.h"
+#include "euroscope/EuroscopePluginLoopbackInterface.h"
 
 using UKControllerPlugin::IntentionCode::IntentionCodeGenerator;
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPlugin::IntentionCode::IntentionCodeCache;
 using UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface;
+using UKControllerPlugin::IntentionCode::IntentionCodePrecomputer;
+using UKControllerPlugin::TaskManager::TaskRunnerInterface;
+using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
 
 namespace UKControllerPlugin {
     namespace IntentionCode {
         IntentionCodeEventHandler::IntentionCodeEventHandler(
             IntentionCodeGenerator intention,
-            IntentionCodeCache codeCache
+            IntentionCodeCache codeCache,
+            TaskRunnerInterface & taskRunner,
+            const EuroscopePluginLoopbackInterface & plugin
         )
-            : intention(std::move(intention)), codeCache(codeCache)
+            : intention(std::move(intention)), codeCache(codeCache), precomputer(this->intention, taskRunner),
+            plugin(plugin)
         {
 
         }
@@ -33,13 +41,27 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Respond to flightplan updates - invalidate the intention code cache.
+            Move any codes that have been generated in the background into the cache.
+        */
+        void IntentionCodeEventHandler::CollectPrecomputedCodes(void)
+        {
+            this->precomputer.CollectIntentionCodes(
+                [this](const std::string & callsign, const IntentionCodeData & data) {
+                    this->codeCache.UnregisterAircraft(callsign);
+                    this->codeCache.RegisterAircraft(callsign, data);
+                }
+            );
+        }
+
+        /*
+            Respond to flightplan updates - start generating the new code in the background. The old code
+            stays in the cache until the new one is ready.
         */
         void IntentionCodeEventHandler::FlightPlanEvent(
             EuroScopeCFlightPlanInterface & flightPlan,
             EuroScopeCRadarTargetInterface & radarTarget
         ) {
-            this->codeCache.UnregisterAircraft(flightPlan.GetCallsign());
+            this->precomputer.SubmitAircraft(flightPlan.GetCallsign(), flightPlan);
         }
 
         /*
@@ -47,7 +69,17 @@ namespace UKControllerPlugin {
         */
         void IntentionCodeEventHandler::FlightPlanDisconnectEvent(EuroScopeCFlightPlanInterface & flightPlan)
         {
-            this->codeCache.UnregisterAircraft(flightPlan.GetCallsign());
+            const std::string callsign = flightPlan.GetCallsign();
+            this->codeCache.UnregisterAircraft(callsign);
+            this->precomputer.RemoveAircraft(callsign);
+        }
+
+        /*
+            Returns the background code generator.
+        */
+        const IntentionCodePrecomputer & IntentionCodeEventHandler::GetPrecomputer(void) const
+        {
+            return this->precomputer;
         }
 
         /*
@@ -65,26 +97,65 @@ namespace UKControllerPlugin {
             EuroScopeCFlightPlanInterface & flightPlan,
             EuroScopeCRadarTargetInterface & radarTarget
         ) {
-            // If we have it cached, then use the cached value
-            EuroscopeExtractedRouteInterface extractedRoute = flightPlan.GetExtractedRoute();
-            if (
-                this->codeCache.HasIntentionCodeForAircraft(flightPlan.GetCallsign()) &&
-                this->codeCache.IntentionCodeValid(flightPlan.GetCallsign(), extractedRoute)
-                ) {
-                return this->codeCache.GetIntentionCodeForAircraft(flightPlan.GetCallsign());
+            return this->GetIntentionCode(flightPlan);
+        }
+
+        /*
+            Writes the intention code straight into the tag item.
+        */
+        bool IntentionCodeEventHandler::WriteTagItemData(
+            EuroScopeCFlightPlanInterface & flightPlan,
+            EuroScopeCRadarTargetInterface & radarTarget,
+            char itemData[16]
+        ) {
+            return this->CopyItemData(this->GetIntentionCode(flightPlan), itemData);
+        }
+
+        /*
+            Returns the cached intention code for the aircraft. Nothing is generated here, if there's no
+            code yet then the tag item is left blank until the background generation has finished.
+        */
+        const std::string & IntentionCodeEventHandler::GetIntentionCode(EuroScopeCFlightPlanInterface & flightPlan)
+        {
+            if (this->precomputer.HasPrecomputedCodes()) {
+                this->CollectPrecomputedCodes();
             }
 
-            // Generate the code and then cache it
-            IntentionCodeData data = this->intention.GetIntentionCodeForFlightplan(
-                flightPlan.GetCallsign(),
-                flightPlan.GetOrigin(),
-                flightPlan.GetDestination(),
-                extractedRoute,
-                flightPlan.GetCruiseLevel()
-            );
+            const std::string callsign = flightPlan.GetCallsign();
+            if (this->codeCache.HasIntentionCodeForAircraft(callsign)) {
+                return this->codeCache.GetIntentionCodeForAircraft(callsign);
+            }
+
+            // Flightplans that were loaded before the plugin haven't had an update to submit them
+            if (!this->precomputer.HasSubmittedAircraft(callsign)) {
+                this->precomputer.SubmitAircraft(callsign, flightPlan);
+            }
+
+            return this->noCode;
+        }
 
-            this->codeCache.RegisterAircraft(flightPlan.GetCallsign(), data);
-            return data.intentionCode;
+        /*
+            If the aircraft's code depends on an exit point, check it's still valid now that the aircraft
+            has moved, and generate it again if not. The old code is shown until the new one is ready.
+        */
+        void IntentionCodeEventHandler::RadarTargetPositionUpdateEvent(EuroScopeCRadarTargetInterface & radarTarget)
+        {
+            const std::string callsign = radarTarget.GetCallsign();
+            if (!this->codeCache.HasExitPointForAircraft(callsign)) {
+                return;
+            }
+
+            std::shared_ptr<EuroScopeCFlightPlanInterface> flightPlan;
+            try {
+                flightPlan = this->plugin.GetFlightplanForCallsign(callsign);
+            } catch (std::invalid_argument) {
+                return;
+            }
+
+            EuroscopeExtractedRouteInterface extractedRoute = flightPlan->GetExtractedRoute();
+            if (!this->codeCache.IntentionCodeValid(callsign, extractedRoute)) {
+                this->precomputer.ResubmitAircraft(callsign, *flightPlan);
+            }
         }
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
@@ -1,8 +1,10 @@
 #pragma once
-#include "tag/TagItemInterface.h"
+#include "tag/TagItemWriterInterface.h"
 #include "flightplan/FlightPlanEventHandlerInterface.h"
+#include "euroscope/RadarTargetEventHandlerInterface.h"
 #include "intention/IntentionCodeGenerator.h"
 #include "intention/IntentionCodeCache.h"
+#include "intention/IntentionCodePrecomputer.h"
 
 // Forward declarations
 namespace UKControllerPlugin {
@@ -10,6 +12,12 @@ namespace UKControllerPlugin {
         class IntentionCode;
         class IntentionCodeCache;
     }  // namespace IntentionCode
+    namespace TaskManager {
+        class TaskRunnerInterface;
+    }  // namespace TaskManager
+    namespace Euroscope {
+        class EuroscopePluginLoopbackInterface;
+    }  // namespace Euroscope
 }  // namespace UKControllerPlugin
 // END
 
@@ -18,15 +26,25 @@ namespace UKControllerPlugin {
 
         /*
             A class for generating intention code tag items.
+
+            Codes are generated in the background whenever a flightplan changes, so that the tag item
+            only ever reads the cached code. Until the first code for an aircraft is ready, the tag
+            item is left blank, and when a flightplan changes the old code is shown until it is replaced.
+
+            Codes that depend on an exit point are checked as the aircraft moves, rather than whenever
+            the tag is drawn, and are generated again once the aircraft passes its exit point.
         */
         class IntentionCodeEventHandler
-            : public UKControllerPlugin::Tag::TagItemInterface,
-            public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface
+            : public UKControllerPlugin::Tag::TagItemWriterInterface,
+            public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface,
+            public UKControllerPlugin::Euroscope::RadarTargetEventHandlerInterface
         {
             public:
                 IntentionCodeEventHandler(
                     UKControllerPlugin::IntentionCode::IntentionCodeGenerator intention,
-                    UKControllerPlugin::IntentionCode::IntentionCodeCache codeCache
+                    UKControllerPlugin::IntentionCode::IntentionCodeCache codeCache,
+                    UKControllerPlugin::TaskManager::TaskRunnerInterface & taskRunner,
+                    const UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface & plugin
                 );
                 void ControllerFlightPlanDataEvent(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
@@ -39,19 +57,42 @@ namespace UKControllerPlugin {
                 void FlightPlanDisconnectEvent(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
                 );
+                const UKControllerPlugin::IntentionCode::IntentionCodePrecomputer & GetPrecomputer(void) const;
                 std::string GetTagItemDescription(void) const;
                 std::string GetTagItemData(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
                     UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
                 );
+                void RadarTargetPositionUpdateEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+                ) override;
+                bool WriteTagItemData(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+                    char itemData[16]
+                );
+
+                // Shown in the tag item until a code has been generated for the aircraft
+                const std::string noCode = "";
 
             private:
 
+                void CollectPrecomputedCodes(void);
+                const std::string & GetIntentionCode(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
+                );
+
                 // A class for generating intention codes
                 UKControllerPlugin::IntentionCode::IntentionCodeGenerator intention;
 
                 // A cache for codes that have already been generated
                 UKControllerPlugin::IntentionCode::IntentionCodeCache codeCache;
+
+                // Generates codes in the background
+                UKControllerPlugin::IntentionCode::IntentionCodePrecomputer precomputer;
+
+                // Used to find the flightplan for a radar target
+                const UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface & plugin;
         };
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
@@ -1,34 +1,120 @@
 #include "pch/stdafx.h"
 #include "intention/IntentionCodeFactory.h"
-#include "intention/AmsterdamAirfieldGroup.h"
-#include "intention/BrusselsAirfieldGroup.h"
-#include "intention/DublinAirfieldGroup.h"
-#include "intention/HomeAirfieldGroup.h"
-#include "intention/ShannonAirfieldGroup.h"
 #include "intention/IntentionCodeGenerator.h"
+#include "intention/IntentionCodeRule.h"
+#include "intention/IntentionCodeRuleTable.h"
 #include "intention/SectorExitRepository.h"
 
 using UKControllerPlugin::IntentionCode::IntentionCodeGenerator;
+using UKControllerPlugin::IntentionCode::IntentionCodeRule;
+using UKControllerPlugin::IntentionCode::IntentionCodeRuleTable;
 using UKControllerPlugin::IntentionCode::SectorExitRepository;
 
 namespace UKControllerPlugin {
     namespace IntentionCode {
 
         /*
-            Adds the airfield groups to the intention code generator.
+            Creates the intention code generator with its destination rules.
         */
-        std::unique_ptr<IntentionCodeGenerator> IntentionCodeFactory::Create(SectorExitRepository & exitPoints)
-        {
-            std::vector <std::unique_ptr<AirfieldGroup>> airfields;
-            airfields.push_back(std::unique_ptr<AirfieldGroup>(new HomeAirfieldGroup));
-            airfields.push_back(std::unique_ptr<AirfieldGroup>(new ShannonAirfieldGroup));
-            airfields.push_back(std::unique_ptr<AirfieldGroup>(new BrusselsAirfieldGroup));
-            airfields.push_back(std::unique_ptr<AirfieldGroup>(new DublinAirfieldGroup));
-            airfields.push_back(std::unique_ptr<AirfieldGroup>(new AmsterdamAirfieldGroup));
-
+        std::unique_ptr<IntentionCodeGenerator> IntentionCodeFactory::Create(
+            const nlohmann::json & rules,
+            SectorExitRepository & exitPoints
+        ) {
             return std::unique_ptr<IntentionCodeGenerator>(
-                new IntentionCodeGenerator(std::move(airfields), exitPoints)
+                new IntentionCodeGenerator(std::move(*IntentionCodeFactory::CreateRuleTable(rules)), exitPoints)
             );
         }
+
+        /*
+            Creates the destination rule table from JSON, skipping any rules that are invalid.
+        */
+        std::unique_ptr<IntentionCodeRuleTable> IntentionCodeFactory::CreateRuleTable(const nlohmann::json & rules)
+        {
+            std::vector<IntentionCodeRule> ruleList;
+
+            if (!rules.is_array()) {
+                LogWarning("Intention code rules are invalid");
+                return std::make_unique<IntentionCodeRuleTable>(std::move(ruleList));
+            }
+
+            for (nlohmann::json::const_iterator it = rules.cbegin(); it != rules.cend(); ++it) {
+                if (!IntentionCodeFactory::RuleValid(*it)) {
+                    LogWarning("Invalid intention code rule: " + it->dump());
+                    continue;
+                }
+
+                IntentionCodeRule rule;
+                if (it->find("airfields") != it->cend()) {
+                    rule.airfields = it->at("airfields").get<std::vector<std::string>>();
+                } else {
+                    rule.airfieldPrefix = it->at("airfield_prefix").get<std::string>();
+                }
+
+                rule.via = it->value("via", "");
+                rule.code = it->value("code", "");
+                rule.useAirfieldSuffix = it->value("use_airfield_suffix", false);
+                ruleList.push_back(std::move(rule));
+            }
+
+            LogInfo("Loaded " + std::to_string(ruleList.size()) + " intention code rules");
+            return std::make_unique<IntentionCodeRuleTable>(std::move(ruleList));
+        }
+
+        /*
+            A rule must apply to either a list of airfields or a prefix, may optionally have a via point,
+            and must either give a code or use the airfield suffix.
+        */
+        bool IntentionCodeFactory::RuleValid(const nlohmann::json & rule)
+        {
+            if (!rule.is_object()) {
+                return false;
+            }
+
+            bool hasAirfields = rule.find("airfields") != rule.end();
+            bool hasPrefix = rule.find("airfield_prefix") != rule.end();
+            if (hasAirfields == hasPrefix) {
+                return false;
+            }
+
+            if (hasAirfields) {
+                const nlohmann::json & airfields = rule.at("airfields");
+                if (!airfields.is_array() || airfields.empty()) {
+                    return false;
+                }
+
+                for (nlohmann::json::const_iterator it = airfields.cbegin(); it != airfields.cend(); ++it) {
+                    if (!it->is_string() || it->get<std::string>().empty()) {
+                        return false;
+                    }
+                }
+            } else if (
+                !rule.at("airfield_prefix").is_string() ||
+                rule.at("airfield_prefix").get<std::string>().empty()
+            ) {
+                return false;
+            }
+
+            if (
+                rule.find("via") != rule.end() &&
+                (!rule.at("via").is_string() || rule.at("via").get<std::string>().empty())
+            ) {
+                return false;
+            }
+
+            bool hasCode = rule.find("code") != rule.end();
+            if (rule.find("use_airfield_suffix") != rule.end()) {
+                if (!rule.at("use_airfield_suffix").is_boolean()) {
+                    return false;
+                }
+
+                if (rule.at("use_airfield_suffix").get<bool>()) {
+                    return !hasCode;
+                }
+            }
+
+            return hasCode &&
+                rule.at("code").is_string() &&
+                !rule.at("code").get<std::string>().empty();
+        }
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
@@ -4,6 +4,7 @@
 namespace UKControllerPlugin {
     namespace IntentionCode {
         class IntentionCodeGenerator;
+        class IntentionCodeRuleTable;
         class SectorExitRepository;
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
@@ -19,8 +20,11 @@ namespace UKControllerPlugin {
         {
             public:
                 static std::unique_ptr<IntentionCodeGenerator> Create(
+                    const nlohmann::json & rules,
                     UKControllerPlugin::IntentionCode::SectorExitRepository & exitPoints
                 );
+                static std::unique_ptr<IntentionCodeRuleTable> CreateRuleTable(const nlohmann::json & rules);
+                static bool RuleValid(const nlohmann::json & rule);
         };
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
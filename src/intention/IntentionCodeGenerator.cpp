@@ -1,11 +1,13 @@
 #include "pch/stdafx.h"
 #include "intention/IntentionCodeGenerator.h"
-#include "intention/AirfieldGroup.h"
 #include "euroscope/EuroscopeExtractedRouteInterface.h"
 #include "intention/SectorExitRepository.h"
 #include "intention/SectorExitPoint.h"
+#include "intention/ApproximateBearing.h"
 
 using UKControllerPlugin::IntentionCode::IntentionCodeData;
+using UKControllerPlugin::IntentionCode::ExtractedRouteSnapshot;
+using UKControllerPlugin::IntentionCode::IntentionCodeRuleTable;
 using UKControllerPlugin::IntentionCode::SectorExitPoint;
 using UKControllerPlugin::IntentionCode::SectorExitRepository;
 using UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface;
@@ -14,13 +16,13 @@ namespace UKControllerPlugin {
     namespace IntentionCode {
 
         /*
-            Set up the lists. This is hard coded for now, but may change.
+            Set up the destination rules and exit points.
         */
         IntentionCodeGenerator::IntentionCodeGenerator(
-            std::vector<std::unique_ptr<AirfieldGroup>> airfieldGroups,
+            IntentionCodeRuleTable destinationRules,
             SectorExitRepository & exitPoints
         )
-            : airfieldGroups(std::move(airfieldGroups)), exitPoints(exitPoints)
+            : destinationRules(std::move(destinationRules)), exitPoints(exitPoints)
         {
 
         }
@@ -29,22 +31,23 @@ namespace UKControllerPlugin {
             Looks through the route from start to finish for a sector exit point. Returns the index in the route where
             it may be found.
         */
-        int IntentionCodeGenerator::FindFirExitPoint(EuroscopeExtractedRouteInterface & route)
+        int IntentionCodeGenerator::FindFirExitPoint(EuroscopeExtractedRouteInterface & route) const
         {
+            const int pointsNumber = route.GetPointsNumber();
             int i = 0;
-            while (i < route.GetPointsNumber()) {
+            while (i < pointsNumber) {
 
                 // If we find an exit point, return that, subject to rules;
-                if (exitPoints.HasSectorExitPoint(route.GetPointName(i))) {
+                const SectorExitPoint * exitPoint = exitPoints.FindSectorExitPoint(route.GetPointName(i));
+                if (exitPoint != nullptr) {
 
                     // Check that they're travelling in the right direction to leave the FIR at this point.
                     if (
-                        i + 1 < route.GetPointsNumber() &&
-                        !exitPoints.GetSectorExitPoint(route.GetPointName(i))
-                            .IsCorrectOutDirection(
-                                route.GetPointPosition(i).DirectionTo(route.GetPointPosition(i + 1))
-                            )
-                        ) {
+                        i + 1 < pointsNumber &&
+                        !exitPoint->IsCorrectOutDirection(
+                            ApproximateBearing(route.GetPointPosition(i), route.GetPointPosition(i + 1))
+                        )
+                    ) {
                         i++;
                         continue;
                     }
@@ -80,33 +83,26 @@ namespace UKControllerPlugin {
             std::string destination,
             EuroscopeExtractedRouteInterface & route,
             int cruiseLevel
-        ) {
+        ) const {
             // No flightplan filed, so we'll kill this one here.
             if (source.compare("") == 0) {
                 return IntentionCodeData(this->invalidCode, false, this->invalidExitPointIndex);
             }
 
-            // Go through the airfield groups, to see if we can find a match.
-            for (
-                std::vector<std::unique_ptr<AirfieldGroup>>::const_iterator group = this->airfieldGroups.cbegin();
-                group != this->airfieldGroups.cend();
-                ++group
-            ) {
-                if ((*group)->HasAirfield(destination, route)) {
-
-                    return IntentionCodeData(
-                        (*group)->GetIntentionCodeForGroup(destination, route),
-                        false,
-                        this->invalidExitPointIndex
-                    );
-                }
+            // Check whether the destination has its own intention code.
+            std::string destinationCode;
+            if (this->destinationRules.FindIntentionCode(destination, route, destinationCode)) {
+                return IntentionCodeData(destinationCode, false, this->invalidExitPointIndex);
             }
 
             // Look for a known sector exit fix
             int exitIndex = this->FindFirExitPoint(route);
             if (exitIndex != this->invalidExitPointIndex) {
 
-                if (!this->exitPoints.HasSectorExitPoint(route.GetPointName(exitIndex))) {
+                const SectorExitPoint * exitPoint = this->exitPoints.FindSectorExitPoint(
+                    route.GetPointName(exitIndex)
+                );
+                if (exitPoint == nullptr) {
                     LogError("Discovered invalid exit point " + std::string(route.GetPointName(exitIndex)));
                     // Just return the ICAO code.
                     return IntentionCodeData(
@@ -117,10 +113,10 @@ namespace UKControllerPlugin {
                 }
 
                 return IntentionCodeData(
-                    this->exitPoints.GetSectorExitPoint(
-                        route.GetPointName(exitIndex)).GetIntentionCode(route, exitIndex, cruiseLevel),
+                    exitPoint->GetIntentionCode(route, exitIndex, cruiseLevel),
                     true,
-                    exitIndex
+                    exitIndex,
+                    std::hash<std::string>()(route.GetPointName(exitIndex))
                 );
             }
 
@@ -131,5 +127,27 @@ namespace UKControllerPlugin {
                 this->invalidExitPointIndex
             );
         }
+
+        /*
+            Returns true if the route is needed to work out the intention code, false if the origin
+            and destination alone are enough.
+        */
+        bool IntentionCodeGenerator::RequiresRoute(const std::string & origin, const std::string & destination) const
+        {
+            return origin != "" && this->destinationRules.RequiresRoute(destination);
+        }
+
+        /*
+            Copies the parts of the route that are needed to generate a code. Every point name is needed
+            to look for exit points and via points, but positions and times are only needed either side
+            of an exit point.
+        */
+        ExtractedRouteSnapshot IntentionCodeGenerator::SnapshotRoute(EuroscopeExtractedRouteInterface & route) const
+        {
+            return ExtractedRouteSnapshot(
+                route,
+                [this](const char * pointName) { return this->exitPoints.FindSectorExitPoint(pointName) != nullptr; }
+            );
+        }
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
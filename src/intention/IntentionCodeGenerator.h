@@ -1,9 +1,8 @@
 #pragma once
 #include "intention/SectorExitRepository.h"
-
-// Need to make the vector of groups a pointer to resolve this.
-#include "intention/AirfieldGroup.h"
+#include "intention/IntentionCodeRuleTable.h"
 #include "intention/IntentionCodeData.h"
+#include "intention/ExtractedRouteSnapshot.h"
 
 namespace UKControllerPlugin {
     namespace Euroscope {
@@ -17,22 +16,18 @@ namespace UKControllerPlugin {
 namespace UKControllerPlugin {
     namespace IntentionCode {
 
-        // Pre Declarations
-        class AirfieldGroup;
-        // END
-
         /*
             Class that determines an intention code, given a flightplan.
 
             Only one publically facing method, which uses the private methods to determine
-            what intention code to return. Once a flightplan has been recieved once, the
-            result is cached so it doesn't have to be caclulated on every TAG load.
+            what intention code to return. Codes are generated away from the EuroScope thread
+            and cached, so they don't have to be caclulated on every TAG load.
         */
         class IntentionCodeGenerator
         {
             public:
                 IntentionCodeGenerator(
-                    std::vector<std::unique_ptr<UKControllerPlugin::IntentionCode::AirfieldGroup>> airfieldGroups,
+                    UKControllerPlugin::IntentionCode::IntentionCodeRuleTable destinationRules,
                     UKControllerPlugin::IntentionCode::SectorExitRepository & exitPoints
                 );
                 UKControllerPlugin::IntentionCode::IntentionCodeData GetIntentionCodeForFlightplan(
@@ -41,7 +36,11 @@ namespace UKControllerPlugin {
                     std::string destination,
                     UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route,
                     int cruiseLevel
-                );
+                ) const;
+                bool RequiresRoute(const std::string & origin, const std::string & destination) const;
+                UKControllerPlugin::IntentionCode::ExtractedRouteSnapshot SnapshotRoute(
+                    UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route
+                ) const;
 
                 // Invalid code - to be used when we have no information for intention codes
                 const std::string invalidCode = "--";
@@ -53,10 +52,10 @@ namespace UKControllerPlugin {
                 const int exitPointPassed = -1;
 
             private:
-                int FindFirExitPoint(UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route);
+                int FindFirExitPoint(UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route) const;
 
-                // Special airfields
-                std::vector<std::unique_ptr<UKControllerPlugin::IntentionCode::AirfieldGroup>> airfieldGroups;
+                // Rules for airfields that get an intention code based on their destination
+                UKControllerPlugin::IntentionCode::IntentionCodeRuleTable destinationRules;
 
                 // Exit Point Repository
                 SectorExitRepository & exitPoints;
@@ -5,6 +5,9 @@
 #include "intention/IntentionCodeCache.h"
 #include "bootstrap/PersistenceContainer.h"
 #include "intention/SectorExitRepositoryFactory.h"
+#include "dependency/DependencyProviderInterface.h"
+#include "dependency/DependencyConfig.h"
+#include "task/TaskRunner.h"
 
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
 using UKControllerPlugin::IntentionCode::IntentionCodeEventHandler;
@@ -12,24 +15,37 @@ using UKControllerPlugin::IntentionCode::IntentionCodeFactory;
 using UKControllerPlugin::IntentionCode::IntentionCodeCache;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::IntentionCode::SectorExitRepositoryFactory;
+using UKControllerPlugin::Dependency::DependencyProviderInterface;
+using UKControllerPlugin::Dependency::DependencyConfig;
+using UKControllerPlugin::TaskManager::TaskRunner;
 
 namespace UKControllerPlugin {
     namespace IntentionCode {
 
         // Bootstrap the intention code module
         void IntentionCodeModule::BootstrapPlugin(
+            const DependencyProviderInterface & dependencyProvider,
             PersistenceContainer & container
         ) {
             container.sectorExitPoints = std::move(SectorExitRepositoryFactory::Create());
 
+            // Codes get their own thread, so that a burst of flightplans doesn't queue behind API requests
+            container.intentionCodeTaskRunner.reset(new TaskRunner(1, 0));
+
             // Create the handler and its dependencies
             std::shared_ptr<IntentionCodeEventHandler> handler = std::make_shared<IntentionCodeEventHandler>(
-                    std::move(*IntentionCodeFactory::Create(*container.sectorExitPoints)),
-                    IntentionCodeCache()
+                    std::move(*IntentionCodeFactory::Create(
+                        dependencyProvider.GetDependency(DependencyConfig::intentionCodes),
+                        *container.sectorExitPoints
+                    )),
+                    IntentionCodeCache(),
+                    *container.intentionCodeTaskRunner,
+                    *container.plugin
             );
 
             // Register with required event handlers.
             container.flightplanHandler->RegisterHandler(handler);
+            container.radarTargetHandler->RegisterHandler(handler);
             container.tagHandler->RegisterTagItem(IntentionCodeModule::tagItemId, handler);
         }
     }  // namespace IntentionCode
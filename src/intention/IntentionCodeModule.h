@@ -5,6 +5,9 @@ namespace UKControllerPlugin {
     namespace Bootstrap {
         struct PersistenceContainer;
     }  // namespace Bootstrap
+    namespace Dependency {
+        class DependencyProviderInterface;
+    }  // namespace Dependency
 }  // namespace UKControllerPlugin
 // END
 
@@ -19,6 +22,7 @@ namespace UKControllerPlugin {
         {
             public:
                 static void BootstrapPlugin(
+                    const UKControllerPlugin::Dependency::DependencyProviderInterface & dependencyProvider,
                     UKControllerPlugin::Bootstrap::PersistenceContainer & container
                 );
 
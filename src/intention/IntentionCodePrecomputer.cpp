@@ -0,0 +1,275 @@
+#include "pch/stdafx.h"
+#include "intention/IntentionCodePrecomputer.h"
+#include "intention/IntentionCodeGenerator.h"
+#include "intention/ExtractedRouteSnapshot.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+#include "euroscope/EuroscopeExtractedRouteInterface.h"
+#include "task/TaskRunnerInterface.h"
+
+using UKControllerPlugin::IntentionCode::IntentionCodeGenerator;
+using UKControllerPlugin::IntentionCode::IntentionCodeData;
+using UKControllerPlugin::IntentionCode::ExtractedRouteSnapshot;
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface;
+using UKControllerPlugin::TaskManager::TaskRunnerInterface;
+
+namespace UKControllerPlugin {
+    namespace IntentionCode {
+
+        IntentionCodePrecomputer::IntentionCodePrecomputer(
+            const IntentionCodeGenerator & generator,
+            TaskRunnerInterface & taskRunner
+        )
+            : generator(generator), taskRunner(taskRunner), taskGuard(std::make_shared<TaskGuard>())
+        {
+            this->taskGuard->precomputer = this;
+        }
+
+        /*
+            Waits for any batch that's being processed to finish and stops any queued tasks from
+            touching the precomputer once it's gone.
+        */
+        IntentionCodePrecomputer::~IntentionCodePrecomputer(void)
+        {
+            std::lock_guard<std::mutex> lock(this->taskGuard->lock);
+            this->taskGuard->precomputer = nullptr;
+        }
+
+        /*
+            Passes each code that has been generated for the latest version of a flightplan to the collector.
+            Codes for older versions of a flightplan, or for aircraft that have since been removed, are dropped.
+        */
+        void IntentionCodePrecomputer::CollectIntentionCodes(
+            const std::function<void(const std::string &, const IntentionCodeData &)> & collector
+        ) {
+            if (!this->hasCodes.exchange(false)) {
+                return;
+            }
+
+            PrecomputedCodeMap collected;
+            {
+                std::lock_guard<std::mutex> lock(this->codeLock);
+                collected.swap(this->codes);
+            }
+
+            for (const auto & code : collected) {
+                auto submission = this->submissions.find(code.first);
+                if (
+                    submission == this->submissions.end() ||
+                    submission->second.generation != code.second.generation
+                ) {
+                    continue;
+                }
+
+                submission->second.collected = true;
+                collector(code.first, code.second.data);
+            }
+        }
+
+        /*
+            Returns how many codes have been generated but not yet collected.
+        */
+        size_t IntentionCodePrecomputer::CountPrecomputedCodes(void) const
+        {
+            std::lock_guard<std::mutex> lock(this->codeLock);
+            return this->codes.size();
+        }
+
+        /*
+            Returns true if there may be codes waiting to be collected.
+        */
+        bool IntentionCodePrecomputer::HasPrecomputedCodes(void) const
+        {
+            return this->hasCodes.load();
+        }
+
+        /*
+            Returns true if the aircraft has been submitted since it was last removed.
+        */
+        bool IntentionCodePrecomputer::HasSubmittedAircraft(const std::string & callsign) const
+        {
+            return this->submissions.count(callsign) != 0;
+        }
+
+        /*
+            Hashes everything on the flightplan that the intention code depends on, so that updates to
+            anything else can be ignored.
+        */
+        size_t IntentionCodePrecomputer::HashInputs(const EuroScopeCFlightPlanInterface & flightPlan)
+        {
+            return std::hash<std::string>()(
+                flightPlan.GetOrigin() + " " + flightPlan.GetDestination() + " " +
+                std::to_string(flightPlan.GetCruiseLevel()) + " " + flightPlan.GetRawRouteString()
+            );
+        }
+
+        /*
+            Stop collecting codes for the aircraft.
+        */
+        void IntentionCodePrecomputer::RemoveAircraft(const std::string & callsign)
+        {
+            this->submissions.erase(callsign);
+        }
+
+        /*
+            Queue an aircraft for its intention code to be generated again, even though its flightplan
+            hasn't changed. Used when the aircraft has passed its exit point. If a code is already being
+            generated, there's no need to queue another.
+        */
+        void IntentionCodePrecomputer::ResubmitAircraft(
+            const std::string & callsign,
+            const EuroScopeCFlightPlanInterface & flightPlan
+        ) {
+            auto submission = this->submissions.find(callsign);
+            if (submission != this->submissions.end() && !submission->second.collected) {
+                return;
+            }
+
+            this->QueueAircraft(callsign, HashInputs(flightPlan), flightPlan);
+        }
+
+        /*
+            Queue an aircraft for its intention code to be generated, unless nothing that affects the
+            code has changed since it was last submitted.
+        */
+        void IntentionCodePrecomputer::SubmitAircraft(
+            const std::string & callsign,
+            const EuroScopeCFlightPlanInterface & flightPlan
+        ) {
+            const size_t inputs = HashInputs(flightPlan);
+            auto submission = this->submissions.find(callsign);
+            if (submission != this->submissions.end() && submission->second.inputs == inputs) {
+                return;
+            }
+
+            this->QueueAircraft(callsign, inputs, flightPlan);
+        }
+
+        /*
+            Queue an aircraft for its intention code to be generated from the given route.
+        */
+        void IntentionCodePrecomputer::SubmitAircraft(
+            const std::string & callsign,
+            const std::string & origin,
+            const std::string & destination,
+            int cruiseLevel,
+            EuroscopeExtractedRouteInterface & route
+        ) {
+            this->QueueAircraft(callsign, 0, origin, destination, cruiseLevel, &route);
+        }
+
+        /*
+            Queue the aircraft, only fetching the route if the origin and destination aren't enough to
+            work out the code.
+        */
+        void IntentionCodePrecomputer::QueueAircraft(
+            const std::string & callsign,
+            size_t inputs,
+            const EuroScopeCFlightPlanInterface & flightPlan
+        ) {
+            const std::string origin = flightPlan.GetOrigin();
+            const std::string destination = flightPlan.GetDestination();
+            if (this->generator.RequiresRoute(origin, destination)) {
+                EuroscopeExtractedRouteInterface route = flightPlan.GetExtractedRoute();
+                this->QueueAircraft(callsign, inputs, origin, destination, flightPlan.GetCruiseLevel(), &route);
+            } else {
+                this->QueueAircraft(callsign, inputs, origin, destination, flightPlan.GetCruiseLevel(), nullptr);
+            }
+        }
+
+        /*
+            Give the aircraft a new generation and queue it. Only the parts of the route that the
+            generator needs are copied, and only if the origin and destination aren't enough.
+        */
+        void IntentionCodePrecomputer::QueueAircraft(
+            const std::string & callsign,
+            size_t inputs,
+            const std::string & origin,
+            const std::string & destination,
+            int cruiseLevel,
+            EuroscopeExtractedRouteInterface * route
+        ) {
+            uint64_t generation = ++this->lastGeneration;
+            this->submissions[callsign] = {generation, inputs, false};
+
+            std::shared_ptr<ExtractedRouteSnapshot> snapshot =
+                route != nullptr && this->generator.RequiresRoute(origin, destination)
+                    ? std::make_shared<ExtractedRouteSnapshot>(this->generator.SnapshotRoute(*route))
+                    : std::make_shared<ExtractedRouteSnapshot>();
+
+            this->QueueJob({callsign, generation, origin, destination, cruiseLevel, snapshot});
+        }
+
+        /*
+            Add a job to the queue, starting a task to process the queue if one isn't already going.
+        */
+        void IntentionCodePrecomputer::QueueJob(PrecomputeJob job)
+        {
+            bool startProcessing = false;
+            {
+                std::lock_guard<std::mutex> lock(this->jobLock);
+                this->jobs.push_back(std::move(job));
+                if (!this->processingJobs) {
+                    this->processingJobs = true;
+                    startProcessing = true;
+                }
+            }
+
+            if (startProcessing) {
+                std::weak_ptr<TaskGuard> weakGuard = this->taskGuard;
+                this->taskRunner.QueueAsynchronousTask([weakGuard]() {
+                    std::shared_ptr<TaskGuard> guard = weakGuard.lock();
+                    if (!guard) {
+                        return;
+                    }
+
+                    std::lock_guard<std::mutex> lock(guard->lock);
+                    if (guard->precomputer != nullptr) {
+                        guard->precomputer->ProcessJobs();
+                    }
+                });
+            }
+        }
+
+        /*
+            Take batches of jobs off the queue until it is empty. Only the latest job for each aircraft
+            in a batch is processed, and each code is published as soon as it has been generated.
+        */
+        void IntentionCodePrecomputer::ProcessJobs(void)
+        {
+            while (true) {
+                std::deque<PrecomputeJob> batch;
+                {
+                    std::lock_guard<std::mutex> lock(this->jobLock);
+                    if (this->jobs.empty()) {
+                        this->processingJobs = false;
+                        return;
+                    }
+
+                    batch.swap(this->jobs);
+                }
+
+                std::unordered_set<std::string> processed;
+                for (auto job = batch.rbegin(); job != batch.rend(); ++job) {
+                    if (!processed.insert(job->callsign).second) {
+                        continue;
+                    }
+
+                    IntentionCodeData data = this->generator.GetIntentionCodeForFlightplan(
+                        job->callsign,
+                        job->origin,
+                        job->destination,
+                        *job->route,
+                        job->cruiseLevel
+                    );
+
+                    {
+                        std::lock_guard<std::mutex> lock(this->codeLock);
+                        this->codes[job->callsign] = {job->generation, std::move(data)};
+                    }
+                    this->hasCodes.store(true);
+                }
+            }
+        }
+    }  // namespace IntentionCode
+}  // namespace UKControllerPlugin
@@ -0,0 +1,156 @@
+#pragma once
+#include "intention/IntentionCodeData.h"
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Euroscope {
+        class EuroScopeCFlightPlanInterface;
+        class EuroscopeExtractedRouteInterface;
+    }  // namespace Euroscope
+    namespace IntentionCode {
+        class IntentionCodeGenerator;
+        class ExtractedRouteSnapshot;
+    }  // namespace IntentionCode
+    namespace TaskManager {
+        class TaskRunnerInterface;
+    }  // namespace TaskManager
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace IntentionCode {
+
+        /*
+            Generates intention codes away from the EuroScope thread.
+
+            When a flightplan changes, the parts of its route that the generator needs are copied and
+            queued for a background task to generate the intention code. Flightplan updates that don't
+            change the origin, destination, cruise level or route are ignored.
+
+            Each code is published as soon as it is generated, and the EuroScope thread collects the
+            published codes into the intention code cache, where they stay until they are superseded.
+
+            Each submission is given a generation, so that codes generated for an older version of a
+            flightplan are never collected.
+        */
+        class IntentionCodePrecomputer
+        {
+            public:
+                IntentionCodePrecomputer(
+                    const UKControllerPlugin::IntentionCode::IntentionCodeGenerator & generator,
+                    UKControllerPlugin::TaskManager::TaskRunnerInterface & taskRunner
+                );
+                ~IntentionCodePrecomputer(void);
+                void CollectIntentionCodes(
+                    const std::function<void(
+                        const std::string &,
+                        const UKControllerPlugin::IntentionCode::IntentionCodeData &
+                    )> & collector
+                );
+                size_t CountPrecomputedCodes(void) const;
+                bool HasPrecomputedCodes(void) const;
+                bool HasSubmittedAircraft(const std::string & callsign) const;
+                void RemoveAircraft(const std::string & callsign);
+                void ResubmitAircraft(
+                    const std::string & callsign,
+                    const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
+                );
+                void SubmitAircraft(
+                    const std::string & callsign,
+                    const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
+                );
+                void SubmitAircraft(
+                    const std::string & callsign,
+                    const std::string & origin,
+                    const std::string & destination,
+                    int cruiseLevel,
+                    UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route
+                );
+
+            private:
+
+                // Lets queued tasks check that the precomputer still exists before they run
+                typedef struct TaskGuard {
+                    std::mutex lock;
+                    IntentionCodePrecomputer * precomputer;
+                } TaskGuard;
+
+                // A request to generate an intention code
+                typedef struct PrecomputeJob {
+                    std::string callsign;
+                    uint64_t generation;
+                    std::string origin;
+                    std::string destination;
+                    int cruiseLevel;
+                    std::shared_ptr<UKControllerPlugin::IntentionCode::ExtractedRouteSnapshot> route;
+                } PrecomputeJob;
+
+                // A generated intention code
+                typedef struct PrecomputedCode {
+                    uint64_t generation;
+                    UKControllerPlugin::IntentionCode::IntentionCodeData data;
+                } PrecomputedCode;
+
+                // The latest submission for an aircraft
+                typedef struct Submission {
+                    uint64_t generation;
+                    size_t inputs;
+                    bool collected;
+                } Submission;
+
+                typedef std::unordered_map<std::string, PrecomputedCode> PrecomputedCodeMap;
+
+                static size_t HashInputs(
+                    const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
+                );
+                void ProcessJobs(void);
+                void QueueAircraft(
+                    const std::string & callsign,
+                    size_t inputs,
+                    const std::string & origin,
+                    const std::string & destination,
+                    int cruiseLevel,
+                    UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface * route
+                );
+                void QueueAircraft(
+                    const std::string & callsign,
+                    size_t inputs,
+                    const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
+                );
+                void QueueJob(PrecomputeJob job);
+
+                // Generates the codes
+                const UKControllerPlugin::IntentionCode::IntentionCodeGenerator & generator;
+
+                // Runs the background generation
+                UKControllerPlugin::TaskManager::TaskRunnerInterface & taskRunner;
+
+                // The latest submission for each aircraft, only used on the EuroScope thread
+                std::unordered_map<std::string, Submission> submissions;
+
+                // The last generation handed out
+                uint64_t lastGeneration = 0;
+
+                // Protects the job queue
+                std::mutex jobLock;
+
+                // Jobs waiting to be processed
+                std::deque<PrecomputeJob> jobs;
+
+                // Whether a task is already queued or running to process the jobs
+                bool processingJobs = false;
+
+                // Protects the published codes
+                mutable std::mutex codeLock;
+
+                // Codes that have been generated but not yet collected
+                PrecomputedCodeMap codes;
+
+                // Whether there are codes waiting to be collected, checked without taking the lock
+                std::atomic<bool> hasCodes{false};
+
+                // Queued tasks only hold a weak reference to this
+                std::shared_ptr<TaskGuard> taskGuard;
+        };
+    }  // namespace IntentionCode
+}  // namespace UKControllerPlugin
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace IntentionCode {
+
+        /*
+            A rule that assigns an intention code based on the destination of an aircraft, rather than
+            the point at which it leaves the FIR.
+
+            A rule matches either a list of airfields or any airfield beginning with a given prefix. It
+            may also require the aircraft to be routing via a particular point.
+        */
+        typedef struct IntentionCodeRule {
+
+            // The airfields this rule applies to
+            std::vector<std::string> airfields;
+
+            // Alternatively, the ICAO prefix that this rule applies to
+            std::string airfieldPrefix;
+
+            // A point that the aircraft must route via for the rule to apply, empty if none
+            std::string via;
+
+            // The intention code to assign
+            std::string code;
+
+            // If true, the intention code is the last two letters of the destination instead
+            bool useAirfieldSuffix = false;
+        } IntentionCodeRule;
+    }  // namespace IntentionCode
+}  // namespace UKControllerPlugin
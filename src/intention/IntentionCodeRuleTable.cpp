@@ -0,0 +1,201 @@
+#include "pch/stdafx.h"
+#include "intention/IntentionCodeRuleTable.h"
+#include "euroscope/EuroscopeExtractedRouteInterface.h"
+
+using UKControllerPlugin::IntentionCode::IntentionCodeRule;
+using UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface;
+
+namespace UKControllerPlugin {
+    namespace IntentionCode {
+
+        /*
+            Compile the rules into rule sets for each airfield and prefix that they mention. Every set
+            also picks up any prefix rules that apply to its key, so that a single lookup finds everything.
+        */
+        IntentionCodeRuleTable::IntentionCodeRuleTable(std::vector<IntentionCodeRule> rules)
+            : rules(std::move(rules))
+        {
+            std::set<size_t> lengths;
+            for (const IntentionCodeRule & rule : this->rules) {
+                if (!rule.airfieldPrefix.empty()) {
+                    this->prefixRuleSets[rule.airfieldPrefix];
+                    lengths.insert(rule.airfieldPrefix.size());
+                }
+
+                for (const std::string & airfield : rule.airfields) {
+                    this->airfieldRuleSets[airfield];
+                }
+            }
+            this->prefixLengths.assign(lengths.crbegin(), lengths.crend());
+
+            for (size_t i = 0; i < this->rules.size(); i++) {
+                const IntentionCodeRule & rule = this->rules[i];
+
+                if (rule.airfieldPrefix.empty()) {
+                    for (const std::string & airfield : rule.airfields) {
+                        this->AddRuleToSet(this->airfieldRuleSets.at(airfield), i);
+                    }
+                    continue;
+                }
+
+                for (auto & ruleSet : this->airfieldRuleSets) {
+                    if (ruleSet.first.compare(0, rule.airfieldPrefix.size(), rule.airfieldPrefix) == 0) {
+                        this->AddRuleToSet(ruleSet.second, i);
+                    }
+                }
+
+                for (auto & ruleSet : this->prefixRuleSets) {
+                    if (ruleSet.first.compare(0, rule.airfieldPrefix.size(), rule.airfieldPrefix) == 0) {
+                        this->AddRuleToSet(ruleSet.second, i);
+                    }
+                }
+            }
+        }
+
+        /*
+            Add a rule to a set. Once a set has a rule without a via point, nothing after it can ever
+            apply, so it isn't added.
+        */
+        void IntentionCodeRuleTable::AddRuleToSet(RuleSet & ruleSet, size_t rule) const
+        {
+            if (!ruleSet.rules.empty() && ruleSet.rules.back().viaIndex == this->noViaPoint) {
+                return;
+            }
+
+            const std::string & via = this->rules[rule].via;
+            if (via.empty()) {
+                ruleSet.rules.push_back({rule, this->noViaPoint});
+                return;
+            }
+
+            auto viaPoint = std::find(ruleSet.viaPoints.cbegin(), ruleSet.viaPoints.cend(), via);
+            if (viaPoint == ruleSet.viaPoints.cend()) {
+                if (ruleSet.viaPoints.size() == this->maxViaPoints) {
+                    LogWarning("Too many intention code via points, ignoring rule via " + via);
+                    return;
+                }
+
+                ruleSet.viaPoints.push_back(via);
+                viaPoint = ruleSet.viaPoints.cend() - 1;
+            }
+
+            ruleSet.rules.push_back({rule, static_cast<int>(viaPoint - ruleSet.viaPoints.cbegin())});
+        }
+
+        /*
+            Returns the number of rules in the table.
+        */
+        size_t IntentionCodeRuleTable::CountRules(void) const
+        {
+            return this->rules.size();
+        }
+
+        /*
+            Find the rule set for a destination, preferring a specific airfield, then the longest prefix.
+        */
+        const IntentionCodeRuleTable::RuleSet * IntentionCodeRuleTable::FindRuleSet(
+            const std::string & destination
+        ) const {
+            auto airfieldRuleSet = this->airfieldRuleSets.find(destination);
+            if (airfieldRuleSet != this->airfieldRuleSets.cend()) {
+                return &airfieldRuleSet->second;
+            }
+
+            for (size_t length : this->prefixLengths) {
+                if (destination.size() < length) {
+                    continue;
+                }
+
+                auto prefixRuleSet = this->prefixRuleSets.find(destination.substr(0, length));
+                if (prefixRuleSet != this->prefixRuleSets.cend()) {
+                    return &prefixRuleSet->second;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /*
+            Looks for a rule that applies to the destination and sets the intention code if one is
+            found. Returns false if no rule applies.
+        */
+        bool IntentionCodeRuleTable::FindIntentionCode(
+            const std::string & destination,
+            EuroscopeExtractedRouteInterface & route,
+            std::string & code
+        ) const {
+            const RuleSet * ruleSet = this->FindRuleSet(destination);
+            if (ruleSet == nullptr) {
+                return false;
+            }
+
+            uint64_t viaPointsFound = ruleSet->viaPoints.empty() ? 0 : this->ScanRouteForViaPoints(*ruleSet, route);
+            for (const CompiledRule & compiled : ruleSet->rules) {
+                if (
+                    compiled.viaIndex != this->noViaPoint &&
+                    (viaPointsFound & (uint64_t{1} << compiled.viaIndex)) == 0
+                ) {
+                    continue;
+                }
+
+                code = this->GetCodeForRule(this->rules[compiled.rule], destination);
+                return true;
+            }
+
+            return false;
+        }
+
+        /*
+            Returns true if the route might need to be checked to find the intention code for a destination,
+            which is the case unless the first rule that applies has no via point.
+        */
+        bool IntentionCodeRuleTable::RequiresRoute(const std::string & destination) const
+        {
+            const RuleSet * ruleSet = this->FindRuleSet(destination);
+            return ruleSet == nullptr ||
+                ruleSet->rules.empty() ||
+                ruleSet->rules.front().viaIndex != this->noViaPoint;
+        }
+
+        /*
+            Returns the intention code that a rule gives for a destination.
+        */
+        std::string IntentionCodeRuleTable::GetCodeForRule(
+            const IntentionCodeRule & rule,
+            const std::string & destination
+        ) const {
+            if (!rule.useAirfieldSuffix) {
+                return rule.code;
+            }
+
+            return destination.size() < 2 ? destination : destination.substr(destination.size() - 2);
+        }
+
+        /*
+            Walk the route once, returning a mask of which of the sets via points were found. Stops
+            early if they've all been found.
+        */
+        uint64_t IntentionCodeRuleTable::ScanRouteForViaPoints(
+            const RuleSet & ruleSet,
+            EuroscopeExtractedRouteInterface & route
+        ) const {
+            const size_t viaPointCount = ruleSet.viaPoints.size();
+            const uint64_t allFound = viaPointCount == this->maxViaPoints
+                ? ~uint64_t{0}
+                : (uint64_t{1} << viaPointCount) - 1;
+
+            uint64_t found = 0;
+            const int pointsNumber = route.GetPointsNumber();
+            for (int i = 0; i < pointsNumber && found != allFound; i++) {
+                const char * pointName = route.GetPointName(i);
+                for (size_t via = 0; via < viaPointCount; via++) {
+                    if (ruleSet.viaPoints[via] == pointName) {
+                        found |= uint64_t{1} << via;
+                    }
+                }
+            }
+
+            return found;
+        }
+    }  // namespace IntentionCode
+}  // namespace UKControllerPlugin
@@ -0,0 +1,81 @@
+#pragma once
+#include "intention/IntentionCodeRule.h"
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Euroscope {
+        class EuroscopeExtractedRouteInterface;
+    }  // namespace Euroscope
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace IntentionCode {
+
+        /*
+            Assigns intention codes to aircraft based on their destination.
+
+            On construction, the rules are compiled into a table keyed on destination (or destination prefix),
+            where each entry contains the rules that could apply to that destination in priority order. Any
+            via point requirements for those rules are checked together in a single pass of the route, which
+            is only done if the first applicable rule actually requires a via point.
+        */
+        class IntentionCodeRuleTable
+        {
+            public:
+                explicit IntentionCodeRuleTable(
+                    std::vector<UKControllerPlugin::IntentionCode::IntentionCodeRule> rules
+                );
+                size_t CountRules(void) const;
+                bool FindIntentionCode(
+                    const std::string & destination,
+                    UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route,
+                    std::string & code
+                ) const;
+                bool RequiresRoute(const std::string & destination) const;
+
+                // The maximum number of distinct via points that may apply to a single destination
+                static const size_t maxViaPoints = 64;
+
+                // Used when a rule has no via point requirement
+                static const int noViaPoint = -1;
+
+            private:
+
+                // A rule that may apply to a destination, and which of the destinations via points it requires
+                typedef struct CompiledRule {
+                    size_t rule;
+                    int viaIndex;
+                } CompiledRule;
+
+                // All the rules that may apply to a destination, in priority order
+                typedef struct RuleSet {
+                    std::vector<CompiledRule> rules;
+                    std::vector<std::string> viaPoints;
+                } RuleSet;
+
+                void AddRuleToSet(RuleSet & ruleSet, size_t rule) const;
+                const RuleSet * FindRuleSet(const std::string & destination) const;
+                std::string GetCodeForRule(
+                    const UKControllerPlugin::IntentionCode::IntentionCodeRule & rule,
+                    const std::string & destination
+                ) const;
+                uint64_t ScanRouteForViaPoints(
+                    const RuleSet & ruleSet,
+                    UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route
+                ) const;
+
+                // The rules, in priority order
+                const std::vector<UKControllerPlugin::IntentionCode::IntentionCodeRule> rules;
+
+                // Rule sets for specific airfields
+                std::unordered_map<std::string, RuleSet> airfieldRuleSets;
+
+                // Rule sets for airfield prefixes
+                std::unordered_map<std::string, RuleSet> prefixRuleSets;
+
+                // The distinct prefix lengths in use, longest first
+                std::vector<size_t> prefixLengths;
+        };
+    }  // namespace IntentionCode
+}  // namespace UKControllerPlugin
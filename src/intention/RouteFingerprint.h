@@ -0,0 +1,51 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace IntentionCode {
+
+        /*
+            A cheap summary of an extracted route, used to decide whether a cached
+            intention code is still valid without walking the route again.
+        */
+        typedef struct RouteFingerprint {
+
+            RouteFingerprint(void)
+                : pointsNumber(-1), assignedIndex(-1), calculatedIndex(-1), exitPointHash(0)
+            {
+
+            }
+
+            RouteFingerprint(int pointsNumber, int assignedIndex, int calculatedIndex, size_t exitPointHash)
+                : pointsNumber(pointsNumber), assignedIndex(assignedIndex), calculatedIndex(calculatedIndex),
+                exitPointHash(exitPointHash)
+            {
+
+            }
+
+            bool operator==(const RouteFingerprint & compare) const
+            {
+                return this->pointsNumber == compare.pointsNumber &&
+                    this->assignedIndex == compare.assignedIndex &&
+                    this->calculatedIndex == compare.calculatedIndex &&
+                    this->exitPointHash == compare.exitPointHash;
+            }
+
+            bool operator!=(const RouteFingerprint & compare) const
+            {
+                return !(*this == compare);
+            }
+
+            // The number of points on the route
+            int pointsNumber;
+
+            // The index of the point the aircraft has been cleared direct to
+            int assignedIndex;
+
+            // The index of the point closest to the aircraft
+            int calculatedIndex;
+
+            // A hash of the name of the exit point
+            size_t exitPointHash;
+        } RouteFingerprint;
+    }  // namespace IntentionCode
+}  // namespace UKControllerPlugin
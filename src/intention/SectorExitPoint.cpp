@@ -13,6 +13,12 @@ namespace UKControllerPlugin {
             this->name = name;
             this->intentionCode = intentionCode;
             this->outDirection = outDirection;
+
+            // Every range boundary is a whole degree, so the answer is the same for any direction strictly
+            // between two whole degrees. Evaluate each whole degree and each gap once, up front.
+            for (size_t i = 0; i < this->directionTableSize; i++) {
+                this->outDirectionTable[i] = this->DirectionInOutRange(i / 2.0);
+            }
         }
 
         /*
@@ -49,6 +55,30 @@ namespace UKControllerPlugin {
             entry point rather than the sector  exit.
         */
         bool SectorExitPoint::IsCorrectOutDirection(double directionOfTravel) const
+        {
+            // Invalid heading, return false.
+            if (!(directionOfTravel >= 0.0 && directionOfTravel <= 360.0)) {
+                return false;
+            }
+
+            return this->outDirectionTable[this->GetDirectionTableIndex(directionOfTravel)];
+        }
+
+        /*
+            Returns the index in the direction table for a given direction of travel. Whole degrees
+            are at even indexes, the gap after each whole degree at the odd index that follows it.
+        */
+        size_t SectorExitPoint::GetDirectionTableIndex(double directionOfTravel)
+        {
+            double wholeDegrees = std::floor(directionOfTravel);
+            return static_cast<size_t>(wholeDegrees) * 2 + (directionOfTravel == wholeDegrees ? 0 : 1);
+        }
+
+        /*
+            Checks the direction of travel against the ranges for each of the out directions. Used
+            to build the direction table.
+        */
+        bool SectorExitPoint::DirectionInOutRange(double directionOfTravel) const
         {
             // Invalid heading, return false.
             if (directionOfTravel < 0.0 || directionOfTravel > 360.0) {
@@ -37,7 +37,13 @@ namespace UKControllerPlugin {
                 static const int outSouthEast = 64;
                 static const int outSouthWest = 128;
 
+                // Entries in the direction table, one per whole degree and one per gap between them
+                static const size_t directionTableSize = 721;
+
             private:
+                bool DirectionInOutRange(double directionOfTravel) const;
+                static size_t GetDirectionTableIndex(double directionOfTravel);
+
                 // Name of the sector exit point
                 std::string name;
 
@@ -46,6 +52,9 @@ namespace UKControllerPlugin {
 
                 // The direction considered to be "out" of the FIR
                 unsigned int outDirection;
+
+                // Whether each direction of travel is "out", compiled from outDirection on construction
+                std::bitset<directionTableSize> outDirectionTable;
             };
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
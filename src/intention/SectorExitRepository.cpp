@@ -14,7 +14,90 @@ namespace UKControllerPlugin {
         SectorExitRepository::SectorExitRepository(std::map<std::string, std::unique_ptr<SectorExitPoint>> exitMap)
             : exitMap(std::move(exitMap))
         {
+            this->CompileFixIndex();
+        }
+
+        /*
+            Builds the fix index. Each packed point name is hashed into a power-of-two sized table
+            using a multiplicative hash. We try multipliers until we find one where no two points
+            share a slot, growing the table if need be, so that every lookup is a single probe.
+        */
+        void SectorExitRepository::CompileFixIndex(void)
+        {
+            const uint64_t goldenRatio = 0x9E3779B97F4A7C15ULL;
+            const int attemptsPerSize = 256;
+
+            unsigned int tableBits = 1;
+            while ((static_cast<size_t>(1) << tableBits) < this->exitMap.size() * 2) {
+                tableBits++;
+            }
+
+            while (true) {
+                size_t tableSize = static_cast<size_t>(1) << tableBits;
+                this->fixIndexShift = 64 - tableBits;
+
+                for (int attempt = 0; attempt < attemptsPerSize; attempt++) {
+                    this->fixIndexMultiplier = goldenRatio + (static_cast<uint64_t>(attempt) << 1);
+                    this->fixIndexKeys.assign(tableSize, this->invalidPackedName);
+                    this->fixIndexPoints.assign(tableSize, nullptr);
+
+                    bool collision = false;
+                    for (
+                        auto it = this->exitMap.cbegin();
+                        it != this->exitMap.cend() && !collision;
+                        ++it
+                    ) {
+                        // Names too long to pack are looked up in the map instead
+                        uint64_t key = this->PackPointName(it->first.c_str());
+                        if (key == this->invalidPackedName) {
+                            continue;
+                        }
 
+                        size_t slot = this->GetFixIndexSlot(key);
+                        if (this->fixIndexKeys[slot] != this->invalidPackedName) {
+                            collision = true;
+                            continue;
+                        }
+
+                        this->fixIndexKeys[slot] = key;
+                        this->fixIndexPoints[slot] = it->second.get();
+                    }
+
+                    if (!collision) {
+                        return;
+                    }
+                }
+
+                tableBits++;
+            }
+        }
+
+        /*
+            Returns the sector exit point with the given name, or nullptr if there isn't one. Names
+            that are too long to pack fall back to the map.
+        */
+        const SectorExitPoint * SectorExitRepository::FindSectorExitPoint(const char * point) const
+        {
+            uint64_t key = this->PackPointName(point);
+            if (key == this->invalidPackedName) {
+                if (point == nullptr || *point == '\0') {
+                    return nullptr;
+                }
+
+                auto exitPoint = this->exitMap.find(point);
+                return exitPoint == this->exitMap.cend() ? nullptr : exitPoint->second.get();
+            }
+
+            size_t slot = this->GetFixIndexSlot(key);
+            return this->fixIndexKeys[slot] == key ? this->fixIndexPoints[slot] : nullptr;
+        }
+
+        /*
+            Returns the slot in the fix index for a given packed key.
+        */
+        size_t SectorExitRepository::GetFixIndexSlot(uint64_t key) const
+        {
+            return static_cast<size_t>((key * this->fixIndexMultiplier) >> this->fixIndexShift);
         }
 
         /*
@@ -22,7 +105,29 @@ namespace UKControllerPlugin {
         */
         bool SectorExitRepository::HasSectorExitPoint(std::string point) const
         {
-            return this->exitMap.count(point) == 1;
+            return this->FindSectorExitPoint(point.c_str()) != nullptr;
+        }
+
+        /*
+            Packs a point name into an integer, one byte per character. Names that are empty or
+            too long to pack give the invalid key.
+        */
+        uint64_t SectorExitRepository::PackPointName(const char * point)
+        {
+            if (point == nullptr || *point == '\0') {
+                return SectorExitRepository::invalidPackedName;
+            }
+
+            uint64_t key = 0;
+            for (size_t i = 0; point[i] != '\0'; i++) {
+                if (i == SectorExitRepository::maxPackedNameLength) {
+                    return SectorExitRepository::invalidPackedName;
+                }
+
+                key = (key << 8) | static_cast<unsigned char>(point[i]);
+            }
+
+            return key;
         }
 
         /*
@@ -30,11 +135,12 @@ namespace UKControllerPlugin {
         */
         const SectorExitPoint & SectorExitRepository::GetSectorExitPoint(std::string point) const
         {
-            if (!this->HasSectorExitPoint(point)) {
+            const SectorExitPoint * exitPoint = this->FindSectorExitPoint(point.c_str());
+            if (exitPoint == nullptr) {
                 throw new std::invalid_argument("Exit point not found");
             }
 
-            return *this->exitMap.at(point);
+            return *exitPoint;
         }
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
@@ -6,6 +6,10 @@ namespace UKControllerPlugin {
 
         /*
             A class that maintains all the Sector Exit pointrs we need.
+
+            On construction, the point names are packed into integer keys and compiled into a
+            collision-free hash table, so that looking up a fix from a route is a single probe
+            that does not allocate.
         */
         class SectorExitRepository
         {
@@ -14,8 +18,12 @@ namespace UKControllerPlugin {
                     std::map<std::string,
                     std::unique_ptr<UKControllerPlugin::IntentionCode::SectorExitPoint>> exitMap
                 );
+                const UKControllerPlugin::IntentionCode::SectorExitPoint * FindSectorExitPoint(
+                    const char * point
+                ) const;
                 bool HasSectorExitPoint(std::string point) const;
                 const UKControllerPlugin::IntentionCode::SectorExitPoint & GetSectorExitPoint(std::string point) const;
+                static uint64_t PackPointName(const char * point);
 
                 // The exit directions.
                 const int outNorth = 1;
@@ -27,8 +35,29 @@ namespace UKControllerPlugin {
                 const int outSouthEast = 64;
                 const int outSouthWest = 128;
 
+                // The longest point name that can be packed into a key
+                static const size_t maxPackedNameLength = 8;
+
+                // The key used to indicate that a point name cannot be packed
+                static const uint64_t invalidPackedName = 0;
+
             private:
+                void CompileFixIndex(void);
+                size_t GetFixIndexSlot(uint64_t key) const;
+
                 std::map<std::string, std::unique_ptr<UKControllerPlugin::IntentionCode::SectorExitPoint>> exitMap;
+
+                // The packed point name in each slot of the fix index
+                std::vector<uint64_t> fixIndexKeys;
+
+                // The exit point in each slot of the fix index
+                std::vector<const UKControllerPlugin::IntentionCode::SectorExitPoint *> fixIndexPoints;
+
+                // The multiplier used to hash keys into the fix index
+                uint64_t fixIndexMultiplier = 0;
+
+                // How far to shift the hashed key to get the slot
+                unsigned int fixIndexShift = 64;
             };
     }  // namespace IntentionCode
 }  // namespace UKControllerPlugin
@@ -158,6 +158,24 @@ namespace UKControllerPlugin {
 
         }
 
+        /*
+            If the user is amongst the controllers already online, check the login status once.
+        */
+        void Login::InitialControllerLoadEvent(
+            const std::vector<std::shared_ptr<EuroScopeCControllerInterface>> & controllers
+        ) {
+            for (
+                std::vector<std::shared_ptr<EuroScopeCControllerInterface>>::const_iterator it = controllers.cbegin();
+                it != controllers.cend();
+                ++it
+            ) {
+                if ((*it)->IsCurrentUser()) {
+                    this->TimedEventTrigger();
+                    return;
+                }
+            }
+        }
+
         /*
             We trigger this event, so nout to do here.
         */
@@ -33,6 +33,10 @@ namespace UKControllerPlugin {
                 void ControllerDisconnectEvent(
                     UKControllerPlugin::Euroscope::EuroScopeCControllerInterface & controller
                 ) override;
+                void InitialControllerLoadEvent(
+                    const std::vector<std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCControllerInterface>>
+                        & controllers
+                ) override;
                 const int GetLoginStatus(void) const;
                 std::chrono::system_clock::time_point GetLoginTime(void) const;
                 std::chrono::seconds GetSecondsLoggedIn(void) const;
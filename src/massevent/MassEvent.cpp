@@ -4,11 +4,13 @@
 #include "flightplan/StoredFlightplan.h"
 #include "euroscope/EuroscopePluginLoopbackInterface.h"
 #include "initialaltitude/InitialAltitudeEventHandler.h"
+#include "flightplan/FlightPlanEventHandlerInterface.h"
 
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
 using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
 using UKControllerPlugin::InitialAltitude::InitialAltitudeEventHandler;
 using UKControllerPlugin::Squawk::SquawkEventHandler;
+using UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface;
 
 namespace UKControllerPlugin {
     namespace EventHandler {
@@ -25,36 +27,88 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Loops through every flightplan in the collection and triggers an "update" event.
+            Returns the most flightplans that have been waiting to be processed at once since the
+            queue was last empty.
         */
-        void MassEvent::SetAllInitialAltitudes(void)
+        size_t MassEvent::GetPeakPendingFlightplans(void) const
         {
-            if (!this->initialAltitudes) {
-                return;
+            return this->peakPendingFlightplans;
+        }
+
+        /*
+            Returns how many flightplans are waiting to be processed across all the jobs.
+        */
+        size_t MassEvent::GetPendingFlightplans(void) const
+        {
+            return this->pendingFlightplans;
+        }
+
+        /*
+            Returns how far through the queued jobs we are, between 0 and 1. If nothing
+            is queued, we're done.
+        */
+        double MassEvent::GetProgress(void) const
+        {
+            if (this->pendingFlightplans == 0) {
+                return 1.0;
             }
 
-            LogInfo("Mass assigning initial altitudes");
+            return static_cast<double>(this->processedFlightplans) /
+                (this->processedFlightplans + this->pendingFlightplans);
+        }
 
+        /*
+            Returns true if there are jobs still to be finished.
+        */
+        bool MassEvent::InProgress(void) const
+        {
+            return !this->jobs.empty();
+        }
+
+        /*
+            Queues up a job to pass every flightplan in the collection to the given handler. If the handler
+            already has a job waiting, that job is replaced, as the new one covers everything anyway.
+        */
+        void MassEvent::QueueJob(std::string description, std::shared_ptr<FlightPlanEventHandlerInterface> handler)
+        {
+            for (std::list<MassEventJob>::iterator it = this->jobs.begin(); it != this->jobs.end(); ++it) {
+                if (it->handler == handler) {
+                    this->pendingFlightplans -= it->callsigns.size() - it->next;
+                    this->jobs.erase(it);
+                    break;
+                }
+            }
+
+            std::vector<std::string> callsigns;
+            callsigns.reserve(this->flightplans.CountPlans());
             for (
                 StoredFlightplanCollection::const_iterator it = this->flightplans.cbegin();
                 it != this->flightplans.cend();
                 ++it
             ) {
-                try {
+                callsigns.push_back(it->second->GetCallsign());
+            }
 
-                    this->initialAltitudes->FlightPlanEvent(
-                        *this->pluginInterface.GetFlightplanForCallsign(it->second->GetCallsign()),
-                        *this->pluginInterface.GetRadarTargetForCallsign(it->second->GetCallsign())
-                    );
+            LogInfo(description + " queued for " + std::to_string(callsigns.size()) + " flightplans");
+            this->pendingFlightplans += callsigns.size();
+            this->peakPendingFlightplans = (std::max)(this->peakPendingFlightplans, this->pendingFlightplans);
+            this->jobs.push_back({ description, handler, std::move(callsigns), 0, std::chrono::steady_clock::now() });
+        }
 
-                } catch (std::invalid_argument) {
-                    continue;
-                }
+        /*
+            Queues up a job to trigger an "update" event for every flightplan in the collection.
+        */
+        void MassEvent::SetAllInitialAltitudes(void)
+        {
+            if (!this->initialAltitudes) {
+                return;
             }
+
+            this->QueueJob("Mass assigning initial altitudes", this->initialAltitudes);
         }
 
         /*
-            Loops through all the flightplans and triggers an update event.
+            Queues up a job to trigger an update event for all the flightplans.
         */
         void MassEvent::SetAllSquawks(void)
         {
@@ -62,24 +116,61 @@ namespace UKControllerPlugin {
                 return;
             }
 
-            LogInfo("Mass assigning squawks");
+            this->QueueJob("Mass assigning squawks", this->squawks);
+        }
 
-            for (
-                StoredFlightplanCollection::const_iterator it = this->flightplans.cbegin();
-                it != this->flightplans.cend();
-                ++it
-            ) {
-                try {
+        /*
+            Works through the next chunk of flightplans. Flightplans that have gone away since
+            the job was queued are skipped. Once the queue drains, the counters start again.
+        */
+        void MassEvent::TimedEventTrigger(void)
+        {
+            if (this->jobs.empty()) {
+                return;
+            }
+
+            size_t budget = this->flightplansPerTick;
+            while (budget > 0 && !this->jobs.empty()) {
+                MassEventJob & job = this->jobs.front();
 
-                    this->squawks->FlightPlanEvent(
-                        *this->pluginInterface.GetFlightplanForCallsign(it->second->GetCallsign()),
-                        *this->pluginInterface.GetRadarTargetForCallsign(it->second->GetCallsign())
-                    );
+                while (budget > 0 && job.next < job.callsigns.size()) {
+                    const std::string & callsign = job.callsigns[job.next++];
+                    budget--;
+                    this->pendingFlightplans--;
+                    this->processedFlightplans++;
 
+                    try {
+                        job.handler->FlightPlanEvent(
+                            *this->pluginInterface.GetFlightplanForCallsign(callsign),
+                            *this->pluginInterface.GetRadarTargetForCallsign(callsign)
+                        );
+                    } catch (std::invalid_argument) {
+                        continue;
+                    }
                 }
-                catch (std::invalid_argument) {
-                    continue;
+
+                if (job.next < job.callsigns.size()) {
+                    break;
                 }
+
+                LogInfo(
+                    job.description + " complete for " + std::to_string(job.callsigns.size()) + " flightplans in " +
+                    std::to_string(
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - job.queued
+                        ).count()
+                    ) + "ms"
+                );
+                this->jobs.pop_front();
+            }
+
+            if (this->jobs.empty()) {
+                LogInfo(
+                    "Mass event queue drained after " + std::to_string(this->processedFlightplans) +
+                    " flightplans, peak of " + std::to_string(this->peakPendingFlightplans) + " waiting"
+                );
+                this->processedFlightplans = 0;
+                this->peakPendingFlightplans = 0;
             }
         }
     }  // namespace EventHandler
@@ -1,5 +1,7 @@
 #pragma once
 #include "squawk/SquawkEventHandler.h"
+#include "timedevent/AbstractTimedEvent.h"
+#include "massevent/MassEventJob.h"
 
 namespace UKControllerPlugin {
     namespace Flightplan {
@@ -19,8 +21,12 @@ namespace UKControllerPlugin {
         /*
             A class for running events in bulk across entire collections, for example
             assigning squawks in bulk.
+
+            Rather than doing every flightplan at once and holding up EuroScope, each mass event is
+            queued up as a job and worked through a chunk of flightplans at a time whenever the timed
+            event triggers. Jobs are run in the order they were queued.
         */
-        class MassEvent
+        class MassEvent : public UKControllerPlugin::TimedEvent::AbstractTimedEvent
         {
             public:
                 MassEvent(
@@ -30,10 +36,27 @@ namespace UKControllerPlugin {
                     std::shared_ptr<UKControllerPlugin::Squawk::SquawkEventHandler> squawks1
                 );
 
+                size_t GetPeakPendingFlightplans(void) const;
+                size_t GetPendingFlightplans(void) const;
+                double GetProgress(void) const;
+                bool InProgress(void) const;
                 void SetAllInitialAltitudes(void);
                 void SetAllSquawks(void);
+                void TimedEventTrigger(void);
+
+                // The most flightplans to process each time the timed event triggers
+                static const size_t flightplansPerTick = 50;
+
+                // How often the timed event should be triggered
+                static const int timedEventFrequency = 1;
 
             private:
+
+                void QueueJob(
+                    std::string description,
+                    std::shared_ptr<UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface> handler
+                );
+
                 // A way to get things we need from Euroscope.
                 UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface & pluginInterface;
 
@@ -46,6 +69,18 @@ namespace UKControllerPlugin {
                 // The flightplan repository so we can iterate it.
                 const UKControllerPlugin::Flightplan::StoredFlightplanCollection & flightplans;
 
+                // Jobs that haven't finished yet
+                std::list<UKControllerPlugin::EventHandler::MassEventJob> jobs;
+
+                // How many flightplans are waiting to be processed across all jobs
+                size_t pendingFlightplans = 0;
+
+                // The most flightplans that have been waiting at once since the queue was last empty
+                size_t peakPendingFlightplans = 0;
+
+                // How many flightplans have been processed since the queue was last empty
+                size_t processedFlightplans = 0;
+
         };
     }  // namespace EventHandler
 }  // namespace UKControllerPlugin
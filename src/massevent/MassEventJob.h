@@ -0,0 +1,34 @@
+#pragma once
+#include "pch/stdafx.h"
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Flightplan {
+        class FlightPlanEventHandlerInterface;
+    }  // namespace Flightplan
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace EventHandler {
+        /*
+            A mass event that has been queued up, but not yet run against every flightplan.
+        */
+        typedef struct MassEventJob {
+            // What the job is doing, for logging
+            std::string description;
+
+            // The handler to pass each flightplan to
+            std::shared_ptr<UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface> handler;
+
+            // The callsigns of the flightplans that existed when the job was queued
+            std::vector<std::string> callsigns;
+
+            // The index of the next callsign to process
+            size_t next;
+
+            // When the job was queued
+            std::chrono::steady_clock::time_point queued;
+        } MassEventJob;
+    }  // namespace EventHandler
+}  // namespace UKControllerPlugin
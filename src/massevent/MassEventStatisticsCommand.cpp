@@ -0,0 +1,46 @@
+#include "pch/stdafx.h"
+#include "massevent/MassEventStatisticsCommand.h"
+#include "massevent/MassEventStatisticsMessage.h"
+#include "massevent/MassEvent.h"
+#include "message/UserMessager.h"
+
+using UKControllerPlugin::Message::UserMessager;
+
+namespace UKControllerPlugin {
+    namespace EventHandler {
+
+        MassEventStatisticsCommand::MassEventStatisticsCommand(
+            const MassEvent & massEvent,
+            UserMessager & userMessager
+        )
+            : massEvent(massEvent), userMessager(userMessager)
+        {
+
+        }
+
+        /*
+            Tell the user how far through the queued mass events we are, how many flightplans are still
+            waiting and the most that have been waiting at once.
+        */
+        bool MassEventStatisticsCommand::ProcessCommand(std::string command)
+        {
+            if (command != this->statsCommand) {
+                return false;
+            }
+
+            if (!this->massEvent.InProgress()) {
+                this->userMessager.SendMessageToUser(MassEventStatisticsMessage("No mass events in progress"));
+                return true;
+            }
+
+            this->userMessager.SendMessageToUser(
+                MassEventStatisticsMessage(
+                    "Mass events " + std::to_string(static_cast<int>(this->massEvent.GetProgress() * 100)) +
+                    "% complete, " + std::to_string(this->massEvent.GetPendingFlightplans()) +
+                    " flightplans waiting, peak of " + std::to_string(this->massEvent.GetPeakPendingFlightplans())
+                )
+            );
+            return true;
+        }
+    }  // namespace EventHandler
+}  // namespace UKControllerPlugin
@@ -0,0 +1,44 @@
+#pragma once
+#include "command/CommandHandlerInterface.h"
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Message {
+        class UserMessager;
+    }  // namespace Message
+    namespace EventHandler {
+        class MassEvent;
+    }  // namespace EventHandler
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace EventHandler {
+
+        /*
+            Handles the dot command for showing how far through the queued mass events we are.
+        */
+        class MassEventStatisticsCommand : public UKControllerPlugin::Command::CommandHandlerInterface
+        {
+            public:
+                MassEventStatisticsCommand(
+                    const UKControllerPlugin::EventHandler::MassEvent & massEvent,
+                    UKControllerPlugin::Message::UserMessager & userMessager
+                );
+
+                // Inherited via CommandHandlerInterface
+                bool ProcessCommand(std::string command) override;
+
+                // Shows the progress in the chat area
+                const std::string statsCommand = ".ukcp stats massevents";
+
+            private:
+
+                // The mass events
+                const UKControllerPlugin::EventHandler::MassEvent & massEvent;
+
+                // For sending the progress to the user
+                UKControllerPlugin::Message::UserMessager & userMessager;
+        };
+    }  // namespace EventHandler
+}  // namespace UKControllerPlugin
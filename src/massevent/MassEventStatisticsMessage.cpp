@@ -0,0 +1,74 @@
+#include "pch/stdafx.h"
+#include "massevent/MassEventStatisticsMessage.h"
+
+namespace UKControllerPlugin {
+    namespace EventHandler {
+
+        MassEventStatisticsMessage::MassEventStatisticsMessage(std::string line)
+            : line(line)
+        {
+
+        }
+
+        /*
+        *   Put the message in the query handler
+        */
+        std::string MassEventStatisticsMessage::MessageHandler(void) const
+        {
+            return "UKCP_Query";
+        }
+
+        /*
+        *   The message sender should be the plugin
+        */
+        std::string MassEventStatisticsMessage::MessageSender(void) const
+        {
+            return "UKCP";
+        }
+
+        std::string MassEventStatisticsMessage::MessageString(void) const
+        {
+            return this->line;
+        }
+
+        /*
+        *   The handler should be shown
+        */
+        bool MassEventStatisticsMessage::MessageShowHandler(void) const
+        {
+            return true;
+        }
+
+        /*
+        *   The message handler should be marked as unread
+        */
+        bool MassEventStatisticsMessage::MessageMarkUnread(void) const
+        {
+            return true;
+        }
+
+        /*
+        *   If they've typed this command they've asked for it, so override busy
+        */
+        bool MassEventStatisticsMessage::MessageOverrideBusy(void) const
+        {
+            return true;
+        }
+
+        /*
+        *   Only one line, so no need to flash
+        */
+        bool MassEventStatisticsMessage::MessageFlashHandler(void) const
+        {
+            return false;
+        }
+
+        /*
+        *   Don't make them click too much
+        */
+        bool MassEventStatisticsMessage::MessageRequiresConfirm(void) const
+        {
+            return false;
+        }
+    }  // namespace EventHandler
+}  // namespace UKControllerPlugin
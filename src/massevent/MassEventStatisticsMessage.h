@@ -0,0 +1,28 @@
+#pragma once
+#include "message/MessageSerializableInterface.h"
+
+namespace UKControllerPlugin {
+    namespace EventHandler {
+
+        /*
+            A message containing the progress of the mass events.
+        */
+        class MassEventStatisticsMessage : public UKControllerPlugin::Message::MessageSerializableInterface
+        {
+            public:
+                explicit MassEventStatisticsMessage(std::string line);
+                std::string MessageHandler(void) const override;
+                std::string MessageSender(void) const override;
+                std::string MessageString(void) const override;
+                bool MessageShowHandler(void) const override;
+                bool MessageMarkUnread(void) const override;
+                bool MessageOverrideBusy(void) const override;
+                bool MessageFlashHandler(void) const override;
+                bool MessageRequiresConfirm(void) const override;
+
+            private:
+                // The line to display
+                const std::string line;
+        };
+    }  // namespace EventHandler
+}  // namespace UKControllerPlugin
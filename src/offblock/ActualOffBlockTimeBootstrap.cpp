@@ -22,7 +22,7 @@ namespace UKControllerPlugin {
                 *container.timeFormatting
             );
 
-            container.tagHandler->RegisterTagItem(ActualOffBlockTimeBootstrap::tagItemId, handler);
+            container.tagHandler->RegisterCachedTagItem(ActualOffBlockTimeBootstrap::tagItemId, handler);
             container.flightplanHandler->RegisterHandler(handler);
         }
     }  // namespace Datablock
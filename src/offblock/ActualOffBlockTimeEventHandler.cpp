@@ -9,6 +9,7 @@ using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPlugin::Datablock::DisplayTime;
+using UKControllerPlugin::Tag::TagItemWriterInterface;
 
 namespace UKControllerPlugin {
     namespace Datablock {
@@ -65,22 +66,41 @@ namespace UKControllerPlugin {
             return "Actual Off-block Time";
         }
 
+        /*
+            Returns the tag item data as a string.
+        */
         std::string ActualOffBlockTimeEventHandler::GetTagItemData(
             EuroScopeCFlightPlanInterface & flightPlan,
             EuroScopeCRadarTargetInterface & radarTarget
         ) {
-            if (!this->flightplans.HasFlightplanForCallsign(flightPlan.GetCallsign())) {
-                return this->displayTime.GetUnknownTimeFormat();
+            char itemData[TagItemWriterInterface::itemDataSize];
+            this->WriteTagItemData(flightPlan, radarTarget, itemData);
+            return itemData;
+        }
+
+        /*
+            Writes the time into the tag item, or the unknown time format if there isn't one.
+        */
+        bool ActualOffBlockTimeEventHandler::WriteTagItemData(
+            EuroScopeCFlightPlanInterface & flightPlan,
+            EuroScopeCRadarTargetInterface & radarTarget,
+            char itemData[16]
+        ) {
+            const std::string callsign = flightPlan.GetCallsign();
+            if (!this->flightplans.HasFlightplanForCallsign(callsign)) {
+                return this->CopyItemData(this->displayTime.GetUnknownTimeFormat(), itemData);
             }
 
-            std::chrono::system_clock::time_point offBlock = this->flightplans.GetFlightplanForCallsign(
-                flightPlan.GetCallsign()
-            )
+            std::chrono::system_clock::time_point offBlock = this->flightplans.GetFlightplanForCallsign(callsign)
                 .GetActualOffBlockTime();
 
-            return offBlock == (std::chrono::system_clock::time_point::max)()
-                ? this->displayTime.GetUnknownTimeFormat()
-                : this->displayTime.FromTimePoint(offBlock);
+            // If no valid time, nothing to do
+            if (offBlock == (std::chrono::system_clock::time_point::max)()) {
+                return this->CopyItemData(this->displayTime.GetUnknownTimeFormat(), itemData);
+            }
+
+            this->displayTime.WriteTimePoint(offBlock, itemData, TagItemWriterInterface::itemDataSize);
+            return true;
         }
     }  // namespace Datablock
 }  // namespace UKControllerPlugin
@@ -1,6 +1,6 @@
 #pragma once
 #include "datablock/DisplayTime.h"
-#include "tag/TagItemInterface.h"
+#include "tag/TagItemWriterInterface.h"
 #include "flightplan/FlightPlanEventHandlerInterface.h"
 
 namespace UKControllerPlugin {
@@ -21,7 +21,7 @@ namespace UKControllerPlugin {
             TAGs.
         */
         class ActualOffBlockTimeEventHandler : public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface,
-            public UKControllerPlugin::Tag::TagItemInterface
+            public UKControllerPlugin::Tag::TagItemWriterInterface
         {
             public:
                 ActualOffBlockTimeEventHandler(
@@ -42,12 +42,17 @@ namespace UKControllerPlugin {
                     int dataType
                 ) override;
 
-                // Inherited via TagItemInterface
+                // Inherited via TagItemWriterInterface
                 std::string GetTagItemDescription(void) const override;
                 std::string GetTagItemData(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
                     UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
                 ) override;
+                bool WriteTagItemData(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+                    char itemData[16]
+                ) override;
 
             private:
 
@@ -22,7 +22,7 @@ namespace UKControllerPlugin {
                 );
 
             container.flightplanHandler->RegisterHandler(handler);
-            container.tagHandler->RegisterTagItem(EstimatedDepartureTimeBootstrap::tagItemId, handler);
+            container.tagHandler->RegisterCachedTagItem(EstimatedDepartureTimeBootstrap::tagItemId, handler);
         }
     }  // namespace Datablock
 }  // namespace UKControllerPlugin
@@ -12,6 +12,7 @@ using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPlugin::HelperFunctions;
 using UKControllerPlugin::Datablock::DisplayTime;
+using UKControllerPlugin::Tag::TagItemWriterInterface;
 
 namespace UKControllerPlugin {
 namespace Datablock {
@@ -29,24 +30,41 @@ std::string EstimatedDepartureTimeEventHandler::GetTagItemDescription(void) cons
     return "Estimated Departure Time";
 }
 
+/*
+    Returns the tag item data as a string.
+*/
 std::string EstimatedDepartureTimeEventHandler::GetTagItemData(
     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
     UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
 ) {
-    if (!this->storedFlightplans.HasFlightplanForCallsign(flightPlan.GetCallsign())) {
-        return this->displayTime.GetUnknownTimeFormat();
+    char itemData[TagItemWriterInterface::itemDataSize];
+    this->WriteTagItemData(flightPlan, radarTarget, itemData);
+    return itemData;
+}
+
+/*
+    Writes the time into the tag item, or the unknown time format if there isn't one.
+*/
+bool EstimatedDepartureTimeEventHandler::WriteTagItemData(
+    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+    char itemData[16]
+) {
+    const std::string callsign = flightPlan.GetCallsign();
+    if (!this->storedFlightplans.HasFlightplanForCallsign(callsign)) {
+        return this->CopyItemData(this->displayTime.GetUnknownTimeFormat(), itemData);
     }
 
-    std::chrono::system_clock::time_point edt = this->storedFlightplans
-        .GetFlightplanForCallsign(flightPlan.GetCallsign())
+    std::chrono::system_clock::time_point edt = this->storedFlightplans.GetFlightplanForCallsign(callsign)
         .GetEstimatedDepartureTime();
 
-    // If no valid EOBT, nothing to do
+    // If no valid time, nothing to do
     if (edt == (std::chrono::system_clock::time_point::max)()) {
-        return this->displayTime.GetUnknownTimeFormat();
+        return this->CopyItemData(this->displayTime.GetUnknownTimeFormat(), itemData);
     }
 
-    return this->displayTime.FromTimePoint(edt);
+    this->displayTime.WriteTimePoint(edt, itemData, TagItemWriterInterface::itemDataSize);
+    return true;
 }
 
 /*
@@ -1,5 +1,5 @@
 #pragma once
-#include "tag/TagItemInterface.h"
+#include "tag/TagItemWriterInterface.h"
 #include "datablock/DisplayTime.h"
 #include "flightplan/FlightPlanEventHandlerInterface.h"
 
@@ -16,7 +16,7 @@ namespace UKControllerPlugin {
 namespace UKControllerPlugin {
 namespace Datablock {
 
-class EstimatedDepartureTimeEventHandler : public UKControllerPlugin::Tag::TagItemInterface,
+class EstimatedDepartureTimeEventHandler : public UKControllerPlugin::Tag::TagItemWriterInterface,
     public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface
 {
     public:
@@ -39,6 +39,11 @@ class EstimatedDepartureTimeEventHandler : public UKControllerPlugin::Tag::TagIt
             UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
             UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
         ) override;
+        bool WriteTagItemData(
+            UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+            UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+            char itemData[16]
+        ) override;
 
     private:
 
@@ -21,7 +21,7 @@ namespace UKControllerPlugin {
                     *container.timeFormatting
                 );
 
-            container.tagHandler->RegisterTagItem(EstimatedOffBlockTimeBootstrap::tagItemId, handler);
+            container.tagHandler->RegisterCachedTagItem(EstimatedOffBlockTimeBootstrap::tagItemId, handler);
         }
     }  // namespace Datablock
 }  // namespace UKControllerPlugin
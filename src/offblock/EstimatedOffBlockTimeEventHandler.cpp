@@ -7,6 +7,7 @@
 
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
 using UKControllerPlugin::Datablock::DisplayTime;
+using UKControllerPlugin::Tag::TagItemWriterInterface;
 
 namespace UKControllerPlugin {
 namespace Datablock {
@@ -24,24 +25,41 @@ std::string EstimatedOffBlockTimeEventHandler::GetTagItemDescription(void) const
     return "Estimated Off-block Time";
 }
 
+/*
+    Returns the tag item data as a string.
+*/
 std::string EstimatedOffBlockTimeEventHandler::GetTagItemData(
     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
     UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
 ) {
-    if (!this->storedFlightplans.HasFlightplanForCallsign(flightPlan.GetCallsign())) {
-        return this->displayTime.GetUnknownTimeFormat();
+    char itemData[TagItemWriterInterface::itemDataSize];
+    this->WriteTagItemData(flightPlan, radarTarget, itemData);
+    return itemData;
+}
+
+/*
+    Writes the time into the tag item, or the unknown time format if there isn't one.
+*/
+bool EstimatedOffBlockTimeEventHandler::WriteTagItemData(
+    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+    char itemData[16]
+) {
+    const std::string callsign = flightPlan.GetCallsign();
+    if (!this->storedFlightplans.HasFlightplanForCallsign(callsign)) {
+        return this->CopyItemData(this->displayTime.GetUnknownTimeFormat(), itemData);
     }
 
-    std::chrono::system_clock::time_point eobt = this->storedFlightplans
-        .GetFlightplanForCallsign(flightPlan.GetCallsign())
+    std::chrono::system_clock::time_point eobt = this->storedFlightplans.GetFlightplanForCallsign(callsign)
         .GetExpectedOffBlockTime();
 
-    // If no valid EOBT, nothing to do
+    // If no valid time, nothing to do
     if (eobt == (std::chrono::system_clock::time_point::max)()) {
-        return this->displayTime.GetUnknownTimeFormat();
+        return this->CopyItemData(this->displayTime.GetUnknownTimeFormat(), itemData);
     }
 
-    return this->displayTime.FromTimePoint(eobt);
+    this->displayTime.WriteTimePoint(eobt, itemData, TagItemWriterInterface::itemDataSize);
+    return true;
 }
 
 }  // namespace Datablock
@@ -1,5 +1,5 @@
 #pragma once
-#include "tag/TagItemInterface.h"
+#include "tag/TagItemWriterInterface.h"
 #include "datablock/DisplayTime.h"
 
 namespace UKControllerPlugin {
@@ -15,7 +15,7 @@ namespace UKControllerPlugin {
 namespace UKControllerPlugin {
 namespace Datablock {
 
-class EstimatedOffBlockTimeEventHandler : public UKControllerPlugin::Tag::TagItemInterface
+class EstimatedOffBlockTimeEventHandler : public UKControllerPlugin::Tag::TagItemWriterInterface
 {
     public:
         EstimatedOffBlockTimeEventHandler(
@@ -27,6 +27,11 @@ class EstimatedOffBlockTimeEventHandler : public UKControllerPlugin::Tag::TagIte
             UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
             UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
         ) override;
+        bool WriteTagItemData(
+            UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+            UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+            char itemData[16]
+        ) override;
 
     private:
 
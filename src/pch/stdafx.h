@@ -26,16 +26,21 @@
 
 // Standard headers
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
 #include <CommCtrl.h>
 #include <CommDlg.h>
 #include <shtypes.h>
 #include <filesystem>
 #include <cctype>
+#include <cmath>
 #include <ctime>
 #include <string>
 #include <tchar.h>
 #include <map>
 #include <mutex>
+#include <optional>
 #include <vector>
 #include <KnownFolders.h>
 #include <iterator>
@@ -43,6 +48,7 @@
 #include <queue>
 #include <set>
 #include <fstream>
+#include <future>
 #include <mmsystem.h>
 #include <minmax.h>
 #include <gdiplus.h>
@@ -54,6 +60,7 @@
 #include <type_traits>
 #include <gdipluspixelformats.h>
 #include <unordered_set>
+#include <unordered_map>
 #include <codecvt>
 #include <locale>
 #include <Shobjidl.h>
@@ -133,29 +133,28 @@ namespace UKControllerPlugin {
     {
         LogInfo("Initial controller load started");
 
+        // Collect everyone up first, so that the handlers can process them in one go
+        std::vector<std::shared_ptr<EuroScopeCControllerInterface>> controllers;
         EuroScopePlugIn::CController me = this->ControllerMyself();
         if (me.IsValid()) {
-            this->OnControllerPositionUpdate(me);
+            controllers.push_back(std::make_shared<EuroScopeCControllerWrapper>(me, true));
             LogInfo("Loaded myself, on " + std::string(me.GetCallsign()));
         }
 
+        // Loop through all visible controllers
         EuroScopePlugIn::CController current = this->ControllerSelectFirst();
+        while (strcmp(current.GetCallsign(), "") != 0) {
+            if (current.IsValid()) {
+                controllers.push_back(
+                    std::make_shared<EuroScopeCControllerWrapper>(current, this->ControllerIsMe(current, me))
+                );
+            }
 
-        // If there's nobody online, stop.
-        if (strcmp(current.GetCallsign(), "") == 0) {
-            LogInfo("Initial controller load complete, none found");
-            return;
+            current = this->ControllerSelectNext(current);
         }
 
-        // Loop through all visible controllers
-        do {
-            if (!current.IsValid()) {
-                continue;
-            }
-
-            this->OnControllerPositionUpdate(current);
-        } while (strcmp((current = this->ControllerSelectNext(current)).GetCallsign(), "") != 0);
-        LogInfo("Initial controller load complete");
+        this->statusEventHandler.InitialControllerLoadEvent(controllers);
+        LogInfo("Initial controller load complete, " + std::to_string(controllers.size()) + " found");
     }
 
     /*
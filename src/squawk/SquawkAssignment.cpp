@@ -1,6 +1,7 @@
 #include "pch/stdafx.h"
 #include "squawk/SquawkAssignment.h"
 #include "airfield/AirfieldOwnershipManager.h"
+#include "airfield/AirfieldOwnershipSnapshot.h"
 #include "controller/ControllerPosition.h"
 #include "flightplan/StoredFlightplan.h"
 #include "euroscope/EuroscopePluginLoopbackInterface.h"
@@ -9,6 +10,7 @@
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
 #include "euroscope/EuroScopeCControllerInterface.h"
 #include "controller/ActiveCallsignCollection.h"
+#include "controller/ActiveCallsignSnapshot.h"
 #include "flightplan/StoredFlightplanCollection.h"
 
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
@@ -20,6 +22,7 @@ using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
 using UKControllerPlugin::Controller::ControllerPosition;
 using UKControllerPlugin::Controller::ActiveCallsignCollection;
+using UKControllerPlugin::Controller::ActiveCallsignSnapshot;
 
 namespace UKControllerPlugin {
     namespace Squawk {
@@ -92,7 +95,8 @@ namespace UKControllerPlugin {
             const EuroScopeCRadarTargetInterface & radarTarget
         ) const
         {
-            if (!this->activeCallsigns.UserHasCallsign()) {
+            std::shared_ptr<const ActiveCallsignSnapshot> callsigns = this->activeCallsigns.GetSnapshot();
+            if (!callsigns->UserHasCallsign()) {
                 return false;
             }
 
@@ -100,9 +104,9 @@ namespace UKControllerPlugin {
                 return radarTarget.GetGroundSpeed() <= this->untrackedMaxAssignmentSpeed &&
                     flightPlan.GetDistanceFromOrigin() <= this->untrackedMaxAssignmentDistanceFromOrigin &&
                     !flightPlan.HasAssignedSquawk() &&
-                    this->airfieldOwnership.AirfieldOwnedBy(
+                    this->airfieldOwnership.GetSnapshot()->AirfieldOwnedBy(
                         flightPlan.GetOrigin(),
-                        this->activeCallsigns.GetUserCallsign()
+                        callsigns->GetUserCallsign()
                     );
             }
 
@@ -117,12 +121,14 @@ namespace UKControllerPlugin {
             const EuroScopeCRadarTargetInterface & radarTarget
         ) const
         {
-            if (!this->activeCallsigns.UserHasCallsign()) {
+            std::shared_ptr<const ActiveCallsignSnapshot> callsigns = this->activeCallsigns.GetSnapshot();
+            if (!callsigns->UserHasCallsign()) {
                 return false;
             }
 
-            return flightPlan.IsTrackedByUser() ? this->NeedsLocalSquawkTracked(flightPlan, radarTarget)
-                : this->NeedsLocalSquawkUntracked(flightPlan, radarTarget);
+            return flightPlan.IsTrackedByUser()
+                ? this->NeedsLocalSquawkTracked(flightPlan, radarTarget, callsigns->GetUserCallsign())
+                : this->NeedsLocalSquawkUntracked(flightPlan, radarTarget, callsigns->GetUserCallsign());
         }
 
         /*
@@ -130,10 +136,11 @@ namespace UKControllerPlugin {
         */
         bool SquawkAssignment::NeedsLocalSquawkTracked(
             const EuroScopeCFlightPlanInterface & flightPlan,
-            const EuroScopeCRadarTargetInterface & radarTarget
+            const EuroScopeCRadarTargetInterface & radarTarget,
+            const ActiveCallsign & userCallsign
         ) const
         {
-            if (this->activeCallsigns.GetUserCallsign().GetNormalisedPosition().GetType() == "CTR") {
+            if (userCallsign.GetNormalisedPosition().GetType() == "CTR") {
                 return !flightPlan.HasAssignedSquawk() && flightPlan.GetCruiseLevel() <= this->maxAssignmentAltitude;
             }
 
@@ -148,7 +155,8 @@ namespace UKControllerPlugin {
         */
         bool SquawkAssignment::NeedsLocalSquawkUntracked(
             const EuroScopeCFlightPlanInterface & flightPlan,
-            const EuroScopeCRadarTargetInterface & radarTarget
+            const EuroScopeCRadarTargetInterface & radarTarget,
+            const ActiveCallsign & userCallsign
         ) const
         {
             return (
@@ -158,9 +166,7 @@ namespace UKControllerPlugin {
                 ) &&
                 radarTarget.GetGroundSpeed() <= this->untrackedMaxAssignmentSpeed &&
                 flightPlan.GetDistanceFromOrigin() <= this->untrackedMaxAssignmentDistanceFromOrigin &&
-                this->airfieldOwnership.AirfieldOwnedBy(
-                    flightPlan.GetOrigin(), this->activeCallsigns.GetUserCallsign()
-                ) &&
+                this->airfieldOwnership.GetSnapshot()->AirfieldOwnedBy(flightPlan.GetOrigin(), userCallsign) &&
                 !flightPlan.HasAssignedSquawk();
         }
 
@@ -174,7 +180,7 @@ namespace UKControllerPlugin {
         ) const
         {
 
-            if (!this->activeCallsigns.UserHasCallsign()) {
+            if (!this->activeCallsigns.GetSnapshot()->UserHasCallsign()) {
                 return false;
             }
 
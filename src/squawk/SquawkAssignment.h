@@ -7,6 +7,7 @@ namespace UKControllerPlugin {
         class EuroscopePluginLoopbackInterface;
     }  // namespace Euroscope
     namespace Controller {
+        class ActiveCallsign;
         class ActiveCallsignCollection;
     }  // namespace Controller
     namespace Flightplan {
@@ -23,6 +24,9 @@ namespace UKControllerPlugin {
 
         /*
             Class that determines whether or not a squawk should be assigned.
+
+            Decisions are made against the published snapshots of the active callsigns and airfield
+            ownership, so each check sees a consistent view even if it isn't on the EuroScope thread.
         */
         class SquawkAssignment
         {
@@ -81,11 +85,13 @@ namespace UKControllerPlugin {
             private:
                 bool NeedsLocalSquawkTracked(
                     const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
-                    const UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+                    const UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+                    const UKControllerPlugin::Controller::ActiveCallsign & userCallsign
                 ) const;
                 bool NeedsLocalSquawkUntracked(
                     const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
-                    const UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+                    const UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+                    const UKControllerPlugin::Controller::ActiveCallsign & userCallsign
                 ) const;
 
                 // The active callsigns
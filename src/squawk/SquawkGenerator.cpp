@@ -4,11 +4,13 @@
 #include "flightplan/StoredFlightplan.h"
 #include "api/ApiException.h"
 #include "api/ApiNotFoundException.h"
+#include "api/ApiUnavailableException.h"
 #include "api/ApiInterface.h"
 #include "controller/ControllerPosition.h"
 #include "flightplan/StoredFlightplanCollection.h"
 #include "squawk/SquawkAssignment.h"
 #include "controller/ActiveCallsignCollection.h"
+#include "controller/ActiveCallsignSnapshot.h"
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
 #include "squawk/ApiSquawkAllocation.h"
@@ -24,6 +26,7 @@ using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Squawk::SquawkAssignment;
 using UKControllerPlugin::Api::ApiException;
 using UKControllerPlugin::Api::ApiNotFoundException;
+using UKControllerPlugin::Api::ApiUnavailableException;
 using UKControllerPlugin::Controller::ControllerPosition;
 using UKControllerPlugin::Squawk::ApiSquawkAllocation;
 using UKControllerPlugin::Squawk::ApiSquawkAllocationHandler;
@@ -40,7 +43,8 @@ namespace UKControllerPlugin {
             const std::shared_ptr<ApiSquawkAllocationHandler> allocations
         )
             : api(api), taskRunner(taskRunner), assignmentRules(assignmentRules), activeCallsigns(activeCallsigns),
-            storedFlightplans(storedFlightplans), allocations(allocations)
+            storedFlightplans(storedFlightplans), squawkRequests(std::make_shared<SquawkRequest>()),
+            allocations(allocations)
         {
         }
 
@@ -87,7 +91,6 @@ namespace UKControllerPlugin {
 
             this->taskRunner->QueueAsynchronousTask([this, callsign, origin, destination]() {
                 this->CreateGeneralSquawkAssignment(callsign, origin, destination);
-                this->EndSquawkUpdate(callsign);
             });
             return true;
         }
@@ -113,13 +116,13 @@ namespace UKControllerPlugin {
 
             // Get some data incase the flightplan goes away
             std::string callsign = flightplan.GetCallsign();
-            std::string unit = this->activeCallsigns.GetUserCallsign().GetNormalisedPosition().GetUnit();
+            std::string unit = this->activeCallsigns.GetSnapshot()->GetUserCallsign()
+                .GetNormalisedPosition().GetUnit();
             std::string flightRules = flightplan.GetFlightRules();
 
             // Make the request
             this->taskRunner->QueueAsynchronousTask([this, callsign, unit, flightRules]() {
                 this->CreateLocalSquawkAssignment(callsign, unit, flightRules);
-                this->EndSquawkUpdate(callsign);
             });
             return true;
         }
@@ -177,17 +180,24 @@ namespace UKControllerPlugin {
             if (this->assignmentRules.ForceAssignmentNeeded(flightplan)) {
                 this->taskRunner->QueueAsynchronousTask([this, callsign, origin, destination]() {
                     this->CreateGeneralSquawkAssignment(callsign, origin, destination);
-                    this->EndSquawkUpdate(callsign);
                 });
                 return true;
             }
 
             // Search for an existing assignment, create if necessary
             this->taskRunner->QueueAsynchronousTask([this, callsign, origin, destination]() {
-                if (!this->GetSquawkAssignment(callsign)) {
-                    this->CreateGeneralSquawkAssignment(callsign, origin, destination);
+                try {
+                    if (this->GetSquawkAssignment(callsign)) {
+                        this->EndSquawkUpdate(callsign);
+                        return;
+                    }
+                } catch (ApiUnavailableException exception) {
+                    LogInfo("Squawk API unavailable, not assigning general squawk to " + callsign);
+                    this->EndSquawkUpdate(callsign);
+                    return;
                 }
-                this->EndSquawkUpdate(callsign);
+
+                this->CreateGeneralSquawkAssignment(callsign, origin, destination);
             });
             return true;
         }
@@ -214,22 +224,32 @@ namespace UKControllerPlugin {
 
             // Get the variables out now, just incase anything goes away.
             std::string callsign = flightplan.GetCallsign();
-            std::string unit = this->activeCallsigns.GetUserCallsign().GetNormalisedPosition().GetUnit();
+            std::string unit = this->activeCallsigns.GetSnapshot()->GetUserCallsign()
+                .GetNormalisedPosition().GetUnit();
             std::string flightRules = flightplan.GetFlightRules();
 
             // Check for existing squawk assignment, create if necessary
             this->taskRunner->QueueAsynchronousTask([this, callsign, unit, flightRules]() {
-                if (!this->GetSquawkAssignment(callsign)) {
-                    this->CreateLocalSquawkAssignment(callsign, unit, flightRules);
+                try {
+                    if (this->GetSquawkAssignment(callsign)) {
+                        this->EndSquawkUpdate(callsign);
+                        return;
+                    }
+                } catch (ApiUnavailableException exception) {
+                    LogInfo("Squawk API unavailable, not assigning local squawk to " + callsign);
+                    this->EndSquawkUpdate(callsign);
+                    return;
                 }
-                this->EndSquawkUpdate(callsign);
+
+                this->CreateLocalSquawkAssignment(callsign, unit, flightRules);
             });
             return true;
         }
 
         /*
             Checks for a squawk assignment on the API for the given aircraft. Returns true after assigning the squawk
-            if one is found, false otherwise.
+            if one is found, false otherwise. If the API is unavailable, the exception is passed on so that
+            the caller doesn't try to create an assignment either.
 
             THIS FUNCTION SHOULD ONLY BE USED ON AN ASYNCHRONOUS THREAD.
         */
@@ -245,6 +265,8 @@ namespace UKControllerPlugin {
             catch (ApiNotFoundException exception) {
                 // We don't need to log here, as this is a legitimate thing
                 return false;
+            } catch (ApiUnavailableException exception) {
+                throw;
             } catch (ApiException exception) {
                 LogInfo(
                     "Error when searching for sqawk assignement, API threw exception: " + std::string(exception.what())
@@ -254,56 +276,59 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Calls the API to create a new local squawk assignment or force update an existing one.
+            Calls the API to create a new general squawk assignment or force update an existing one, without
+            waiting for the response. The squawk update is ended once the API has responded.
 
-            THIS FUNCTION SHOULD ONLY BE USED ON AN ASYNCHRONOUS THREAD.
+            The callbacks may run after the generator has gone, so they only hold on to what they need.
         */
-        bool SquawkGenerator::CreateGeneralSquawkAssignment(
+        void SquawkGenerator::CreateGeneralSquawkAssignment(
             std::string callsign,
             std::string origin,
             std::string destination
         ) const {
-            // Assign the squawk to our aircraft
-            try {
-                ApiSquawkAllocation allocation = this->api.CreateGeneralSquawkAssignment(
-                    callsign,
-                    origin,
-                    destination
-                );
-                this->allocations->AddAllocationToQueue(allocation);
-                LogInfo("API allocated general squawk " + allocation.squawk + " to " + callsign);
-                return true;
-            } catch (ApiException exception) {
-                LogInfo(
-                    "Error when create general squawk assignement, API threw exception: "
-                        + std::string(exception.what())
-                );
-                return false;
-            }
+            std::shared_ptr<ApiSquawkAllocationHandler> allocations = this->allocations;
+            std::shared_ptr<SquawkRequest> squawkRequests = this->squawkRequests;
+            this->api.CreateGeneralSquawkAssignmentAsync(
+                callsign,
+                origin,
+                destination,
+                [allocations, squawkRequests, callsign](ApiSquawkAllocation allocation) {
+                    allocations->AddAllocationToQueue(allocation);
+                    LogInfo("API allocated general squawk " + allocation.squawk + " to " + callsign);
+                    squawkRequests->End(callsign);
+                },
+                [squawkRequests, callsign](std::string error) {
+                    LogInfo("Error when create general squawk assignement, API threw exception: " + error);
+                    squawkRequests->End(callsign);
+                }
+            );
         }
 
         /*
-            Calls the API to create a new general squawk assignment or force update an existing one.
-
-            THIS FUNCTION SHOULD ONLY BE USED ON AN ASYNCHRONOUS THREAD.
+            Calls the API to create a new local squawk assignment or force update an existing one, without
+            waiting for the response. The squawk update is ended once the API has responded.
         */
-        bool SquawkGenerator::CreateLocalSquawkAssignment(
+        void SquawkGenerator::CreateLocalSquawkAssignment(
             std::string callsign,
             std::string unit,
             std::string flightRules
         ) const {
-            try {
-                ApiSquawkAllocation allocation = this->api.CreateLocalSquawkAssignment(callsign, unit, flightRules);
-                this->allocations->AddAllocationToQueue(allocation);
-                LogInfo("API allocated local squawk " + allocation.squawk + " to " + callsign);
-                return true;
-            } catch (ApiException exception) {
-                LogInfo(
-                    "Error when create general squawk assignement, API threw exception: " +
-                        std::string(exception.what())
-                );
-                return false;
-            }
+            std::shared_ptr<ApiSquawkAllocationHandler> allocations = this->allocations;
+            std::shared_ptr<SquawkRequest> squawkRequests = this->squawkRequests;
+            this->api.CreateLocalSquawkAssignmentAsync(
+                callsign,
+                unit,
+                flightRules,
+                [allocations, squawkRequests, callsign](ApiSquawkAllocation allocation) {
+                    allocations->AddAllocationToQueue(allocation);
+                    LogInfo("API allocated local squawk " + allocation.squawk + " to " + callsign);
+                    squawkRequests->End(callsign);
+                },
+                [squawkRequests, callsign](std::string error) {
+                    LogInfo("Error when create local squawk assignement, API threw exception: " + error);
+                    squawkRequests->End(callsign);
+                }
+            );
         }
 
         /*
@@ -312,7 +337,7 @@ namespace UKControllerPlugin {
         bool SquawkGenerator::StartSquawkUpdate(EuroScopeCFlightPlanInterface & flightplan)
         {
             // Lock the requests queue and mark the request as in progress. Set a holding squawk.
-            if (!this->squawkRequests.Start(flightplan.GetCallsign())) {
+            if (!this->squawkRequests->Start(flightplan.GetCallsign())) {
                 return false;
             }
 
@@ -326,7 +351,7 @@ namespace UKControllerPlugin {
         */
         void SquawkGenerator::EndSquawkUpdate(std::string callsign)
         {
-            this->squawkRequests.End(callsign);
+            this->squawkRequests->End(callsign);
         }
     }  // namespace Squawk
 }  // namespace UKControllerPlugin
@@ -71,12 +71,12 @@ namespace UKControllerPlugin {
             private:
 
                 bool GetSquawkAssignment(std::string callsign) const;
-                bool CreateGeneralSquawkAssignment(
+                void CreateGeneralSquawkAssignment(
                     std::string callsign,
                     std::string origin,
                     std::string destination
                 ) const;
-                bool CreateLocalSquawkAssignment(
+                void CreateLocalSquawkAssignment(
                     std::string callsign,
                     std::string unit,
                     std::string flightRules
@@ -99,8 +99,8 @@ namespace UKControllerPlugin {
                 // Runs tasks asynchronously from the rest of the plugin
                 UKControllerPlugin::TaskManager::TaskRunnerInterface * const taskRunner;
 
-                // A class for thread-safe tracking of squawk requests
-                UKControllerPlugin::Squawk::SquawkRequest squawkRequests;
+                // A class for thread-safe tracking of squawk requests, shared with requests still waiting on the API
+                const std::shared_ptr<UKControllerPlugin::Squawk::SquawkRequest> squawkRequests;
 
                 // Receives API squawk allocations, so that they may be assigned to flightplans on the main thread
                 const std::shared_ptr<UKControllerPlugin::Squawk::ApiSquawkAllocationHandler> allocations;
@@ -0,0 +1,202 @@
+#include "pch/stdafx.h"
+#include "tag/TagItemCache.h"
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        /*
+            Start caching values for the given item.
+        */
+        void TagItemCache::AddItem(int itemId)
+        {
+            if (itemId < 0 || this->HasItem(itemId)) {
+                return;
+            }
+
+            if (this->itemSlots.size() <= static_cast<size_t>(itemId)) {
+                this->itemSlots.resize(itemId + 1, static_cast<int>(this->noSlot));
+            }
+
+            this->itemSlots[itemId] = static_cast<int>(this->slotInvalidatedGenerations.size());
+            this->slotInvalidatedGenerations.push_back(0);
+        }
+
+        /*
+            Returns the number of aircraft that have values cached.
+        */
+        size_t TagItemCache::CountAircraft(void) const
+        {
+            return this->aircraft.size();
+        }
+
+        /*
+            Returns the number of lookups that found a valid value.
+        */
+        uint64_t TagItemCache::CountHits(void) const
+        {
+            return this->hits;
+        }
+
+        /*
+            Returns the number of lookups that had to be recalculated.
+        */
+        uint64_t TagItemCache::CountMisses(void) const
+        {
+            return this->misses;
+        }
+
+        /*
+            Returns the proportion of lookups that found a valid value.
+        */
+        double TagItemCache::GetHitRatio(void) const
+        {
+            const uint64_t lookups = this->hits + this->misses;
+            return lookups == 0 ? 0.0 : static_cast<double>(this->hits) / lookups;
+        }
+
+        /*
+            Copies the cached value into the tag item, if there is a valid one. Returns false if the value
+            needs to be calculated.
+        */
+        bool TagItemCache::GetValue(int itemId, const std::string & callsign, char itemData[16])
+        {
+            bool valid;
+            return this->GetValue(itemId, callsign, itemData, valid);
+        }
+
+        /*
+            As above, but also says whether the cached value was a valid rendering of the item or the
+            invalid placeholder.
+        */
+        bool TagItemCache::GetValue(int itemId, const std::string & callsign, char itemData[16], bool & valid)
+        {
+            const int slot = this->GetSlot(itemId);
+            if (slot == this->noSlot) {
+                return false;
+            }
+
+            auto aircraftValues = this->aircraft.find(callsign);
+            if (
+                aircraftValues == this->aircraft.cend() ||
+                aircraftValues->second.values.size() <= static_cast<size_t>(slot)
+            ) {
+                this->misses++;
+                return false;
+            }
+
+            const CachedValue & value = aircraftValues->second.values[slot];
+            if (
+                value.generation <= aircraftValues->second.invalidatedGeneration ||
+                value.generation <= this->slotInvalidatedGenerations[slot] ||
+                value.generation <= this->allInvalidatedGeneration
+            ) {
+                this->misses++;
+                return false;
+            }
+
+            memcpy(itemData, value.data, this->itemDataSize);
+            valid = value.valid;
+            this->hits++;
+            return true;
+        }
+
+        /*
+            Returns the cache slot for an item.
+        */
+        int TagItemCache::GetSlot(int itemId) const
+        {
+            return itemId < 0 || static_cast<size_t>(itemId) >= this->itemSlots.size()
+                ? this->noSlot
+                : this->itemSlots[itemId];
+        }
+
+        /*
+            Returns true if values are cached for the given item.
+        */
+        bool TagItemCache::HasItem(int itemId) const
+        {
+            return this->GetSlot(itemId) != this->noSlot;
+        }
+
+        /*
+            Invalidates every cached value for an aircraft.
+        */
+        void TagItemCache::InvalidateAircraft(const std::string & callsign)
+        {
+            auto aircraftValues = this->aircraft.find(callsign);
+            if (aircraftValues == this->aircraft.cend()) {
+                return;
+            }
+
+            aircraftValues->second.invalidatedGeneration = ++this->generation;
+        }
+
+        /*
+            Invalidates every cached value.
+        */
+        void TagItemCache::InvalidateAll(void)
+        {
+            this->allInvalidatedGeneration = ++this->generation;
+        }
+
+        /*
+            Invalidates the cached values of an item for every aircraft.
+        */
+        void TagItemCache::InvalidateItem(int itemId)
+        {
+            const int slot = this->GetSlot(itemId);
+            if (slot == this->noSlot) {
+                return;
+            }
+
+            this->slotInvalidatedGenerations[slot] = ++this->generation;
+        }
+
+        /*
+            Invalidates the cached value of an item for a single aircraft.
+        */
+        void TagItemCache::InvalidateItemForAircraft(int itemId, const std::string & callsign)
+        {
+            const int slot = this->GetSlot(itemId);
+            auto aircraftValues = this->aircraft.find(callsign);
+            if (
+                slot == this->noSlot ||
+                aircraftValues == this->aircraft.cend() ||
+                aircraftValues->second.values.size() <= static_cast<size_t>(slot)
+            ) {
+                return;
+            }
+
+            aircraftValues->second.values[slot].generation = 0;
+        }
+
+        /*
+            Removes all the cached values for an aircraft.
+        */
+        void TagItemCache::RemoveAircraft(const std::string & callsign)
+        {
+            this->aircraft.erase(callsign);
+        }
+
+        /*
+            Stores the value of an item for an aircraft, along with whether the value is valid.
+        */
+        void TagItemCache::SetValue(int itemId, const std::string & callsign, const char * itemData, bool valid)
+        {
+            const int slot = this->GetSlot(itemId);
+            if (slot == this->noSlot) {
+                return;
+            }
+
+            AircraftValues & aircraftValues = this->aircraft[callsign];
+            if (aircraftValues.values.size() <= static_cast<size_t>(slot)) {
+                aircraftValues.values.resize(this->slotInvalidatedGenerations.size());
+            }
+
+            CachedValue & value = aircraftValues.values[slot];
+            strcpy_s(value.data, this->itemDataSize, itemData);
+            value.valid = valid;
+            value.generation = ++this->generation;
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
@@ -0,0 +1,76 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        /*
+            Caches the rendered value of tag items for each aircraft, so that items whose values rarely
+            change don't have to be recalculated every time EuroScope asks for them.
+
+            Cached values are validated using generation counters. Every time something is invalidated,
+            whether it be a single item for an aircraft, everything for an aircraft or an item for every
+            aircraft, it is given the next generation. A cached value is only valid if it was stored after
+            the last invalidation that covers it.
+        */
+        class TagItemCache
+        {
+            public:
+                void AddItem(int itemId);
+                size_t CountAircraft(void) const;
+                uint64_t CountHits(void) const;
+                uint64_t CountMisses(void) const;
+                double GetHitRatio(void) const;
+                bool GetValue(int itemId, const std::string & callsign, char itemData[16]);
+                bool GetValue(int itemId, const std::string & callsign, char itemData[16], bool & valid);
+                bool HasItem(int itemId) const;
+                void InvalidateAircraft(const std::string & callsign);
+                void InvalidateAll(void);
+                void InvalidateItem(int itemId);
+                void InvalidateItemForAircraft(int itemId, const std::string & callsign);
+                void RemoveAircraft(const std::string & callsign);
+                void SetValue(int itemId, const std::string & callsign, const char * itemData, bool valid = true);
+
+                // The size of the cached values, 15 characters + 1 null terminator
+                static const size_t itemDataSize = 16;
+
+            private:
+
+                // A cached tag item value, the generation in which it was stored and whether the value was valid
+                typedef struct CachedValue {
+                    uint64_t generation = 0;
+                    bool valid = true;
+                    char data[itemDataSize];
+                } CachedValue;
+
+                // The cached values for an aircraft, indexed by the items cache slot
+                typedef struct AircraftValues {
+                    uint64_t invalidatedGeneration = 0;
+                    std::vector<CachedValue> values;
+                } AircraftValues;
+
+                int GetSlot(int itemId) const;
+
+                // The cache slot for each item id, or noSlot if the item isn't cached
+                std::vector<int> itemSlots;
+
+                // The generation in which each cache slot was last invalidated for every aircraft
+                std::vector<uint64_t> slotInvalidatedGenerations;
+
+                // Cached values by callsign
+                std::unordered_map<std::string, AircraftValues> aircraft;
+
+                // The most recent generation
+                uint64_t generation = 0;
+
+                // The generation in which everything was last invalidated
+                uint64_t allInvalidatedGeneration = 0;
+
+                // Lookup statistics
+                uint64_t hits = 0;
+                uint64_t misses = 0;
+
+                // Used when an item isn't cached
+                static const int noSlot = -1;
+        };
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
@@ -0,0 +1,55 @@
+#include "pch/stdafx.h"
+#include "tag/TagItemCacheEventHandler.h"
+#include "tag/TagItemCache.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+using UKControllerPlugin::Euroscope::UserSetting;
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        TagItemCacheEventHandler::TagItemCacheEventHandler(TagItemCache & cache)
+            : cache(cache)
+        {
+
+        }
+
+        /*
+            The flightplan has changed, so everything cached for the aircraft may have too.
+        */
+        void TagItemCacheEventHandler::FlightPlanEvent(
+            EuroScopeCFlightPlanInterface & flightPlan,
+            EuroScopeCRadarTargetInterface & radarTarget
+        ) {
+            this->cache.InvalidateAircraft(flightPlan.GetCallsign());
+        }
+
+        /*
+            The aircraft has gone, so drop its values.
+        */
+        void TagItemCacheEventHandler::FlightPlanDisconnectEvent(EuroScopeCFlightPlanInterface & flightPlan)
+        {
+            this->cache.RemoveAircraft(flightPlan.GetCallsign());
+        }
+
+        /*
+            A controller has changed some of the flightplan data, such as the ground state.
+        */
+        void TagItemCacheEventHandler::ControllerFlightPlanDataEvent(
+            EuroScopeCFlightPlanInterface & flightPlan,
+            int dataType
+        ) {
+            this->cache.InvalidateAircraft(flightPlan.GetCallsign());
+        }
+
+        /*
+            User settings affect how items are displayed, so invalidate everything.
+        */
+        void TagItemCacheEventHandler::UserSettingsUpdated(UserSetting & userSettings)
+        {
+            this->cache.InvalidateAll();
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
@@ -0,0 +1,49 @@
+#pragma once
+#include "flightplan/FlightPlanEventHandlerInterface.h"
+#include "euroscope/UserSettingAwareInterface.h"
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Tag {
+        class TagItemCache;
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        /*
+            Invalidates cached tag item values when the things that most tag items depend on change. An
+            aircraft's values are invalidated whenever its flightplan changes, and everything is invalidated
+            when the user settings change, as they affect how items are displayed.
+        */
+        class TagItemCacheEventHandler : public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface,
+            public UKControllerPlugin::Euroscope::UserSettingAwareInterface
+        {
+            public:
+                explicit TagItemCacheEventHandler(UKControllerPlugin::Tag::TagItemCache & cache);
+
+                // Inherited via FlightPlanEventHandlerInterface
+                void FlightPlanEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+                ) override;
+                void FlightPlanDisconnectEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
+                ) override;
+                void ControllerFlightPlanDataEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    int dataType
+                ) override;
+
+                // Inherited via UserSettingAwareInterface
+                void UserSettingsUpdated(UKControllerPlugin::Euroscope::UserSetting & userSettings) override;
+
+            private:
+
+                // The cache to invalidate
+                UKControllerPlugin::Tag::TagItemCache & cache;
+        };
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
@@ -2,6 +2,8 @@
 #include "tag/TagItemCollection.h"
 #include "euroscope/EuroscopePluginLoopbackInterface.h"
 #include "tag/TagItemInterface.h"
+#include "tag/TagItemWriterInterface.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
 
 using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
 
@@ -16,6 +18,30 @@ namespace UKControllerPlugin {
             return this->tagItems.size();
         }
 
+        /*
+            Returns the cache of tag item values, so that it can be invalidated.
+        */
+        TagItemCache & TagItemCollection::GetCache(void)
+        {
+            return this->cache;
+        }
+
+        /*
+            Returns the cache of tag item values.
+        */
+        const TagItemCache & TagItemCollection::GetCache(void) const
+        {
+            return this->cache;
+        }
+
+        /*
+            Returns the tag item timing statistics.
+        */
+        TagItemStatistics & TagItemCollection::GetStatistics(void)
+        {
+            return this->statistics;
+        }
+
         /*
             Returns true if a handler is registered for a particular tagItem id.
         */
@@ -24,8 +50,18 @@ namespace UKControllerPlugin {
             return this->tagItems.count(id) > 0;
         }
         /*
-            Registers a new TagItem with the collection. Registers it with Euroscope and increments
-            the next tag item ID.
+            Registers a new TagItem with the collection, caching its values for each aircraft.
+            Whatever the item depends on must invalidate the cache when it changes.
+        */
+        void TagItemCollection::RegisterCachedTagItem(int itemId, std::shared_ptr<TagItemInterface> tagItem)
+        {
+            this->RegisterTagItem(itemId, tagItem);
+            this->tagItemTable[itemId].cached = true;
+            this->cache.AddItem(itemId);
+        }
+
+        /*
+            Registers a new TagItem with the collection and adds it to the lookup table.
         */
         void TagItemCollection::RegisterTagItem(
             int itemId,
@@ -35,7 +71,17 @@ namespace UKControllerPlugin {
                 throw std::invalid_argument("Tag item already exists!");
             }
 
+            if (itemId < 0 || itemId > this->maxTagItemId) {
+                throw std::invalid_argument("Tag item id out of range!");
+            }
+
             this->tagItems[itemId] = tagItem;
+            if (this->tagItemTable.size() <= static_cast<size_t>(itemId)) {
+                this->tagItemTable.resize(itemId + 1);
+            }
+
+            this->tagItemTable[itemId].item = tagItem.get();
+            this->tagItemTable[itemId].writer = dynamic_cast<TagItemWriterInterface *>(tagItem.get());
         }
 
         /*
@@ -49,22 +95,87 @@ namespace UKControllerPlugin {
             UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
         ) const {
 
-            if (this->tagItems.count(tagItemId) == 0) {
+            if (
+                tagItemId < 0 ||
+                static_cast<size_t>(tagItemId) >= this->tagItemTable.size() ||
+                this->tagItemTable[tagItemId].item == nullptr
+            ) {
                 LogWarning("Invalid TAG item requested, id: " + std::to_string(tagItemId));
                 strcpy_s(itemData, 16, this->errorTagItemText.c_str());
                 return;
             }
 
+            const TagItemSlot & slot = this->tagItemTable[tagItemId];
+            if (!this->statistics.IsEnabled()) {
+                this->UpdateTagItem(tagItemId, slot, itemData, flightPlan, radarTarget);
+                return;
+            }
+
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            const bool valid = this->UpdateTagItem(tagItemId, slot, itemData, flightPlan, radarTarget);
+            this->statistics.Record(
+                tagItemId,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(),
+                !valid
+            );
+        }
+
+        /*
+            Produce the data for a tag item, using the cached value if the item is cached and the value is
+            still valid. Returns false if the item had to be rendered and was invalid.
+        */
+        bool TagItemCollection::UpdateTagItem(
+            int tagItemId,
+            const TagItemSlot & slot,
+            char itemData[16],
+            UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+            UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+        ) const {
+            if (!slot.cached) {
+                return this->RenderTagItem(slot, itemData, flightPlan, radarTarget);
+            }
+
+            const std::string callsign = flightPlan.GetCallsign();
+            bool cachedValid;
+            if (this->cache.GetValue(tagItemId, callsign, itemData, cachedValid)) {
+                return cachedValid;
+            }
+
+            const bool valid = this->RenderTagItem(slot, itemData, flightPlan, radarTarget);
+            this->cache.SetValue(tagItemId, callsign, itemData, valid);
+            return valid;
+        }
+
+        /*
+            Get the data from the tag item itself. If the item can write straight into the buffer,
+            let it. Returns false if the data was invalid.
+        */
+        bool TagItemCollection::RenderTagItem(
+            const TagItemSlot & slot,
+            char itemData[16],
+            UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+            UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+        ) const {
+            if (slot.writer) {
+                if (!slot.writer->WriteTagItemData(flightPlan, radarTarget, itemData)) {
+                    strcpy_s(itemData, 16, this->invalidItemText.c_str());
+                    return false;
+                }
+                return true;
+            }
+
             // Get the TAG data and check it's of a suitable length
-            std::string tagData = this->tagItems.at(tagItemId)->GetTagItemData(flightPlan, radarTarget);
+            std::string tagData = slot.item->GetTagItemData(flightPlan, radarTarget);
 
             // We only allow data of length maxlength - 1 because of null char on the end.
             if (tagData.size() > this->maxItemSize - 1) {
-                tagData = this->invalidItemText;
+                strcpy_s(itemData, 16, this->invalidItemText.c_str());
+                return false;
             }
 
             // Copy into place
             strcpy_s(itemData, 16, tagData.c_str());
+            return true;
         }
 
         /*
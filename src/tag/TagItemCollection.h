@@ -1,8 +1,12 @@
 #pragma once
+#include "tag/TagItemCache.h"
+#include "tag/TagItemStatistics.h"
+
 // Forward declarations
 namespace UKControllerPlugin {
     namespace Tag {
         class TagItemInterface;
+        class TagItemWriterInterface;
     }  // namespace Tag
 }  // namespace UKControllerPlugin
 
@@ -21,12 +25,28 @@ namespace UKControllerPlugin {
         /*
             A collection of TAG items, which can be called to
             produce data for a TAG.
+
+            Tag items are looked up in a table indexed by their id, as EuroScope calls
+            for tag item data for every aircraft on every refresh. Items that implement
+            TagItemWriterInterface write their data straight into EuroScope's buffer.
+
+            Items registered as cached have their values stored per aircraft and are only
+            recalculated once the cache has been invalidated for them.
+
+            If statistics are enabled, every request is timed and recorded against its item.
         */
         class TagItemCollection
         {
             public:
                 int CountHandlers(void) const;
+                UKControllerPlugin::Tag::TagItemCache & GetCache(void);
+                const UKControllerPlugin::Tag::TagItemCache & GetCache(void) const;
+                UKControllerPlugin::Tag::TagItemStatistics & GetStatistics(void);
                 bool HasHandlerForItemId(int id) const;
+                void RegisterCachedTagItem(
+                    int itemId,
+                    std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem
+                );
                 void RegisterTagItem(int itemId, std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem);
                 void TagItemUpdate(
                     int tagItemId,
@@ -47,9 +67,43 @@ namespace UKControllerPlugin {
                 // Max length we can have on TAG items, 15 characters + 1 null terminator
                 const size_t maxItemSize = 16;
 
+                // The largest tag item id that may be registered
+                static const int maxTagItemId = 1023;
+
             private:
+
+                // A tag item in the lookup table, the writer is null if the item doesn't implement it
+                typedef struct TagItemSlot {
+                    UKControllerPlugin::Tag::TagItemInterface * item = nullptr;
+                    UKControllerPlugin::Tag::TagItemWriterInterface * writer = nullptr;
+                    bool cached = false;
+                } TagItemSlot;
+
+                bool RenderTagItem(
+                    const TagItemSlot & slot,
+                    char itemData[16],
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+                ) const;
+                bool UpdateTagItem(
+                    int tagItemId,
+                    const TagItemSlot & slot,
+                    char itemData[16],
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+                ) const;
+
+                // Registered tag items, indexed by id
+                std::vector<TagItemSlot> tagItemTable;
+
                 // All registered tag items
                 std::map<int, std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface>> tagItems;
+
+                // Cached tag item values, updated as tag items are requested
+                mutable UKControllerPlugin::Tag::TagItemCache cache;
+
+                // Timings for each tag item, when enabled
+                mutable UKControllerPlugin::Tag::TagItemStatistics statistics;
         };
     }  // namespace Tag
 }  // namespace UKControllerPlugin
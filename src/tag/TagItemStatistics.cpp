@@ -0,0 +1,179 @@
+#include "pch/stdafx.h"
+#include "tag/TagItemStatistics.h"
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        void TagItemStatistics::Disable(void)
+        {
+            this->enabled = false;
+        }
+
+        void TagItemStatistics::Enable(void)
+        {
+            this->enabled = true;
+        }
+
+        /*
+            Formats a duration for display, in the most appropriate unit.
+        */
+        std::string TagItemStatistics::FormatNanoseconds(uint64_t nanoseconds)
+        {
+            char formatted[32];
+            if (nanoseconds < 1000) {
+                sprintf_s(formatted, "%lluns", static_cast<unsigned long long>(nanoseconds));
+            } else if (nanoseconds < 1000000) {
+                sprintf_s(formatted, "%.1fus", nanoseconds / 1000.0);
+            } else {
+                sprintf_s(formatted, "%.1fms", nanoseconds / 1000000.0);
+            }
+
+            return formatted;
+        }
+
+        /*
+            Returns the histogram bucket for a duration. Durations below four nanoseconds get a bucket each,
+            after that there are four buckets for each power of two.
+        */
+        size_t TagItemStatistics::GetBucket(uint64_t nanoseconds)
+        {
+            if (nanoseconds < 4) {
+                return static_cast<size_t>(nanoseconds);
+            }
+
+            size_t highestBit = 0;
+            for (uint64_t remaining = nanoseconds >> 1; remaining != 0; remaining >>= 1) {
+                highestBit++;
+            }
+
+            return (highestBit - 1) * 4 + ((nanoseconds >> (highestBit - 2)) & 3);
+        }
+
+        /*
+            Returns the largest duration that falls into a bucket.
+        */
+        uint64_t TagItemStatistics::GetBucketUpperBound(size_t bucket)
+        {
+            if (bucket < 4) {
+                return bucket;
+            }
+
+            const size_t shift = bucket / 4 - 1;
+            return ((uint64_t{4} + bucket % 4) << shift) + (uint64_t{1} << shift) - 1;
+        }
+
+        /*
+            Estimates a percentile from the histogram, never reporting more than the maximum seen.
+        */
+        uint64_t TagItemStatistics::GetPercentile(const ItemCounters & counters, double percentile)
+        {
+            if (counters.calls == 0) {
+                return 0;
+            }
+
+            const uint64_t target = static_cast<uint64_t>(std::ceil(counters.calls * percentile));
+            uint64_t seen = 0;
+            for (size_t bucket = 0; bucket < bucketCount; bucket++) {
+                seen += counters.buckets[bucket];
+                if (seen >= target) {
+                    return (std::min)(GetBucketUpperBound(bucket), counters.maxNanoseconds);
+                }
+            }
+
+            return counters.maxNanoseconds;
+        }
+
+        /*
+            Returns the statistics for every item that has been recorded, those taking the most time
+            overall first.
+        */
+        std::vector<TagItemStatistics::ItemStatistics> TagItemStatistics::GetStatistics(void) const
+        {
+            std::vector<ItemStatistics> statistics;
+            for (const auto & item : this->counters) {
+                statistics.push_back(
+                    {
+                        item.first,
+                        item.second.calls,
+                        item.second.totalNanoseconds,
+                        GetPercentile(item.second, 0.99),
+                        item.second.maxNanoseconds,
+                        item.second.invalid
+                    }
+                );
+            }
+
+            std::stable_sort(
+                statistics.begin(),
+                statistics.end(),
+                [](const ItemStatistics & first, const ItemStatistics & second) -> bool {
+                    return first.totalNanoseconds > second.totalNanoseconds;
+                }
+            );
+
+            return statistics;
+        }
+
+        bool TagItemStatistics::IsEnabled(void) const
+        {
+            return this->enabled;
+        }
+
+        /*
+            Record a single request for a tag item.
+        */
+        void TagItemStatistics::Record(int itemId, uint64_t nanoseconds, bool invalid)
+        {
+            if (itemId < 0) {
+                return;
+            }
+
+            if (this->itemSlots.size() <= static_cast<size_t>(itemId)) {
+                this->itemSlots.resize(itemId + 1, static_cast<int>(this->noSlot));
+            }
+
+            if (this->itemSlots[itemId] == this->noSlot) {
+                this->itemSlots[itemId] = static_cast<int>(this->counters.size());
+                this->counters.push_back({itemId, ItemCounters()});
+            }
+
+            ItemCounters & item = this->counters[this->itemSlots[itemId]].second;
+            item.calls++;
+            item.totalNanoseconds += nanoseconds;
+            item.maxNanoseconds = (std::max)(item.maxNanoseconds, nanoseconds);
+            item.buckets[GetBucket(nanoseconds)]++;
+            if (invalid) {
+                item.invalid++;
+            }
+        }
+
+        /*
+            Clear everything recorded so far.
+        */
+        void TagItemStatistics::Reset(void)
+        {
+            this->itemSlots.clear();
+            this->counters.clear();
+        }
+
+        /*
+            Summarise the statistics, one line per item.
+        */
+        std::vector<std::string> TagItemStatistics::Summarise(void) const
+        {
+            std::vector<std::string> summary;
+            for (const ItemStatistics & item : this->GetStatistics()) {
+                summary.push_back(
+                    "Item " + std::to_string(item.itemId) + ": " + std::to_string(item.calls) + " calls, " +
+                    FormatNanoseconds(item.totalNanoseconds) + " total, " +
+                    FormatNanoseconds(item.totalNanoseconds / item.calls) + " mean, " +
+                    FormatNanoseconds(item.p99Nanoseconds) + " p99, " +
+                    FormatNanoseconds(item.maxNanoseconds) + " max, " +
+                    std::to_string(item.invalid) + " invalid"
+                );
+            }
+
+            return summary;
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
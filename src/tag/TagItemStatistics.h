@@ -0,0 +1,69 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        /*
+            Records how often each tag item is requested and how long it takes to produce, so that
+            it's possible to see which items are taking up EuroScope's frame time.
+
+            Timings are recorded in a log-linear histogram per item, with four buckets per power of
+            two, so that percentiles can be estimated to within 25% without storing every sample.
+
+            Recording is disabled by default.
+        */
+        class TagItemStatistics
+        {
+            public:
+
+                // The statistics for a single tag item
+                typedef struct ItemStatistics {
+                    int itemId;
+                    uint64_t calls;
+                    uint64_t totalNanoseconds;
+                    uint64_t p99Nanoseconds;
+                    uint64_t maxNanoseconds;
+                    uint64_t invalid;
+                } ItemStatistics;
+
+                void Disable(void);
+                void Enable(void);
+                std::vector<ItemStatistics> GetStatistics(void) const;
+                bool IsEnabled(void) const;
+                void Record(int itemId, uint64_t nanoseconds, bool invalid);
+                void Reset(void);
+                std::vector<std::string> Summarise(void) const;
+
+                // The number of histogram buckets
+                static const size_t bucketCount = 256;
+
+            private:
+
+                // The counters for a single tag item
+                typedef struct ItemCounters {
+                    uint64_t calls = 0;
+                    uint64_t totalNanoseconds = 0;
+                    uint64_t maxNanoseconds = 0;
+                    uint64_t invalid = 0;
+                    std::array<uint32_t, bucketCount> buckets = {};
+                } ItemCounters;
+
+                static size_t GetBucket(uint64_t nanoseconds);
+                static uint64_t GetBucketUpperBound(size_t bucket);
+                static uint64_t GetPercentile(const ItemCounters & counters, double percentile);
+                static std::string FormatNanoseconds(uint64_t nanoseconds);
+
+                // The counter slot for each item id, or noSlot if the item hasn't been recorded
+                std::vector<int> itemSlots;
+
+                // Counters for each item that has been recorded, with the id they belong to
+                std::vector<std::pair<int, ItemCounters>> counters;
+
+                // Whether or not to record
+                bool enabled = false;
+
+                // Used when an item has no counters
+                static const int noSlot = -1;
+        };
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
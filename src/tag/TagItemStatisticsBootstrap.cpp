@@ -0,0 +1,22 @@
+#include "pch/stdafx.h"
+#include "tag/TagItemStatisticsBootstrap.h"
+#include "tag/TagItemStatisticsCommand.h"
+#include "bootstrap/PersistenceContainer.h"
+
+using UKControllerPlugin::Bootstrap::PersistenceContainer;
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        void TagItemStatisticsBootstrap::BootstrapPlugin(PersistenceContainer & container)
+        {
+            container.commandHandlers->RegisterHandler(
+                std::make_shared<TagItemStatisticsCommand>(
+                    container.tagHandler->GetStatistics(),
+                    *container.userMessager,
+                    *container.windows
+                )
+            );
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
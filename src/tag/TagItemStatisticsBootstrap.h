@@ -0,0 +1,23 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Bootstrap {
+        struct PersistenceContainer;
+    }  // namespace Bootstrap
+}  // namespace UKControllerPlugin
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        /*
+            Bootstraps the commands for tag item statistics.
+        */
+        class TagItemStatisticsBootstrap
+        {
+            public:
+                static void BootstrapPlugin(
+                    UKControllerPlugin::Bootstrap::PersistenceContainer & container
+                );
+        };
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
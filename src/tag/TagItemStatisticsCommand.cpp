@@ -0,0 +1,84 @@
+#include "pch/stdafx.h"
+#include "tag/TagItemStatisticsCommand.h"
+#include "tag/TagItemStatistics.h"
+#include "tag/TagItemStatisticsMessage.h"
+#include "message/UserMessager.h"
+#include "windows/WinApiInterface.h"
+
+using UKControllerPlugin::Message::UserMessager;
+using UKControllerPlugin::Windows::WinApiInterface;
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        TagItemStatisticsCommand::TagItemStatisticsCommand(
+            TagItemStatistics & statistics,
+            UserMessager & userMessager,
+            WinApiInterface & winApi
+        )
+            : statistics(statistics), userMessager(userMessager), winApi(winApi)
+        {
+
+        }
+
+        /*
+            Process the statistics commands.
+        */
+        bool TagItemStatisticsCommand::ProcessCommand(std::string command)
+        {
+            if (command == this->enableCommand) {
+                this->statistics.Enable();
+                this->SendStatisticsMessage("Tag item statistics enabled");
+                return true;
+            }
+
+            if (command == this->disableCommand) {
+                this->statistics.Disable();
+                this->SendStatisticsMessage("Tag item statistics disabled");
+                return true;
+            }
+
+            if (command == this->resetCommand) {
+                this->statistics.Reset();
+                this->SendStatisticsMessage("Tag item statistics reset");
+                return true;
+            }
+
+            if (command == this->dumpCommand) {
+                std::string data;
+                for (const std::string & line : this->statistics.Summarise()) {
+                    data += line + "\n";
+                }
+
+                this->winApi.WriteToFile(this->dumpFile, data, true);
+                this->SendStatisticsMessage("Tag item statistics written to " + this->dumpFile);
+                return true;
+            }
+
+            if (command != this->statsCommand) {
+                return false;
+            }
+
+            std::vector<std::string> summary = this->statistics.Summarise();
+            if (summary.empty()) {
+                this->SendStatisticsMessage(
+                    this->statistics.IsEnabled()
+                        ? "No tag item statistics recorded"
+                        : "Tag item statistics are disabled, use " + this->enableCommand + " to enable"
+                );
+                return true;
+            }
+
+            for (const std::string & line : summary) {
+                this->SendStatisticsMessage(line);
+            }
+
+            return true;
+        }
+
+        void TagItemStatisticsCommand::SendStatisticsMessage(std::string message) const
+        {
+            this->userMessager.SendMessageToUser(TagItemStatisticsMessage(message));
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
@@ -0,0 +1,68 @@
+#pragma once
+#include "command/CommandHandlerInterface.h"
+
+// Forward declarations
+namespace UKControllerPlugin {
+    namespace Message {
+        class UserMessager;
+    }  // namespace Message
+    namespace Tag {
+        class TagItemStatistics;
+    }  // namespace Tag
+    namespace Windows {
+        class WinApiInterface;
+    }  // namespace Windows
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        /*
+            Handles the dot commands for controlling and displaying tag item statistics.
+        */
+        class TagItemStatisticsCommand : public UKControllerPlugin::Command::CommandHandlerInterface
+        {
+            public:
+                TagItemStatisticsCommand(
+                    UKControllerPlugin::Tag::TagItemStatistics & statistics,
+                    UKControllerPlugin::Message::UserMessager & userMessager,
+                    UKControllerPlugin::Windows::WinApiInterface & winApi
+                );
+
+                // Inherited via CommandHandlerInterface
+                bool ProcessCommand(std::string command) override;
+
+                // Shows the statistics in the chat area
+                const std::string statsCommand = ".ukcp stats tags";
+
+                // Starts recording statistics
+                const std::string enableCommand = ".ukcp stats tags on";
+
+                // Stops recording statistics
+                const std::string disableCommand = ".ukcp stats tags off";
+
+                // Clears the statistics
+                const std::string resetCommand = ".ukcp stats tags reset";
+
+                // Writes the statistics to a file
+                const std::string dumpCommand = ".ukcp stats tags dump";
+
+                // The file that statistics are written to
+                const std::string dumpFile = "logs/tag-statistics.txt";
+
+            private:
+
+                void SendStatisticsMessage(std::string message) const;
+
+                // The statistics
+                UKControllerPlugin::Tag::TagItemStatistics & statistics;
+
+                // For sending the statistics to the user
+                UKControllerPlugin::Message::UserMessager & userMessager;
+
+                // For writing the statistics to file
+                UKControllerPlugin::Windows::WinApiInterface & winApi;
+        };
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
@@ -0,0 +1,74 @@
+#include "pch/stdafx.h"
+#include "tag/TagItemStatisticsMessage.h"
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        TagItemStatisticsMessage::TagItemStatisticsMessage(std::string line)
+            : line(line)
+        {
+
+        }
+
+        /*
+        *   Put the message in the query handler
+        */
+        std::string TagItemStatisticsMessage::MessageHandler(void) const
+        {
+            return "UKCP_Query";
+        }
+
+        /*
+        *   The message sender should be the plugin
+        */
+        std::string TagItemStatisticsMessage::MessageSender(void) const
+        {
+            return "UKCP";
+        }
+
+        std::string TagItemStatisticsMessage::MessageString(void) const
+        {
+            return this->line;
+        }
+
+        /*
+        *   The handler should be shown
+        */
+        bool TagItemStatisticsMessage::MessageShowHandler(void) const
+        {
+            return true;
+        }
+
+        /*
+        *   The message handler should be marked as unread
+        */
+        bool TagItemStatisticsMessage::MessageMarkUnread(void) const
+        {
+            return true;
+        }
+
+        /*
+        *   If they've typed this command they've asked for it, so override busy
+        */
+        bool TagItemStatisticsMessage::MessageOverrideBusy(void) const
+        {
+            return true;
+        }
+
+        /*
+        *   There may be many lines, so don't flash for each one
+        */
+        bool TagItemStatisticsMessage::MessageFlashHandler(void) const
+        {
+            return false;
+        }
+
+        /*
+        *   Don't make them click too much
+        */
+        bool TagItemStatisticsMessage::MessageRequiresConfirm(void) const
+        {
+            return false;
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
@@ -0,0 +1,42 @@
+#pragma once
+#include "tag/TagItemInterface.h"
+
+namespace UKControllerPlugin {
+    namespace Tag {
+
+        /*
+            Interface for TagItems that can write their data straight into the buffer
+            that EuroScope provides, rather than building a string for every update.
+        */
+        class TagItemWriterInterface : public UKControllerPlugin::Tag::TagItemInterface
+        {
+            public:
+                /*
+                    Write the tag item data into the buffer, returning false if it won't fit.
+                */
+                virtual bool WriteTagItemData(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+                    char itemData[16]
+                ) = 0;
+
+                // The size of the tag item buffer, 15 characters + 1 null terminator
+                static const size_t itemDataSize = 16;
+
+            protected:
+
+                /*
+                    Copy a string into the tag item buffer, returning false if it won't fit.
+                */
+                static bool CopyItemData(const std::string & data, char itemData[16])
+                {
+                    if (data.size() > itemDataSize - 1) {
+                        return false;
+                    }
+
+                    memcpy(itemData, data.c_str(), data.size() + 1);
+                    return true;
+                }
+        };
+    }  // namespace Tag
+}  // namespace UKControllerPlugin
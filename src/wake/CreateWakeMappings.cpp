@@ -2,14 +2,30 @@
 #include "wake/CreateWakeMappings.h"
 #include "message/UserMessager.h"
 #include "bootstrap/BootstrapWarningMessage.h"
+#include "wake/WakeMappingDecoder.h"
 
 using UKControllerPlugin::Wake::WakeCategoryMapper;
 using UKControllerPlugin::Message::UserMessager;
 using UKControllerPlugin::Bootstrap::BootstrapWarningMessage;
+using UKControllerPlugin::Wake::WakeMappingDecoder;
 
 namespace UKControllerPlugin {
     namespace Wake {
 
+        /*
+            Let the user know if any categories failed to load.
+        */
+        static WakeCategoryMapper FinishWakeMappings(WakeCategoryMapper mapper, int errorCount, UserMessager & messager)
+        {
+            if (!errorCount == 0) {
+                BootstrapWarningMessage message("Failed to load " + std::to_string(errorCount) + " wake categories");
+                messager.SendMessageToUser(message);
+            }
+
+            LogInfo("Loaded " + std::to_string(mapper.Count()) + " wake turbulence categories");
+            return mapper;
+        }
+
         /*
             Create the mapper from JSON data
         */
@@ -27,13 +43,22 @@ namespace UKControllerPlugin {
                 mapper.AddTypeMapping(it.key(), it.value());
             }
 
-            if (!errorCount == 0) {
-                BootstrapWarningMessage message("Failed to load " + std::to_string(errorCount) + " wake categories");
-                messager.SendMessageToUser(message);
+            return FinishWakeMappings(mapper, errorCount, messager);
+        }
+
+        /*
+            Create the mapper straight from the JSON text, decoding each category as it is parsed rather
+            than building the whole document first. If the JSON is invalid, no categories are loaded.
+        */
+        WakeCategoryMapper DecodeWakeMappings(const std::string & jsonData, UserMessager & messager)
+        {
+            WakeCategoryMapper mapper;
+            WakeMappingDecoder decoder(mapper);
+            if (!nlohmann::json::sax_parse(jsonData, &decoder)) {
+                return FinishWakeMappings(WakeCategoryMapper(), decoder.CountErrors(), messager);
             }
 
-            LogInfo("Loaded " + std::to_string(mapper.Count()) + " wake turbulence categories");
-            return mapper;
+            return FinishWakeMappings(mapper, decoder.CountErrors(), messager);
         }
     }  // namespace Wake
 }  // namespace UKControllerPlugin
@@ -13,5 +13,9 @@ namespace UKControllerPlugin {
             nlohmann::json jsonData,
             UKControllerPlugin::Message::UserMessager & messager
         );
+        WakeCategoryMapper DecodeWakeMappings(
+            const std::string & jsonData,
+            UKControllerPlugin::Message::UserMessager & messager
+        );
     }  // namespace Wake
 }  // namespace UKControllerPlugin
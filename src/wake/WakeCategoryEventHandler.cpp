@@ -48,28 +48,49 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Get item from the cache or generate if not exists
+            Returns the tag item data as a string.
         */
         std::string WakeCategoryEventHandler::GetTagItemData(
             EuroScopeCFlightPlanInterface & flightPlan,
             EuroScopeCRadarTargetInterface & radarTarget
         ) {
-            if (this->cache.count(flightPlan.GetCallsign()) == 0) {
-                std::string tagString = flightPlan.GetAircraftType()
-                    + "/" + this->mapper.MapFlightplanToCategory(flightPlan);
+            return this->GetCachedTagItem(flightPlan);
+        }
+
+        /*
+            Writes the cached tag item data into the tag item.
+        */
+        bool WakeCategoryEventHandler::WriteTagItemData(
+            EuroScopeCFlightPlanInterface & flightPlan,
+            EuroScopeCRadarTargetInterface & radarTarget,
+            char itemData[16]
+        ) {
+            return this->CopyItemData(this->GetCachedTagItem(flightPlan), itemData);
+        }
+
+        /*
+            Get item from the cache or generate if not exists
+        */
+        const std::string & WakeCategoryEventHandler::GetCachedTagItem(EuroScopeCFlightPlanInterface & flightPlan)
+        {
+            const std::string callsign = flightPlan.GetCallsign();
+            auto cachedItem = this->cache.find(callsign);
+            if (cachedItem != this->cache.cend()) {
+                return cachedItem->second;
+            }
 
-                // 15 characters is the max for tag functions, trim the aircraft type accordingly
-                if (tagString.size() > this->maxItemSize) {
-                    const unsigned int charactersToTrim = tagString.size() - this->maxItemSize;
-                    const std::string aircraftType = flightPlan.GetAircraftType();
-                    tagString = aircraftType.substr(0, aircraftType.size() - charactersToTrim) + "/"
-                        + this->mapper.MapFlightplanToCategory(flightPlan);
-                }
+            std::string tagString = flightPlan.GetAircraftType()
+                + "/" + this->mapper.MapFlightplanToCategory(flightPlan);
 
-                this->cache[flightPlan.GetCallsign()] = tagString;
+            // 15 characters is the max for tag functions, trim the aircraft type accordingly
+            if (tagString.size() > this->maxItemSize) {
+                const unsigned int charactersToTrim = tagString.size() - this->maxItemSize;
+                const std::string aircraftType = flightPlan.GetAircraftType();
+                tagString = aircraftType.substr(0, aircraftType.size() - charactersToTrim) + "/"
+                    + this->mapper.MapFlightplanToCategory(flightPlan);
             }
 
-            return this->cache.at(flightPlan.GetCallsign());
+            return this->cache.emplace(callsign, tagString).first->second;
         }
     }  // namespace Wake
 }  // namespace UKControllerPlugin
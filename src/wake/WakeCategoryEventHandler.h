@@ -1,7 +1,7 @@
 #pragma once
 #include "wake/WakeCategoryMapper.h"
 #include "flightplan/FlightPlanEventHandlerInterface.h"
-#include "tag/TagItemInterface.h"
+#include "tag/TagItemWriterInterface.h"
 
 namespace UKControllerPlugin {
     namespace Wake {
@@ -10,7 +10,7 @@ namespace UKControllerPlugin {
             Handles wake category events
         */
         class WakeCategoryEventHandler : public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface,
-            public UKControllerPlugin::Tag::TagItemInterface
+            public UKControllerPlugin::Tag::TagItemWriterInterface
         {
             public:
                 explicit WakeCategoryEventHandler(const UKControllerPlugin::Wake::WakeCategoryMapper mapper);
@@ -30,9 +30,18 @@ namespace UKControllerPlugin {
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
                     UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
                 ) override;
+                bool WriteTagItemData(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget,
+                    char itemData[16]
+                ) override;
 
             private:
 
+                const std::string & GetCachedTagItem(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
+                );
+
                 // The maximum length we can have in a tag item
                 const size_t maxItemSize = 15;
 
@@ -0,0 +1,126 @@
+#include "pch/stdafx.h"
+#include "wake/WakeMappingDecoder.h"
+
+using UKControllerPlugin::Wake::WakeCategoryMapper;
+
+namespace UKControllerPlugin {
+    namespace Wake {
+
+        WakeMappingDecoder::WakeMappingDecoder(WakeCategoryMapper & mapper)
+            : mapper(mapper)
+        {
+
+        }
+
+        /*
+            Returns how many categories were invalid.
+        */
+        int WakeMappingDecoder::CountErrors(void) const
+        {
+            return this->errorCount;
+        }
+
+        /*
+            A value that isn't a category has been found. At the top level, the file isn't the object we
+            expect so stop. For a type, count it. Anything nested inside an invalid category is ignored.
+        */
+        bool WakeMappingDecoder::InvalidCategory(void)
+        {
+            if (this->depth == 0) {
+                return false;
+            }
+
+            if (this->depth == 1) {
+                this->errorCount++;
+                LogError("Invalid wake category for type " + this->type);
+            }
+
+            return true;
+        }
+
+        bool WakeMappingDecoder::null()
+        {
+            return this->InvalidCategory();
+        }
+
+        bool WakeMappingDecoder::boolean(bool val)
+        {
+            return this->InvalidCategory();
+        }
+
+        bool WakeMappingDecoder::number_integer(number_integer_t val)
+        {
+            return this->InvalidCategory();
+        }
+
+        bool WakeMappingDecoder::number_unsigned(number_unsigned_t val)
+        {
+            return this->InvalidCategory();
+        }
+
+        bool WakeMappingDecoder::number_float(number_float_t val, const string_t & s)
+        {
+            return this->InvalidCategory();
+        }
+
+        bool WakeMappingDecoder::string(string_t & val)
+        {
+            if (this->depth != 1) {
+                return this->InvalidCategory();
+            }
+
+            this->mapper.AddTypeMapping(this->type, val);
+            return true;
+        }
+
+        bool WakeMappingDecoder::start_object(std::size_t elements)
+        {
+            if (this->depth != 0 && !this->InvalidCategory()) {
+                return false;
+            }
+
+            this->depth++;
+            return true;
+        }
+
+        bool WakeMappingDecoder::key(string_t & val)
+        {
+            if (this->depth == 1) {
+                this->type = val;
+            }
+
+            return true;
+        }
+
+        bool WakeMappingDecoder::end_object()
+        {
+            this->depth--;
+            return true;
+        }
+
+        bool WakeMappingDecoder::start_array(std::size_t elements)
+        {
+            if (!this->InvalidCategory()) {
+                return false;
+            }
+
+            this->depth++;
+            return true;
+        }
+
+        bool WakeMappingDecoder::end_array()
+        {
+            this->depth--;
+            return true;
+        }
+
+        bool WakeMappingDecoder::parse_error(
+            std::size_t position,
+            const std::string & lastToken,
+            const nlohmann::detail::exception & ex
+        ) {
+            LogError("Error wake categories file, invalid JSON: " + std::string(ex.what()));
+            return false;
+        }
+    }  // namespace Wake
+}  // namespace UKControllerPlugin
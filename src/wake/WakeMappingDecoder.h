@@ -0,0 +1,52 @@
+#pragma once
+#include "wake/WakeCategoryMapper.h"
+
+namespace UKControllerPlugin {
+    namespace Wake {
+
+        /*
+            Decodes the wake categories dependency straight into a mapper as the JSON is parsed, without
+            building a document for the whole file first.
+
+            The file is an object of aircraft type to category. Anything other than a string category is
+            counted as an error and skipped.
+        */
+        class WakeMappingDecoder : public nlohmann::json_sax<nlohmann::json>
+        {
+            public:
+                explicit WakeMappingDecoder(UKControllerPlugin::Wake::WakeCategoryMapper & mapper);
+                int CountErrors(void) const;
+                bool null() override;
+                bool boolean(bool val) override;
+                bool number_integer(number_integer_t val) override;
+                bool number_unsigned(number_unsigned_t val) override;
+                bool number_float(number_float_t val, const string_t & s) override;
+                bool string(string_t & val) override;
+                bool start_object(std::size_t elements) override;
+                bool key(string_t & val) override;
+                bool end_object() override;
+                bool start_array(std::size_t elements) override;
+                bool end_array() override;
+                bool parse_error(
+                    std::size_t position,
+                    const std::string & lastToken,
+                    const nlohmann::detail::exception & ex
+                ) override;
+
+            private:
+                bool InvalidCategory(void);
+
+                // Where the mappings go
+                UKControllerPlugin::Wake::WakeCategoryMapper & mapper;
+
+                // How far into nested objects and arrays we are
+                unsigned int depth = 0;
+
+                // The aircraft type currently being decoded
+                std::string type;
+
+                // How many categories were invalid
+                int errorCount = 0;
+        };
+    }  // namespace Wake
+}  // namespace UKControllerPlugin
@@ -7,7 +7,7 @@
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Dependency::DependencyCache;
-using UKControllerPlugin::Wake::CreateWakeMappings;
+using UKControllerPlugin::Wake::DecodeWakeMappings;
 using UKControllerPlugin::Wake::WakeCategoryEventHandler;
 
 namespace UKControllerPlugin {
@@ -21,23 +21,21 @@ namespace UKControllerPlugin {
         */
         void BootstrapPlugin(const PersistenceContainer & container, const DependencyCache & dependencies)
         {
-            // Create the data
-            nlohmann::json data;
+            // Get the data, it's decoded as it's parsed
+            std::string data;
             try {
-                data = nlohmann::json::parse(dependencies.GetDependency(dependencyFile));
-            } catch (nlohmann::json::exception) {
-                LogError("Error wake categories file, invalid JSON");
+                data = dependencies.GetDependency(dependencyFile);
             } catch (...) {
-                LogError("GEneral area parsing wake categories file");
+                LogError("Wake categories dependency not found");
             }
 
             // Create handler and register
             std::shared_ptr<WakeCategoryEventHandler> handler = std::make_shared<WakeCategoryEventHandler>(
-                CreateWakeMappings(data, *container.userMessager)
+                DecodeWakeMappings(data, *container.userMessager)
             );
 
             container.flightplanHandler->RegisterHandler(handler);
-            container.tagHandler->RegisterTagItem(tagItemId, handler);
+            container.tagHandler->RegisterCachedTagItem(tagItemId, handler);
         }
 
     }  // namespace Wake
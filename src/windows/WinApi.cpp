@@ -160,6 +160,27 @@ namespace UKControllerPlugin {
             return this->filesDirectoryW + L"/" + relativePath;
         }
 
+        /*
+            Moves a file, replacing anything already at the destination. On the same volume this is
+            a rename, so anyone reading the destination sees either the old file or the new one, never
+            a partly written one.
+        */
+        bool WinApi::MoveGivenFile(std::string from, std::string to)
+        {
+            std::string fromPath = this->GetFullPathToLocalFile(from);
+            std::string toPath = this->GetFullPathToLocalFile(to);
+            std::wstring fromWide(fromPath.length(), L' ');
+            std::copy(fromPath.begin(), fromPath.end(), fromWide.begin());
+            std::wstring toWide(toPath.length(), L' ');
+            std::copy(toPath.begin(), toPath.end(), toWide.begin());
+
+            return MoveFileEx(
+                fromWide.c_str(),
+                toWide.c_str(),
+                MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH
+            ) == TRUE;
+        }
+
         /*
             Opens a Windows message box.
         */
@@ -194,6 +215,25 @@ namespace UKControllerPlugin {
             }
         }
 
+        /*
+            Write a given string into a file, without any newline translation.
+        */
+        void WinApi::WriteToBinaryFile(std::string filename, std::string data, bool truncate)
+        {
+            std::string newFilename = this->GetFullPathToLocalFile(filename);
+            this->CreateMissingDirectories(newFilename);
+            std::ofstream file(
+                newFilename,
+                std::ofstream::out | std::ofstream::binary |
+                    ((truncate) ? std::ofstream::trunc : std::ofstream::app)
+            );
+            file.exceptions(std::ofstream::badbit);
+            if (file.is_open()) {
+                file.write(data.data(), data.size());
+                file.close();
+            }
+        }
+
         /*
             Creates the directories needed for a given file.
         */
@@ -219,6 +259,19 @@ namespace UKControllerPlugin {
             );
         }
 
+        /*
+            Return the entire contents of a file as a string, without any newline translation.
+        */
+        std::string WinApi::ReadFromBinaryFile(std::string filename)
+        {
+            return this->ReadFileContents(
+                std::ifstream(
+                    this->GetFullPathToLocalFile(filename),
+                    std::ifstream::in | std::ifstream::binary
+                )
+            );
+        }
+
         /*
             Return the entire contents of a file as a string - except the filename is widechar
         */
@@ -25,6 +25,7 @@ namespace UKControllerPlugin {
                 bool FileExists(std::string filename);
                 std::string GetFullPathToLocalFile(std::string relativePath) const;
                 std::wstring GetFullPathToLocalFile(std::wstring relativePath) const;
+                bool MoveGivenFile(std::string from, std::string to) override;
                 std::wstring FileOpenDialog(
                     std::wstring title,
                     UINT numFileTypes,
@@ -32,8 +33,10 @@ namespace UKControllerPlugin {
                 ) const override;
                 int OpenMessageBox(LPCWSTR message, LPCWSTR title, int options) override;
                 void PlayWave(LPCTSTR sound);
+                std::string ReadFromBinaryFile(std::string filename) override;
                 std::string ReadFromFile(std::string filename, bool relativePath = true);
                 std::string ReadFromFile(std::wstring filename, bool relativePath = true);
+                void WriteToBinaryFile(std::string filename, std::string data, bool truncate) override;
                 void WriteToFile(std::string filename, std::string data, bool truncate);
 
                 // Inherited via DialogProviderInterface
@@ -33,10 +33,13 @@ namespace UKControllerPlugin {
                 return this->dllInstance;
             }
             virtual std::string GetFullPathToLocalFile(std::string relativePath) const = 0;
+            virtual bool MoveGivenFile(std::string from, std::string to) = 0;
             virtual int OpenMessageBox(LPCWSTR message, LPCWSTR title, int options) = 0;
             virtual void PlayWave(LPCTSTR sound) = 0;
+            virtual std::string ReadFromBinaryFile(std::string filename) = 0;
             virtual std::string ReadFromFile(std::string filename, bool relativePath = true) = 0;
             virtual std::string ReadFromFile(std::wstring filename, bool relativePath = true) = 0;
+            virtual void WriteToBinaryFile(std::string filename, std::string data, bool truncate) = 0;
             virtual void WriteToFile(std::string filename, std::string data, bool truncate) = 0;
 
         private:
@@ -0,0 +1,38 @@
+#include "pch/pch.h"
+#include "helper/AllocationCounter.h"
+
+namespace {
+    std::atomic<size_t> allocations{0};
+}  // namespace
+
+/*
+    Replaces the global operator new so that allocations can be counted.
+*/
+void * operator new(size_t size)
+{
+    allocations++;
+    void * memory = malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void operator delete(void * memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void * memory, size_t size) noexcept
+{
+    free(memory);
+}
+
+/*
+    Returns how many times the global operator new has been called.
+*/
+size_t CountAllocations(void)
+{
+    return allocations.load();
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+/*
+    Returns how many times the global operator new has been called by the test binary.
+    Used by the disabled benchmarks to compare allocations between two code paths.
+*/
+size_t CountAllocations(void);
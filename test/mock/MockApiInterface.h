@@ -28,7 +28,7 @@ namespace UKControllerPluginTest {
                 MOCK_CONST_METHOD0(CheckApiAuthorisation, bool(void));
                 MOCK_CONST_METHOD1(DeleteSquawkAssignment, void(std::string));
                 MOCK_CONST_METHOD0(FetchDependencyManifest, UKControllerPlugin::Api::RemoteFileManifest(void));
-                MOCK_CONST_METHOD1(FetchRemoteFile, std::string(std::string));
+                MOCK_CONST_METHOD2(StreamRemoteFile, void(std::string, std::function<bool(const char *, size_t)>));
                 MOCK_CONST_METHOD1(GetAssignedSquawk, UKControllerPlugin::Squawk::ApiSquawkAllocation(std::string));
                 MOCK_CONST_METHOD0(GetApiDomain, std::string(void));
                 MOCK_CONST_METHOD0(GetApiKey, std::string(void));
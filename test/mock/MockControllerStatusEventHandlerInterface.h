@@ -16,6 +16,12 @@ namespace UKControllerPluginTest {
                     ControllerDisconnectEvent,
                     void(UKControllerPlugin::Euroscope::EuroScopeCControllerInterface &)
                 );
+                MOCK_METHOD1(
+                    InitialControllerLoadEvent,
+                    void(const std::vector<
+                        std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCControllerInterface>
+                    > &)
+                );
                 MOCK_METHOD0(SelfDisconnectEvent, void(void));
         };
     }  // namespace EventHandler
@@ -15,16 +15,43 @@ namespace UKControllerPluginTest {
                 };
 
                 /*
-                    Run the task only if required.
+                    Run the task only if required, otherwise hold on to it.
                 */
                 void QueueAsynchronousTask(std::function<void()> callback)
                 {
-                    if (this->runTask) callback();
+                    if (this->runTask) {
+                        callback();
+                    } else {
+                        this->heldTasks.push_back(callback);
+                    }
                 };
 
+                /*
+                    Returns how many tasks are being held.
+                */
+                size_t CountHeldTasks(void) const
+                {
+                    return this->heldTasks.size();
+                }
+
+                /*
+                    Run the tasks that have been held.
+                */
+                void RunHeldTasks(void)
+                {
+                    std::vector<std::function<void()>> tasks;
+                    tasks.swap(this->heldTasks);
+                    for (auto & task : tasks) {
+                        task();
+                    }
+                }
+
             private:
                 // Whether we actually want to run the task.
                 bool runTask;
+
+                // Tasks that weren't run
+                std::vector<std::function<void()>> heldTasks;
         };
     }  // namespace TaskManager
 }  // namespace UKControllerPluginTest
@@ -19,6 +19,8 @@ namespace UKControllerPluginTest {
             MOCK_METHOD3(OpenMessageBox, int(LPCWSTR, LPCWSTR, int));
             MOCK_METHOD1(PlayWave, void(LPCTSTR));
             MOCK_METHOD3(WriteToFile, void(std::string, std::string, bool));
+            MOCK_METHOD3(WriteToBinaryFile, void(std::string, std::string, bool));
+            MOCK_METHOD1(ReadFromBinaryFile, std::string(std::string));
             MOCK_METHOD2(ReadFromFileMock, std::string(std::string, bool));
             MOCK_METHOD2(ReadFromFileMock, std::string(std::wstring, bool));
             MOCK_METHOD1(FileExists, bool(std::string ));
@@ -26,6 +28,7 @@ namespace UKControllerPluginTest {
             MOCK_METHOD1(CreateFolderRecursive, bool(std::string folder));
             MOCK_METHOD1(CreateLocalFolderRecursive, bool(std::string folder));
             MOCK_METHOD1(DeleteGivenFile, bool(std::string filename));
+            MOCK_METHOD2(MoveGivenFile, bool(std::string from, std::string to));
             MOCK_CONST_METHOD1(GetFullPathToLocalFile, std::string(std::string));
 
 
@@ -0,0 +1,123 @@
+#include "pch/pch.h"
+#include "api/ApiCircuitBreaker.h"
+
+using UKControllerPlugin::Api::ApiCircuitBreaker;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Api {
+
+        class ApiCircuitBreakerTest : public Test
+        {
+            public:
+                ApiCircuitBreakerTest()
+                    : breaker(3, std::chrono::seconds(30)), probingBreaker(3, std::chrono::seconds(0))
+                {
+
+                }
+
+                void Fail(ApiCircuitBreaker & circuitBreaker, std::string endpoint, int times)
+                {
+                    for (int i = 0; i < times; i++) {
+                        circuitBreaker.RecordFailure(endpoint);
+                    }
+                }
+
+                ApiCircuitBreaker breaker;
+                ApiCircuitBreaker probingBreaker;
+        };
+
+        TEST_F(ApiCircuitBreakerTest, GetEndpointClassReturnsHostAndFirstPathSegment)
+        {
+            EXPECT_EQ(
+                "ukcp.vatsim.uk/squawk-assignment",
+                ApiCircuitBreaker::GetEndpointClass("https://ukcp.vatsim.uk/squawk-assignment/BAW123")
+            );
+        }
+
+        TEST_F(ApiCircuitBreakerTest, GetEndpointClassIgnoresQueryString)
+        {
+            EXPECT_EQ("ukcp.vatsim.uk/msl", ApiCircuitBreaker::GetEndpointClass("https://ukcp.vatsim.uk/msl?foo=bar"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, GetEndpointClassHandlesNoPath)
+        {
+            EXPECT_EQ("ukcp.vatsim.uk", ApiCircuitBreaker::GetEndpointClass("https://ukcp.vatsim.uk"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, ItAllowsRequestsByDefault)
+        {
+            EXPECT_TRUE(this->breaker.AllowRequest("ukcp/squawk"));
+            EXPECT_FALSE(this->breaker.IsOpen("ukcp/squawk"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, ItCountsConsecutiveFailures)
+        {
+            this->Fail(this->breaker, "ukcp/squawk", 2);
+            EXPECT_EQ(2u, this->breaker.CountConsecutiveFailures("ukcp/squawk"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, ItAllowsRequestsBelowTheThreshold)
+        {
+            this->Fail(this->breaker, "ukcp/squawk", 2);
+            EXPECT_TRUE(this->breaker.AllowRequest("ukcp/squawk"));
+            EXPECT_FALSE(this->breaker.IsOpen("ukcp/squawk"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, SuccessResetsTheFailureCount)
+        {
+            this->Fail(this->breaker, "ukcp/squawk", 2);
+            this->breaker.RecordSuccess("ukcp/squawk");
+            this->Fail(this->breaker, "ukcp/squawk", 2);
+            EXPECT_EQ(2u, this->breaker.CountConsecutiveFailures("ukcp/squawk"));
+            EXPECT_FALSE(this->breaker.IsOpen("ukcp/squawk"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, ItOpensAtTheThreshold)
+        {
+            this->Fail(this->breaker, "ukcp/squawk", 3);
+            EXPECT_TRUE(this->breaker.IsOpen("ukcp/squawk"));
+            EXPECT_FALSE(this->breaker.AllowRequest("ukcp/squawk"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, ItOnlyOpensForTheFailingEndpoint)
+        {
+            this->Fail(this->breaker, "ukcp/squawk", 3);
+            EXPECT_TRUE(this->breaker.AllowRequest("ukcp/hold"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, ItAllowsOneProbeOnceOpenDurationHasPassed)
+        {
+            this->Fail(this->probingBreaker, "ukcp/squawk", 3);
+            EXPECT_TRUE(this->probingBreaker.AllowRequest("ukcp/squawk"));
+            EXPECT_FALSE(this->probingBreaker.AllowRequest("ukcp/squawk"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, SuccessfulProbeClosesTheCircuit)
+        {
+            this->Fail(this->probingBreaker, "ukcp/squawk", 3);
+            EXPECT_TRUE(this->probingBreaker.AllowRequest("ukcp/squawk"));
+            this->probingBreaker.RecordSuccess("ukcp/squawk");
+            EXPECT_FALSE(this->probingBreaker.IsOpen("ukcp/squawk"));
+            EXPECT_EQ(0u, this->probingBreaker.CountConsecutiveFailures("ukcp/squawk"));
+            EXPECT_TRUE(this->probingBreaker.AllowRequest("ukcp/squawk"));
+            EXPECT_TRUE(this->probingBreaker.AllowRequest("ukcp/squawk"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, FailedProbeKeepsTheCircuitOpen)
+        {
+            this->Fail(this->probingBreaker, "ukcp/squawk", 3);
+            EXPECT_TRUE(this->probingBreaker.AllowRequest("ukcp/squawk"));
+            this->probingBreaker.RecordFailure("ukcp/squawk");
+            EXPECT_TRUE(this->probingBreaker.IsOpen("ukcp/squawk"));
+            EXPECT_TRUE(this->probingBreaker.AllowRequest("ukcp/squawk"));
+        }
+
+        TEST_F(ApiCircuitBreakerTest, FailuresWhileOpenKeepItOpen)
+        {
+            this->Fail(this->breaker, "ukcp/squawk", 4);
+            EXPECT_TRUE(this->breaker.IsOpen("ukcp/squawk"));
+            EXPECT_FALSE(this->breaker.AllowRequest("ukcp/squawk"));
+        }
+    }  // namespace Api
+}  // namespace UKControllerPluginTest
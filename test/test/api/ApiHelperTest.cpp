@@ -10,6 +10,8 @@
 #include "api/ApiNotAuthorisedException.h"
 #include "mock/MockWinApi.h"
 #include "squawk/ApiSquawkAllocation.h"
+#include "api/ApiHttpCache.h"
+#include "api/ApiUnavailableException.h"
 
 using UKControllerPlugin::Api::ApiHelper;
 using UKControllerPlugin::Api::ApiResponse;
@@ -26,6 +28,10 @@ using UKControllerPlugin::Squawk::ApiSquawkAllocation;
 using ::testing::Test;
 using ::testing::NiceMock;
 using ::testing::Return;
+using ::testing::Throw;
+using ::testing::_;
+using UKControllerPlugin::Api::ApiHttpCache;
+using UKControllerPlugin::Api::ApiUnavailableException;
 
 namespace UKControllerPluginTest {
 namespace Api {
@@ -37,7 +43,8 @@ class ApiHelperTest : public Test
         ApiHelperTest()
             : helper(mockCurlApi, GetApiRequestBuilder(), mockWinApi)
         {
-
+            ON_CALL(this->mockWinApi, MoveGivenFile(_, _))
+                .WillByDefault(Return(true));
         }
 
         ApiHelper helper;
@@ -166,20 +173,88 @@ TEST_F(ApiHelperTest, FetchDependencyManifestReturnsCorrectly)
     EXPECT_FALSE(this->helper.FetchDependencyManifest().IsEmpty());
 }
 
-TEST_F(ApiHelperTest, FetchRemoteFileReturnsFileString)
+TEST_F(ApiHelperTest, StreamRemoteFileGivesTheFileToTheReceiverAsSent)
 {
-    nlohmann::json responseJson;
-    responseJson["test"] = "hi!";
-    CurlResponse response(responseJson.dump(), false, 200);
+    EXPECT_CALL(
+            this->mockCurlApi,
+            MakeCurlRequest(CurlRequest("http://test.com/averynicefile", CurlRequest::METHOD_GET))
+        )
+        .Times(1)
+        .WillOnce(Return(CurlResponse("{\"test\":   \"hi!\"}", false, 200)));
+
+    std::string file;
+    this->helper.StreamRemoteFile(
+        "http://test.com/averynicefile",
+        [&file](const char * data, size_t length) { file.append(data, length); return true; }
+    );
+    EXPECT_EQ("{\"test\":   \"hi!\"}", file);
+}
 
+TEST_F(ApiHelperTest, StreamRemoteFileThrowsNotFoundExceptionIf404)
+{
     EXPECT_CALL(
             this->mockCurlApi,
             MakeCurlRequest(CurlRequest("http://test.com/averynicefile", CurlRequest::METHOD_GET))
         )
         .Times(1)
-        .WillOnce(Return(response));
+        .WillOnce(Return(CurlResponse("", false, 404)));
+
+    EXPECT_THROW(
+        this->helper.StreamRemoteFile("http://test.com/averynicefile", [](const char *, size_t) { return true; }),
+        ApiNotFoundException
+    );
+}
 
-    EXPECT_TRUE(responseJson.dump() == this->helper.FetchRemoteFile("http://test.com/averynicefile"));
+TEST_F(ApiHelperTest, StreamRemoteFileThrowsApiExceptionOnCurlError)
+{
+    EXPECT_CALL(
+            this->mockCurlApi,
+            MakeCurlRequest(CurlRequest("http://test.com/averynicefile", CurlRequest::METHOD_GET))
+        )
+        .Times(1)
+        .WillOnce(Return(CurlResponse("", true, -1)));
+
+    EXPECT_THROW(
+        this->helper.StreamRemoteFile("http://test.com/averynicefile", [](const char *, size_t) { return true; }),
+        ApiException
+    );
+}
+
+TEST_F(ApiHelperTest, StreamRemoteFileThrowsApiExceptionOnServerError)
+{
+    EXPECT_CALL(
+            this->mockCurlApi,
+            MakeCurlRequest(CurlRequest("http://test.com/averynicefile", CurlRequest::METHOD_GET))
+        )
+        .Times(1)
+        .WillOnce(Return(CurlResponse("", false, 500)));
+
+    EXPECT_THROW(
+        this->helper.StreamRemoteFile("http://test.com/averynicefile", [](const char *, size_t) { return true; }),
+        ApiException
+    );
+}
+
+TEST_F(ApiHelperTest, StreamRemoteFileFailsFastAfterRepeatedFailures)
+{
+    EXPECT_CALL(
+            this->mockCurlApi,
+            MakeCurlRequest(CurlRequest("http://test.com/averynicefile", CurlRequest::METHOD_GET))
+        )
+        .Times(3)
+        .WillRepeatedly(Return(CurlResponse("", true, -1)));
+
+    for (int i = 0; i < 3; i++) {
+        EXPECT_THROW(
+            this->helper.StreamRemoteFile("http://test.com/averynicefile", [](const char *, size_t) { return true; }),
+            ApiException
+        );
+    }
+
+    EXPECT_THROW(
+        this->helper.StreamRemoteFile("http://test.com/averynicefile", [](const char *, size_t) { return true; }),
+        ApiUnavailableException
+    );
 }
 
 TEST_F(ApiHelperTest, GetSquawkAssignmentHandlesNonJsonResponse)
@@ -390,6 +465,100 @@ TEST_F(ApiHelperTest, CreateLocalSquawkThrowsExceptionIfSquawkInvalid)
     EXPECT_THROW(this->helper.CreateLocalSquawkAssignment("BAW123", "EGCC", "V"), ApiException);
 }
 
+TEST_F(ApiHelperTest, CreateGeneralSquawkAssignmentAsyncCallsBackWithSquawk)
+{
+    CurlResponse response("{\"squawk\": \"1234\"}", false, 200);
+    nlohmann::json requestBody;
+    requestBody["type"] = "general";
+    requestBody["origin"] = "EGKK";
+    requestBody["destination"] = "EGCC";
+
+    EXPECT_CALL(
+            this->mockCurlApi,
+            MakeCurlRequest(GetApiCurlRequest("/squawk-assignment/BAW123", CurlRequest::METHOD_PUT, requestBody))
+        )
+        .Times(1)
+        .WillOnce(Return(response));
+
+    std::string squawk;
+    bool failed = false;
+    this->helper.CreateGeneralSquawkAssignmentAsync(
+        "BAW123",
+        "EGKK",
+        "EGCC",
+        [&squawk](ApiSquawkAllocation allocation) { squawk = allocation.callsign + ":" + allocation.squawk; },
+        [&failed](std::string error) { failed = true; }
+    );
+    EXPECT_EQ("BAW123:1234", squawk);
+    EXPECT_FALSE(failed);
+}
+
+TEST_F(ApiHelperTest, CreateLocalSquawkAssignmentAsyncCallsBackWithSquawk)
+{
+    CurlResponse response("{\"squawk\": \"1234\"}", false, 200);
+    nlohmann::json requestBody;
+    requestBody["type"] = "local";
+    requestBody["rules"] = "V";
+    requestBody["unit"] = "EGCC";
+
+    EXPECT_CALL(
+            this->mockCurlApi,
+            MakeCurlRequest(GetApiCurlRequest("/squawk-assignment/BAW123", CurlRequest::METHOD_PUT, requestBody))
+        )
+        .Times(1)
+        .WillOnce(Return(response));
+
+    std::string squawk;
+    bool failed = false;
+    this->helper.CreateLocalSquawkAssignmentAsync(
+        "BAW123",
+        "EGCC",
+        "V",
+        [&squawk](ApiSquawkAllocation allocation) { squawk = allocation.callsign + ":" + allocation.squawk; },
+        [&failed](std::string error) { failed = true; }
+    );
+    EXPECT_EQ("BAW123:1234", squawk);
+    EXPECT_FALSE(failed);
+}
+
+TEST_F(ApiHelperTest, CreateGeneralSquawkAssignmentAsyncCallsBackIfSquawkNotAllowed)
+{
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(_))
+        .Times(1)
+        .WillOnce(Return(CurlResponse("{\"squawk\": \"7500\"}", false, 200)));
+
+    bool allocated = false;
+    std::string error;
+    this->helper.CreateGeneralSquawkAssignmentAsync(
+        "BAW123",
+        "EGKK",
+        "EGCC",
+        [&allocated](ApiSquawkAllocation allocation) { allocated = true; },
+        [&error](std::string message) { error = message; }
+    );
+    EXPECT_FALSE(allocated);
+    EXPECT_EQ("Invalid squawk returned from API", error);
+}
+
+TEST_F(ApiHelperTest, CreateGeneralSquawkAssignmentAsyncFailsFastAfterRepeatedFailures)
+{
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(_))
+        .Times(3)
+        .WillRepeatedly(Return(CurlResponse("", true, -1)));
+
+    int failures = 0;
+    for (int i = 0; i < 4; i++) {
+        this->helper.CreateGeneralSquawkAssignmentAsync(
+            "BAW123",
+            "EGKK",
+            "EGCC",
+            [](ApiSquawkAllocation allocation) {},
+            [&failures](std::string error) { failures++; }
+        );
+    }
+    EXPECT_EQ(4, failures);
+}
+
 TEST_F(ApiHelperTest, DeleteSquawkAssignmentIsCalledCorrectly)
 {
     CurlResponse response("{\"squawk\": \"1234\"}", false, 204);
@@ -582,6 +751,311 @@ TEST_F(ApiHelperTest, GetDependencyReturnsJsonData)
     EXPECT_EQ(data, this->helper.GetDependency({"local", "dependency/somecoolthing", "default"}));
 }
 
+TEST_F(ApiHelperTest, GetDependencyCachesResponsesWithValidators)
+{
+    nlohmann::json data;
+    data["foo"] = "bar";
+
+    CurlResponse response(data.dump(), false, 200);
+    response.AddHeader("ETag", "\"abc\"");
+    CurlRequest expectedRequest(GetApiCurlRequest("/dependency/somecoolthing", CurlRequest::METHOD_GET));
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(expectedRequest))
+        .Times(1)
+        .WillOnce(Return(response));
+
+    nlohmann::json expectedIndex = {
+        {"http://ukcp.test.com/dependency/somecoolthing", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+    };
+    EXPECT_CALL(this->mockWinApi, WriteToBinaryFile(_, data.dump(), true))
+        .Times(1);
+
+    EXPECT_CALL(this->mockWinApi, WriteToFile(ApiHttpCache::INDEX_FILE, expectedIndex.dump(), true))
+        .Times(1);
+
+    EXPECT_EQ(data, this->helper.GetDependency({"local", "dependency/somecoolthing", "default"}));
+}
+
+TEST_F(ApiHelperTest, GetDependencyUsesCachedResponseIfNotModified)
+{
+    nlohmann::json data;
+    data["foo"] = "bar";
+
+    nlohmann::json index = {
+        {"http://ukcp.test.com/dependency/somecoolthing", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+    };
+    ON_CALL(this->mockWinApi, FileExists(_))
+        .WillByDefault(Return(true));
+
+    ON_CALL(this->mockWinApi, ReadFromBinaryFile(_))
+        .WillByDefault(Return(data.dump()));
+
+    ON_CALL(this->mockWinApi, ReadFromFileMock(ApiHttpCache::INDEX_FILE, true))
+        .WillByDefault(Return(index.dump()));
+
+    CurlRequest expectedRequest(GetApiCurlRequest("/dependency/somecoolthing", CurlRequest::METHOD_GET));
+    expectedRequest.AddHeader("If-None-Match", "\"abc\"");
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(expectedRequest))
+        .Times(1)
+        .WillOnce(Return(CurlResponse("", false, 304)));
+
+    EXPECT_EQ(data, this->helper.GetDependency({"local", "dependency/somecoolthing", "default"}));
+}
+
+TEST_F(ApiHelperTest, GetDependencyRequestsAgainIfCachedResponseMissing)
+{
+    nlohmann::json data;
+    data["foo"] = "bar";
+
+    nlohmann::json index = {
+        {"http://ukcp.test.com/dependency/somecoolthing", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+    };
+    ON_CALL(this->mockWinApi, FileExists(ApiHttpCache::INDEX_FILE))
+        .WillByDefault(Return(true));
+
+    ON_CALL(this->mockWinApi, ReadFromFileMock(ApiHttpCache::INDEX_FILE, true))
+        .WillByDefault(Return(index.dump()));
+
+    CurlRequest expectedRequest(GetApiCurlRequest("/dependency/somecoolthing", CurlRequest::METHOD_GET));
+    CurlRequest conditionalRequest = expectedRequest;
+    conditionalRequest.AddHeader("If-None-Match", "\"abc\"");
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(conditionalRequest))
+        .Times(1)
+        .WillOnce(Return(CurlResponse("", false, 304)));
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(expectedRequest))
+        .Times(1)
+        .WillOnce(Return(CurlResponse(data.dump(), false, 200)));
+
+    EXPECT_EQ(data, this->helper.GetDependency({"local", "dependency/somecoolthing", "default"}));
+}
+
+TEST_F(ApiHelperTest, GetDependencyUsesNewResponseIfModified)
+{
+    nlohmann::json data;
+    data["foo"] = "baz";
+
+    nlohmann::json index = {
+        {"http://ukcp.test.com/dependency/somecoolthing", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+    };
+    ON_CALL(this->mockWinApi, FileExists(ApiHttpCache::INDEX_FILE))
+        .WillByDefault(Return(true));
+
+    ON_CALL(this->mockWinApi, ReadFromFileMock(ApiHttpCache::INDEX_FILE, true))
+        .WillByDefault(Return(index.dump()));
+
+    CurlRequest conditionalRequest(GetApiCurlRequest("/dependency/somecoolthing", CurlRequest::METHOD_GET));
+    conditionalRequest.AddHeader("If-None-Match", "\"abc\"");
+
+    CurlResponse response(data.dump(), false, 200);
+    response.AddHeader("ETag", "\"def\"");
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(conditionalRequest))
+        .Times(1)
+        .WillOnce(Return(response));
+
+    nlohmann::json expectedIndex = {
+        {"http://ukcp.test.com/dependency/somecoolthing", {{"etag", "\"def\""}, {"last_modified", ""}}}
+    };
+    EXPECT_CALL(this->mockWinApi, WriteToBinaryFile(_, data.dump(), true))
+        .Times(1);
+
+    EXPECT_CALL(this->mockWinApi, WriteToFile(ApiHttpCache::INDEX_FILE, expectedIndex.dump(), true))
+        .Times(1);
+
+    EXPECT_EQ(data, this->helper.GetDependency({"local", "dependency/somecoolthing", "default"}));
+}
+
+TEST_F(ApiHelperTest, GetDependencyUsesCachedResponseIfApiUnavailable)
+{
+    nlohmann::json data;
+    data["foo"] = "bar";
+
+    nlohmann::json index = {
+        {"http://ukcp.test.com/dependency/somecoolthing", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+    };
+    ON_CALL(this->mockWinApi, FileExists(_))
+        .WillByDefault(Return(true));
+
+    ON_CALL(this->mockWinApi, ReadFromBinaryFile(_))
+        .WillByDefault(Return(data.dump()));
+
+    ON_CALL(this->mockWinApi, ReadFromFileMock(ApiHttpCache::INDEX_FILE, true))
+        .WillByDefault(Return(index.dump()));
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(_))
+        .Times(3)
+        .WillRepeatedly(Return(CurlResponse("", true, -1)));
+
+    for (int i = 0; i < 3; i++) {
+        EXPECT_THROW(this->helper.GetDependency({"local", "dependency/somecoolthing", "default"}), ApiException);
+    }
+
+    EXPECT_EQ(data, this->helper.GetDependency({"local", "dependency/somecoolthing", "default"}));
+}
+
+TEST_F(ApiHelperTest, ItFailsFastAfterRepeatedFailures)
+{
+    CurlRequest expectedRequest(GetApiCurlRequest("/version/1.0.0/status", CurlRequest::METHOD_GET));
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(expectedRequest))
+        .Times(3)
+        .WillRepeatedly(Return(CurlResponse("", true, -1)));
+
+    for (int i = 0; i < 3; i++) {
+        EXPECT_THROW(this->helper.UpdateCheck("1.0.0"), ApiException);
+    }
+
+    EXPECT_THROW(this->helper.UpdateCheck("1.0.0"), ApiUnavailableException);
+}
+
+TEST_F(ApiHelperTest, ItSendsAnotherProbeIfTheProbeRequestThrows)
+{
+    ApiHelper helper(this->mockCurlApi, GetApiRequestBuilder(), this->mockWinApi, std::chrono::seconds(0));
+    CurlRequest expectedRequest(GetApiCurlRequest("/version/1.0.0/status", CurlRequest::METHOD_GET));
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(expectedRequest))
+        .Times(5)
+        .WillOnce(Return(CurlResponse("", true, -1)))
+        .WillOnce(Return(CurlResponse("", true, -1)))
+        .WillOnce(Return(CurlResponse("", true, -1)))
+        .WillOnce(Throw(std::runtime_error("Oops")))
+        .WillOnce(Return(CurlResponse("{\"version_disabled\": false, \"update_available\": false}", false, 200)));
+
+    for (int i = 0; i < 3; i++) {
+        EXPECT_THROW(helper.UpdateCheck("1.0.0"), ApiException);
+    }
+
+    EXPECT_THROW(helper.UpdateCheck("1.0.0"), std::runtime_error);
+    EXPECT_EQ(ApiHelper::UPDATE_UP_TO_DATE, helper.UpdateCheck("1.0.0"));
+}
+
+TEST_F(ApiHelperTest, ItSendsAnotherAsyncProbeIfTheProbeRequestThrows)
+{
+    ApiHelper helper(this->mockCurlApi, GetApiRequestBuilder(), this->mockWinApi, std::chrono::seconds(0));
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(_))
+        .Times(5)
+        .WillOnce(Return(CurlResponse("", true, -1)))
+        .WillOnce(Return(CurlResponse("", true, -1)))
+        .WillOnce(Return(CurlResponse("", true, -1)))
+        .WillOnce(Throw(std::runtime_error("Oops")))
+        .WillOnce(Return(CurlResponse("{\"squawk\": \"1234\"}", false, 200)));
+
+    int failures = 0;
+    std::string squawk;
+    for (int i = 0; i < 5; i++) {
+        helper.CreateGeneralSquawkAssignmentAsync(
+            "BAW123",
+            "EGKK",
+            "EGCC",
+            [&squawk](ApiSquawkAllocation allocation) { squawk = allocation.squawk; },
+            [&failures](std::string error) { failures++; }
+        );
+    }
+
+    EXPECT_EQ(4, failures);
+    EXPECT_EQ("1234", squawk);
+}
+
+TEST_F(ApiHelperTest, ItFailsFastAfterRepeatedServerErrors)
+{
+    CurlRequest expectedRequest(GetApiCurlRequest("/version/1.0.0/status", CurlRequest::METHOD_GET));
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(expectedRequest))
+        .Times(3)
+        .WillRepeatedly(Return(CurlResponse("", false, 503)));
+
+    for (int i = 0; i < 3; i++) {
+        EXPECT_THROW(this->helper.UpdateCheck("1.0.0"), ApiException);
+    }
+
+    EXPECT_THROW(this->helper.UpdateCheck("1.0.0"), ApiUnavailableException);
+}
+
+TEST_F(ApiHelperTest, ItDoesntFailFastOnClientErrors)
+{
+    CurlRequest expectedRequest(GetApiCurlRequest("/version/1.0.0/status", CurlRequest::METHOD_GET));
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(expectedRequest))
+        .Times(5)
+        .WillRepeatedly(Return(CurlResponse("", false, 404)));
+
+    for (int i = 0; i < 5; i++) {
+        EXPECT_THROW(this->helper.UpdateCheck("1.0.0"), ApiNotFoundException);
+    }
+}
+
+TEST_F(ApiHelperTest, ItOnlyFailsFastForTheFailingEndpoint)
+{
+    EXPECT_CALL(
+        this->mockCurlApi,
+        MakeCurlRequest(GetApiCurlRequest("/version/1.0.0/status", CurlRequest::METHOD_GET))
+    )
+        .Times(3)
+        .WillRepeatedly(Return(CurlResponse("", true, -1)));
+
+    for (int i = 0; i < 3; i++) {
+        EXPECT_THROW(this->helper.UpdateCheck("1.0.0"), ApiException);
+    }
+
+    nlohmann::json responseData;
+    responseData["bla"] = "bla";
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET)))
+        .Times(1)
+        .WillOnce(Return(CurlResponse(responseData.dump(), false, 200)));
+
+    EXPECT_EQ(responseData, this->helper.GetMinStackLevels());
+}
+
+TEST_F(ApiHelperTest, ItCollapsesIdenticalGetRequestsInFlight)
+{
+    nlohmann::json responseData;
+    responseData["bla"] = "bla";
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET)))
+        .Times(1)
+        .WillOnce(testing::InvokeWithoutArgs([released, responseData]() {
+            released.wait();
+            return CurlResponse(responseData.dump(), false, 200);
+        }));
+
+    std::future<nlohmann::json> first = std::async(
+        std::launch::async,
+        [this]() { return this->helper.GetMinStackLevels(); }
+    );
+    std::future<nlohmann::json> second = std::async(
+        std::launch::async,
+        [this]() { return this->helper.GetMinStackLevels(); }
+    );
+
+    while (this->helper.CountCollapsedRequests() == 0) {
+        std::this_thread::yield();
+    }
+    release.set_value();
+
+    EXPECT_EQ(responseData, first.get());
+    EXPECT_EQ(responseData, second.get());
+    EXPECT_EQ(1u, this->helper.CountCollapsedRequests());
+}
+
+TEST_F(ApiHelperTest, ItDoesntCollapseGetRequestsThatArentInFlight)
+{
+    nlohmann::json responseData;
+    responseData["bla"] = "bla";
+
+    EXPECT_CALL(this->mockCurlApi, MakeCurlRequest(GetApiCurlRequest("/msl", CurlRequest::METHOD_GET)))
+        .Times(2)
+        .WillRepeatedly(Return(CurlResponse(responseData.dump(), false, 200)));
+
+    EXPECT_EQ(responseData, this->helper.GetMinStackLevels());
+    EXPECT_EQ(responseData, this->helper.GetMinStackLevels());
+    EXPECT_EQ(0u, this->helper.CountCollapsedRequests());
+}
+
 TEST_F(ApiHelperTest, AuthoriseWebsocketChannelReturnsTheAuthCode)
 {
     nlohmann::json responseData;
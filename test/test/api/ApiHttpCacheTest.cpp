@@ -0,0 +1,235 @@
+#include "pch/pch.h"
+#include "api/ApiHttpCache.h"
+#include "curl/CurlRequest.h"
+#include "curl/CurlResponse.h"
+#include "mock/MockWinApi.h"
+
+using UKControllerPlugin::Api::ApiHttpCache;
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPluginTest::Windows::MockWinApi;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::Test;
+using ::testing::_;
+
+namespace UKControllerPluginTest {
+    namespace Api {
+
+        class ApiHttpCacheTest : public Test
+        {
+            public:
+                ApiHttpCacheTest()
+                    : cache(mockWinApi)
+                {
+
+                }
+
+                void SetIndex(nlohmann::json index)
+                {
+                    ON_CALL(this->mockWinApi, FileExists(ApiHttpCache::INDEX_FILE))
+                        .WillByDefault(Return(true));
+
+                    ON_CALL(this->mockWinApi, ReadFromFileMock(ApiHttpCache::INDEX_FILE, true))
+                        .WillByDefault(Return(index.dump()));
+                }
+
+                CurlResponse MakeResponse(std::string etag, std::string lastModified)
+                {
+                    CurlResponse response("{\"foo\": \"bar\"}", false, 200);
+                    if (etag != "") {
+                        response.AddHeader("ETag", etag);
+                    }
+
+                    if (lastModified != "") {
+                        response.AddHeader("Last-Modified", lastModified);
+                    }
+
+                    return response;
+                }
+
+                NiceMock<MockWinApi> mockWinApi;
+                ApiHttpCache cache;
+        };
+
+        TEST_F(ApiHttpCacheTest, ItStartsEmptyIfNoIndex)
+        {
+            EXPECT_EQ(0, this->cache.CountEntries());
+        }
+
+        TEST_F(ApiHttpCacheTest, ItLoadsTheIndex)
+        {
+            this->SetIndex({
+                {"http://ukcp.test.com/a", {{"etag", "\"abc\""}, {"last_modified", ""}}},
+                {"http://ukcp.test.com/b", {{"etag", ""}, {"last_modified", "Wed, 21 Oct 2015 07:28:00 GMT"}}}
+            });
+            EXPECT_EQ(2, this->cache.CountEntries());
+        }
+
+        TEST_F(ApiHttpCacheTest, ItIgnoresInvalidIndexEntries)
+        {
+            this->SetIndex({
+                {"http://ukcp.test.com/a", {{"etag", "\"abc\""}, {"last_modified", ""}}},
+                {"http://ukcp.test.com/b", {{"etag", 123}}},
+                {"http://ukcp.test.com/c", "nope"}
+            });
+            EXPECT_EQ(1, this->cache.CountEntries());
+        }
+
+        TEST_F(ApiHttpCacheTest, ItStartsEmptyIfIndexIsCorrupt)
+        {
+            ON_CALL(this->mockWinApi, FileExists(ApiHttpCache::INDEX_FILE))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWinApi, ReadFromFileMock(ApiHttpCache::INDEX_FILE, true))
+                .WillByDefault(Return("{notjson"));
+
+            EXPECT_EQ(0, this->cache.CountEntries());
+        }
+
+        TEST_F(ApiHttpCacheTest, AddConditionalHeadersReturnsFalseIfNotCached)
+        {
+            CurlRequest request("http://ukcp.test.com/a", CurlRequest::METHOD_GET);
+            EXPECT_FALSE(this->cache.AddConditionalHeaders(request));
+            EXPECT_EQ(request.cbegin(), request.cend());
+        }
+
+        TEST_F(ApiHttpCacheTest, AddConditionalHeadersAddsValidators)
+        {
+            this->SetIndex({
+                {"http://ukcp.test.com/a", {{"etag", "\"abc\""}, {"last_modified", "Wed, 21 Oct 2015 07:28:00 GMT"}}}
+            });
+
+            CurlRequest request("http://ukcp.test.com/a", CurlRequest::METHOD_GET);
+            CurlRequest expected("http://ukcp.test.com/a", CurlRequest::METHOD_GET);
+            expected.AddHeader("If-None-Match", "\"abc\"");
+            expected.AddHeader("If-Modified-Since", "Wed, 21 Oct 2015 07:28:00 GMT");
+
+            EXPECT_TRUE(this->cache.AddConditionalHeaders(request));
+            EXPECT_EQ(expected, request);
+        }
+
+        TEST_F(ApiHttpCacheTest, AddConditionalHeadersOnlyAddsValidatorsThatExist)
+        {
+            this->SetIndex({
+                {"http://ukcp.test.com/a", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+            });
+
+            CurlRequest request("http://ukcp.test.com/a", CurlRequest::METHOD_GET);
+            CurlRequest expected("http://ukcp.test.com/a", CurlRequest::METHOD_GET);
+            expected.AddHeader("If-None-Match", "\"abc\"");
+
+            EXPECT_TRUE(this->cache.AddConditionalHeaders(request));
+            EXPECT_EQ(expected, request);
+        }
+
+        TEST_F(ApiHttpCacheTest, StoreWritesBodyAndIndex)
+        {
+            EXPECT_CALL(this->mockWinApi, CreateLocalFolderRecursive(ApiHttpCache::CACHE_FOLDER))
+                .Times(1)
+                .WillOnce(Return(true));
+
+            const std::string body = ApiHttpCache::CACHE_FOLDER + "/05cabf34aad55e41.cache";
+            testing::InSequence sequence;
+            EXPECT_CALL(this->mockWinApi, WriteToBinaryFile(body + ".tmp", "{\"foo\": \"bar\"}", true))
+                .Times(1);
+
+            EXPECT_CALL(this->mockWinApi, MoveGivenFile(body + ".tmp", body))
+                .Times(1)
+                .WillOnce(Return(true));
+
+            nlohmann::json expectedIndex = {
+                {"http://ukcp.test.com/a", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+            };
+            EXPECT_CALL(this->mockWinApi, WriteToFile(ApiHttpCache::INDEX_FILE, expectedIndex.dump(), true))
+                .Times(1);
+
+            this->cache.Store("http://ukcp.test.com/a", this->MakeResponse("\"abc\"", ""));
+            EXPECT_EQ(1, this->cache.CountEntries());
+        }
+
+        TEST_F(ApiHttpCacheTest, StoreDoesntUpdateTheIndexIfTheBodyCantBeMovedIntoPlace)
+        {
+            this->SetIndex({
+                {"http://ukcp.test.com/a", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+            });
+
+            EXPECT_CALL(this->mockWinApi, WriteToBinaryFile(_, "{\"foo\": \"bar\"}", true))
+                .Times(1);
+
+            EXPECT_CALL(this->mockWinApi, MoveGivenFile(_, _))
+                .Times(1)
+                .WillOnce(Return(false));
+
+            EXPECT_CALL(this->mockWinApi, WriteToFile(ApiHttpCache::INDEX_FILE, "{}", true))
+                .Times(1);
+
+            this->cache.Store("http://ukcp.test.com/a", this->MakeResponse("\"def\"", ""));
+            EXPECT_EQ(0, this->cache.CountEntries());
+        }
+
+        TEST_F(ApiHttpCacheTest, StoreDoesNothingWithoutValidators)
+        {
+            EXPECT_CALL(this->mockWinApi, WriteToBinaryFile(_, _, _))
+                .Times(0);
+
+            EXPECT_CALL(this->mockWinApi, WriteToFile(_, _, _))
+                .Times(0);
+
+            this->cache.Store("http://ukcp.test.com/a", this->MakeResponse("", ""));
+            EXPECT_EQ(0, this->cache.CountEntries());
+        }
+
+        TEST_F(ApiHttpCacheTest, StoreForgetsEntryIfResponseHasNoValidators)
+        {
+            this->SetIndex({
+                {"http://ukcp.test.com/a", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+            });
+
+            EXPECT_CALL(this->mockWinApi, WriteToFile(ApiHttpCache::INDEX_FILE, "{}", true))
+                .Times(1);
+
+            this->cache.Store("http://ukcp.test.com/a", this->MakeResponse("", ""));
+            EXPECT_EQ(0, this->cache.CountEntries());
+        }
+
+        TEST_F(ApiHttpCacheTest, GetCachedBodyReturnsBodyFromDisk)
+        {
+            ON_CALL(this->mockWinApi, FileExists(_))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWinApi, ReadFromBinaryFile(_))
+                .WillByDefault(Return("{\"foo\": \"bar\"}\r\n"));
+
+            this->SetIndex({
+                {"http://ukcp.test.com/a", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+            });
+
+            EXPECT_EQ("{\"foo\": \"bar\"}\r\n", this->cache.GetCachedBody("http://ukcp.test.com/a"));
+        }
+
+        TEST_F(ApiHttpCacheTest, GetCachedBodyReturnsNothingIfNotCached)
+        {
+            EXPECT_FALSE(this->cache.GetCachedBody("http://ukcp.test.com/a"));
+        }
+
+        TEST_F(ApiHttpCacheTest, GetCachedBodyReturnsNothingIfBodyMissing)
+        {
+            this->SetIndex({
+                {"http://ukcp.test.com/a", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+            });
+
+            EXPECT_FALSE(this->cache.GetCachedBody("http://ukcp.test.com/a"));
+        }
+
+        TEST_F(ApiHttpCacheTest, ForgetRemovesEntry)
+        {
+            this->SetIndex({
+                {"http://ukcp.test.com/a", {{"etag", "\"abc\""}, {"last_modified", ""}}}
+            });
+
+            this->cache.Forget("http://ukcp.test.com/a");
+            EXPECT_EQ(0, this->cache.CountEntries());
+        }
+    }  // namespace Api
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,183 @@
+#include "pch/pch.h"
+#include "api/ApiRequestCollapser.h"
+#include "api/ApiException.h"
+#include "curl/CurlRequest.h"
+#include "curl/CurlResponse.h"
+
+using UKControllerPlugin::Api::ApiException;
+using UKControllerPlugin::Api::ApiRequestCollapser;
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Api {
+
+        class ApiRequestCollapserTest : public Test
+        {
+            public:
+                ApiRequestCollapserTest()
+                    : request("http://ukcp.test.com/hold/profile", CurlRequest::METHOD_GET)
+                {
+
+                }
+
+                /*
+                    Waits until the collapser has seen the given number of collapsed requests.
+                */
+                void WaitForCollapsed(unsigned long long count)
+                {
+                    while (this->collapser.CountCollapsed() < count) {
+                        std::this_thread::yield();
+                    }
+                }
+
+                CurlRequest request;
+                ApiRequestCollapser collapser;
+        };
+
+        TEST_F(ApiRequestCollapserTest, GetRequestKeyIsTheSameForIdenticalRequests)
+        {
+            CurlRequest other("http://ukcp.test.com/hold/profile", CurlRequest::METHOD_GET);
+            EXPECT_EQ(ApiRequestCollapser::GetRequestKey(this->request), ApiRequestCollapser::GetRequestKey(other));
+        }
+
+        TEST_F(ApiRequestCollapserTest, GetRequestKeyDiffersByMethod)
+        {
+            CurlRequest other("http://ukcp.test.com/hold/profile", CurlRequest::METHOD_DELETE);
+            EXPECT_NE(ApiRequestCollapser::GetRequestKey(this->request), ApiRequestCollapser::GetRequestKey(other));
+        }
+
+        TEST_F(ApiRequestCollapserTest, GetRequestKeyDiffersByUri)
+        {
+            CurlRequest other("http://ukcp.test.com/hold/profile/1", CurlRequest::METHOD_GET);
+            EXPECT_NE(ApiRequestCollapser::GetRequestKey(this->request), ApiRequestCollapser::GetRequestKey(other));
+        }
+
+        TEST_F(ApiRequestCollapserTest, GetRequestKeyDiffersByBody)
+        {
+            CurlRequest first("http://ukcp.test.com/hold/profile", CurlRequest::METHOD_POST);
+            first.SetBody("{\"foo\": \"bar\"}");
+            CurlRequest second("http://ukcp.test.com/hold/profile", CurlRequest::METHOD_POST);
+            second.SetBody("{\"foo\": \"baz\"}");
+            EXPECT_NE(ApiRequestCollapser::GetRequestKey(first), ApiRequestCollapser::GetRequestKey(second));
+        }
+
+        TEST_F(ApiRequestCollapserTest, GetRequestKeyDiffersByHeaders)
+        {
+            CurlRequest other("http://ukcp.test.com/hold/profile", CurlRequest::METHOD_GET);
+            other.AddHeader("If-None-Match", "\"abc\"");
+            EXPECT_NE(ApiRequestCollapser::GetRequestKey(this->request), ApiRequestCollapser::GetRequestKey(other));
+        }
+
+        TEST_F(ApiRequestCollapserTest, ItSendsRequestsThatArentInFlight)
+        {
+            int calls = 0;
+            auto send = [&calls]() { calls++; return CurlResponse("foo", false, 200); };
+
+            EXPECT_EQ("foo", this->collapser.Send(this->request, send).GetResponse());
+            EXPECT_EQ("foo", this->collapser.Send(this->request, send).GetResponse());
+            EXPECT_EQ(2, calls);
+            EXPECT_EQ(2u, this->collapser.CountSent());
+            EXPECT_EQ(0u, this->collapser.CountCollapsed());
+            EXPECT_EQ(0u, this->collapser.CountInFlight());
+        }
+
+        TEST_F(ApiRequestCollapserTest, ItCollapsesIdenticalRequestsInFlight)
+        {
+            std::promise<void> release;
+            std::shared_future<void> released = release.get_future().share();
+            std::atomic<int> calls(0);
+            auto send = [&calls, released]() {
+                calls++;
+                released.wait();
+                return CurlResponse("foo", false, 200);
+            };
+
+            std::future<CurlResponse> first = std::async(
+                std::launch::async,
+                [this, send]() { return this->collapser.Send(this->request, send); }
+            );
+            while (this->collapser.CountInFlight() == 0) {
+                std::this_thread::yield();
+            }
+
+            std::future<CurlResponse> second = std::async(
+                std::launch::async,
+                [this, send]() { return this->collapser.Send(this->request, send); }
+            );
+            std::future<CurlResponse> third = std::async(
+                std::launch::async,
+                [this, send]() { return this->collapser.Send(this->request, send); }
+            );
+            this->WaitForCollapsed(2);
+            release.set_value();
+
+            EXPECT_EQ("foo", first.get().GetResponse());
+            EXPECT_EQ("foo", second.get().GetResponse());
+            EXPECT_EQ("foo", third.get().GetResponse());
+            EXPECT_EQ(1, calls);
+            EXPECT_EQ(1u, this->collapser.CountSent());
+            EXPECT_EQ(2u, this->collapser.CountCollapsed());
+            EXPECT_EQ(0u, this->collapser.CountInFlight());
+        }
+
+        TEST_F(ApiRequestCollapserTest, ItDoesntCollapseDifferentRequests)
+        {
+            std::promise<void> release;
+            std::shared_future<void> released = release.get_future().share();
+            auto send = [released]() {
+                released.wait();
+                return CurlResponse("foo", false, 200);
+            };
+
+            CurlRequest other("http://ukcp.test.com/hold/profile/1", CurlRequest::METHOD_GET);
+            std::future<CurlResponse> first = std::async(
+                std::launch::async,
+                [this, send]() { return this->collapser.Send(this->request, send); }
+            );
+            std::future<CurlResponse> second = std::async(
+                std::launch::async,
+                [this, send, other]() { return this->collapser.Send(other, send); }
+            );
+            while (this->collapser.CountInFlight() < 2) {
+                std::this_thread::yield();
+            }
+            release.set_value();
+
+            first.get();
+            second.get();
+            EXPECT_EQ(2u, this->collapser.CountSent());
+            EXPECT_EQ(0u, this->collapser.CountCollapsed());
+        }
+
+        TEST_F(ApiRequestCollapserTest, ItPassesExceptionsToEveryWaiter)
+        {
+            std::promise<void> release;
+            std::shared_future<void> released = release.get_future().share();
+            auto send = [released]() -> CurlResponse {
+                released.wait();
+                throw ApiException("Down");
+            };
+
+            std::future<CurlResponse> first = std::async(
+                std::launch::async,
+                [this, send]() { return this->collapser.Send(this->request, send); }
+            );
+            while (this->collapser.CountInFlight() == 0) {
+                std::this_thread::yield();
+            }
+
+            std::future<CurlResponse> second = std::async(
+                std::launch::async,
+                [this, send]() { return this->collapser.Send(this->request, send); }
+            );
+            this->WaitForCollapsed(1);
+            release.set_value();
+
+            EXPECT_THROW(first.get(), ApiException);
+            EXPECT_THROW(second.get(), ApiException);
+            EXPECT_EQ(0u, this->collapser.CountInFlight());
+        }
+    }  // namespace Api
+}  // namespace UKControllerPluginTest
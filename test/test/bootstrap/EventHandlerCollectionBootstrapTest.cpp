@@ -35,7 +35,7 @@ namespace UKControllerPluginTest {
 
         TEST_F(EventHandlerCollectionBootstrapTest, BootstrapPluginCreatesFlightplanHandler)
         {
-            EXPECT_EQ(0, this->container.flightplanHandler->CountHandlers());
+            EXPECT_EQ(1, this->container.flightplanHandler->CountHandlers());
         }
 
         TEST_F(EventHandlerCollectionBootstrapTest, BootstrapPluginCreatesControllerHandler)
@@ -65,7 +65,7 @@ namespace UKControllerPluginTest {
 
         TEST_F(EventHandlerCollectionBootstrapTest, BootstrapPluginCreatesUserSettingAwareHandler)
         {
-            EXPECT_EQ(0, this->container.userSettingHandlers->Count());
+            EXPECT_EQ(1, this->container.userSettingHandlers->Count());
         }
 
         TEST_F(EventHandlerCollectionBootstrapTest, BootstrapPluginCreatesCommandHandler)
@@ -83,5 +83,6 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(1, this->container.timedHandler->CountHandlers());
             EXPECT_EQ(1, this->container.timedHandler->CountHandlersForFrequency(3));
         }
+
     }  // namespace Bootstrap
 }  // namespace UKControllerPluginTest
@@ -1,5 +1,6 @@
 #include "pch/pch.h"
 #include "controller/ActiveCallsignCollection.h"
+#include "controller/ActiveCallsignSnapshot.h"
 #include "controller/ActiveCallsign.h"
 #include "controller/ControllerPosition.h"
 
@@ -251,5 +252,75 @@ namespace UKControllerPluginTest {
             EXPECT_FALSE(collection.PositionActive("LON_N_CTR"));
             EXPECT_FALSE(collection.CallsignActive("LON_S_CTR"));
         }
+
+        TEST(ActiveCallsignCollection, GenerationChangesWhenCallsignsChange)
+        {
+            ActiveCallsignCollection collection;
+            ControllerPosition pos("LON_S_CTR", 129.420, "CTR", { "EGKK", "EGLL", "EGLC" });
+            ActiveCallsign callsign("LON_S_CTR", "Testy McTest", pos);
+            unsigned int generation = collection.GetGeneration();
+
+            collection.AddCallsign(callsign);
+            EXPECT_NE(generation, collection.GetGeneration());
+            generation = collection.GetGeneration();
+
+            collection.RemoveCallsign(callsign);
+            EXPECT_NE(generation, collection.GetGeneration());
+            generation = collection.GetGeneration();
+
+            collection.Flush();
+            EXPECT_NE(generation, collection.GetGeneration());
+        }
+
+        /*
+            Times adding 300 callsigns, as happens when the plugin loads with controllers already online,
+            comparing adding each one on its own with adding them all in one batch. Disabled by default as
+            it only reports timings, to run it use --gtest_also_run_disabled_tests.
+        */
+        TEST(ActiveCallsignCollection, DISABLED_AddingCallsignsInABatchIsFasterThanAddingThemOneByOne)
+        {
+            std::vector<std::unique_ptr<ControllerPosition>> positions;
+            std::vector<ActiveCallsign> callsigns;
+            for (int i = 0; i < 300; i++) {
+                positions.push_back(std::make_unique<ControllerPosition>(
+                    "POS_" + std::to_string(i) + "_CTR", 120.0, "CTR", std::vector<std::string>{}
+                ));
+                callsigns.push_back(
+                    ActiveCallsign("POS_" + std::to_string(i) + "_CTR", "Testy McTestface", *positions.back())
+                );
+            }
+
+            const int iterations = 10;
+            std::chrono::steady_clock::duration oneByOne(0);
+            std::chrono::steady_clock::duration batched(0);
+            for (int i = 0; i < iterations; i++) {
+                ActiveCallsignCollection unbatchedCollection;
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                for (const ActiveCallsign & callsign : callsigns) {
+                    unbatchedCollection.AddCallsign(callsign);
+                }
+                oneByOne += std::chrono::steady_clock::now() - start;
+
+                ActiveCallsignCollection batchedCollection;
+                start = std::chrono::steady_clock::now();
+                {
+                    ActiveCallsignCollection::Batch batch(batchedCollection);
+                    for (const ActiveCallsign & callsign : callsigns) {
+                        batchedCollection.AddCallsign(callsign);
+                    }
+                }
+                batched += std::chrono::steady_clock::now() - start;
+
+                EXPECT_TRUE(batchedCollection.GetSnapshot()->CallsignActive("POS_299_CTR"));
+            }
+
+            const long long oneByOneMicroseconds =
+                std::chrono::duration_cast<std::chrono::microseconds>(oneByOne).count() / iterations;
+            const long long batchedMicroseconds =
+                std::chrono::duration_cast<std::chrono::microseconds>(batched).count() / iterations;
+            RecordProperty("OneByOneMicroseconds", static_cast<int>(oneByOneMicroseconds));
+            RecordProperty("BatchedMicroseconds", static_cast<int>(batchedMicroseconds));
+            EXPECT_LT(batchedMicroseconds, oneByOneMicroseconds);
+        }
     }  // namespace Controller
 }  // namespace UKControllerPluginTest
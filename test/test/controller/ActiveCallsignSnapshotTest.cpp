@@ -0,0 +1,157 @@
+#include "pch/pch.h"
+#include "controller/ActiveCallsignSnapshot.h"
+#include "controller/ActiveCallsignCollection.h"
+#include "controller/ActiveCallsign.h"
+#include "controller/ControllerPosition.h"
+
+using UKControllerPlugin::Controller::ActiveCallsignSnapshot;
+using UKControllerPlugin::Controller::ActiveCallsignCollection;
+using UKControllerPlugin::Controller::ActiveCallsign;
+using UKControllerPlugin::Controller::ControllerPosition;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Controller {
+
+        class ActiveCallsignSnapshotTest : public Test
+        {
+            public:
+                ActiveCallsignSnapshotTest(void)
+                    : position1("LON_S_CTR", 129.420, "CTR", { "EGKK", "EGLL", "EGLC" }),
+                    position2("LON_N_CTR", 133.700, "CTR", { "EGCC", "EGGP" }),
+                    callsign1("LON_S_CTR", "Testy McTest", position1),
+                    callsign2("LON_S_CTR_1", "Testy McTest 2", position1),
+                    callsign3("LON_N_CTR", "Testy McTest 3", position2)
+                {
+
+                }
+
+                ControllerPosition position1;
+                ControllerPosition position2;
+                ActiveCallsign callsign1;
+                ActiveCallsign callsign2;
+                ActiveCallsign callsign3;
+                ActiveCallsignCollection collection;
+        };
+
+        TEST_F(ActiveCallsignSnapshotTest, ItStartsEmpty)
+        {
+            std::shared_ptr<const ActiveCallsignSnapshot> snapshot = this->collection.GetSnapshot();
+            EXPECT_FALSE(snapshot->CallsignActive("LON_S_CTR"));
+            EXPECT_FALSE(snapshot->PositionActive("LON_S_CTR"));
+            EXPECT_FALSE(snapshot->UserHasCallsign());
+            EXPECT_THROW(snapshot->GetUserCallsign(), std::out_of_range);
+        }
+
+        TEST_F(ActiveCallsignSnapshotTest, ItContainsTheActiveCallsigns)
+        {
+            this->collection.AddCallsign(this->callsign1);
+            this->collection.AddCallsign(this->callsign2);
+
+            std::shared_ptr<const ActiveCallsignSnapshot> snapshot = this->collection.GetSnapshot();
+            EXPECT_TRUE(snapshot->CallsignActive("LON_S_CTR"));
+            EXPECT_TRUE(snapshot->CallsignActive("LON_S_CTR_1"));
+            EXPECT_FALSE(snapshot->CallsignActive("LON_N_CTR"));
+            EXPECT_TRUE(snapshot->PositionActive("LON_S_CTR"));
+            EXPECT_FALSE(snapshot->PositionActive("LON_N_CTR"));
+            EXPECT_EQ(this->collection.GetGeneration(), snapshot->GetGeneration());
+        }
+
+        TEST_F(ActiveCallsignSnapshotTest, ItHasTheLeadCallsignForEachPosition)
+        {
+            this->collection.AddCallsign(this->callsign2);
+            this->collection.AddCallsign(this->callsign1);
+
+            EXPECT_TRUE(this->callsign1 == this->collection.GetSnapshot()->GetLeadCallsignForPosition("LON_S_CTR"));
+            EXPECT_THROW(this->collection.GetSnapshot()->GetLeadCallsignForPosition("LON_N_CTR"), std::out_of_range);
+        }
+
+        TEST_F(ActiveCallsignSnapshotTest, ItHasTheUserCallsign)
+        {
+            this->collection.AddUserCallsign(this->callsign3);
+
+            std::shared_ptr<const ActiveCallsignSnapshot> snapshot = this->collection.GetSnapshot();
+            EXPECT_TRUE(snapshot->UserHasCallsign());
+            EXPECT_TRUE(this->callsign3 == snapshot->GetUserCallsign());
+        }
+
+        TEST_F(ActiveCallsignSnapshotTest, OldSnapshotsDontChange)
+        {
+            this->collection.AddUserCallsign(this->callsign1);
+            std::shared_ptr<const ActiveCallsignSnapshot> snapshot = this->collection.GetSnapshot();
+
+            this->collection.Flush();
+
+            EXPECT_TRUE(snapshot->UserHasCallsign());
+            EXPECT_TRUE(snapshot->CallsignActive("LON_S_CTR"));
+            EXPECT_FALSE(this->collection.GetSnapshot()->UserHasCallsign());
+            EXPECT_FALSE(this->collection.GetSnapshot()->CallsignActive("LON_S_CTR"));
+        }
+
+        TEST_F(ActiveCallsignSnapshotTest, RemovingACallsignPublishesANewSnapshot)
+        {
+            this->collection.AddCallsign(this->callsign1);
+            this->collection.AddCallsign(this->callsign2);
+            this->collection.RemoveCallsign(this->callsign1);
+
+            std::shared_ptr<const ActiveCallsignSnapshot> snapshot = this->collection.GetSnapshot();
+            EXPECT_FALSE(snapshot->CallsignActive("LON_S_CTR"));
+            EXPECT_TRUE(snapshot->PositionActive("LON_S_CTR"));
+            EXPECT_TRUE(this->callsign2 == snapshot->GetLeadCallsignForPosition("LON_S_CTR"));
+        }
+
+        TEST_F(ActiveCallsignSnapshotTest, ABatchOnlyPublishesWhenItEnds)
+        {
+            std::shared_ptr<const ActiveCallsignSnapshot> before = this->collection.GetSnapshot();
+            {
+                ActiveCallsignCollection::Batch batch(this->collection);
+                this->collection.AddCallsign(this->callsign1);
+                this->collection.AddUserCallsign(this->callsign3);
+                this->collection.RemoveCallsign(this->callsign1);
+                this->collection.AddCallsign(this->callsign2);
+                EXPECT_EQ(before, this->collection.GetSnapshot());
+            }
+
+            std::shared_ptr<const ActiveCallsignSnapshot> snapshot = this->collection.GetSnapshot();
+            EXPECT_NE(before, snapshot);
+            EXPECT_FALSE(snapshot->CallsignActive("LON_S_CTR"));
+            EXPECT_TRUE(snapshot->CallsignActive("LON_S_CTR_1"));
+            EXPECT_TRUE(this->callsign3 == snapshot->GetUserCallsign());
+            EXPECT_EQ(this->collection.GetGeneration(), snapshot->GetGeneration());
+        }
+
+        TEST_F(ActiveCallsignSnapshotTest, NestedBatchesPublishWhenTheOutermostEnds)
+        {
+            std::shared_ptr<const ActiveCallsignSnapshot> before = this->collection.GetSnapshot();
+            {
+                ActiveCallsignCollection::Batch outer(this->collection);
+                {
+                    ActiveCallsignCollection::Batch inner(this->collection);
+                    this->collection.AddCallsign(this->callsign1);
+                }
+                EXPECT_EQ(before, this->collection.GetSnapshot());
+            }
+
+            EXPECT_TRUE(this->collection.GetSnapshot()->CallsignActive("LON_S_CTR"));
+        }
+
+        TEST_F(ActiveCallsignSnapshotTest, ABatchWithoutChangesDoesntPublish)
+        {
+            this->collection.AddCallsign(this->callsign1);
+            std::shared_ptr<const ActiveCallsignSnapshot> before = this->collection.GetSnapshot();
+            {
+                ActiveCallsignCollection::Batch batch(this->collection);
+            }
+
+            EXPECT_EQ(before, this->collection.GetSnapshot());
+        }
+
+        TEST_F(ActiveCallsignSnapshotTest, EndingABatchThatHasNotBegunDoesNothing)
+        {
+            this->collection.EndBatch();
+            this->collection.AddCallsign(this->callsign1);
+
+            EXPECT_TRUE(this->collection.GetSnapshot()->CallsignActive("LON_S_CTR"));
+        }
+    }  // namespace Controller
+}  // namespace UKControllerPluginTest
@@ -193,10 +193,317 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE("EGGD" == this->manager.GetOwnedAirfields("EGGD_TWR").begin()->GetIcao());
         }
 
+        TEST_F(AirfieldOwnershipManagerTest, GetOwnedDoesntReturnAirfieldsThatHaveChangedHands)
+        {
+            ControllerPosition controller1("EGGD_TWR", 133.850, "TWR", { "EGGD" });
+            ControllerPosition controller2("EGGD_GND", 121.920, "GND", { "EGGD" });
+            ActiveCallsign active1("EGGD_TWR", "Testy McTestface", controller1);
+            ActiveCallsign active2("EGGD_GND", "Testy McTestface 2", controller2);
+            this->activeCallsigns.AddCallsign(active1);
+            this->manager.RefreshOwner("EGGD");
+            this->activeCallsigns.AddCallsign(active2);
+            this->manager.RefreshOwner("EGGD");
+
+            EXPECT_EQ(0, this->manager.GetOwnedAirfields("EGGD_TWR").size());
+            EXPECT_EQ(1, this->manager.GetOwnedAirfields("EGGD_GND").size());
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, GetOwnedReturnsAirfieldsInIcaoOrder)
+        {
+            this->airfields.AddAirfield(std::make_unique<UKControllerPlugin::Airfield::Airfield>(
+                "EGFF",
+                std::vector<std::string>{ "EGFF_APP", "LON_W_CTR" }
+            ));
+            ControllerPosition controller("LON_W_CTR", 126.020, "CTR", { "EGGD", "EGFF" });
+            this->activeCallsigns.AddCallsign(ActiveCallsign("LON_W_CTR", "Testy McTestface", controller));
+            this->manager.RefreshOwner("EGGD");
+            this->manager.RefreshOwner("EGFF");
+
+            std::vector<UKControllerPlugin::Airfield::Airfield> owned = this->manager.GetOwnedAirfields("LON_W_CTR");
+            EXPECT_EQ(2, owned.size());
+            EXPECT_TRUE("EGFF" == owned[0].GetIcao());
+            EXPECT_TRUE("EGGD" == owned[1].GetIcao());
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, FlushRemovesAllOwnedAirfields)
+        {
+            ControllerPosition controller("EGGD_TWR", 133.850, "TWR", { "EGGD" });
+            this->activeCallsigns.AddCallsign(ActiveCallsign("EGGD_TWR", "Testy McTestface", controller));
+            this->manager.RefreshOwner("EGGD");
+            this->manager.Flush();
+
+            EXPECT_EQ(0, this->manager.GetOwnedAirfields("EGGD_TWR").size());
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnersForPositionRefreshesAirfieldsWithThePositionInTheirOrder)
+        {
+            this->airfields.AddAirfield(std::make_unique<UKControllerPlugin::Airfield::Airfield>(
+                "EGFF",
+                std::vector<std::string>{ "EGFF_APP", "LON_W_CTR" }
+            ));
+            ControllerPosition controller("LON_W_CTR", 126.020, "CTR", { "EGGD", "EGFF" });
+            ActiveCallsign active("LON_W_CTR", "Testy McTestface", controller);
+            this->activeCallsigns.AddCallsign(active);
+
+            this->manager.RefreshOwnersForPosition("LON_W_CTR");
+
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active));
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGFF", active));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnersForPositionDoesntRefreshOtherAirfields)
+        {
+            this->airfields.AddAirfield(std::make_unique<UKControllerPlugin::Airfield::Airfield>(
+                "EGFF",
+                std::vector<std::string>{ "EGFF_APP", "LON_W_CTR" }
+            ));
+            ControllerPosition controller("EGGD_APP", 136.070, "APP", { "EGGD" });
+            this->activeCallsigns.AddCallsign(ActiveCallsign("EGGD_APP", "Testy McTestface", controller));
+
+            this->manager.RefreshOwnersForPosition("EGGD_APP");
+
+            EXPECT_TRUE(this->manager.AirfieldHasOwner("EGGD"));
+            EXPECT_FALSE(this->manager.AirfieldHasOwner("EGFF"));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnersForPositionRemovesOwnersWhenPositionGoesOffline)
+        {
+            ControllerPosition controller("EGGD_APP", 136.070, "APP", { "EGGD" });
+            ActiveCallsign active("EGGD_APP", "Testy McTestface", controller);
+            this->activeCallsigns.AddCallsign(active);
+            this->manager.RefreshOwnersForPosition("EGGD_APP");
+
+            this->activeCallsigns.RemoveCallsign(active);
+            this->manager.RefreshOwnersForPosition("EGGD_APP");
+
+            EXPECT_FALSE(this->manager.AirfieldHasOwner("EGGD"));
+            EXPECT_EQ(0, this->manager.GetOwnedAirfields("EGGD_APP").size());
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnersForPositionHandlesUnknownPositions)
+        {
+            EXPECT_NO_THROW(this->manager.RefreshOwnersForPosition("EGXX_APP"));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnerPicksUpAirfieldsAddedLater)
+        {
+            ControllerPosition controller("EGGD_TWR", 133.850, "TWR", { "EGGD" });
+            this->activeCallsigns.AddCallsign(ActiveCallsign("EGGD_TWR", "Testy McTestface", controller));
+            this->manager.RefreshOwner("EGGD");
+
+            this->airfields.AddAirfield(std::make_unique<UKControllerPlugin::Airfield::Airfield>(
+                "EGFF",
+                std::vector<std::string>{ "EGGD_TWR" }
+            ));
+            this->manager.RefreshOwner("EGFF");
+
+            EXPECT_TRUE(this->manager.AirfieldHasOwner("EGFF"));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshAllOwnersSetsOwnersOfAllAirfields)
+        {
+            this->airfields.AddAirfield(std::make_unique<UKControllerPlugin::Airfield::Airfield>(
+                "EGFF",
+                std::vector<std::string>{ "EGFF_TWR", "EGFF_APP", "LON_W_CTR" }
+            ));
+            ControllerPosition controller1("EGGD_APP", 125.650, "APP", { "EGGD" });
+            ActiveCallsign active1("EGGD_APP", "Testy McTestface", controller1);
+            ControllerPosition controller2("EGFF_APP", 125.850, "APP", { "EGFF" });
+            ActiveCallsign active2("EGFF_APP", "Testy McTestface 2", controller2);
+            this->activeCallsigns.AddCallsign(active1);
+            this->activeCallsigns.AddCallsign(active2);
+
+            this->manager.RefreshAllOwners();
+
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active1));
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGFF", active2));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshAllOwnersPicksUpChangesToActiveCallsigns)
+        {
+            ControllerPosition controller1("EGGD_TWR", 133.850, "TWR", { "EGGD" });
+            ActiveCallsign active1("EGGD_TWR", "Testy McTestface", controller1);
+            ControllerPosition controller2("EGGD_GND", 121.920, "GND", { "EGGD" });
+            ActiveCallsign active2("EGGD_GND", "Testy McTestface 2", controller2);
+            this->activeCallsigns.AddCallsign(active1);
+            this->manager.RefreshAllOwners();
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active1));
+
+            this->activeCallsigns.AddCallsign(active2);
+            this->manager.RefreshAllOwners();
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active2));
+
+            this->activeCallsigns.Flush();
+            this->manager.RefreshAllOwners();
+            EXPECT_FALSE(this->manager.AirfieldHasOwner("EGGD"));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnerHandlesAirfieldsWithConflictingPrecedence)
+        {
+            // EGGD has EGFF_APP before LON_W_CTR, EGFF has them the other way round
+            this->airfields.AddAirfield(std::make_unique<UKControllerPlugin::Airfield::Airfield>(
+                "EGFF",
+                std::vector<std::string>{ "LON_W_CTR", "EGFF_APP" }
+            ));
+            ControllerPosition controller1("EGFF_APP", 125.850, "APP", { "EGFF" });
+            ActiveCallsign active1("EGFF_APP", "Testy McTestface", controller1);
+            ControllerPosition controller2("LON_W_CTR", 126.020, "CTR", { "EGFF", "EGGD" });
+            ActiveCallsign active2("LON_W_CTR", "Testy McTestface 2", controller2);
+            this->activeCallsigns.AddCallsign(active1);
+            this->activeCallsigns.AddCallsign(active2);
+
+            this->manager.RefreshAllOwners();
+
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active1));
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGFF", active2));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnerHandlesMoreThanSixtyFourPositions)
+        {
+            std::vector<std::string> topDown;
+            for (int i = 0; i < 100; i++) {
+                topDown.push_back("EGXX_" + std::to_string(i) + "_CTR");
+            }
+            this->airfields.AddAirfield(std::make_unique<UKControllerPlugin::Airfield::Airfield>("EGXX", topDown));
+
+            ControllerPosition controller1("EGXX_90_CTR", 127.000, "CTR", { "EGXX" });
+            ActiveCallsign active1("EGXX_90_CTR", "Testy McTestface", controller1);
+            ControllerPosition controller2("EGXX_70_CTR", 128.000, "CTR", { "EGXX" });
+            ActiveCallsign active2("EGXX_70_CTR", "Testy McTestface 2", controller2);
+            this->activeCallsigns.AddCallsign(active1);
+            this->manager.RefreshOwner("EGXX");
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGXX", active1));
+
+            this->activeCallsigns.AddCallsign(active2);
+            this->manager.RefreshOwner("EGXX");
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGXX", active2));
+        }
+
         TEST_F(AirfieldOwnershipManagerTest, ItHasANoOwnerObject)
         {
             EXPECT_TRUE("" == this->manager.notFoundCallsign.GetCallsign());
             EXPECT_TRUE("" == this->manager.notFoundCallsign.GetControllerName());
         }
+
+        /*
+            Times working out the owner of 60 airfields with 12 positions each, from 300 active positions,
+            comparing RefreshAllOwners with walking each airfield's precedence against the active callsigns,
+            as RefreshOwner used to do. Runs once with no controller changes between refreshes, and once
+            with a controller logging on or off before each refresh. Disabled by default as it only reports
+            timings, to run it use --gtest_also_run_disabled_tests. The time taken to log a controller on
+            or off is reported separately, and is included in the timings after a change.
+        */
+        TEST(AirfieldOwnershipManager, DISABLED_RefreshAllOwnersIsFasterThanWalkingThePrecedence)
+        {
+            AirfieldCollection airfields;
+            ActiveCallsignCollection activeCallsigns;
+            std::vector<std::vector<std::string>> precedences;
+            for (int i = 0; i < 60; i++) {
+                std::vector<int> positionNumbers;
+                for (int j = 0; j < 12; j++) {
+                    positionNumbers.push_back((i * 5 + j * 31) % 400);
+                }
+                std::sort(positionNumbers.begin(), positionNumbers.end());
+
+                std::vector<std::string> topDown;
+                for (int positionNumber : positionNumbers) {
+                    topDown.push_back("POS_" + std::to_string(positionNumber) + "_CTR");
+                }
+
+                const std::string icao = std::string("EG") + static_cast<char>('A' + i / 26) +
+                    static_cast<char>('A' + i % 26);
+                airfields.AddAirfield(std::make_unique<UKControllerPlugin::Airfield::Airfield>(icao, topDown));
+                precedences.push_back(topDown);
+            }
+
+            std::vector<std::unique_ptr<ControllerPosition>> positions;
+            for (int i = 0; i < 400; i++) {
+                if (i % 4 == 0) {
+                    continue;
+                }
+
+                positions.push_back(std::make_unique<ControllerPosition>(
+                    "POS_" + std::to_string(i) + "_CTR", 120.0, "CTR", std::vector<std::string>{}
+                ));
+                activeCallsigns.AddCallsign(
+                    ActiveCallsign("POS_" + std::to_string(i) + "_CTR", "Testy McTestface", *positions.back())
+                );
+            }
+            ControllerPosition changingPosition("POS_4_CTR", 120.0, "CTR", {});
+            ActiveCallsign changingCallsign("POS_4_CTR", "Testy McTestface", changingPosition);
+
+            AirfieldOwnershipManager manager(airfields, activeCallsigns);
+            const auto walkPrecedence = [&precedences, &activeCallsigns]() -> size_t {
+                size_t owned = 0;
+                for (const std::vector<std::string> & precedence : precedences) {
+                    for (const std::string & position : precedence) {
+                        if (activeCallsigns.PositionActive(position)) {
+                            ActiveCallsign owner = activeCallsigns.GetLeadCallsignForPosition(position);
+                            owned++;
+                            break;
+                        }
+                    }
+                }
+                return owned;
+            };
+            const auto countOwned = [&airfields, &manager]() -> size_t {
+                size_t owned = 0;
+                for (auto it = airfields.cbegin(); it != airfields.cend(); ++it) {
+                    owned += manager.AirfieldHasOwner(it->first) ? 1 : 0;
+                }
+                return owned;
+            };
+            const auto changeController = [&activeCallsigns, &changingCallsign](int iteration) {
+                if (iteration % 2 == 0) {
+                    activeCallsigns.AddCallsign(changingCallsign);
+                } else {
+                    activeCallsigns.RemoveCallsign(changingCallsign);
+                }
+            };
+            manager.RefreshAllOwners();
+
+            const int iterations = 2000;
+            size_t walkOwned = 0;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                walkOwned = walkPrecedence();
+            }
+            std::chrono::nanoseconds walkTime = std::chrono::steady_clock::now() - start;
+
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                manager.RefreshAllOwners();
+            }
+            std::chrono::nanoseconds maskTime = std::chrono::steady_clock::now() - start;
+            EXPECT_EQ(walkOwned, countOwned());
+
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                changeController(i);
+            }
+            std::chrono::nanoseconds changeTime = std::chrono::steady_clock::now() - start;
+
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                changeController(i);
+                walkOwned = walkPrecedence();
+            }
+            std::chrono::nanoseconds walkChangedTime = std::chrono::steady_clock::now() - start;
+
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                changeController(i);
+                manager.RefreshAllOwners();
+            }
+            std::chrono::nanoseconds maskChangedTime = std::chrono::steady_clock::now() - start;
+            EXPECT_EQ(walkOwned, countOwned());
+
+            RecordProperty("ChangeNanoseconds", static_cast<int>(changeTime.count() / iterations));
+            RecordProperty("WalkNanosecondsNoChanges", static_cast<int>(walkTime.count() / iterations));
+            RecordProperty("MaskNanosecondsNoChanges", static_cast<int>(maskTime.count() / iterations));
+            RecordProperty("WalkNanosecondsAfterChange", static_cast<int>(walkChangedTime.count() / iterations));
+            RecordProperty("MaskNanosecondsAfterChange", static_cast<int>(maskChangedTime.count() / iterations));
+            EXPECT_LT(maskTime, walkTime);
+        }
     }  // namespace Airfield
 }  // namespace UKControllerPluginTest
@@ -4,12 +4,16 @@
 #include "controller/ControllerStatusEventHandlerCollection.h"
 #include "dependency/DependencyCache.h"
 #include "command/CommandHandlerCollection.h"
+#include "timedevent/TimedEventCollection.h"
+#include "massevent/MassEvent.h"
 
 using UKControllerPlugin::Airfield::AirfieldOwnershipModule;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Controller::ControllerStatusEventHandlerCollection;
 using UKControllerPlugin::Dependency::DependencyCache;
 using UKControllerPlugin::Command::CommandHandlerCollection;
+using UKControllerPlugin::TimedEvent::TimedEventCollection;
+using UKControllerPlugin::EventHandler::MassEvent;
 using ::testing::Test;
 
 namespace UKControllerPluginTest {
@@ -23,6 +27,7 @@ namespace UKControllerPluginTest {
                 {
                     this->container.controllerHandler.reset(new ControllerStatusEventHandlerCollection);
                     this->container.commandHandlers.reset(new CommandHandlerCollection);
+                    this->container.timedHandler.reset(new TimedEventCollection);
                 }
 
                 PersistenceContainer container;
@@ -33,7 +38,7 @@ namespace UKControllerPluginTest {
         {
             EXPECT_EQ(0, this->container.commandHandlers->CountHandlers());
             AirfieldOwnershipModule::BootstrapPlugin(this->container, this->dependency);
-            EXPECT_EQ(1, this->container.commandHandlers->CountHandlers());
+            EXPECT_EQ(2, this->container.commandHandlers->CountHandlers());
         }
 
         TEST_F(AirfieldOwnershipModuleTest, BootstrapPluginRegistersWithControllerEvents)
@@ -42,5 +47,13 @@ namespace UKControllerPluginTest {
             AirfieldOwnershipModule::BootstrapPlugin(this->container, this->dependency);
             EXPECT_EQ(1, this->container.controllerHandler->CountHandlers());
         }
+
+        TEST_F(AirfieldOwnershipModuleTest, BootstrapPluginRegistersMassEventsWithTimedEvents)
+        {
+            EXPECT_EQ(0, this->container.timedHandler->CountHandlers());
+            AirfieldOwnershipModule::BootstrapPlugin(this->container, this->dependency);
+            EXPECT_EQ(1, this->container.timedHandler->CountHandlers());
+            EXPECT_EQ(1, this->container.timedHandler->CountHandlersForFrequency(MassEvent::timedEventFrequency));
+        }
     }  // namespace Airfield
 }  // namespace UKControllerPluginTest
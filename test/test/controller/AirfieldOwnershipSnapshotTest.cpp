@@ -0,0 +1,178 @@
+#include "pch/pch.h"
+#include "airfield/AirfieldOwnershipSnapshot.h"
+#include "airfield/AirfieldOwnershipManager.h"
+#include "airfield/AirfieldCollection.h"
+#include "airfield/Airfield.h"
+#include "controller/ActiveCallsignSnapshot.h"
+#include "controller/ActiveCallsignCollection.h"
+#include "controller/ActiveCallsign.h"
+#include "controller/ControllerPosition.h"
+
+using UKControllerPlugin::Airfield::AirfieldOwnershipSnapshot;
+using UKControllerPlugin::Airfield::AirfieldOwnershipManager;
+using UKControllerPlugin::Airfield::AirfieldCollection;
+using UKControllerPlugin::Controller::ActiveCallsignSnapshot;
+using UKControllerPlugin::Controller::ActiveCallsignCollection;
+using UKControllerPlugin::Controller::ActiveCallsign;
+using UKControllerPlugin::Controller::ControllerPosition;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Airfield {
+
+        class AirfieldOwnershipSnapshotTest : public Test
+        {
+            public:
+
+                AirfieldOwnershipSnapshotTest(void)
+                    : manager(this->airfields, this->activeCallsigns),
+                    tower("EGGD_TWR", 133.850, "TWR", { "EGGD" }),
+                    ground("EGGD_GND", 121.920, "GND", { "EGGD" }),
+                    activeTower("EGGD_TWR", "Testy McTestface", tower),
+                    activeGround("EGGD_GND", "Testy McTestface 2", ground)
+                {
+
+                }
+
+                void SetUp()
+                {
+                    std::vector<std::string> topDown = { "EGGD_GND", "EGGD_TWR", "EGGD_APP", "LON_W_CTR" };
+                    this->airfields.AddAirfield(std::make_unique<UKControllerPlugin::Airfield::Airfield>(
+                        "EGGD",
+                        topDown
+                    ));
+                };
+
+                ActiveCallsignCollection activeCallsigns;
+                AirfieldCollection airfields;
+                AirfieldOwnershipManager manager;
+                ControllerPosition tower;
+                ControllerPosition ground;
+                ActiveCallsign activeTower;
+                ActiveCallsign activeGround;
+        };
+
+        TEST_F(AirfieldOwnershipSnapshotTest, ItStartsWithNoOwners)
+        {
+            EXPECT_FALSE(this->manager.GetSnapshot()->AirfieldHasOwner("EGGD"));
+            EXPECT_THROW(this->manager.GetSnapshot()->GetOwner("EGGD"), std::out_of_range);
+        }
+
+        TEST_F(AirfieldOwnershipSnapshotTest, RefreshingOwnersPublishesASnapshot)
+        {
+            this->activeCallsigns.AddCallsign(this->activeTower);
+            this->manager.RefreshOwnersForPosition("EGGD_TWR");
+
+            std::shared_ptr<const AirfieldOwnershipSnapshot> snapshot = this->manager.GetSnapshot();
+            EXPECT_TRUE(snapshot->AirfieldHasOwner("EGGD"));
+            EXPECT_TRUE(snapshot->AirfieldOwnedBy("EGGD", this->activeTower));
+            EXPECT_FALSE(snapshot->AirfieldOwnedBy("EGGD", this->activeGround));
+            EXPECT_TRUE(this->activeTower == snapshot->GetOwner("EGGD"));
+        }
+
+        TEST_F(AirfieldOwnershipSnapshotTest, RefreshingWithoutChangesKeepsTheSameSnapshot)
+        {
+            this->activeCallsigns.AddCallsign(this->activeTower);
+            this->manager.RefreshOwner("EGGD");
+            std::shared_ptr<const AirfieldOwnershipSnapshot> snapshot = this->manager.GetSnapshot();
+
+            this->manager.RefreshAllOwners();
+
+            EXPECT_EQ(snapshot, this->manager.GetSnapshot());
+        }
+
+        TEST_F(AirfieldOwnershipSnapshotTest, OldSnapshotsDontChange)
+        {
+            this->activeCallsigns.AddCallsign(this->activeTower);
+            this->manager.RefreshOwner("EGGD");
+            std::shared_ptr<const AirfieldOwnershipSnapshot> snapshot = this->manager.GetSnapshot();
+
+            this->activeCallsigns.AddCallsign(this->activeGround);
+            this->manager.RefreshOwner("EGGD");
+
+            EXPECT_TRUE(snapshot->AirfieldOwnedBy("EGGD", this->activeTower));
+            EXPECT_TRUE(this->manager.GetSnapshot()->AirfieldOwnedBy("EGGD", this->activeGround));
+        }
+
+        TEST_F(AirfieldOwnershipSnapshotTest, FlushPublishesAnEmptySnapshot)
+        {
+            this->activeCallsigns.AddCallsign(this->activeTower);
+            this->manager.RefreshOwner("EGGD");
+
+            this->manager.Flush();
+
+            EXPECT_FALSE(this->manager.GetSnapshot()->AirfieldHasOwner("EGGD"));
+        }
+
+        TEST_F(AirfieldOwnershipSnapshotTest, SnapshotsCanBeReadWhilstControllersChange)
+        {
+            std::vector<std::unique_ptr<ControllerPosition>> positions;
+            std::vector<std::string> topDown;
+            for (int i = 0; i < 20; i++) {
+                topDown.push_back("EGXX_" + std::to_string(i) + "_CTR");
+                positions.push_back(
+                    std::make_unique<ControllerPosition>(topDown.back(), 127.000, "CTR", std::vector<std::string>{})
+                );
+            }
+            this->airfields.AddAirfield(std::make_unique<UKControllerPlugin::Airfield::Airfield>("EGXX", topDown));
+
+            // Readers check that every published ownership is one of the positions, and that the user is consistent
+            std::atomic<bool> finished(false);
+            std::atomic<int> inconsistencies(0);
+            std::vector<std::thread> readers;
+            for (int i = 0; i < 4; i++) {
+                readers.push_back(std::thread([this, &finished, &inconsistencies]() {
+                    while (!finished) {
+                        std::shared_ptr<const ActiveCallsignSnapshot> callsigns = this->activeCallsigns.GetSnapshot();
+                        std::shared_ptr<const AirfieldOwnershipSnapshot> ownership = this->manager.GetSnapshot();
+                        if (
+                            callsigns->UserHasCallsign() &&
+                            !callsigns->CallsignActive(callsigns->GetUserCallsign().GetCallsign())
+                        ) {
+                            inconsistencies++;
+                        }
+
+                        if (
+                            ownership->AirfieldHasOwner("EGXX") &&
+                            ownership->GetOwner("EGXX").GetCallsign().substr(0, 5) != "EGXX_"
+                        ) {
+                            inconsistencies++;
+                        }
+                    }
+                }));
+            }
+
+            for (int churn = 0; churn < 2000; churn++) {
+                const ControllerPosition & position = *positions[churn % positions.size()];
+                ActiveCallsign active(
+                    position.GetCallsign() + "_" + std::to_string(churn),
+                    "Testy McTestface",
+                    position
+                );
+                if (churn % 7 == 0) {
+                    this->activeCallsigns.AddUserCallsign(active);
+                } else {
+                    this->activeCallsigns.AddCallsign(active);
+                }
+                this->manager.RefreshOwnersForPosition(position.GetCallsign());
+
+                if (churn % 3 != 0) {
+                    this->activeCallsigns.RemoveCallsign(active);
+                    this->manager.RefreshOwnersForPosition(position.GetCallsign());
+                }
+
+                if (churn % 100 == 99) {
+                    this->activeCallsigns.Flush();
+                    this->manager.Flush();
+                }
+            }
+
+            finished = true;
+            for (std::vector<std::thread>::iterator it = readers.begin(); it != readers.end(); ++it) {
+                it->join();
+            }
+
+            EXPECT_EQ(0, inconsistencies);
+        }
+    }  // namespace Airfield
+}  // namespace UKControllerPluginTest
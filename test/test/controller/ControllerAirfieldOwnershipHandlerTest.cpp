@@ -7,6 +7,7 @@
 #include "airfield/AirfieldOwnershipManager.h"
 #include "controller/ActiveCallsign.h"
 #include "controller/ActiveCallsignCollection.h"
+#include "controller/ActiveCallsignSnapshot.h"
 #include "mock/MockEuroScopeCControllerInterface.h"
 #include "flightplan/StoredFlightplanCollection.h"
 #include "mock/MockEuroscopePluginLoopbackInterface.h"
@@ -29,6 +30,7 @@ using UKControllerPlugin::Controller::ControllerPosition;
 using UKControllerPlugin::Controller::ControllerPositionCollection;
 using UKControllerPlugin::Controller::ActiveCallsign;
 using UKControllerPlugin::Controller::ActiveCallsignCollection;
+using UKControllerPlugin::Controller::ActiveCallsignSnapshot;
 using UKControllerPlugin::Airfield::AirfieldOwnershipManager;
 using UKControllerPluginTest::Euroscope::MockEuroScopeCControllerInterface;
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
@@ -88,12 +90,12 @@ namespace UKControllerPluginTest {
                     // Add airfields to the collection
                     airfieldCollection.AddAirfield(
                         std::unique_ptr<Airfield>(
-                            new Airfield("EGKK", { "EGKK_DEL", "EGKK_GND", "EGKK_TWR", "EGKK_APP" })
+                            new Airfield("EGKK", { "EGKK_DEL", "EGKK_GND", "EGKK_TWR", "EGKK_APP", "LTC_S_CTR" })
                         )
                     );
                     airfieldCollection.AddAirfield(
                         std::unique_ptr<Airfield>(
-                            new Airfield("EGLL", { "EGLL_DEL", "EGLL_2_GND", "EGLL_S_TWR", "EGLL_N_APP" })
+                            new Airfield("EGLL", { "EGLL_DEL", "EGLL_2_GND", "EGLL_S_TWR", "EGLL_N_APP", "LTC_S_CTR" })
                         )
                     );
                     airfieldCollection.AddAirfield(
@@ -174,6 +176,32 @@ namespace UKControllerPluginTest {
                     this->login.SetLoginTime(std::chrono::system_clock::now() - std::chrono::minutes(15));
                 }
 
+                std::shared_ptr<NiceMock<MockEuroScopeCControllerInterface>> MakeController(
+                    std::string callsign,
+                    double frequency,
+                    bool hasFrequency,
+                    bool isUser
+                ) {
+                    std::shared_ptr<NiceMock<MockEuroScopeCControllerInterface>> controller =
+                        std::make_shared<NiceMock<MockEuroScopeCControllerInterface>>();
+                    ON_CALL(*controller, GetCallsign())
+                        .WillByDefault(Return(callsign));
+
+                    ON_CALL(*controller, GetControllerName())
+                        .WillByDefault(Return("Testy McTestington"));
+
+                    ON_CALL(*controller, GetFrequency())
+                        .WillByDefault(Return(frequency));
+
+                    ON_CALL(*controller, HasActiveFrequency())
+                        .WillByDefault(Return(hasFrequency));
+
+                    ON_CALL(*controller, IsCurrentUser())
+                        .WillByDefault(Return(isUser));
+
+                    return controller;
+                }
+
                 AirfieldCollection airfieldCollection;
                 ControllerPositionCollection controllerCollection;
                 AirfieldOwnershipManager ownership;
@@ -548,8 +576,118 @@ namespace UKControllerPluginTest {
                 )
                 .Times(1);
 
-
             this->handler.ControllerUpdateEvent(euroscopeMock);
+            this->massEvents.TimedEventTrigger();
+        }
+
+        TEST_F(ControllerAirfieldOwnershipHandlerTest, InitialControllerLoadEventAddsActiveCallsigns)
+        {
+            this->handler.InitialControllerLoadEvent({
+                this->MakeController("EGKK_DEL", 199.998, true, false),
+                this->MakeController("LTC_S_CTR", 134.120, true, false)
+            });
+
+            EXPECT_TRUE(this->activeCallsigns.CallsignActive("EGKK_DEL"));
+            EXPECT_TRUE(this->activeCallsigns.CallsignActive("LTC_S_CTR"));
+            EXPECT_TRUE(this->ownership.AirfieldOwnedBy("EGKK", this->activeCallsigns.GetCallsign("EGKK_DEL")));
+            EXPECT_TRUE(this->ownership.AirfieldOwnedBy("EGLL", this->activeCallsigns.GetCallsign("EGLL_S_TWR")));
+            EXPECT_TRUE(this->ownership.AirfieldOwnedBy("EGLC", this->activeCallsigns.GetCallsign("LTC_S_CTR")));
+            EXPECT_TRUE(this->ownership.AirfieldOwnedBy("EGKA", this->activeCallsigns.GetCallsign("LTC_S_CTR")));
+        }
+
+        TEST_F(ControllerAirfieldOwnershipHandlerTest, InitialControllerLoadEventPublishesTheLoadedControllers)
+        {
+            this->handler.InitialControllerLoadEvent({
+                this->MakeController("EGKK_DEL", 199.998, true, false),
+                this->MakeController("LTC_S_CTR", 134.120, true, false)
+            });
+
+            std::shared_ptr<const ActiveCallsignSnapshot> snapshot = this->activeCallsigns.GetSnapshot();
+            EXPECT_TRUE(snapshot->CallsignActive("EGKK_DEL"));
+            EXPECT_TRUE(snapshot->CallsignActive("LTC_S_CTR"));
+            EXPECT_EQ(this->activeCallsigns.GetGeneration(), snapshot->GetGeneration());
+        }
+
+        TEST_F(ControllerAirfieldOwnershipHandlerTest, InitialControllerLoadEventRemovesCallsignsWithoutFrequency)
+        {
+            this->handler.InitialControllerLoadEvent({
+                this->MakeController("EGKK_TWR", 199.999, false, false)
+            });
+
+            EXPECT_FALSE(this->activeCallsigns.CallsignActive("EGKK_TWR"));
+            EXPECT_TRUE(this->ownership.AirfieldOwnedBy("EGKK", this->activeCallsigns.GetCallsign("EGKK_APP")));
+        }
+
+        TEST_F(ControllerAirfieldOwnershipHandlerTest, InitialControllerLoadEventIgnoresUnrecognisedControllers)
+        {
+            this->handler.InitialControllerLoadEvent({
+                this->MakeController("EGXX_TWR", 118.000, true, false),
+                this->MakeController("EGKK_DEL", 199.998, false, false)
+            });
+
+            EXPECT_FALSE(this->activeCallsigns.CallsignActive("EGXX_TWR"));
+            EXPECT_FALSE(this->activeCallsigns.CallsignActive("EGKK_DEL"));
+            EXPECT_TRUE(this->ownership.AirfieldOwnedBy("EGKK", this->activeCallsigns.GetCallsign("EGKK_TWR")));
+        }
+
+        TEST_F(ControllerAirfieldOwnershipHandlerTest, InitialControllerLoadEventUpdatesFlightplansOnceIfUserLoaded)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            ON_CALL(mockFlightplan, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockFlightplan, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            this->flightplans.UpdatePlan(StoredFlightplan(mockFlightplan));
+
+            std::shared_ptr<MockEuroScopeCFlightPlanInterface> mockFlightplanReturn(
+                new NiceMock<MockEuroScopeCFlightPlanInterface>
+            );
+
+            ON_CALL(*mockFlightplanReturn, GetDistanceFromOrigin())
+                .WillByDefault(Return(1));
+
+            ON_CALL(*mockFlightplanReturn, GetSidName())
+                .WillByDefault(Return("ADMAG2X"));
+
+            ON_CALL(*mockFlightplanReturn, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            ON_CALL(*mockFlightplanReturn, GetCruiseLevel())
+                .WillByDefault(Return(6000));
+
+            ON_CALL(*mockFlightplanReturn, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            std::shared_ptr<MockEuroScopeCRadarTargetInterface> mockRadarTargetReturn(
+                new NiceMock<MockEuroScopeCRadarTargetInterface>
+            );
+
+            ON_CALL(*mockRadarTargetReturn, GetGroundSpeed())
+                .WillByDefault(Return(5));
+
+            ON_CALL(this->plugin, GetFlightplanForCallsign("BAW123"))
+                .WillByDefault(Return(mockFlightplanReturn));
+
+            ON_CALL(this->plugin, GetRadarTargetForCallsign("BAW123"))
+                .WillByDefault(Return(mockRadarTargetReturn));
+
+            // Initial altitudes and squawks should be done once, after everyone has been loaded
+            EXPECT_CALL(*mockFlightplanReturn, SetClearedAltitude(6000))
+                .Times(1);
+
+            EXPECT_CALL(
+                    *this->squawkEvents,
+                    FlightPlanEvent(testing::Ref(*mockFlightplanReturn), testing::Ref(*mockRadarTargetReturn))
+                )
+                .Times(1);
+
+            this->handler.InitialControllerLoadEvent({
+                this->MakeController("EGKK_DEL", 199.998, true, true),
+                this->MakeController("LTC_S_CTR", 134.120, true, false)
+            });
+            this->massEvents.TimedEventTrigger();
         }
     }  // namespace Controller
 }  // namespace UKControllerPluginTest
@@ -3,6 +3,7 @@
 #include "controller/ControllerPositionCollection.h"
 #include "controller/ControllerPosition.h"
 #include "dependency/DependencyCache.h"
+#include "helper/AllocationCounter.h"
 
 using UKControllerPlugin::Controller::ControllerPosition;
 using UKControllerPlugin::Controller::ControllerPositionCollection;
@@ -55,5 +56,73 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(0, position.GetType().compare("GND"));
             EXPECT_THAT(position.GetTopdown(), ElementsAre("EGAA"));
         }
+
+        /*
+            Times loading 1442 controller positions, comparing decoding while parsing with parsing into a
+            json object and walking it, as Create used to do. Disabled by default as it only reports
+            measurements, to run it use --gtest_also_run_disabled_tests.
+        */
+        TEST(ControllerPositionCollectionFactory, DISABLED_CreateIsFasterThanWalkingAJsonObject)
+        {
+            const std::vector<std::string> types = {"DEL", "GND", "TWR", "APP", "CTR"};
+            nlohmann::json data;
+            for (int i = 0; i < 1442; i++) {
+                std::vector<std::string> topDown;
+                for (int j = 0; j < 2 + i % 6; j++) {
+                    topDown.push_back("EG" + std::to_string(10 + (i + j * 7) % 90));
+                }
+
+                const std::string callsign = "EG" + std::to_string(i) + "_" + types[i % types.size()];
+                data[callsign]["frequency"] = 118.0 + (i % 700) * 0.025 + 0.001;
+                data[callsign]["top-down"] = topDown;
+            }
+            DependencyCache dependency;
+            dependency.AddDependency(ControllerPositionCollectionFactory::requiredDependency, data.dump());
+
+            const int iterations = 50;
+            size_t objectCount = 0;
+            size_t allocations = CountAllocations();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                ControllerPositionCollection collection;
+                nlohmann::json positions = nlohmann::json::parse(
+                    dependency.GetDependency(ControllerPositionCollectionFactory::requiredDependency)
+                );
+                for (nlohmann::json::iterator it = positions.begin(); it != positions.end(); ++it) {
+                    if (!it.value()["frequency"].is_number_float() || !it.value()["top-down"].is_array()) {
+                        continue;
+                    }
+
+                    const std::string callsign = it.key();
+                    collection.AddPosition(std::make_unique<ControllerPosition>(
+                        callsign,
+                        it.value()["frequency"].get<double>(),
+                        callsign.substr(callsign.size() - 3),
+                        it.value()["top-down"].get<std::vector<std::string>>()
+                    ));
+                }
+                objectCount = collection.GetSize();
+            }
+            std::chrono::nanoseconds objectTime = std::chrono::steady_clock::now() - start;
+            size_t objectAllocations = CountAllocations() - allocations;
+
+            size_t decodeCount = 0;
+            allocations = CountAllocations();
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                decodeCount = ControllerPositionCollectionFactory::Create(dependency)->GetSize();
+            }
+            std::chrono::nanoseconds decodeTime = std::chrono::steady_clock::now() - start;
+            size_t decodeAllocations = CountAllocations() - allocations;
+
+            RecordProperty("ObjectMicroseconds", static_cast<int>(objectTime.count() / iterations / 1000));
+            RecordProperty("DecodeMicroseconds", static_cast<int>(decodeTime.count() / iterations / 1000));
+            RecordProperty("ObjectAllocations", static_cast<int>(objectAllocations / iterations));
+            RecordProperty("DecodeAllocations", static_cast<int>(decodeAllocations / iterations));
+            EXPECT_EQ(1442, decodeCount);
+            EXPECT_EQ(objectCount, decodeCount);
+            EXPECT_LT(decodeAllocations, objectAllocations);
+            EXPECT_LT(decodeTime, objectTime);
+        }
     }  // namespace Controller
 }  // namespace UKControllerPluginTest
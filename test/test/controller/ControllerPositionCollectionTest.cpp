@@ -112,6 +112,50 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(*controllerRaw, collection.FetchPositionByFacilityAndFrequency("EGFF", 125.8514));
         }
 
+        TEST(ControllerPositionCollection, FetchPositionByFacilityAndFrequencyMatchesAcrossKilohertzBoundaries)
+        {
+            ControllerPositionCollection collection;
+            std::unique_ptr<ControllerPosition> controller(
+                new ControllerPosition("EGFF_APP", 125.8494, "APP", std::vector<std::string> {"EGGD, EGFF"})
+            );
+
+            ControllerPosition * controllerRaw = controller.get();
+            collection.AddPosition(std::move(controller));
+            EXPECT_EQ(*controllerRaw, collection.FetchPositionByFacilityAndFrequency("EGFF", 125.8503));
+        }
+
+        TEST(ControllerPositionCollection, FetchPositionByFacilityAndFrequencyMatchesFacilitiesOnTheSameFrequency)
+        {
+            ControllerPositionCollection collection;
+            std::unique_ptr<ControllerPosition> controllerFirst(
+                new ControllerPosition("EGFF_APP", 125.850, "APP", std::vector<std::string> {"EGFF"})
+            );
+            std::unique_ptr<ControllerPosition> controllerSecond(
+                new ControllerPosition("EGGD_APP", 125.850, "APP", std::vector<std::string> {"EGGD"})
+            );
+
+            ControllerPosition * secondRaw = controllerSecond.get();
+            collection.AddPosition(std::move(controllerFirst));
+            collection.AddPosition(std::move(controllerSecond));
+            EXPECT_EQ(*secondRaw, collection.FetchPositionByFacilityAndFrequency("EGGD", 125.850));
+        }
+
+        TEST(ControllerPositionCollection, FetchPositionByFacilityAndFrequencyReturnsFirstCallsignIfSeveralMatch)
+        {
+            ControllerPositionCollection collection;
+            std::unique_ptr<ControllerPosition> controllerFirst(
+                new ControllerPosition("EGLL_S_TWR", 118.500, "TWR", std::vector<std::string> {"EGLL"})
+            );
+            std::unique_ptr<ControllerPosition> controllerSecond(
+                new ControllerPosition("EGLL_N_TWR", 118.500, "TWR", std::vector<std::string> {"EGLL"})
+            );
+
+            ControllerPosition * secondRaw = controllerSecond.get();
+            collection.AddPosition(std::move(controllerFirst));
+            collection.AddPosition(std::move(controllerSecond));
+            EXPECT_EQ(*secondRaw, collection.FetchPositionByFacilityAndFrequency("EGLL", 118.500));
+        }
+
         TEST(ControllerPositionCollection, FetchPositionByFacilityAndFrequencyWillWorkForEssex)
         {
             ControllerPositionCollection collection;
@@ -159,5 +203,86 @@ namespace UKControllerPluginTest {
             collection.AddPosition(std::move(controller));
             EXPECT_EQ(*controllerRaw, collection.FetchPositionByFacilityAndFrequency("ESX", 120.620));
         }
+
+        /*
+            Times matching a sweep of online controllers against 700 positions, comparing the frequency
+            index with a scan of every position as FetchPositionByFacilityAndFrequency used to do.
+            Disabled by default as it only reports timings, to run it use --gtest_also_run_disabled_tests.
+        */
+        TEST(ControllerPositionCollection, DISABLED_FetchPositionByFacilityAndFrequencyIsFasterThanAScan)
+        {
+            ControllerPositionCollection collection;
+            std::map<std::string, double> scannedPositions;
+            std::vector<std::pair<std::string, double>> online;
+            const std::vector<std::string> areas = {"LON", "LTC", "SCO", "STC", "MAN", "ESSEX", "THAMES", "SOLENT"};
+            const std::vector<std::string> types = {"DEL", "GND", "TWR", "APP", "F_APP", "R_APP"};
+            int positionCount = 0;
+            for (int i = 0; i < 60; i++) {
+                const std::string airfield = std::string("EG") + static_cast<char>('A' + i / 26) +
+                    static_cast<char>('A' + i % 26);
+                for (const std::string & type : types) {
+                    const double frequency = 118.0 + (positionCount++ % 900) * 0.025;
+                    const std::string callsign = airfield + "_" + type;
+                    collection.AddPosition(std::make_unique<ControllerPosition>(
+                        callsign, frequency, "APP", std::vector<std::string>{}
+                    ));
+                    scannedPositions[callsign] = frequency;
+                    if (positionCount % 2 == 1) {
+                        online.push_back({airfield, frequency});
+                    }
+                }
+            }
+
+            for (int i = 0; i < 340; i++) {
+                const std::string area = areas[i % areas.size()];
+                const double frequency = 118.0 + (positionCount++ % 900) * 0.025;
+                const std::string callsign = area + "_" + std::to_string(i) + "_CTR";
+                collection.AddPosition(std::make_unique<ControllerPosition>(
+                    callsign, frequency, "CTR", std::vector<std::string>{}
+                ));
+                scannedPositions[callsign] = frequency;
+                if (i % 3 == 0) {
+                    online.push_back({area, frequency});
+                }
+            }
+
+            const int iterations = 100;
+            size_t scanFound = 0;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                for (const auto & controller : online) {
+                    auto position = std::find_if(
+                        scannedPositions.begin(),
+                        scannedPositions.end(),
+                        [&controller](const std::pair<const std::string, double> & position) -> bool {
+                            return fabs(controller.second - position.second) < 0.001 &&
+                                position.first.substr(0, position.first.find('_')).compare(controller.first) == 0;
+                        }
+                    );
+
+                    if (position != scannedPositions.end()) {
+                        scanFound++;
+                    }
+                }
+            }
+            std::chrono::nanoseconds scanTime = std::chrono::steady_clock::now() - start;
+
+            size_t indexFound = 0;
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                for (const auto & controller : online) {
+                    collection.FetchPositionByFacilityAndFrequency(controller.first, controller.second);
+                    indexFound++;
+                }
+            }
+            std::chrono::nanoseconds indexTime = std::chrono::steady_clock::now() - start;
+
+            RecordProperty("Positions", static_cast<int>(collection.GetSize()));
+            RecordProperty("OnlineControllers", static_cast<int>(online.size()));
+            RecordProperty("ScanNanosecondsPerSweep", static_cast<int>(scanTime.count() / iterations));
+            RecordProperty("IndexNanosecondsPerSweep", static_cast<int>(indexTime.count() / iterations));
+            EXPECT_EQ(scanFound, indexFound);
+            EXPECT_LT(indexTime, scanTime);
+        }
     }  // namespace Controller
 }  // namespace UKControllerPluginTest
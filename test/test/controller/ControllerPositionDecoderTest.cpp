@@ -0,0 +1,109 @@
+#include "pch/pch.h"
+#include "controller/ControllerPositionDecoder.h"
+#include "controller/ControllerPositionCollection.h"
+#include "controller/ControllerPosition.h"
+
+using UKControllerPlugin::Controller::ControllerPosition;
+using UKControllerPlugin::Controller::ControllerPositionCollection;
+using UKControllerPlugin::Controller::ControllerPositionDecoder;
+using ::testing::ElementsAre;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Controller {
+
+        class ControllerPositionDecoderTest : public Test
+        {
+            public:
+                ControllerPositionDecoderTest()
+                    : decoder(collection)
+                {
+
+                }
+
+                bool Decode(std::string data)
+                {
+                    return nlohmann::json::sax_parse(data, &this->decoder);
+                }
+
+                ControllerPositionCollection collection;
+                ControllerPositionDecoder decoder;
+        };
+
+        TEST_F(ControllerPositionDecoderTest, ItDecodesPositions)
+        {
+            EXPECT_TRUE(
+                this->Decode(
+                    "{\"EGAA_GND\": {\"frequency\": 121.750, \"top-down\": [\"EGAA\"]},"
+                    "\"EGKK_APP\": {\"frequency\": 126.820, \"top-down\": [\"EGKK\", \"EGLL\"]}}"
+                )
+            );
+            EXPECT_EQ(2, this->collection.GetSize());
+
+            ControllerPosition position = this->collection.FetchPositionByCallsign("EGKK_APP");
+            EXPECT_EQ("EGKK_APP", position.GetCallsign());
+            EXPECT_EQ(126.820, position.GetFrequency());
+            EXPECT_EQ("APP", position.GetType());
+            EXPECT_THAT(position.GetTopdown(), ElementsAre("EGKK", "EGLL"));
+        }
+
+        TEST_F(ControllerPositionDecoderTest, ItIgnoresOtherFields)
+        {
+            EXPECT_TRUE(
+                this->Decode(
+                    "{\"EGAA_GND\": {\"id\": 1, \"extra\": {\"frequency\": 1}, \"frequency\": 121.750,"
+                    "\"sectors\": [[1, 2]], \"top-down\": [\"EGAA\"]}}"
+                )
+            );
+            EXPECT_EQ(1, this->collection.GetSize());
+            EXPECT_EQ(121.750, this->collection.FetchPositionByCallsign("EGAA_GND").GetFrequency());
+        }
+
+        TEST_F(ControllerPositionDecoderTest, ItSkipsPositionsWithoutFloatFrequency)
+        {
+            EXPECT_TRUE(
+                this->Decode(
+                    "{\"EGAA_GND\": {\"frequency\": 121, \"top-down\": [\"EGAA\"]},"
+                    "\"EGAA_TWR\": {\"top-down\": [\"EGAA\"]},"
+                    "\"EGAA_APP\": {\"frequency\": \"120.9\", \"top-down\": [\"EGAA\"]}}"
+                )
+            );
+            EXPECT_EQ(0, this->collection.GetSize());
+        }
+
+        TEST_F(ControllerPositionDecoderTest, ItSkipsPositionsWithoutTopDownArray)
+        {
+            EXPECT_TRUE(
+                this->Decode(
+                    "{\"EGAA_GND\": {\"frequency\": 121.750},"
+                    "\"EGAA_TWR\": {\"frequency\": 118.300, \"top-down\": \"EGAA\"},"
+                    "\"EGAA_APP\": {\"frequency\": 120.900, \"top-down\": [\"EGAA\", 1]}}"
+                )
+            );
+            EXPECT_EQ(0, this->collection.GetSize());
+        }
+
+        TEST_F(ControllerPositionDecoderTest, ItSkipsPositionsThatArentObjects)
+        {
+            EXPECT_TRUE(
+                this->Decode(
+                    "{\"EGAA_GND\": [121.750], \"EGAA_TWR\": 118.300,"
+                    "\"EGAA_APP\": {\"frequency\": 120.900, \"top-down\": [\"EGAA\"]}}"
+                )
+            );
+            EXPECT_EQ(1, this->collection.GetSize());
+            EXPECT_EQ(120.900, this->collection.FetchPositionByCallsign("EGAA_APP").GetFrequency());
+        }
+
+        TEST_F(ControllerPositionDecoderTest, ItStopsIfNotAnObject)
+        {
+            EXPECT_FALSE(this->Decode("[{\"frequency\": 121.750, \"top-down\": [\"EGAA\"]}]"));
+            EXPECT_EQ(0, this->collection.GetSize());
+        }
+
+        TEST_F(ControllerPositionDecoderTest, ItStopsIfNotJson)
+        {
+            EXPECT_FALSE(this->Decode("{\"EGAA_GND\": {\"frequency\": 121.750, not json"));
+        }
+    }  // namespace Controller
+}  // namespace UKControllerPluginTest
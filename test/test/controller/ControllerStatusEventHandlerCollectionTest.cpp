@@ -43,6 +43,23 @@ namespace UKControllerPluginTest {
             collection.ControllerUpdateEvent(controller);
         }
 
+        TEST(ControllerStatusEventHandlerCollection, InitialControllerLoadEventCallsCorrectMethodOnHandler)
+        {
+            ControllerStatusEventHandlerCollection collection;
+            std::shared_ptr<StrictMock<MockControllerStatusEventHandlerInterface>> mockHandler(
+                new StrictMock<MockControllerStatusEventHandlerInterface>
+            );
+            std::vector<std::shared_ptr<UKControllerPlugin::Euroscope::EuroScopeCControllerInterface>> controllers = {
+                std::make_shared<EuroScopeCControllerWrapper>(EuroScopePlugIn::CController(), false)
+            };
+
+            EXPECT_CALL(*mockHandler, InitialControllerLoadEvent(Ref(controllers)))
+                .Times(1);
+
+            collection.RegisterHandler(mockHandler);
+            collection.InitialControllerLoadEvent(controllers);
+        }
+
         TEST(ControllerStatusEventHandlerCollection, SelfDisconnectEventCallsCorrectMethodOnHandler)
         {
             ControllerStatusEventHandlerCollection collection;
@@ -0,0 +1,242 @@
+#include "pch/pch.h"
+#include "curl/CurlApi.h"
+#include "task/TaskRunner.h"
+#include "helper/AllocationCounter.h"
+
+using UKControllerPlugin::Curl::CurlApi;
+using UKControllerPlugin::Curl::CurlReceiveBuffer;
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPlugin::TaskManager::TaskRunner;
+
+namespace UKControllerPluginTest {
+    namespace Curl {
+
+        // Servers on this machine for the disabled benchmarks, see the benchmarks for what they need to serve
+        const std::string localServer = "http://127.0.0.1:8450";
+        const std::string slowLocalServer = "http://127.0.0.1:8451";
+
+        /*
+            Appends the received data to a string
+        */
+        size_t AppendReceivedData(void * ptr, size_t size, size_t nmemb, void * body)
+        {
+            static_cast<std::string *>(body)->append(static_cast<char *>(ptr), size * nmemb);
+            return size * nmemb;
+        }
+
+        /*
+            Makes a GET request on a new handle that is cleaned up afterwards, as CurlApi did before
+            handles were pooled.
+        */
+        std::string GetWithNewHandle(const std::string & uri)
+        {
+            std::string body;
+            CURL * handle = curl_easy_init();
+            curl_easy_setopt(handle, CURLOPT_URL, uri.c_str());
+            curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, AppendReceivedData);
+            curl_easy_setopt(handle, CURLOPT_WRITEDATA, &body);
+            curl_easy_perform(handle);
+            curl_easy_cleanup(handle);
+            return body;
+        }
+
+        TEST(CurlApi, CreateResponseAddsHeaders)
+        {
+            CurlResponse response = CurlApi::CreateResponse("body", 200, { { "etag", "\"abc\"" } });
+            EXPECT_EQ("body", response.GetResponse());
+            EXPECT_EQ(200, response.GetStatusCode());
+            EXPECT_FALSE(response.IsCurlError());
+            EXPECT_EQ("\"abc\"", response.GetHeader("etag"));
+        }
+
+        TEST(CurlApi, GetExpectedBodySizeReturnsZeroIfNoContentLength)
+        {
+            EXPECT_EQ(0u, CurlApi::GetExpectedBodySize({ { "etag", "\"abc\"" } }));
+        }
+
+        TEST(CurlApi, GetExpectedBodySizeReturnsZeroIfContentLengthInvalid)
+        {
+            EXPECT_EQ(0u, CurlApi::GetExpectedBodySize({ { "content-length", "abc" } }));
+        }
+
+        TEST(CurlApi, GetExpectedBodySizeReturnsContentLengthIfNotEncoded)
+        {
+            EXPECT_EQ(1234u, CurlApi::GetExpectedBodySize({ { "content-length", "1234" } }));
+        }
+
+        TEST(CurlApi, GetExpectedBodySizeReturnsContentLengthIfIdentityEncoded)
+        {
+            EXPECT_EQ(
+                1234u,
+                CurlApi::GetExpectedBodySize({ { "content-length", "1234" }, { "content-encoding", "identity" } })
+            );
+        }
+
+        TEST(CurlApi, GetExpectedBodySizeAllowsForCompressedBodies)
+        {
+            EXPECT_EQ(
+                1234u * CurlApi::compressedExpansionRatio,
+                CurlApi::GetExpectedBodySize({ { "content-length", "1234" }, { "content-encoding", "gzip" } })
+            );
+        }
+
+        TEST(CurlApi, GetExpectedBodySizeIsCapped)
+        {
+            EXPECT_EQ(
+                CurlApi::maxBodyReservation,
+                CurlApi::GetExpectedBodySize({ { "content-length", "999999999999" } })
+            );
+        }
+
+        TEST(CurlApi, GetExpectedBodySizeIsCappedForCompressedBodies)
+        {
+            EXPECT_EQ(
+                CurlApi::maxBodyReservation,
+                CurlApi::GetExpectedBodySize({ { "content-length", "8000000" }, { "content-encoding", "br" } })
+            );
+        }
+
+        /*
+            Makes 200 requests one after the other, comparing the pooled handles with a new handle for
+            each request. It needs a server serving file0.json to file29.json, so it's disabled by default.
+            The server has to keep connections alive and have Nagle's algorithm turned off, otherwise
+            every reused connection waits on a delayed ACK. Python's http.server does both with protocol
+            HTTP/1.1 and disable_nagle_algorithm set on the handler. Run with --gtest_also_run_disabled_tests.
+        */
+        TEST(CurlApi, DISABLED_MakeCurlRequestIsFasterWithPooledHandles)
+        {
+            CurlApi curl;
+            const int requests = 200;
+            size_t newHandleBytes = 0;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < requests; i++) {
+                newHandleBytes += GetWithNewHandle(localServer + "/file" + std::to_string(i % 30) + ".json").size();
+            }
+            std::chrono::nanoseconds newHandleTime = std::chrono::steady_clock::now() - start;
+
+            size_t pooledBytes = 0;
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < requests; i++) {
+                pooledBytes += curl.MakeCurlRequest(
+                    CurlRequest(localServer + "/file" + std::to_string(i % 30) + ".json", CurlRequest::METHOD_GET)
+                ).GetResponse().size();
+            }
+            std::chrono::nanoseconds pooledTime = std::chrono::steady_clock::now() - start;
+
+            RecordProperty("NewHandleNanosecondsPerRequest", static_cast<int>(newHandleTime.count() / requests));
+            RecordProperty("PooledNanosecondsPerRequest", static_cast<int>(pooledTime.count() / requests));
+            EXPECT_LT(0, pooledBytes);
+            EXPECT_EQ(newHandleBytes, pooledBytes);
+            EXPECT_LT(pooledTime, newHandleTime);
+        }
+
+        /*
+            Makes 200 requests at once, comparing the multi engine with synchronous requests on a two
+            thread task runner, which is how requests are made without it. It needs a server like the one for
+            the pooled handle benchmark, but that waits 20ms before each response to stand in for the network,
+            so it's disabled by default. Run with --gtest_also_run_disabled_tests.
+        */
+        TEST(CurlApi, DISABLED_MakeCurlRequestAsyncIsFasterThanATaskRunner)
+        {
+            CurlApi curl;
+            const int requests = 200;
+            std::vector<CurlRequest> fileRequests;
+            for (int i = 0; i < requests; i++) {
+                fileRequests.push_back(
+                    CurlRequest(slowLocalServer + "/file" + std::to_string(i % 30) + ".json", CurlRequest::METHOD_GET)
+                );
+            }
+
+            std::atomic<int> taskRunnerErrors = 0;
+            std::atomic<int> taskRunnerCompleted = 0;
+            TaskRunner taskRunner(2, 0);
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (const CurlRequest & request : fileRequests) {
+                taskRunner.QueueAsynchronousTask([&curl, &taskRunnerErrors, &taskRunnerCompleted, &request]() {
+                    if (curl.MakeCurlRequest(request).IsCurlError()) {
+                        taskRunnerErrors++;
+                    }
+                    taskRunnerCompleted++;
+                });
+            }
+
+            while (taskRunnerCompleted < requests) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            std::chrono::nanoseconds taskRunnerTime = std::chrono::steady_clock::now() - start;
+
+            int asyncErrors = 0;
+            start = std::chrono::steady_clock::now();
+            std::vector<std::future<CurlResponse>> responses;
+            for (const CurlRequest & request : fileRequests) {
+                responses.push_back(curl.MakeCurlRequestAsync(request));
+            }
+            for (std::future<CurlResponse> & response : responses) {
+                if (response.get().IsCurlError()) {
+                    asyncErrors++;
+                }
+            }
+            std::chrono::nanoseconds asyncTime = std::chrono::steady_clock::now() - start;
+
+            RecordProperty("TaskRunnerMilliseconds", static_cast<int>(taskRunnerTime.count() / 1000000));
+            RecordProperty("AsyncMilliseconds", static_cast<int>(asyncTime.count() / 1000000));
+            EXPECT_EQ(0, taskRunnerErrors);
+            EXPECT_EQ(0, asyncErrors);
+            EXPECT_LT(asyncTime, taskRunnerTime);
+        }
+
+        /*
+            Downloads a large file 100 times, counting the allocations made while it arrives. Compares CurlApi's
+            receive buffer, which reserves the body from Content-Length, with appending to a string as CurlApi
+            used to. Both use CurlApi's request options and header parsing on the same handle, so only the
+            body buffer differs. It needs the same server as the pooled handle benchmark, also serving
+            large.json of a few hundred KB, so it's disabled by default. Run with --gtest_also_run_disabled_tests.
+        */
+        TEST(CurlApi, DISABLED_ReservingTheBodyAllocatesLessForLargeBodies)
+        {
+            const CurlRequest request(localServer + "/large.json", CurlRequest::METHOD_GET);
+            const int requests = 100;
+            CURL * handle = curl_easy_init();
+
+            std::string appendedBody;
+            size_t allocations = CountAllocations();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < requests; i++) {
+                // A receiver stops the body being reserved, then the body is appended to a string instead
+                CurlReceiveBuffer received;
+                received.receiver = [](const char * data, size_t size) -> bool { return true; };
+                std::string body;
+                CurlApi::SetRequestOptions(handle, request, nullptr, received);
+                curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, AppendReceivedData);
+                curl_easy_setopt(handle, CURLOPT_WRITEDATA, &body);
+                curl_easy_perform(handle);
+                appendedBody.swap(body);
+            }
+            std::chrono::nanoseconds appendTime = std::chrono::steady_clock::now() - start;
+            size_t appendAllocations = CountAllocations() - allocations;
+
+            std::string reservedBody;
+            allocations = CountAllocations();
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < requests; i++) {
+                CurlReceiveBuffer received;
+                CurlApi::SetRequestOptions(handle, request, nullptr, received);
+                curl_easy_perform(handle);
+                reservedBody.swap(received.body);
+            }
+            std::chrono::nanoseconds reservedTime = std::chrono::steady_clock::now() - start;
+            size_t reservedAllocations = CountAllocations() - allocations;
+            curl_easy_cleanup(handle);
+
+            RecordProperty("BodyBytes", static_cast<int>(reservedBody.size()));
+            RecordProperty("AppendAllocationsPerRequest", static_cast<int>(appendAllocations / requests));
+            RecordProperty("ReservedAllocationsPerRequest", static_cast<int>(reservedAllocations / requests));
+            RecordProperty("AppendNanosecondsPerRequest", static_cast<int>(appendTime.count() / requests));
+            RecordProperty("ReservedNanosecondsPerRequest", static_cast<int>(reservedTime.count() / requests));
+            EXPECT_LT(0, reservedBody.size());
+            EXPECT_EQ(appendedBody, reservedBody);
+            EXPECT_LT(reservedAllocations, appendAllocations);
+        }
+    }  // namespace Curl
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,96 @@
+#include "pch/pch.h"
+#include "curl/CurlHandlePool.h"
+
+using UKControllerPlugin::Curl::CurlHandlePool;
+
+namespace UKControllerPluginTest {
+    namespace Curl {
+
+        TEST(CurlHandlePoolTest, GetHostReturnsSchemeAndHost)
+        {
+            EXPECT_EQ("https://ukcp.test.com", CurlHandlePool::GetHost("https://ukcp.test.com/api/squawk"));
+        }
+
+        TEST(CurlHandlePoolTest, GetHostKeepsThePort)
+        {
+            EXPECT_EQ("http://localhost:8080", CurlHandlePool::GetHost("http://localhost:8080/version?a=b"));
+        }
+
+        TEST(CurlHandlePoolTest, GetHostIsCaseInsensitive)
+        {
+            EXPECT_EQ("https://ukcp.test.com", CurlHandlePool::GetHost("HTTPS://UKCP.Test.com"));
+        }
+
+        TEST(CurlHandlePoolTest, AcquireHandleReturnsAHandle)
+        {
+            CurlHandlePool pool(2);
+            CURL * handle = pool.AcquireHandle("https://ukcp.test.com");
+            EXPECT_NE(nullptr, handle);
+            EXPECT_EQ(1, pool.CountActiveHandles("https://ukcp.test.com"));
+            EXPECT_EQ(0, pool.CountIdleHandles("https://ukcp.test.com"));
+            pool.ReleaseHandle("https://ukcp.test.com", handle);
+        }
+
+        TEST(CurlHandlePoolTest, ReleaseHandleMakesItIdle)
+        {
+            CurlHandlePool pool(2);
+            pool.ReleaseHandle("https://ukcp.test.com", pool.AcquireHandle("https://ukcp.test.com"));
+            EXPECT_EQ(0, pool.CountActiveHandles("https://ukcp.test.com"));
+            EXPECT_EQ(1, pool.CountIdleHandles("https://ukcp.test.com"));
+        }
+
+        TEST(CurlHandlePoolTest, AcquireHandleReusesIdleHandlesForTheSameHost)
+        {
+            CurlHandlePool pool(2);
+            CURL * handle = pool.AcquireHandle("https://ukcp.test.com");
+            pool.ReleaseHandle("https://ukcp.test.com", handle);
+
+            EXPECT_EQ(handle, pool.AcquireHandle("https://ukcp.test.com"));
+            EXPECT_EQ(0, pool.CountIdleHandles("https://ukcp.test.com"));
+            pool.ReleaseHandle("https://ukcp.test.com", handle);
+        }
+
+        TEST(CurlHandlePoolTest, AcquireHandleDoesNotReuseHandlesFromOtherHosts)
+        {
+            CurlHandlePool pool(2);
+            CURL * handle = pool.AcquireHandle("https://ukcp.test.com");
+            pool.ReleaseHandle("https://ukcp.test.com", handle);
+
+            CURL * otherHandle = pool.AcquireHandle("https://other.test.com");
+            EXPECT_NE(handle, otherHandle);
+            EXPECT_EQ(1, pool.CountIdleHandles("https://ukcp.test.com"));
+            pool.ReleaseHandle("https://other.test.com", otherHandle);
+        }
+
+        TEST(CurlHandlePoolTest, AcquireHandleWaitsWhenHostIsAtLimit)
+        {
+            CurlHandlePool pool(1);
+            CURL * handle = pool.AcquireHandle("https://ukcp.test.com");
+
+            std::atomic<bool> acquired = false;
+            std::thread waiting([&pool, &acquired] {
+                pool.ReleaseHandle("https://ukcp.test.com", pool.AcquireHandle("https://ukcp.test.com"));
+                acquired = true;
+            });
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            EXPECT_FALSE(acquired);
+
+            pool.ReleaseHandle("https://ukcp.test.com", handle);
+            waiting.join();
+            EXPECT_TRUE(acquired);
+            EXPECT_EQ(1, pool.CountIdleHandles("https://ukcp.test.com"));
+        }
+
+        TEST(CurlHandlePoolTest, HostLimitDoesNotAffectOtherHosts)
+        {
+            CurlHandlePool pool(1);
+            CURL * handle = pool.AcquireHandle("https://ukcp.test.com");
+            CURL * otherHandle = pool.AcquireHandle("https://other.test.com");
+            EXPECT_EQ(1, pool.CountActiveHandles("https://ukcp.test.com"));
+            EXPECT_EQ(1, pool.CountActiveHandles("https://other.test.com"));
+            pool.ReleaseHandle("https://ukcp.test.com", handle);
+            pool.ReleaseHandle("https://other.test.com", otherHandle);
+        }
+    }  // namespace Curl
+}  // namespace UKControllerPluginTest
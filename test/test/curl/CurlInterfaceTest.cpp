@@ -0,0 +1,89 @@
+#include "pch/pch.h"
+#include "mock/MockCurlApi.h"
+
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPluginTest::Curl::MockCurlApi;
+using ::testing::StrictMock;
+using ::testing::Return;
+
+namespace UKControllerPluginTest {
+    namespace Curl {
+
+        TEST(CurlInterfaceTest, MakeCurlRequestAsyncReturnsReadyFutureByDefault)
+        {
+            StrictMock<MockCurlApi> curl;
+            CurlRequest request("http://ukcp.test.com", CurlRequest::METHOD_GET);
+            EXPECT_CALL(curl, MakeCurlRequest(request))
+                .Times(1)
+                .WillOnce(Return(CurlResponse("test", false, 200)));
+
+            std::future<CurlResponse> response = curl.MakeCurlRequestAsync(request);
+            ASSERT_EQ(std::future_status::ready, response.wait_for(std::chrono::seconds(0)));
+            EXPECT_EQ("test", response.get().GetResponse());
+        }
+
+        TEST(CurlInterfaceTest, MakeCurlRequestAsyncCallsBackByDefault)
+        {
+            StrictMock<MockCurlApi> curl;
+            CurlRequest request("http://ukcp.test.com", CurlRequest::METHOD_GET);
+            EXPECT_CALL(curl, MakeCurlRequest(request))
+                .Times(1)
+                .WillOnce(Return(CurlResponse("test", false, 200)));
+
+            std::string body;
+            curl.MakeCurlRequestAsync(request, [&body](CurlResponse response) { body = response.GetResponse(); });
+            EXPECT_EQ("test", body);
+        }
+
+        TEST(CurlInterfaceTest, StreamCurlRequestGivesTheWholeBodyToTheReceiverByDefault)
+        {
+            StrictMock<MockCurlApi> curl;
+            CurlRequest request("http://ukcp.test.com", CurlRequest::METHOD_GET);
+            EXPECT_CALL(curl, MakeCurlRequest(request))
+                .Times(1)
+                .WillOnce(Return(CurlResponse("test", false, 200)));
+
+            std::string body;
+            CurlResponse response = curl.StreamCurlRequest(
+                request,
+                [&body](const char * data, size_t length) { body.append(data, length); return true; }
+            );
+            EXPECT_EQ("test", body);
+            EXPECT_FALSE(response.IsCurlError());
+            EXPECT_EQ(200, response.GetStatusCode());
+        }
+
+        TEST(CurlInterfaceTest, StreamCurlRequestReturnsErrorIfReceiverAborts)
+        {
+            StrictMock<MockCurlApi> curl;
+            CurlRequest request("http://ukcp.test.com", CurlRequest::METHOD_GET);
+            EXPECT_CALL(curl, MakeCurlRequest(request))
+                .Times(1)
+                .WillOnce(Return(CurlResponse("test", false, 200)));
+
+            CurlResponse response = curl.StreamCurlRequest(
+                request,
+                [](const char * data, size_t length) { return false; }
+            );
+            EXPECT_TRUE(response.IsCurlError());
+        }
+
+        TEST(CurlInterfaceTest, StreamCurlRequestDoesNotCallReceiverOnCurlError)
+        {
+            StrictMock<MockCurlApi> curl;
+            CurlRequest request("http://ukcp.test.com", CurlRequest::METHOD_GET);
+            EXPECT_CALL(curl, MakeCurlRequest(request))
+                .Times(1)
+                .WillOnce(Return(CurlResponse("", true, -1)));
+
+            bool called = false;
+            CurlResponse response = curl.StreamCurlRequest(
+                request,
+                [&called](const char * data, size_t length) { called = true; return true; }
+            );
+            EXPECT_TRUE(response.IsCurlError());
+            EXPECT_FALSE(called);
+        }
+    }  // namespace Curl
+}  // namespace UKControllerPluginTest
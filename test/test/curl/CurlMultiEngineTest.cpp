@@ -0,0 +1,108 @@
+#include "pch/pch.h"
+#include "curl/CurlMultiEngine.h"
+#include "curl/CurlRequest.h"
+#include "curl/CurlResponse.h"
+
+using UKControllerPlugin::Curl::CurlMultiEngine;
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+
+namespace UKControllerPluginTest {
+    namespace Curl {
+
+        // Nothing listens on port 1, so requests fail straight away
+        const std::string unreachableUri = "http://127.0.0.1:1/api";
+
+        TEST(CurlMultiEngineTest, SubmitReturnsFutureForResponse)
+        {
+            CurlMultiEngine engine(2);
+            std::future<CurlResponse> response = engine.Submit(CurlRequest(unreachableUri, CurlRequest::METHOD_GET));
+            ASSERT_EQ(std::future_status::ready, response.wait_for(std::chrono::seconds(5)));
+            EXPECT_TRUE(response.get().IsCurlError());
+        }
+
+        TEST(CurlMultiEngineTest, SubmitCallsBackWithResponse)
+        {
+            CurlMultiEngine engine(2);
+            std::promise<bool> called;
+            engine.Submit(
+                CurlRequest(unreachableUri, CurlRequest::METHOD_GET),
+                [&called](CurlResponse response) { called.set_value(response.IsCurlError()); }
+            );
+
+            std::future<bool> result = called.get_future();
+            ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(5)));
+            EXPECT_TRUE(result.get());
+        }
+
+        TEST(CurlMultiEngineTest, SubmitRunsManyRequestsOnOneThread)
+        {
+            CurlMultiEngine engine(2);
+            std::vector<std::future<CurlResponse>> responses;
+            for (int i = 0; i < 50; i++) {
+                responses.push_back(engine.Submit(CurlRequest(unreachableUri, CurlRequest::METHOD_POST)));
+            }
+
+            for (std::future<CurlResponse> & response : responses) {
+                ASSERT_EQ(std::future_status::ready, response.wait_for(std::chrono::seconds(5)));
+                EXPECT_TRUE(response.get().IsCurlError());
+            }
+            EXPECT_EQ(0, engine.CountTransfers());
+        }
+
+        TEST(CurlMultiEngineTest, ThrowingCallbacksDontStopTheEngine)
+        {
+            CurlMultiEngine engine(2);
+            engine.Submit(
+                CurlRequest(unreachableUri, CurlRequest::METHOD_GET),
+                [](CurlResponse response) { throw std::runtime_error("Oops"); }
+            );
+
+            std::future<CurlResponse> response = engine.Submit(CurlRequest(unreachableUri, CurlRequest::METHOD_GET));
+            ASSERT_EQ(std::future_status::ready, response.wait_for(std::chrono::seconds(5)));
+            EXPECT_TRUE(response.get().IsCurlError());
+        }
+
+        TEST(CurlMultiEngineTest, SubmitWakesTheLoopWhileTransfersAreRunning)
+        {
+            CurlMultiEngine engine(2);
+
+            // Accepts connections but never answers, so the loop is left waiting on the transfer
+            curl_socket_t server = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            socklen_t addressLength = sizeof(address);
+            ASSERT_EQ(0, bind(server, reinterpret_cast<sockaddr *>(&address), sizeof(address)));
+            ASSERT_EQ(0, getsockname(server, reinterpret_cast<sockaddr *>(&address), &addressLength));
+            ASSERT_EQ(0, listen(server, 1));
+
+            std::future<CurlResponse> silent = engine.Submit(
+                CurlRequest("http://127.0.0.1:" + std::to_string(ntohs(address.sin_port)), CurlRequest::METHOD_GET)
+            );
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+            std::chrono::steady_clock::time_point submitted = std::chrono::steady_clock::now();
+            std::future<CurlResponse> response = engine.Submit(CurlRequest(unreachableUri, CurlRequest::METHOD_GET));
+            ASSERT_EQ(std::future_status::ready, response.wait_for(std::chrono::seconds(5)));
+            EXPECT_LT(
+                std::chrono::steady_clock::now() - submitted,
+                std::chrono::milliseconds(CurlMultiEngine::pollTimeout / 2)
+            );
+            EXPECT_EQ(std::future_status::timeout, silent.wait_for(std::chrono::seconds(0)));
+            closesocket(server);
+        }
+
+        TEST(CurlMultiEngineTest, DestructorCompletesOutstandingTransfers)
+        {
+            std::future<CurlResponse> response;
+            {
+                CurlMultiEngine engine(2);
+                response = engine.Submit(CurlRequest(unreachableUri, CurlRequest::METHOD_GET));
+            }
+
+            ASSERT_EQ(std::future_status::ready, response.wait_for(std::chrono::seconds(0)));
+            EXPECT_TRUE(response.get().IsCurlError());
+        }
+    }  // namespace Curl
+}  // namespace UKControllerPluginTest
@@ -38,5 +38,20 @@ namespace UKControllerPluginTest {
             EXPECT_FALSE(response1.IsCurlError());
             EXPECT_TRUE(response2.IsCurlError());
         }
+
+        TEST(CurlResponse, GetHeaderReturnsEmptyIfNotSent)
+        {
+            CurlResponse response("TestResponse", false, 200);
+            EXPECT_FALSE(response.HasHeader("ETag"));
+            EXPECT_EQ("", response.GetHeader("ETag"));
+        }
+
+        TEST(CurlResponse, GetHeaderIgnoresCase)
+        {
+            CurlResponse response("TestResponse", false, 200);
+            response.AddHeader("ETag", "\"abc\"");
+            EXPECT_TRUE(response.HasHeader("etag"));
+            EXPECT_EQ("\"abc\"", response.GetHeader("ETAG"));
+        }
     }  // namespace Curl
 }  // namespace UKControllerPluginTest
@@ -48,6 +48,27 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE(expectedTime == timeDisplay.FromTimePoint(HelperFunctions::GetTimeFromNumberString("1523")));
         }
 
+        TEST_F(DisplayTimeTest, WriteTimePointWritesTimeString)
+        {
+            char buffer[16];
+            timeDisplay.WriteTimePoint(HelperFunctions::GetTimeFromNumberString("1523"), buffer, 16);
+            EXPECT_EQ(0, strcmp("15:23", buffer));
+        }
+
+        TEST_F(DisplayTimeTest, WriteTimePointMatchesFromTimestamp)
+        {
+            char buffer[16];
+            timeDisplay.WriteTimePoint(std::chrono::system_clock::from_time_t(1403549100), buffer, 16);
+            EXPECT_EQ(timeDisplay.FromTimestamp(1403549100), buffer);
+        }
+
+        TEST_F(DisplayTimeTest, WriteTimePointPadsSingleDigits)
+        {
+            char buffer[16];
+            timeDisplay.WriteTimePoint(std::chrono::system_clock::from_time_t(3660), buffer, 16);
+            EXPECT_EQ(0, strcmp("01:01", buffer));
+        }
+
         TEST_F(DisplayTimeTest, UnknownTimeDefaultsToDashes)
         {
             EXPECT_EQ(this->timeDisplay.unknownTimeFormatDefault, this->timeDisplay.GetUnknownTimeFormat());
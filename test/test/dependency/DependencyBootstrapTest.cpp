@@ -25,6 +25,8 @@ using UKControllerPlugin::Api::RemoteFile;
 using UKControllerPluginTest::Curl::MockCurlApi;
 using ::testing::NiceMock;
 using ::testing::Return;
+using ::testing::Invoke;
+using ::testing::_;
 
 namespace UKControllerPluginTest {
 namespace Bootstrap {
@@ -38,7 +40,7 @@ TEST(DependencyBootstrap, BootstrapUpdatesLocalFilesAndProducesADependencyCache)
     RemoteFileManifest manifest;
     RemoteFile file;
     file.filename = "test1.json";
-    file.hash = "nottestmd5";
+    file.hash = "7acfafe1c65d354a251c44946404dbb8";
     file.uri = "http://test1.com";
     manifest.AddFile(file);
 
@@ -48,9 +50,11 @@ TEST(DependencyBootstrap, BootstrapUpdatesLocalFilesAndProducesADependencyCache)
         .Times(1)
         .WillOnce(Return(manifest));
 
-    EXPECT_CALL(mockApi, FetchRemoteFile("http://test1.com"))
+    EXPECT_CALL(mockApi, StreamRemoteFile("http://test1.com", _))
         .Times(1)
-        .WillOnce(Return("somethingnew"));
+        .WillOnce(Invoke([](std::string uri, std::function<bool(const char *, size_t)> receiver) {
+            receiver("somethingnew", 12);
+        }));
 
     // For simulation purposes, we'll just assume that the local file is up to date.
     EXPECT_CALL(mockWindows, CreateFolder("dependencies"))
@@ -69,18 +73,27 @@ TEST(DependencyBootstrap, BootstrapUpdatesLocalFilesAndProducesADependencyCache)
         .Times(1)
         .WillOnce(Return("{\"test1.json\": \"testmd5\"}"));
 
-    EXPECT_CALL(mockWindows, WriteToFile("dependencies/test1.json", "somethingnew", true))
+    EXPECT_CALL(mockWindows, WriteToBinaryFile("dependencies/test1.json.download", "somethingnew", true))
         .Times(1);
 
+    EXPECT_CALL(mockWindows, MoveGivenFile("dependencies/test1.json.download", "dependencies/test1.json"))
+        .Times(1)
+        .WillOnce(Return(true));
+
     EXPECT_CALL(
             mockWindows,
-            WriteToFile("dependencies/filehash.json", "{\n    \"test1.json\": \"nottestmd5\"\n}", true)
+            WriteToFile(
+                "dependencies/filehash.json",
+                "{\n    \"test1.json\": \"7acfafe1c65d354a251c44946404dbb8\"\n}",
+                true
+            )
         )
         .Times(1);
 
     std::string expectedManifest1 =  "{\n    \"manifest\": {\n        \"test1.json\": {\n            \"md5\":";
-    std::string expectedManifest2 =  " \"nottestmd5\",\n            \"uri\": \"http://test1.com\"\n        }\n    }\n}";
-    std::string expectedManfiest = expectedManifest1 + expectedManifest2;
+    std::string expectedManifest2 =  " \"7acfafe1c65d354a251c44946404dbb8\",\n            \"uri\": ";
+    std::string expectedManifest3 =  "\"http://test1.com\"\n        }\n    }\n}";
+    std::string expectedManfiest = expectedManifest1 + expectedManifest2 + expectedManifest3;
     EXPECT_CALL(
         mockWindows,
         WriteToFile(
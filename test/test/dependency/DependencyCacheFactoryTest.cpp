@@ -85,5 +85,44 @@ namespace UKControllerPluginTest {
 
             EXPECT_EQ(0, DependencyCacheFactory::Create("testfolder", manifest, mockWinApi)->DependencyCount());
         }
+
+        TEST(DependencyCacheFactory, AddFileAddsFileIfExistsLocally)
+        {
+            RemoteFile file;
+            file.filename = "test.json";
+            file.hash = "testhash";
+            file.uri = "testuri";
+
+            StrictMock<MockWinApi> mockWinApi;
+            EXPECT_CALL(mockWinApi, FileExists("testfolder/test.json"))
+                .Times(1)
+                .WillOnce(Return(true));
+
+            EXPECT_CALL(mockWinApi, ReadFromFileMock("testfolder/test.json", true))
+                .Times(1)
+                .WillOnce(Return("testdata"));
+
+            DependencyCache cache;
+            DependencyCacheFactory::AddFile(cache, "testfolder", file, mockWinApi);
+            EXPECT_EQ("testdata", cache.GetDependency("test.json"));
+        }
+
+        TEST(DependencyCacheFactory, AddFilesSkipsFilesAlreadyInTheCache)
+        {
+            RemoteFileManifest manifest;
+            RemoteFile file;
+            file.filename = "test.json";
+            file.hash = "testhash";
+            file.uri = "testuri";
+            manifest.AddFile(file);
+
+            StrictMock<MockWinApi> mockWinApi;
+            DependencyCache cache;
+            cache.AddDependency("test.json", "alreadyloaded");
+
+            DependencyCacheFactory::AddFiles(cache, "testfolder", manifest, mockWinApi);
+            EXPECT_EQ(1, cache.DependencyCount());
+            EXPECT_EQ("alreadyloaded", cache.GetDependency("test.json"));
+        }
     }  // namespace Dependency
 }  // namespace UKControllerPluginTest
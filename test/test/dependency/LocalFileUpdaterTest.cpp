@@ -7,6 +7,10 @@
 #include "api/ApiInterface.h"
 #include "api/ApiException.h"
 #include "api/ApiNotFoundException.h"
+#include "api/ApiHelper.h"
+#include "api/ApiRequestBuilder.h"
+#include "curl/CurlApi.h"
+#include "dependency/Md5Hash.h"
 
 using UKControllerPlugin::Dependency::LocalFileUpdater;
 using UKControllerPluginTest::Windows::MockWinApi;
@@ -15,14 +19,31 @@ using UKControllerPlugin::Api::RemoteFileManifest;
 using UKControllerPlugin::Api::RemoteFile;
 using UKControllerPlugin::Api::ApiException;
 using UKControllerPlugin::Api::ApiNotFoundException;
+using UKControllerPlugin::Api::ApiHelper;
+using UKControllerPlugin::Api::ApiRequestBuilder;
+using UKControllerPlugin::Curl::CurlApi;
+using UKControllerPlugin::Dependency::Md5Hash;
 using ::testing::Test;
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::Throw;
+using ::testing::Invoke;
+using ::testing::_;
 
 namespace UKControllerPluginTest {
     namespace Dependency {
 
+        // The MD5 hash of the data the test file is streamed with
+        const std::string testDataHash = "368af8c459f9b184785a0556a1d70fcb";
+
+        // Has the mock API stream some data to the receiver
+        auto Stream(std::string data)
+        {
+            return Invoke([data](std::string uri, std::function<bool(const char *, size_t)> receiver) {
+                receiver(data.c_str(), data.size());
+            });
+        }
+
         class LocalFileUpdaterTest : public Test
         {
             public:
@@ -65,23 +86,30 @@ namespace UKControllerPluginTest {
 
             EXPECT_CALL(
                     this->mockWinApi,
-                    WriteToFile(LocalFileUpdater::HASH_FILE, "{\n    \"test.json\": \"testmd5\"\n}", true)
+                    WriteToFile(LocalFileUpdater::HASH_FILE, "{\n    \"test.json\": \"" + testDataHash + "\"\n}", true)
                 )
                 .Times(1);
 
-            EXPECT_CALL(this->mockWinApi, WriteToFile("dependencies/test.json", "sometestdata", true))
+            EXPECT_CALL(
+                    this->mockWinApi,
+                    WriteToBinaryFile("dependencies/test.json.download", "sometestdata", true)
+                )
                 .Times(1);
 
-            EXPECT_CALL(this->mockWebApi, FetchRemoteFile("testuri"))
+            EXPECT_CALL(this->mockWinApi, MoveGivenFile("dependencies/test.json.download", "dependencies/test.json"))
                 .Times(1)
-                .WillOnce(Return("sometestdata"));
+                .WillOnce(Return(true));
+
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile("testuri", _))
+                .Times(1)
+                .WillOnce(Stream("sometestdata"));
 
 
             // Create the local classes for the test;
             RemoteFileManifest manifest;
             RemoteFile remoteFile;
             remoteFile.filename = "test.json";
-            remoteFile.hash = "testmd5";
+            remoteFile.hash = testDataHash;
             remoteFile.uri = "testuri";
             manifest.AddFile(remoteFile);
 
@@ -109,22 +137,29 @@ namespace UKControllerPluginTest {
 
             EXPECT_CALL(
                     this->mockWinApi,
-                    WriteToFile(LocalFileUpdater::HASH_FILE, "{\n    \"test.json\": \"testmd5\"\n}", true)
+                    WriteToFile(LocalFileUpdater::HASH_FILE, "{\n    \"test.json\": \"" + testDataHash + "\"\n}", true)
                 )
                 .Times(1);
 
-            EXPECT_CALL(this->mockWinApi, WriteToFile("dependencies/test.json", "sometestdata", true))
+            EXPECT_CALL(
+                    this->mockWinApi,
+                    WriteToBinaryFile("dependencies/test.json.download", "sometestdata", true)
+                )
                 .Times(1);
 
-            EXPECT_CALL(this->mockWebApi, FetchRemoteFile("testuri"))
+            EXPECT_CALL(this->mockWinApi, MoveGivenFile("dependencies/test.json.download", "dependencies/test.json"))
                 .Times(1)
-                .WillOnce(Return("sometestdata"));
+                .WillOnce(Return(true));
+
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile("testuri", _))
+                .Times(1)
+                .WillOnce(Stream("sometestdata"));
 
             // Create the local classes for the test;
             RemoteFileManifest manifest;
             RemoteFile remoteFile;
             remoteFile.filename = "test.json";
-            remoteFile.hash = "testmd5";
+            remoteFile.hash = testDataHash;
             remoteFile.uri = "testuri";
             manifest.AddFile(remoteFile);
 
@@ -148,22 +183,29 @@ namespace UKControllerPluginTest {
 
             EXPECT_CALL(
                     this->mockWinApi,
-                    WriteToFile(LocalFileUpdater::HASH_FILE, "{\n    \"test.json\": \"testmd5\"\n}", true)
+                    WriteToFile(LocalFileUpdater::HASH_FILE, "{\n    \"test.json\": \"" + testDataHash + "\"\n}", true)
                 )
                 .Times(1);
 
-            EXPECT_CALL(this->mockWinApi, WriteToFile("dependencies/test.json", "sometestdata", true))
+            EXPECT_CALL(
+                    this->mockWinApi,
+                    WriteToBinaryFile("dependencies/test.json.download", "sometestdata", true)
+                )
                 .Times(1);
 
-            EXPECT_CALL(this->mockWebApi, FetchRemoteFile("testuri"))
+            EXPECT_CALL(this->mockWinApi, MoveGivenFile("dependencies/test.json.download", "dependencies/test.json"))
+                .Times(1)
+                .WillOnce(Return(true));
+
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile("testuri", _))
                 .Times(1)
-                .WillOnce(Return("sometestdata"));
+                .WillOnce(Stream("sometestdata"));
 
             // Create the local classes for the test;
             RemoteFileManifest manifest;
             RemoteFile remoteFile;
             remoteFile.filename = "test.json";
-            remoteFile.hash = "testmd5";
+            remoteFile.hash = testDataHash;
             remoteFile.uri = "testuri";
             manifest.AddFile(remoteFile);
 
@@ -222,7 +264,7 @@ namespace UKControllerPluginTest {
             EXPECT_CALL(this->mockWinApi, WriteToFile(LocalFileUpdater::HASH_FILE, "{}", true))
                 .Times(1);
 
-            EXPECT_CALL(this->mockWebApi, FetchRemoteFile("testuri"))
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile("testuri", _))
                 .Times(1)
                 .WillOnce(Throw(ApiException("Not found")));
 
@@ -254,7 +296,7 @@ namespace UKControllerPluginTest {
             EXPECT_CALL(this->mockWinApi, WriteToFile(LocalFileUpdater::HASH_FILE, "{}", true))
                 .Times(1);
 
-            EXPECT_CALL(this->mockWebApi, FetchRemoteFile("testuri"))
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile("testuri", _))
                 .Times(1)
                 .WillOnce(Throw(ApiNotFoundException("Not found")));
 
@@ -290,23 +332,288 @@ namespace UKControllerPluginTest {
             EXPECT_CALL(this->mockWinApi, WriteToFile(LocalFileUpdater::HASH_FILE, "{}", true))
                 .Times(1);
 
-            EXPECT_CALL(this->mockWinApi, WriteToFile("dependencies/test.json", "sometestdata", true))
+            EXPECT_CALL(
+                    this->mockWinApi,
+                    WriteToBinaryFile("dependencies/test.json.download", "sometestdata", true)
+                )
                 .Times(1)
                 .WillOnce(Throw(std::ifstream::failure("")));
 
-            EXPECT_CALL(this->mockWebApi, FetchRemoteFile("testuri"))
+            EXPECT_CALL(this->mockWinApi, MoveGivenFile(_, _))
+                .Times(0);
+
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile("testuri", _))
                 .Times(1)
-                .WillOnce(Return("sometestdata"));
+                .WillOnce(Stream("sometestdata"));
 
             // Create the local classes for the test;
             RemoteFileManifest manifest;
             RemoteFile remoteFile;
             remoteFile.filename = "test.json";
-            remoteFile.hash = "testmd5";
+            remoteFile.hash = testDataHash;
+            remoteFile.uri = "testuri";
+            manifest.AddFile(remoteFile);
+
+            this->updater.UpdateLocalFilesFromManifest(manifest);
+        }
+
+        TEST_F(LocalFileUpdaterTest, UpdateLocalFilesDoesNotWriteFileIfHashDoesNotMatch)
+        {
+            EXPECT_CALL(this->mockWinApi, CreateFolder("dependencies"))
+                .Times(1)
+                .WillOnce(Return(true));
+
+            EXPECT_CALL(this->mockWinApi, FileExists("dependencies/test.json"))
+                .Times(1)
+                .WillOnce(Return(false));
+
+            EXPECT_CALL(this->mockWinApi, FileExists(LocalFileUpdater::HASH_FILE))
+                .Times(1)
+                .WillOnce(Return(false));
+
+            EXPECT_CALL(this->mockWinApi, WriteToFile(LocalFileUpdater::HASH_FILE, "{}", true))
+                .Times(1);
+
+            EXPECT_CALL(this->mockWinApi, WriteToBinaryFile(_, _, _))
+                .Times(0);
+
+            EXPECT_CALL(this->mockWinApi, MoveGivenFile(_, _))
+                .Times(0);
+
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile("testuri", _))
+                .Times(1)
+                .WillOnce(Stream("sometestdatathatsbeentamperedwith"));
+
+            // Create the local classes for the test;
+            RemoteFileManifest manifest;
+            RemoteFile remoteFile;
+            remoteFile.filename = "test.json";
+            remoteFile.hash = testDataHash;
+            remoteFile.uri = "testuri";
+            manifest.AddFile(remoteFile);
+
+            this->updater.UpdateLocalFilesFromManifest(manifest);
+        }
+
+        TEST_F(LocalFileUpdaterTest, UpdateLocalFilesDoesNotWriteToHashCacheIfFileCannotBeMoved)
+        {
+            EXPECT_CALL(this->mockWinApi, CreateFolder("dependencies"))
+                .Times(1)
+                .WillOnce(Return(true));
+
+            EXPECT_CALL(this->mockWinApi, FileExists("dependencies/test.json"))
+                .Times(1)
+                .WillOnce(Return(false));
+
+            EXPECT_CALL(this->mockWinApi, FileExists(LocalFileUpdater::HASH_FILE))
+                .Times(1)
+                .WillOnce(Return(false));
+
+            EXPECT_CALL(this->mockWinApi, WriteToFile(LocalFileUpdater::HASH_FILE, "{}", true))
+                .Times(1);
+
+            EXPECT_CALL(
+                    this->mockWinApi,
+                    WriteToBinaryFile("dependencies/test.json.download", "sometestdata", true)
+                )
+                .Times(1);
+
+            EXPECT_CALL(this->mockWinApi, MoveGivenFile("dependencies/test.json.download", "dependencies/test.json"))
+                .Times(1)
+                .WillOnce(Return(false));
+
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile("testuri", _))
+                .Times(1)
+                .WillOnce(Stream("sometestdata"));
+
+            // Create the local classes for the test;
+            RemoteFileManifest manifest;
+            RemoteFile remoteFile;
+            remoteFile.filename = "test.json";
+            remoteFile.hash = testDataHash;
             remoteFile.uri = "testuri";
             manifest.AddFile(remoteFile);
 
             this->updater.UpdateLocalFilesFromManifest(manifest);
         }
+
+        TEST_F(LocalFileUpdaterTest, UpdateLocalFilesReportsEachFileThatIsReady)
+        {
+            ON_CALL(this->mockWinApi, CreateFolder("dependencies"))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWinApi, FileExists("dependencies/uptodate.json"))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWinApi, FileExists(LocalFileUpdater::HASH_FILE))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWinApi, ReadFromFileMock(LocalFileUpdater::HASH_FILE, true))
+                .WillByDefault(Return("{\"uptodate.json\": \"testmd5\"}"));
+
+            ON_CALL(this->mockWinApi, MoveGivenFile(_, _))
+                .WillByDefault(Return(true));
+
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile("downloaded", _))
+                .Times(1)
+                .WillOnce(Stream("sometestdata"));
+
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile("failed", _))
+                .Times(1)
+                .WillOnce(Throw(ApiException("Not found")));
+
+            RemoteFileManifest manifest;
+            manifest.AddFile({ "uptodate.json", "uptodate", "testmd5" });
+            manifest.AddFile({ "downloaded.json", "downloaded", testDataHash });
+            manifest.AddFile({ "failed.json", "failed", testDataHash });
+
+            std::set<std::string> readyFiles;
+            this->updater.UpdateLocalFilesFromManifest(
+                manifest,
+                [&readyFiles](const RemoteFile & file) { readyFiles.insert(file.filename); }
+            );
+
+            EXPECT_EQ(std::set<std::string>({ "downloaded.json", "uptodate.json" }), readyFiles);
+        }
+
+        TEST_F(LocalFileUpdaterTest, UpdateLocalFilesDownloadsFilesAtTheSameTime)
+        {
+            ON_CALL(this->mockWinApi, CreateFolder("dependencies"))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWinApi, MoveGivenFile(_, _))
+                .WillByDefault(Return(true));
+
+            // Each download waits for the others to start, so they only finish if they run together.
+            std::mutex lock;
+            std::condition_variable started;
+            int downloading = 0;
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile(_, _))
+                .Times(3)
+                .WillRepeatedly(Invoke([&](std::string uri, std::function<bool(const char *, size_t)> receiver) {
+                    std::unique_lock<std::mutex> guard(lock);
+                    downloading++;
+                    started.notify_all();
+                    started.wait_for(guard, std::chrono::seconds(5), [&downloading]() { return downloading == 3; });
+                    receiver("sometestdata", 12);
+                }));
+
+            RemoteFileManifest manifest;
+            manifest.AddFile({ "test1.json", "test1", testDataHash });
+            manifest.AddFile({ "test2.json", "test2", testDataHash });
+            manifest.AddFile({ "test3.json", "test3", testDataHash });
+
+            size_t readyFiles = 0;
+            LocalFileUpdater concurrentUpdater(this->mockWinApi, this->mockWebApi, 3);
+            concurrentUpdater.UpdateLocalFilesFromManifest(
+                manifest,
+                [&readyFiles](const RemoteFile & file) { readyFiles++; }
+            );
+
+            EXPECT_EQ(3, downloading);
+            EXPECT_EQ(3, readyFiles);
+        }
+
+        TEST_F(LocalFileUpdaterTest, UpdateLocalFilesLimitsHowManyFilesAreDownloadedAtOnce)
+        {
+            ON_CALL(this->mockWinApi, CreateFolder("dependencies"))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWinApi, MoveGivenFile(_, _))
+                .WillByDefault(Return(true));
+
+            std::atomic<int> downloading = 0;
+            std::atomic<int> mostDownloading = 0;
+            EXPECT_CALL(this->mockWebApi, StreamRemoteFile(_, _))
+                .Times(6)
+                .WillRepeatedly(Invoke([&](std::string uri, std::function<bool(const char *, size_t)> receiver) {
+                    int nowDownloading = ++downloading;
+                    int previousMost = mostDownloading;
+                    while (nowDownloading > previousMost &&
+                        !mostDownloading.compare_exchange_weak(previousMost, nowDownloading)
+                    ) {}
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    receiver("sometestdata", 12);
+                    downloading--;
+                }));
+
+            RemoteFileManifest manifest;
+            for (int i = 0; i < 6; i++) {
+                manifest.AddFile({ "test" + std::to_string(i) + ".json", "test" + std::to_string(i), testDataHash });
+            }
+
+            size_t readyFiles = 0;
+            LocalFileUpdater limitedUpdater(this->mockWinApi, this->mockWebApi, 2);
+            limitedUpdater.UpdateLocalFilesFromManifest(
+                manifest,
+                [&readyFiles](const RemoteFile & file) { readyFiles++; }
+            );
+
+            EXPECT_EQ(2, mostDownloading);
+            EXPECT_EQ(6, readyFiles);
+        }
+
+        /*
+            Downloads 30 files from a server on this machine, as happens the first time the plugin is run.
+            It needs the server running, so it's disabled by default. To run it, serve a folder of files named
+            file0.json to file29.json, each containing its own name, for example with
+            "python -m http.server 8450", and serve the same folder on port 8451 from a server that waits 20ms
+            before each response to stand in for the network, then run with --gtest_also_run_disabled_tests.
+            The files are downloaded from each server once on a single thread and once with the default number
+            of threads. Only the slow server is expected to be faster with more threads, as on the local server
+            starting the threads can cost more than the downloads.
+        */
+        TEST_F(LocalFileUpdaterTest, DISABLED_UpdateLocalFilesDownloadsThirtyFilesFromALocalServerOnColdStart)
+        {
+            ON_CALL(this->mockWinApi, CreateFolder("dependencies"))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWinApi, FileExists(_))
+                .WillByDefault(Return(false));
+
+            ON_CALL(this->mockWinApi, MoveGivenFile(_, _))
+                .WillByDefault(Return(true));
+
+            CurlApi curl;
+            const auto coldStart = [this, &curl](std::string server, size_t threads) -> int {
+                RemoteFileManifest manifest;
+                for (int i = 0; i < 30; i++) {
+                    const std::string filename = "file" + std::to_string(i) + ".json";
+                    Md5Hash hash;
+                    hash.Update(filename.c_str(), filename.size());
+                    manifest.AddFile({ filename, server + "/" + filename, hash.Finalise() });
+                }
+
+                ApiHelper api(curl, ApiRequestBuilder(server, "key"), this->mockWinApi);
+                LocalFileUpdater updater(this->mockWinApi, api, threads);
+
+                std::atomic<size_t> readyFiles = 0;
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                updater.UpdateLocalFilesFromManifest(
+                    manifest,
+                    [&readyFiles](const RemoteFile & file) { readyFiles++; }
+                );
+                std::chrono::steady_clock::duration taken = std::chrono::steady_clock::now() - start;
+
+                EXPECT_EQ(30, readyFiles);
+                EXPECT_LT(taken, std::chrono::seconds(10));
+                return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(taken).count());
+            };
+
+            const size_t defaultThreads = LocalFileUpdater::defaultMaxConcurrentDownloads;
+            const int serial = coldStart("http://127.0.0.1:8450", 1);
+            const int parallel = coldStart("http://127.0.0.1:8450", defaultThreads);
+            const int slowSerial = coldStart("http://127.0.0.1:8451", 1);
+            const int slowParallel = coldStart("http://127.0.0.1:8451", defaultThreads);
+
+            RecordProperty("SerialMicroseconds", serial);
+            RecordProperty("ColdStartMicroseconds", parallel);
+            RecordProperty("SerialToColdStartPercent", serial * 100 / (std::max)(parallel, 1));
+            RecordProperty("SlowServerSerialMicroseconds", slowSerial);
+            RecordProperty("SlowServerColdStartMicroseconds", slowParallel);
+            RecordProperty("SlowServerSerialToColdStartPercent", slowSerial * 100 / (std::max)(slowParallel, 1));
+            EXPECT_LE(slowParallel, slowSerial);
+        }
     }  // namespace Dependency
 }  // namespace UKControllerPluginTest
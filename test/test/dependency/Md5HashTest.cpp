@@ -0,0 +1,56 @@
+#include "pch/pch.h"
+#include "dependency/Md5Hash.h"
+
+using UKControllerPlugin::Dependency::Md5Hash;
+
+namespace UKControllerPluginTest {
+    namespace Dependency {
+
+        TEST(Md5HashTest, HashesEmptyData)
+        {
+            Md5Hash hash;
+            EXPECT_EQ("d41d8cd98f00b204e9800998ecf8427e", hash.Finalise());
+        }
+
+        TEST(Md5HashTest, HashesData)
+        {
+            Md5Hash hash;
+            std::string data = "The quick brown fox jumps over the lazy dog";
+            hash.Update(data.c_str(), data.size());
+            EXPECT_EQ("9e107d9d372bb6826bd81d3542a419d6", hash.Finalise());
+        }
+
+        TEST(Md5HashTest, HashesDataLongerThanABlock)
+        {
+            Md5Hash hash;
+            std::string data = "12345678901234567890123456789012345678901234567890123456789012345678901234567890";
+            hash.Update(data.c_str(), data.size());
+            EXPECT_EQ("57edf4a22be3c955ac49da2e2107b67a", hash.Finalise());
+        }
+
+        TEST(Md5HashTest, HashesDataInPieces)
+        {
+            Md5Hash hash;
+            std::string data = "12345678901234567890123456789012345678901234567890123456789012345678901234567890";
+            for (size_t i = 0; i < data.size(); i += 7) {
+                hash.Update(data.c_str() + i, std::min<size_t>(7, data.size() - i));
+            }
+            EXPECT_EQ("57edf4a22be3c955ac49da2e2107b67a", hash.Finalise());
+        }
+
+        TEST(Md5HashTest, MatchesIgnoresCase)
+        {
+            EXPECT_TRUE(Md5Hash::Matches("9e107d9d372bb6826bd81d3542a419d6", "9E107D9D372BB6826BD81D3542A419D6"));
+        }
+
+        TEST(Md5HashTest, MatchesReturnsFalseIfDifferent)
+        {
+            EXPECT_FALSE(Md5Hash::Matches("9e107d9d372bb6826bd81d3542a419d6", "9e107d9d372bb6826bd81d3542a419d7"));
+        }
+
+        TEST(Md5HashTest, MatchesReturnsFalseIfDifferentLength)
+        {
+            EXPECT_FALSE(Md5Hash::Matches("9e107d9d372bb6826bd81d3542a419d6", "9e107d9d"));
+        }
+    }  // namespace Dependency
+}  // namespace UKControllerPluginTest
@@ -3,41 +3,64 @@
 #include "bootstrap/PersistenceContainer.h"
 #include "timedevent/TimedEventCollection.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "flightplan/StoredFlightplanJournal.h"
+#include "mock/MockWinApi.h"
 
 using UKControllerPlugin::Flightplan::FlightplanStorageBootstrap;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplanJournal;
 using UKControllerPlugin::TimedEvent::TimedEventCollection;
+using UKControllerPluginTest::Windows::MockWinApi;
+using ::testing::NiceMock;
+using ::testing::Test;
 
 namespace UKControllerPlugin {
     namespace Flightplan {
 
-        TEST(FlightplanStorageBootstrap, BootstrapPluginAddsHandlerToTimedEvents)
+        class FlightplanStorageBootstrapTest : public Test
         {
-            PersistenceContainer container;
-            container.timedHandler = std::make_unique<TimedEventCollection>();
-            container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            public:
+                void SetUp(void)
+                {
+                    container.timedHandler = std::make_unique<TimedEventCollection>();
+                    container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+                    container.flightplans = std::make_unique<StoredFlightplanCollection>();
+                    container.windows.reset(new NiceMock<MockWinApi>);
+                }
 
+                PersistenceContainer container;
+        };
+
+        TEST_F(FlightplanStorageBootstrapTest, BootstrapPluginAddsHandlerToTimedEvents)
+        {
             FlightplanStorageBootstrap::BootstrapPlugin(container);
-            EXPECT_EQ(1, container.timedHandler->CountHandlers());
+            EXPECT_EQ(2, container.timedHandler->CountHandlers());
             EXPECT_EQ(
                 1,
                 container.timedHandler->CountHandlersForFrequency(FlightplanStorageBootstrap::timedEventFrequency)
             );
         }
 
-        TEST(FlightplanStorageBootstrap, BootstrapPluginAddsHandlerToFlightplanEvents)
+        TEST_F(FlightplanStorageBootstrapTest, BootstrapPluginAddsHandlerToFlightplanEvents)
         {
-            PersistenceContainer container;
-            container.timedHandler = std::make_unique<TimedEventCollection>();
-            container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
-
             FlightplanStorageBootstrap::BootstrapPlugin(container);
-            EXPECT_EQ(1, container.flightplanHandler->CountHandlers());
+            EXPECT_EQ(2, container.flightplanHandler->CountHandlers());
             EXPECT_EQ(
                 1,
                 container.timedHandler->CountHandlersForFrequency(FlightplanStorageBootstrap::timedEventFrequency)
             );
         }
+
+        TEST_F(FlightplanStorageBootstrapTest, BootstrapPluginAddsJournalToTimedEvents)
+        {
+            FlightplanStorageBootstrap::BootstrapPlugin(container);
+            EXPECT_EQ(
+                1,
+                container.timedHandler->CountHandlersForFrequency(StoredFlightplanJournal::timedEventFrequency)
+            );
+        }
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
@@ -1,9 +1,13 @@
 #include "pch/pch.h"
 #include "flightplan/StoredFlightplanCollection.h"
 #include "flightplan/StoredFlightplan.h"
+#include "mock/MockEuroScopeCFlightplanInterface.h"
 
 using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using ::testing::NiceMock;
+using ::testing::Return;
 
 namespace UKControllerPluginTest {
     namespace Flightplan {
@@ -64,5 +68,234 @@ namespace UKControllerPluginTest {
             EXPECT_FALSE(collection.HasFlightplanForCallsign("BAW456"));
         }
 
+        TEST(StoredFlightplanCollection, SetPlanTimeoutSetsTheTimeout)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.SetPlanTimeout("BAW123", 100);
+
+            EXPECT_LT(time(0) + 100 - collection.GetFlightplanForCallsign("BAW123").GetTimeout(), 3);
+        }
+
+        TEST(StoredFlightplanCollection, SetPlanTimeoutHandlesUnknownPlans)
+        {
+            StoredFlightplanCollection collection;
+            EXPECT_NO_THROW(collection.SetPlanTimeout("BAW123", 100));
+        }
+
+        TEST(StoredFlightplanCollection, RemoveTimedOutPlansRemovesPlansWithExpiredTimeouts)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGLL"));
+            collection.UpdatePlan(StoredFlightplan("BAW789", "EGKK", "EGLL"));
+            collection.SetPlanTimeout("BAW123", -50);
+            collection.SetPlanTimeout("BAW456", 100);
+
+            collection.RemoveTimedOutPlans();
+
+            EXPECT_FALSE(collection.HasFlightplanForCallsign("BAW123"));
+            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW456"));
+            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW789"));
+        }
+
+        TEST(StoredFlightplanCollection, RemoveTimedOutPlansIgnoresTimeoutsThatHaveBeenReset)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.SetPlanTimeout("BAW123", -50);
+            collection.GetFlightplanForCallsign("BAW123").ResetTimeout();
+
+            collection.RemoveTimedOutPlans();
+
+            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW123"));
+        }
+
+        TEST(StoredFlightplanCollection, RemoveTimedOutPlansIgnoresTimeoutsThatHaveBeenExtended)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.SetPlanTimeout("BAW123", -50);
+            collection.SetPlanTimeout("BAW123", 100);
+
+            collection.RemoveTimedOutPlans();
+
+            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW123"));
+        }
+
+        TEST(StoredFlightplanCollection, RemoveTimedOutPlansIgnoresTimeoutsForRemovedPlans)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.SetPlanTimeout("BAW123", -50);
+            collection.RemovePlanByCallsign("BAW123");
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGLL"));
+
+            collection.RemoveTimedOutPlans();
+
+            EXPECT_TRUE(collection.HasFlightplanForCallsign("BAW456"));
+        }
+
+        TEST(StoredFlightplanCollection, ItCountsPlans)
+        {
+            StoredFlightplanCollection collection;
+            EXPECT_EQ(0, collection.CountPlans());
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGLL"));
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGCC"));
+            EXPECT_EQ(2, collection.CountPlans());
+        }
+
+        TEST(StoredFlightplanCollection, ItIteratesPlansInCallsignOrder)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGLL"));
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+
+            std::vector<std::string> callsigns;
+            for (auto it = collection.cbegin(); it != collection.cend(); ++it) {
+                callsigns.push_back(it->second->GetCallsign());
+            }
+
+            EXPECT_EQ(std::vector<std::string>({ "BAW123", "BAW456" }), callsigns);
+        }
+
+        TEST(StoredFlightplanCollection, GetCallsignIdReturnsNoIdIfNotFound)
+        {
+            StoredFlightplanCollection collection;
+            EXPECT_EQ(StoredFlightplanCollection::noCallsignId, collection.GetCallsignId("BAW123"));
+        }
+
+        TEST(StoredFlightplanCollection, GetFlightplanByIdReturnsThePlan)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGCC"));
+
+            int callsignId = collection.GetCallsignId("BAW456");
+            EXPECT_NE(StoredFlightplanCollection::noCallsignId, callsignId);
+            EXPECT_EQ(&collection.GetFlightplanForCallsign("BAW456"), &collection.GetFlightplanById(callsignId));
+        }
+
+        TEST(StoredFlightplanCollection, GetFlightplanByIdThrowsExceptionIfNotFound)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            int callsignId = collection.GetCallsignId("BAW123");
+            collection.RemovePlanByCallsign("BAW123");
+
+            EXPECT_THROW(collection.GetFlightplanById(callsignId), std::out_of_range);
+            EXPECT_THROW(collection.GetFlightplanById(-1), std::out_of_range);
+            EXPECT_THROW(collection.GetFlightplanById(5000), std::out_of_range);
+        }
+
+        TEST(StoredFlightplanCollection, ItReusesCallsignIdsOfRemovedPlans)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            int callsignId = collection.GetCallsignId("BAW123");
+            collection.RemovePlanByCallsign("BAW123");
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGLL"));
+
+            EXPECT_EQ(callsignId, collection.GetCallsignId("BAW456"));
+            EXPECT_TRUE(collection.GetFlightplanById(callsignId).GetCallsign() == "BAW456");
+        }
+
+        TEST(StoredFlightplanCollection, PlansDontMoveWhenMoreAreAdded)
+        {
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW0", "EGKK", "EGLL"));
+            const StoredFlightplan * first = &collection.GetFlightplanForCallsign("BAW0");
+
+            for (size_t i = 1; i < StoredFlightplanCollection::slabSize * 3; i++) {
+                collection.UpdatePlan(StoredFlightplan("BAW" + std::to_string(i), "EGKK", "EGLL"));
+            }
+
+            EXPECT_EQ(StoredFlightplanCollection::slabSize * 3, collection.CountPlans());
+            EXPECT_EQ(first, &collection.GetFlightplanForCallsign("BAW0"));
+            EXPECT_TRUE(collection.GetFlightplanById(collection.GetCallsignId("BAW300")).GetCallsign() == "BAW300");
+        }
+
+        TEST(StoredFlightplanCollection, UpdatePlanFromEuroscopeAddsPlan)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            StoredFlightplanCollection collection;
+            StoredFlightplan & plan = collection.UpdatePlan(mockEuroscope);
+
+            EXPECT_EQ(&plan, &collection.GetFlightplanForCallsign("BAW123"));
+            EXPECT_TRUE(plan.GetOrigin() == "EGKK");
+            EXPECT_TRUE(plan.HasChanged(StoredFlightplan::callsignField | StoredFlightplan::originField));
+        }
+
+        TEST(StoredFlightplanCollection, UpdatePlanFromEuroscopeUpdatesInPlace)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            ON_CALL(mockEuroscope, GetDestination())
+                .WillByDefault(Return("EGLL"));
+
+            StoredFlightplanCollection collection;
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGCC"));
+            StoredFlightplan & original = collection.GetFlightplanForCallsign("BAW123");
+            original.SetEstimatedDepartureTime(std::chrono::system_clock::now());
+
+            StoredFlightplan & updated = collection.UpdatePlan(mockEuroscope);
+            EXPECT_EQ(&original, &updated);
+            EXPECT_TRUE(updated.GetDestination() == "EGLL");
+            EXPECT_EQ(StoredFlightplan::destinationField, updated.GetChangedFields());
+            EXPECT_EQ(1, collection.CountPlans());
+        }
+
+        /*
+            Times removing timed out plans from 10,000 stored plans, half of which have timeouts pending,
+            comparing the timeout heap with a scan of every plan as RemoveTimedOutPlans used to do.
+            Disabled by default as it only reports timings, to run it use --gtest_also_run_disabled_tests.
+        */
+        TEST(StoredFlightplanCollection, DISABLED_RemoveTimedOutPlansIsFasterThanAFullScan)
+        {
+            StoredFlightplanCollection collection;
+            for (int i = 0; i < 10000; i++) {
+                const std::string callsign = "BAW" + std::to_string(i);
+                collection.UpdatePlan(StoredFlightplan(callsign, "EGKK", "EGLL"));
+                if (i % 2 == 0) {
+                    collection.SetPlanTimeout(callsign, 10000);
+                }
+            }
+
+            const int iterations = 1000;
+            size_t scanTimedOut = 0;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                for (auto it = collection.begin(); it != collection.end(); ++it) {
+                    if (it->second->HasTimedOut()) {
+                        scanTimedOut++;
+                    }
+                }
+            }
+            std::chrono::nanoseconds scanTime = std::chrono::steady_clock::now() - start;
+
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                collection.RemoveTimedOutPlans();
+            }
+            std::chrono::nanoseconds heapTime = std::chrono::steady_clock::now() - start;
+
+            RecordProperty("ScanNanosecondsPerCall", static_cast<int>(scanTime.count() / iterations));
+            RecordProperty("HeapNanosecondsPerCall", static_cast<int>(heapTime.count() / iterations));
+            EXPECT_EQ(0, scanTimedOut);
+            EXPECT_EQ(10000, collection.CountPlans());
+            EXPECT_LT(heapTime, scanTime);
+        }
     }  // namespace Flightplan
 }  // namespace UKControllerPluginTest
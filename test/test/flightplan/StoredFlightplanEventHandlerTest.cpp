@@ -160,6 +160,33 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE(plan.GetTimeout() == plan.defaultTime);
         }
 
+        TEST_F(StoredFlightplanEventHandlerTest, FlightPlanEventFlagsChangedFields)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplanMock;
+
+            ON_CALL(flightplanMock, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(flightplanMock, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            NiceMock<MockEuroScopeCRadarTargetInterface> radarTargetMock;
+
+            StoredFlightplanEventHandler handler(collection);
+            handler.FlightPlanEvent(flightplanMock, radarTargetMock);
+            handler.FlightPlanEvent(flightplanMock, radarTargetMock);
+            EXPECT_EQ(0, collection.GetFlightplanForCallsign("BAW123").GetChangedFields());
+
+            ON_CALL(flightplanMock, GetDestination())
+                .WillByDefault(Return("EGLL"));
+
+            handler.FlightPlanEvent(flightplanMock, radarTargetMock);
+            EXPECT_EQ(
+                StoredFlightplan::destinationField,
+                collection.GetFlightplanForCallsign("BAW123").GetChangedFields()
+            );
+        }
+
         TEST_F(StoredFlightplanEventHandlerTest, TimedEventTriggerRemovesTimedOutFlightplans)
         {
             StoredFlightplanEventHandler handler(collection);
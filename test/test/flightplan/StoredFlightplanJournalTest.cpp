@@ -0,0 +1,329 @@
+#include "pch/pch.h"
+#include "flightplan/StoredFlightplanJournal.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "flightplan/StoredFlightplan.h"
+#include "mock/MockEuroScopeCFlightplanInterface.h"
+#include "mock/MockEuroScopeCRadarTargetInterface.h"
+#include "mock/MockWinApi.h"
+
+using UKControllerPlugin::Flightplan::StoredFlightplanJournal;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
+using UKControllerPluginTest::Windows::MockWinApi;
+using ::testing::Test;
+using ::testing::NiceMock;
+using ::testing::DoDefault;
+using ::testing::Return;
+using ::testing::_;
+
+namespace UKControllerPluginTest {
+    namespace Flightplan {
+
+        class StoredFlightplanJournalTest : public Test
+        {
+            public:
+                StoredFlightplanJournalTest()
+                    : journal(winApi, collection), restoredJournal(winApi, restored)
+                {
+                    ON_CALL(winApi, WriteToBinaryFile(_, _, _))
+                        .WillByDefault([this](std::string filename, std::string data, bool truncate) {
+                            if (truncate) {
+                                this->files[filename] = data;
+                            } else {
+                                this->files[filename] += data;
+                            }
+                        });
+
+                    ON_CALL(winApi, ReadFromBinaryFile(_))
+                        .WillByDefault([this](std::string filename) {
+                            return this->files[filename];
+                        });
+
+                    ON_CALL(winApi, MoveGivenFile(_, _))
+                        .WillByDefault([this](std::string from, std::string to) {
+                            if (this->files.count(from) == 0) {
+                                return false;
+                            }
+
+                            this->files[to] = this->files[from];
+                            this->files.erase(from);
+                            return true;
+                        });
+
+                    ON_CALL(flightplan, GetCallsign())
+                        .WillByDefault(Return("BAW123"));
+                }
+
+                void Journal(std::string callsign)
+                {
+                    NiceMock<MockEuroScopeCFlightPlanInterface> plan;
+                    ON_CALL(plan, GetCallsign())
+                        .WillByDefault(Return(callsign));
+                    journal.FlightPlanEvent(plan, radarTarget);
+                }
+
+                std::map<std::string, std::string> files;
+                NiceMock<MockWinApi> winApi;
+                NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+                NiceMock<MockEuroScopeCRadarTargetInterface> radarTarget;
+                StoredFlightplanCollection collection;
+                StoredFlightplanCollection restored;
+                StoredFlightplanJournal journal;
+                StoredFlightplanJournal restoredJournal;
+        };
+
+        TEST_F(StoredFlightplanJournalTest, LoadRestoresNothingIfThereAreNoFiles)
+        {
+            EXPECT_EQ(0, journal.Load());
+            EXPECT_EQ(0, collection.CountPlans());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, LoadStartsANewSnapshotAndJournal)
+        {
+            journal.Load();
+            EXPECT_EQ(1, files.count(StoredFlightplanJournal::snapshotFiles[1]));
+            EXPECT_EQ(1, files.count(StoredFlightplanJournal::journalFile));
+            EXPECT_EQ(0, journal.GetJournalRecordCount());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItWritesTheSnapshotAndJournalThroughTemporaryFiles)
+        {
+            EXPECT_CALL(
+                winApi,
+                WriteToBinaryFile(StoredFlightplanJournal::snapshotFiles[1] + ".tmp", _, true)
+            )
+                .Times(1);
+
+            EXPECT_CALL(winApi, MoveGivenFile(
+                StoredFlightplanJournal::snapshotFiles[1] + ".tmp",
+                StoredFlightplanJournal::snapshotFiles[1]
+            ))
+                .Times(1);
+
+            EXPECT_CALL(winApi, WriteToBinaryFile(StoredFlightplanJournal::journalFile + ".tmp", _, true))
+                .Times(1);
+
+            EXPECT_CALL(winApi, MoveGivenFile(
+                StoredFlightplanJournal::journalFile + ".tmp",
+                StoredFlightplanJournal::journalFile
+            ))
+                .Times(1);
+
+            EXPECT_CALL(winApi, WriteToBinaryFile(StoredFlightplanJournal::snapshotFiles[1], _, _))
+                .Times(0);
+
+            journal.Load();
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItKeepsTheJournalIfTheSnapshotCantBeMovedIntoPlace)
+        {
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            journal.Load();
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGLL"));
+            Journal("BAW456");
+            journal.TimedEventTrigger();
+
+            EXPECT_CALL(winApi, MoveGivenFile(_, _))
+                .WillOnce(Return(false))
+                .WillRepeatedly(DoDefault());
+
+            journal.Compact();
+            EXPECT_EQ(1, journal.GetJournalRecordCount());
+            EXPECT_EQ(2, restoredJournal.Load());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItRestoresPlansFromTheSnapshot)
+        {
+            std::chrono::system_clock::time_point departure = std::chrono::system_clock::now();
+            StoredFlightplan plan("BAW123", "EGKK", "EGLL");
+            plan.SetPreviouslyAssignedSquawk("1234");
+            plan.SetEstimatedDepartureTime(departure);
+            collection.UpdatePlan(plan);
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGLL", "EGCC"));
+            journal.Compact();
+
+            EXPECT_EQ(2, restoredJournal.Load());
+            StoredFlightplan & restoredPlan = restored.GetFlightplanForCallsign("BAW123");
+            EXPECT_EQ("EGKK", restoredPlan.GetOrigin());
+            EXPECT_EQ("EGLL", restoredPlan.GetDestination());
+            EXPECT_EQ("1234", restoredPlan.GetPreviouslyAssignedSquawk());
+            EXPECT_EQ(departure, restoredPlan.GetEstimatedDepartureTime());
+            EXPECT_EQ(
+                (std::chrono::system_clock::time_point::max)(),
+                restoredPlan.GetActualOffBlockTime()
+            );
+            EXPECT_TRUE(restored.HasFlightplanForCallsign("BAW456"));
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItGivesRestoredPlansATimeout)
+        {
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            journal.Compact();
+
+            restoredJournal.Load();
+            EXPECT_LT(
+                time(0) + StoredFlightplanJournal::restoredPlanTimeout -
+                    restored.GetFlightplanForCallsign("BAW123").GetTimeout(),
+                3
+            );
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItKeepsTheTimeoutOfRestoredPlans)
+        {
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.SetPlanTimeout("BAW123", 100);
+            journal.Compact();
+
+            restoredJournal.Load();
+            EXPECT_EQ(
+                collection.GetFlightplanForCallsign("BAW123").GetTimeout(),
+                restored.GetFlightplanForCallsign("BAW123").GetTimeout()
+            );
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItDoesntRestoreTimedOutPlans)
+        {
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            collection.SetPlanTimeout("BAW123", -50);
+            journal.Compact();
+
+            EXPECT_EQ(0, restoredJournal.Load());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItJournalsChangedPlans)
+        {
+            journal.Load();
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            Journal("BAW123");
+            journal.TimedEventTrigger();
+            EXPECT_EQ(1, journal.GetJournalRecordCount());
+
+            restoredJournal.Load();
+            EXPECT_TRUE(restored.HasFlightplanForCallsign("BAW123"));
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItJournalsDisconnectedPlans)
+        {
+            journal.Load();
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            journal.FlightPlanDisconnectEvent(flightplan);
+            journal.TimedEventTrigger();
+            EXPECT_EQ(1, journal.GetJournalRecordCount());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItJournalsPlansChangedByControllers)
+        {
+            journal.Load();
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            journal.ControllerFlightPlanDataEvent(flightplan, 1);
+            journal.TimedEventTrigger();
+            EXPECT_EQ(1, journal.GetJournalRecordCount());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItDoesntJournalPlansThatHaventChanged)
+        {
+            journal.Load();
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            Journal("BAW123");
+            journal.TimedEventTrigger();
+            Journal("BAW123");
+            journal.TimedEventTrigger();
+            EXPECT_EQ(1, journal.GetJournalRecordCount());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItJournalsTheLatestStateOfAPlan)
+        {
+            journal.Load();
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            Journal("BAW123");
+            journal.TimedEventTrigger();
+            collection.GetFlightplanForCallsign("BAW123").SetPreviouslyAssignedSquawk("1234");
+            Journal("BAW123");
+            journal.TimedEventTrigger();
+            EXPECT_EQ(2, journal.GetJournalRecordCount());
+
+            restoredJournal.Load();
+            EXPECT_EQ("1234", restored.GetFlightplanForCallsign("BAW123").GetPreviouslyAssignedSquawk());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItJournalsRemovedPlans)
+        {
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            journal.Load();
+            collection.RemovePlanByCallsign("BAW123");
+            Journal("BAW123");
+            journal.TimedEventTrigger();
+            EXPECT_EQ(1, journal.GetJournalRecordCount());
+
+            EXPECT_EQ(0, restoredJournal.Load());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItDoesntJournalUnknownPlans)
+        {
+            journal.Load();
+            Journal("BAW123");
+            journal.TimedEventTrigger();
+            EXPECT_EQ(0, journal.GetJournalRecordCount());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItIgnoresAnIncompleteRecordAtTheEndOfTheJournal)
+        {
+            journal.Load();
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            Journal("BAW123");
+            journal.TimedEventTrigger();
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGLL"));
+            Journal("BAW456");
+            journal.TimedEventTrigger();
+
+            std::string & journalData = files[StoredFlightplanJournal::journalFile];
+            journalData.resize(journalData.size() - 5);
+
+            EXPECT_EQ(1, restoredJournal.Load());
+            EXPECT_TRUE(restored.HasFlightplanForCallsign("BAW123"));
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItFallsBackToThePreviousSnapshotIfTheLatestIsIncomplete)
+        {
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            journal.Compact();
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGLL"));
+            journal.Compact();
+
+            std::string & snapshot = files[StoredFlightplanJournal::snapshotFiles[0]];
+            snapshot.resize(snapshot.size() - 10);
+
+            EXPECT_EQ(1, restoredJournal.Load());
+            EXPECT_TRUE(restored.HasFlightplanForCallsign("BAW123"));
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItReplaysTheJournalOnTopOfTheSnapshot)
+        {
+            collection.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EGLL"));
+            journal.Load();
+            collection.UpdatePlan(StoredFlightplan("BAW456", "EGKK", "EGLL"));
+            Journal("BAW456");
+            journal.TimedEventTrigger();
+
+            EXPECT_EQ(2, restoredJournal.Load());
+        }
+
+        TEST_F(StoredFlightplanJournalTest, ItCompactsTheJournalOnceItGetsTooLong)
+        {
+            journal.Load();
+            for (size_t i = 0; i < StoredFlightplanJournal::compactionThreshold; i++) {
+                collection.UpdatePlan(StoredFlightplan("BAW" + std::to_string(i), "EGKK", "EGLL"));
+                Journal("BAW" + std::to_string(i));
+            }
+            journal.TimedEventTrigger();
+
+            EXPECT_EQ(0, journal.GetJournalRecordCount());
+            EXPECT_EQ(
+                StoredFlightplanJournal::compactionThreshold,
+                restoredJournal.Load()
+            );
+        }
+    }  // namespace Flightplan
+}  // namespace UKControllerPluginTest
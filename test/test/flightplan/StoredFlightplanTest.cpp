@@ -336,6 +336,10 @@ namespace UKControllerPluginTest {
             StoredFlightplan plan2("BAW456", "EGLL", "EDDM");
             plan2.SetTimeout(0);
             plan2.SetPreviouslyAssignedSquawk("1234");
+            std::chrono::system_clock::time_point offBlock = std::chrono::system_clock::now();
+            plan2.SetExpectedOffBlockTime(offBlock);
+            plan2.SetEstimatedDepartureTime(offBlock + std::chrono::minutes(10));
+            plan2.SetActualOffBlockTime(offBlock + std::chrono::minutes(5));
 
             plan1 = plan2;
 
@@ -344,6 +348,9 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE(plan1.GetDestination() == "EDDM");
             EXPECT_LT(time(0) - plan1.GetTimeout(), 3);
             EXPECT_TRUE("1234" == plan1.GetPreviouslyAssignedSquawk());
+            EXPECT_EQ(offBlock, plan1.GetExpectedOffBlockTime());
+            EXPECT_EQ(offBlock + std::chrono::minutes(10), plan1.GetEstimatedDepartureTime());
+            EXPECT_EQ(offBlock + std::chrono::minutes(5), plan1.GetActualOffBlockTime());
         }
 
         TEST(StoredFlightplan, GetSetEstimatedDepartureTimeSetsTime)
@@ -354,5 +361,110 @@ namespace UKControllerPluginTest {
             plan.SetEstimatedDepartureTime(time);
             EXPECT_EQ(time, plan.GetEstimatedDepartureTime());
         }
+
+        TEST(StoredFlightplan, GetSetExpectedOffBlockTimeSetsTime)
+        {
+            StoredFlightplan plan("BAW123", "EGKK", "EDDF");
+            std::chrono::system_clock::time_point time = std::chrono::system_clock::now();
+
+            plan.SetExpectedOffBlockTime(time);
+            EXPECT_EQ(time, plan.GetExpectedOffBlockTime());
+        }
+
+        TEST(StoredFlightplan, SettersFlagChangedFields)
+        {
+            StoredFlightplan plan("BAW123", "EGKK", "EDDF");
+            EXPECT_EQ(0, plan.GetChangedFields());
+
+            plan.SetOrigin("EGLL");
+            plan.SetEstimatedDepartureTime(std::chrono::system_clock::now());
+            EXPECT_EQ(
+                StoredFlightplan::originField | StoredFlightplan::estimatedDepartureTimeField,
+                plan.GetChangedFields()
+            );
+            EXPECT_TRUE(plan.HasChanged(StoredFlightplan::originField));
+            EXPECT_FALSE(plan.HasChanged(StoredFlightplan::destinationField));
+        }
+
+        TEST(StoredFlightplan, SettersDontFlagUnchangedFields)
+        {
+            StoredFlightplan plan("BAW123", "EGKK", "EDDF");
+            plan.SetOrigin("EGKK");
+            plan.SetCallsign("BAW123");
+            plan.SetPreviouslyAssignedSquawk(StoredFlightplan::noSquawkAllocated);
+            EXPECT_EQ(0, plan.GetChangedFields());
+        }
+
+        TEST(StoredFlightplan, ClearChangedFieldsClearsFlags)
+        {
+            StoredFlightplan plan("BAW123", "EGKK", "EDDF");
+            plan.SetDestination("EGLL");
+            plan.ClearChangedFields();
+            EXPECT_EQ(0, plan.GetChangedFields());
+        }
+
+        TEST(StoredFlightplan, UpdateOnlyChangesDifferentFields)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            ON_CALL(mockEuroscope, GetDestination())
+                .WillByDefault(Return("EGLL"));
+
+            ON_CALL(mockEuroscope, HasAssignedSquawk())
+                .WillByDefault(Return(true));
+
+            ON_CALL(mockEuroscope, GetAssignedSquawk())
+                .WillByDefault(Return("2415"));
+
+            ON_CALL(mockEuroscope, GetExpectedDepartureTime())
+                .WillByDefault(Return("2301"));
+
+            StoredFlightplan plan("BAW123", "EGKK", "EDDF");
+            plan.SetOrigin("EGCC");
+            plan.ClearChangedFields();
+
+            unsigned int changed = plan.Update(mockEuroscope);
+            unsigned int expected = StoredFlightplan::originField |
+                StoredFlightplan::destinationField |
+                StoredFlightplan::squawkField |
+                StoredFlightplan::expectedOffBlockTimeField;
+
+            EXPECT_EQ(expected, changed);
+            EXPECT_EQ(expected, plan.GetChangedFields());
+            EXPECT_TRUE(plan.GetOrigin() == "EGKK");
+            EXPECT_TRUE(plan.GetDestination() == "EGLL");
+            EXPECT_TRUE(plan.GetPreviouslyAssignedSquawk() == "2415");
+            EXPECT_EQ(
+                HelperFunctions::GetTimeFromNumberString("2301") - std::chrono::minutes(15),
+                plan.GetExpectedOffBlockTime()
+            );
+            EXPECT_EQ(0, plan.Update(mockEuroscope));
+        }
+
+        TEST(StoredFlightplan, UpdateKeepsEarlierChangedFields)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            ON_CALL(mockEuroscope, GetDestination())
+                .WillByDefault(Return("EDDF"));
+
+            StoredFlightplan plan("BAW123", "EGKK", "EDDF");
+            plan.SetEstimatedDepartureTime(std::chrono::system_clock::now());
+
+            EXPECT_EQ(0, plan.Update(mockEuroscope));
+            EXPECT_EQ(StoredFlightplan::estimatedDepartureTimeField, plan.GetChangedFields());
+        }
     }  // namespace Flightplan
 }  // namespace UKControllerPluginTest
@@ -112,5 +112,20 @@ namespace UKControllerPluginTest {
                 this->handler.noHold == this->handler.GetTagItemData(*this->mockFlightplan, *this->mockRadarTarget)
             );
         }
+
+        TEST_F(HoldEventHandlerTest, ItWritesTheSelectedHoldForAnAircraft)
+        {
+            char itemData[16];
+            EXPECT_TRUE(this->handler.WriteTagItemData(*this->mockFlightplan, *this->mockRadarTarget, itemData));
+            EXPECT_EQ(0, strcmp("HTIMBA", itemData));
+        }
+
+        TEST_F(HoldEventHandlerTest, ItWritesNoHoldIfAircraftNotInHold)
+        {
+            char itemData[16];
+            this->manager.RemoveAircraftFromAnyHold("BAW123");
+            EXPECT_TRUE(this->handler.WriteTagItemData(*this->mockFlightplan, *this->mockRadarTarget, itemData));
+            EXPECT_EQ(this->handler.noHold, itemData);
+        }
     }  // namespace Hold
 }  // namespace UKControllerPluginTest
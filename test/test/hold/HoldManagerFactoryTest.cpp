@@ -4,12 +4,14 @@
 #include "hold/HoldingData.h"
 #include "hold/ManagedHold.h"
 #include "bootstrap/PersistenceContainer.h"
+#include "tag/TagItemCollection.h"
 
 using testing::Test;
 using UKControllerPlugin::Hold::CreateHoldManager;
 using UKControllerPlugin::Hold::HoldingData;
 using UKControllerPlugin::Hold::ManagedHold;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
+using UKControllerPlugin::Tag::TagItemCollection;
 
 namespace UKControllerPluginTest {
     namespace Hold {
@@ -17,6 +19,11 @@ namespace UKControllerPluginTest {
         class HoldManagerFactoryTest : public Test
         {
             public:
+                HoldManagerFactoryTest(void)
+                {
+                    container.tagHandler.reset(new TagItemCollection);
+                }
+
                 PersistenceContainer container;
         };
 
@@ -6,6 +6,7 @@
 #include "hold/ManagedHold.h"
 #include "hold/HoldingData.h"
 #include "hold/HoldingAircraft.h"
+#include "tag/TagItemCache.h"
 
 using UKControllerPlugin::Hold::HoldManager;
 using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
@@ -14,6 +15,7 @@ using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
 using UKControllerPlugin::Hold::ManagedHold;
 using UKControllerPlugin::Hold::HoldingData;
 using UKControllerPlugin::Hold::HoldingAircraft;
+using UKControllerPlugin::Tag::TagItemCache;
 using ::testing::Return;
 using ::testing::NiceMock;
 using ::testing::Test;
@@ -174,5 +176,34 @@ namespace UKControllerPluginTest {
         {
             EXPECT_EQ(NULL, this->manager.GetAircraftHold("BAW123"));
         }
+
+        TEST_F(HoldManagerTest, AddingAircraftToHoldInvalidatesCachedTagItems)
+        {
+            char itemData[16];
+            TagItemCache cache;
+            cache.AddItem(106);
+            cache.SetValue(106, "BAW123", "");
+            HoldManager cachingManager(cache);
+            HoldingData hold = { 1, "WILLO", "WILLO", 8000, 15000, 209, "left", {} };
+            cachingManager.AddHold(ManagedHold(std::move(hold)));
+
+            cachingManager.AddAircraftToHold(mockFlightplan, mockRadarTarget, 1);
+            EXPECT_FALSE(cache.GetValue(106, "BAW123", itemData));
+        }
+
+        TEST_F(HoldManagerTest, RemovingAircraftFromHoldInvalidatesCachedTagItems)
+        {
+            char itemData[16];
+            TagItemCache cache;
+            cache.AddItem(106);
+            HoldManager cachingManager(cache);
+            HoldingData hold = { 1, "WILLO", "WILLO", 8000, 15000, 209, "left", {} };
+            cachingManager.AddHold(ManagedHold(std::move(hold)));
+            cachingManager.AddAircraftToHold(mockFlightplan, mockRadarTarget, 1);
+            cache.SetValue(106, "BAW123", "HWILLO");
+
+            cachingManager.RemoveAircraftFromAnyHold("BAW123");
+            EXPECT_FALSE(cache.GetValue(106, "BAW123", itemData));
+        }
     }  // namespace Hold
 }  // namespace UKControllerPluginTest
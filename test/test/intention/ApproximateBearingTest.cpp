@@ -0,0 +1,116 @@
+#include "pch/pch.h"
+#include "intention/ApproximateBearing.h"
+
+using UKControllerPlugin::IntentionCode::ApproximateBearing;
+using EuroScopePlugIn::CPosition;
+
+namespace UKControllerPluginTest {
+    namespace IntentionCode {
+
+        /*
+            The full great-circle initial bearing, to check the approximation against.
+        */
+        double GreatCircleBearing(const CPosition & from, const CPosition & to)
+        {
+            const double degreesToRadians = 0.017453292519943295;
+            double fromLatitude = from.m_Latitude * degreesToRadians;
+            double toLatitude = to.m_Latitude * degreesToRadians;
+            double longitudeDifference = (to.m_Longitude - from.m_Longitude) * degreesToRadians;
+
+            double bearing = std::atan2(
+                std::sin(longitudeDifference) * std::cos(toLatitude),
+                std::cos(fromLatitude) * std::sin(toLatitude) -
+                    std::sin(fromLatitude) * std::cos(toLatitude) * std::cos(longitudeDifference)
+            ) / degreesToRadians;
+
+            return bearing < 0.0 ? bearing + 360.0 : bearing;
+        }
+
+        CPosition MakePosition(double latitude, double longitude)
+        {
+            CPosition position;
+            position.m_Latitude = latitude;
+            position.m_Longitude = longitude;
+            return position;
+        }
+
+        double BearingDifference(double first, double second)
+        {
+            double difference = std::fabs(first - second);
+            return difference > 180.0 ? 360.0 - difference : difference;
+        }
+
+        TEST(ApproximateBearing, ReturnsNorth)
+        {
+            EXPECT_NEAR(0.0, ApproximateBearing(MakePosition(51.0, -1.0), MakePosition(52.0, -1.0)), 0.001);
+        }
+
+        TEST(ApproximateBearing, ReturnsSouth)
+        {
+            EXPECT_NEAR(180.0, ApproximateBearing(MakePosition(51.0, -1.0), MakePosition(50.0, -1.0)), 0.001);
+        }
+
+        TEST(ApproximateBearing, ReturnsEast)
+        {
+            EXPECT_NEAR(
+                GreatCircleBearing(MakePosition(51.0, -1.0), MakePosition(51.0, 1.0)),
+                ApproximateBearing(MakePosition(51.0, -1.0), MakePosition(51.0, 1.0)),
+                0.01
+            );
+        }
+
+        TEST(ApproximateBearing, ReturnsWest)
+        {
+            EXPECT_NEAR(
+                GreatCircleBearing(MakePosition(53.68, -5.5), MakePosition(55.0, -15.0)),
+                ApproximateBearing(MakePosition(53.68, -5.5), MakePosition(55.0, -15.0)),
+                0.5
+            );
+        }
+
+        TEST(ApproximateBearing, NeverReturnsNegativeBearings)
+        {
+            double bearing = ApproximateBearing(MakePosition(51.0, -1.0), MakePosition(52.0, -1.1));
+            EXPECT_GE(bearing, 0.0);
+            EXPECT_LT(bearing, 360.0);
+        }
+
+        TEST(ApproximateBearing, TakesShortestRouteAcrossAntimeridian)
+        {
+            EXPECT_NEAR(
+                GreatCircleBearing(MakePosition(60.0, 179.0), MakePosition(60.0, 181.0)),
+                ApproximateBearing(MakePosition(60.0, 179.0), MakePosition(60.0, -179.0)),
+                0.01
+            );
+        }
+
+        TEST(ApproximateBearing, IsWithinHalfADegreeForRouteLegsUpTo500Miles)
+        {
+            const double degreesToRadians = 0.017453292519943295;
+            double worstError = 0.0;
+
+            // Legs in every direction, of up to 500nm, from points across the UK and its neighbours.
+            for (double latitude = 40.0; latitude <= 65.0; latitude += 2.5) {
+                for (double longitude = -30.0; longitude <= 20.0; longitude += 5.0) {
+                    for (double course = 0.0; course < 360.0; course += 7.5) {
+                        for (double distance = 10.0; distance <= 500.0; distance += 70.0) {
+                            CPosition from = MakePosition(latitude, longitude);
+                            CPosition to = MakePosition(
+                                latitude + (distance / 60.0) * std::cos(course * degreesToRadians),
+                                longitude + (distance / 60.0) * std::sin(course * degreesToRadians) /
+                                    std::cos(latitude * degreesToRadians)
+                            );
+
+                            worstError = std::max(
+                                worstError,
+                                BearingDifference(GreatCircleBearing(from, to), ApproximateBearing(from, to))
+                            );
+                        }
+                    }
+                }
+            }
+
+            EXPECT_LT(worstError, 0.5);
+        }
+    }  // namespace IntentionCode
+}  // namespace UKControllerPluginTest
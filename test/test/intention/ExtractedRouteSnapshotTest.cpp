@@ -0,0 +1,158 @@
+#include "pch/pch.h"
+#include "intention/ExtractedRouteSnapshot.h"
+#include "mock/MockEuroscopeExtractedRouteInterface.h"
+
+using UKControllerPlugin::IntentionCode::ExtractedRouteSnapshot;
+using UKControllerPluginTest::Euroscope::MockEuroscopeExtractedRouteInterface;
+using ::testing::StrictMock;
+using ::testing::Return;
+using ::testing::Test;
+using EuroScopePlugIn::CPosition;
+
+namespace UKControllerPluginTest {
+    namespace IntentionCode {
+
+        class ExtractedRouteSnapshotTest : public Test
+        {
+            public:
+                void SetUp(void)
+                {
+                    positionOne.m_Latitude = 51.0;
+                    positionOne.m_Longitude = -1.0;
+                    positionTwo.m_Latitude = 52.0;
+                    positionTwo.m_Longitude = 2.0;
+
+                    EXPECT_CALL(route, GetPointsNumber())
+                        .Times(1)
+                        .WillOnce(Return(2));
+
+                    EXPECT_CALL(route, GetPointsAssignedIndex())
+                        .Times(1)
+                        .WillOnce(Return(1));
+
+                    EXPECT_CALL(route, GetPointsCalculatedIndex())
+                        .Times(1)
+                        .WillOnce(Return(0));
+
+                    EXPECT_CALL(route, GetPointName(0))
+                        .Times(1)
+                        .WillOnce(Return("KOK"));
+
+                    EXPECT_CALL(route, GetPointName(1))
+                        .Times(1)
+                        .WillOnce(Return("REDFA"));
+
+                    EXPECT_CALL(route, GetPointPosition(0))
+                        .Times(1)
+                        .WillOnce(Return(positionOne));
+
+                    EXPECT_CALL(route, GetPointPosition(1))
+                        .Times(1)
+                        .WillOnce(Return(positionTwo));
+
+                    EXPECT_CALL(route, GetPointDistanceInMinutes(0))
+                        .Times(1)
+                        .WillOnce(Return(-1));
+
+                    EXPECT_CALL(route, GetPointDistanceInMinutes(1))
+                        .Times(1)
+                        .WillOnce(Return(12));
+                }
+
+                CPosition positionOne;
+                CPosition positionTwo;
+                StrictMock<MockEuroscopeExtractedRouteInterface> route;
+        };
+
+        TEST_F(ExtractedRouteSnapshotTest, ItCopiesTheRoute)
+        {
+            ExtractedRouteSnapshot snapshot(route);
+
+            EXPECT_EQ(2, snapshot.GetPointsNumber());
+            EXPECT_EQ(1, snapshot.GetPointsAssignedIndex());
+            EXPECT_EQ(0, snapshot.GetPointsCalculatedIndex());
+            EXPECT_STREQ("KOK", snapshot.GetPointName(0));
+            EXPECT_STREQ("REDFA", snapshot.GetPointName(1));
+            EXPECT_EQ(51.0, snapshot.GetPointPosition(0).m_Latitude);
+            EXPECT_EQ(2.0, snapshot.GetPointPosition(1).m_Longitude);
+            EXPECT_EQ(-1, snapshot.GetPointDistanceInMinutes(0));
+            EXPECT_EQ(12, snapshot.GetPointDistanceInMinutes(1));
+        }
+
+        TEST_F(ExtractedRouteSnapshotTest, ItHandlesPointsOutsideTheRoute)
+        {
+            ExtractedRouteSnapshot snapshot(route);
+
+            EXPECT_STREQ("", snapshot.GetPointName(2));
+            EXPECT_STREQ("", snapshot.GetPointName(-1));
+            EXPECT_EQ(snapshot.pointPassed, snapshot.GetPointDistanceInMinutes(2));
+        }
+
+        TEST(ExtractedRouteSnapshot, ItOnlyCopiesTheDetailOfPointsThatNeedIt)
+        {
+            CPosition exitPosition;
+            exitPosition.m_Latitude = 51.0;
+            CPosition nextPosition;
+            nextPosition.m_Latitude = 52.0;
+
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            EXPECT_CALL(route, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(3));
+
+            EXPECT_CALL(route, GetPointsAssignedIndex())
+                .Times(1)
+                .WillOnce(Return(route.noDirect));
+
+            EXPECT_CALL(route, GetPointsCalculatedIndex())
+                .Times(1)
+                .WillOnce(Return(0));
+
+            EXPECT_CALL(route, GetPointName(0))
+                .Times(1)
+                .WillOnce(Return("EGKK"));
+
+            EXPECT_CALL(route, GetPointName(1))
+                .Times(1)
+                .WillOnce(Return("KOK"));
+
+            EXPECT_CALL(route, GetPointName(2))
+                .Times(1)
+                .WillOnce(Return("REDFA"));
+
+            EXPECT_CALL(route, GetPointPosition(1))
+                .Times(1)
+                .WillOnce(Return(exitPosition));
+
+            EXPECT_CALL(route, GetPointPosition(2))
+                .Times(1)
+                .WillOnce(Return(nextPosition));
+
+            EXPECT_CALL(route, GetPointDistanceInMinutes(1))
+                .Times(1)
+                .WillOnce(Return(12));
+
+            ExtractedRouteSnapshot snapshot(
+                route,
+                [](const char * pointName) { return strcmp(pointName, "KOK") == 0; }
+            );
+
+            EXPECT_EQ(3, snapshot.GetPointsNumber());
+            EXPECT_STREQ("EGKK", snapshot.GetPointName(0));
+            EXPECT_STREQ("REDFA", snapshot.GetPointName(2));
+            EXPECT_EQ(51.0, snapshot.GetPointPosition(1).m_Latitude);
+            EXPECT_EQ(52.0, snapshot.GetPointPosition(2).m_Latitude);
+            EXPECT_EQ(12, snapshot.GetPointDistanceInMinutes(1));
+            EXPECT_EQ(0, snapshot.GetPointDistanceInMinutes(0));
+        }
+
+        TEST(ExtractedRouteSnapshot, DefaultSnapshotIsEmpty)
+        {
+            ExtractedRouteSnapshot snapshot;
+
+            EXPECT_EQ(0, snapshot.GetPointsNumber());
+            EXPECT_EQ(snapshot.noDirect, snapshot.GetPointsAssignedIndex());
+            EXPECT_STREQ("", snapshot.GetPointName(0));
+        }
+    }  // namespace IntentionCode
+}  // namespace UKControllerPluginTest
@@ -12,6 +12,9 @@ using ::testing::Return;
 namespace UKControllerPluginTest {
     namespace IntentionCode {
 
+        // The hash of the exit point that the codes in these tests were generated for
+        const size_t kokHash = std::hash<std::string>()("KOK");
+
         TEST(IntentionCodeCache, GetIntentionCodeForCallsignReturnsDefaultIfNoneFound)
         {
             IntentionCodeCache cache;
@@ -96,6 +99,14 @@ namespace UKControllerPluginTest {
         {
             IntentionCodeCache cache;
             StrictMock<MockEuroscopeExtractedRouteInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(10));
+
+            EXPECT_CALL(mockFlightplan, GetPointName(5))
+                .Times(1)
+                .WillOnce(Return("KOK"));
+
             EXPECT_CALL(mockFlightplan, GetPointsAssignedIndex())
                 .Times(1)
                 .WillOnce(Return(7));
@@ -105,7 +116,7 @@ namespace UKControllerPluginTest {
                 .WillOnce(Return(4));
 
 
-            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5));
+            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5, kokHash));
             EXPECT_TRUE(cache.IntentionCodeValid("BAW123", mockFlightplan));
         }
 
@@ -113,6 +124,14 @@ namespace UKControllerPluginTest {
         {
             IntentionCodeCache cache;
             StrictMock<MockEuroscopeExtractedRouteInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(10));
+
+            EXPECT_CALL(mockFlightplan, GetPointName(5))
+                .Times(1)
+                .WillOnce(Return("KOK"));
+
             EXPECT_CALL(mockFlightplan, GetPointsAssignedIndex())
                 .Times(1)
                 .WillOnce(Return(7));
@@ -122,7 +141,7 @@ namespace UKControllerPluginTest {
                 .WillOnce(Return(5));
 
 
-            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5));
+            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5, kokHash));
             EXPECT_TRUE(cache.IntentionCodeValid("BAW123", mockFlightplan));
         }
 
@@ -130,16 +149,28 @@ namespace UKControllerPluginTest {
         {
             IntentionCodeCache cache;
             StrictMock<MockEuroscopeExtractedRouteInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(10));
+
+            EXPECT_CALL(mockFlightplan, GetPointName(5))
+                .Times(1)
+                .WillOnce(Return("KOK"));
+
             EXPECT_CALL(mockFlightplan, GetPointsAssignedIndex())
                 .Times(1)
                 .WillOnce(Return(mockFlightplan.noDirect));
 
+            EXPECT_CALL(mockFlightplan, GetPointsCalculatedIndex())
+                .Times(1)
+                .WillOnce(Return(2));
+
             EXPECT_CALL(mockFlightplan, GetPointDistanceInMinutes(5))
                 .Times(1)
                 .WillOnce(Return(mockFlightplan.pointPassed));
 
 
-            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5));
+            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5, kokHash));
             EXPECT_FALSE(cache.IntentionCodeValid("BAW123", mockFlightplan));
         }
 
@@ -147,17 +178,164 @@ namespace UKControllerPluginTest {
         {
             IntentionCodeCache cache;
             StrictMock<MockEuroscopeExtractedRouteInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(10));
+
+            EXPECT_CALL(mockFlightplan, GetPointName(5))
+                .Times(1)
+                .WillOnce(Return("KOK"));
+
             EXPECT_CALL(mockFlightplan, GetPointsAssignedIndex())
                 .Times(1)
                 .WillOnce(Return(mockFlightplan.noDirect));
 
+            EXPECT_CALL(mockFlightplan, GetPointsCalculatedIndex())
+                .Times(1)
+                .WillOnce(Return(2));
+
+            EXPECT_CALL(mockFlightplan, GetPointDistanceInMinutes(5))
+                .Times(1)
+                .WillOnce(Return(999));
+
+
+            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5, kokHash));
+            EXPECT_TRUE(cache.IntentionCodeValid("BAW123", mockFlightplan));
+        }
+
+        TEST(IntentionCodeCache, IntentionCodeValidReturnsFalseIfExitPointNoLongerOnRoute)
+        {
+            IntentionCodeCache cache;
+            StrictMock<MockEuroscopeExtractedRouteInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(4));
+
+            EXPECT_CALL(mockFlightplan, GetPointsAssignedIndex())
+                .Times(1)
+                .WillOnce(Return(mockFlightplan.noDirect));
+
+            EXPECT_CALL(mockFlightplan, GetPointsCalculatedIndex())
+                .Times(1)
+                .WillOnce(Return(2));
+
+            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5, kokHash));
+            EXPECT_FALSE(cache.IntentionCodeValid("BAW123", mockFlightplan));
+        }
+
+        TEST(IntentionCodeCache, IntentionCodeValidUsesFingerprintIfRouteUnchanged)
+        {
+            IntentionCodeCache cache;
+            StrictMock<MockEuroscopeExtractedRouteInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetPointsNumber())
+                .Times(2)
+                .WillRepeatedly(Return(10));
+
+            EXPECT_CALL(mockFlightplan, GetPointName(5))
+                .Times(2)
+                .WillRepeatedly(Return("KOK"));
+
+            EXPECT_CALL(mockFlightplan, GetPointsAssignedIndex())
+                .Times(2)
+                .WillRepeatedly(Return(mockFlightplan.noDirect));
+
+            EXPECT_CALL(mockFlightplan, GetPointsCalculatedIndex())
+                .Times(2)
+                .WillRepeatedly(Return(2));
+
+            // Only checked the first time, the second time the fingerprint matches
             EXPECT_CALL(mockFlightplan, GetPointDistanceInMinutes(5))
                 .Times(1)
                 .WillOnce(Return(999));
 
+            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5, kokHash));
+            EXPECT_TRUE(cache.IntentionCodeValid("BAW123", mockFlightplan));
+            EXPECT_TRUE(cache.IntentionCodeValid("BAW123", mockFlightplan));
+        }
+
+        TEST(IntentionCodeCache, IntentionCodeValidRechecksRouteIfExitPointNameChanges)
+        {
+            IntentionCodeCache cache;
+            StrictMock<MockEuroscopeExtractedRouteInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetPointsNumber())
+                .Times(2)
+                .WillRepeatedly(Return(10));
+
+            EXPECT_CALL(mockFlightplan, GetPointName(5))
+                .Times(2)
+                .WillOnce(Return("KOK"))
+                .WillOnce(Return("SOMVA"));
 
-            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5));
+            EXPECT_CALL(mockFlightplan, GetPointsAssignedIndex())
+                .Times(2)
+                .WillRepeatedly(Return(mockFlightplan.noDirect));
+
+            EXPECT_CALL(mockFlightplan, GetPointsCalculatedIndex())
+                .Times(2)
+                .WillRepeatedly(Return(2));
+
+            // The aircraft is nowhere near the exit point, only the name has changed.
+            EXPECT_CALL(mockFlightplan, GetPointDistanceInMinutes(5))
+                .Times(1)
+                .WillOnce(Return(999));
+
+            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5, kokHash));
             EXPECT_TRUE(cache.IntentionCodeValid("BAW123", mockFlightplan));
+            EXPECT_FALSE(cache.IntentionCodeValid("BAW123", mockFlightplan));
+        }
+
+        TEST(IntentionCodeCache, IntentionCodeValidDoesNotTrustFingerprintAtExitPoint)
+        {
+            IntentionCodeCache cache;
+            StrictMock<MockEuroscopeExtractedRouteInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetPointsNumber())
+                .Times(2)
+                .WillRepeatedly(Return(10));
+
+            EXPECT_CALL(mockFlightplan, GetPointName(5))
+                .Times(2)
+                .WillRepeatedly(Return("KOK"));
+
+            EXPECT_CALL(mockFlightplan, GetPointsAssignedIndex())
+                .Times(2)
+                .WillRepeatedly(Return(mockFlightplan.noDirect));
+
+            EXPECT_CALL(mockFlightplan, GetPointsCalculatedIndex())
+                .Times(2)
+                .WillRepeatedly(Return(5));
+
+            EXPECT_CALL(mockFlightplan, GetPointDistanceInMinutes(5))
+                .Times(2)
+                .WillOnce(Return(1))
+                .WillOnce(Return(mockFlightplan.pointPassed));
+
+            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5, kokHash));
+            EXPECT_TRUE(cache.IntentionCodeValid("BAW123", mockFlightplan));
+            EXPECT_FALSE(cache.IntentionCodeValid("BAW123", mockFlightplan));
+        }
+
+        TEST(IntentionCodeCache, IntentionCodeValidReturnsFalseIfExitPointChangedBeforeFirstCheck)
+        {
+            IntentionCodeCache cache;
+            StrictMock<MockEuroscopeExtractedRouteInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(10));
+
+            EXPECT_CALL(mockFlightplan, GetPointName(5))
+                .Times(1)
+                .WillOnce(Return("SOMVA"));
+
+            EXPECT_CALL(mockFlightplan, GetPointsAssignedIndex())
+                .Times(1)
+                .WillOnce(Return(mockFlightplan.noDirect));
+
+            EXPECT_CALL(mockFlightplan, GetPointsCalculatedIndex())
+                .Times(1)
+                .WillOnce(Return(2));
+
+            cache.RegisterAircraft("BAW123", IntentionCodeData("--", true, 5, kokHash));
+            EXPECT_FALSE(cache.IntentionCodeValid("BAW123", mockFlightplan));
         }
     }  // namespace IntentionCode
 }  // namespace UKControllerPluginTest
@@ -5,22 +5,27 @@
 #include "intention/IntentionCodeCache.h"
 #include "mock/MockEuroScopeCFlightplanInterface.h"
 #include "mock/MockEuroScopeCRadarTargetInterface.h"
-#include "mock/MockEuroscopeExtractedRouteInterface.h"
+#include "mock/MockEuroscopePluginLoopbackInterface.h"
 #include "intention/SectorExitRepositoryFactory.h"
-#include "bootstrap/PersistenceContainer.h"
+#include "dependency/DependencyConfig.h"
+#include "mock/MockTaskRunnerInterface.h"
 
 using UKControllerPlugin::IntentionCode::IntentionCodeGenerator;
 using UKControllerPlugin::IntentionCode::IntentionCodeEventHandler;
 using UKControllerPlugin::IntentionCode::IntentionCodeFactory;
 using UKControllerPlugin::IntentionCode::IntentionCodeCache;
+using UKControllerPlugin::IntentionCode::SectorExitRepository;
 using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
 using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
-using UKControllerPluginTest::Euroscope::MockEuroscopeExtractedRouteInterface;
+using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
 using UKControllerPlugin::IntentionCode::SectorExitRepositoryFactory;
-using UKControllerPlugin::Bootstrap::PersistenceContainer;
+using UKControllerPlugin::Dependency::DependencyConfig;
+using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
+using ::testing::NiceMock;
 using ::testing::StrictMock;
 using ::testing::Return;
 using ::testing::Test;
+using ::testing::_;
 
 namespace UKControllerPluginTest {
     namespace IntentionCode {
@@ -28,15 +33,49 @@ namespace UKControllerPluginTest {
         class IntentionCodeEventHandlerTest : public Test
         {
             public:
+                IntentionCodeEventHandlerTest()
+                    : taskRunner(false), exitPoints(SectorExitRepositoryFactory::Create())
+                {
+
+                }
+
                 void SetUp()
                 {
-                    PersistenceContainer container;
                     this->handler = std::unique_ptr<IntentionCodeEventHandler>(new IntentionCodeEventHandler(
-                        std::move(*IntentionCodeFactory::Create(std::move(*SectorExitRepositoryFactory::Create()))),
-                        IntentionCodeCache()
+                        std::move(*IntentionCodeFactory::Create(
+                            DependencyConfig::intentionCodes.defaultValue,
+                            *this->exitPoints
+                        )),
+                        IntentionCodeCache(),
+                        this->taskRunner,
+                        this->plugin
                     ));
                 };
 
+                void ExpectFlightplan(
+                    NiceMock<MockEuroScopeCFlightPlanInterface> & flightplan,
+                    std::string destination
+                ) {
+                    ON_CALL(flightplan, GetCallsign())
+                        .WillByDefault(Return("BAW123"));
+
+                    ON_CALL(flightplan, GetOrigin())
+                        .WillByDefault(Return("EGKK"));
+
+                    ON_CALL(flightplan, GetDestination())
+                        .WillByDefault(Return(destination));
+
+                    ON_CALL(flightplan, GetCruiseLevel())
+                        .WillByDefault(Return(8000));
+
+                    ON_CALL(flightplan, GetRawRouteString())
+                        .WillByDefault(Return("DCT"));
+                }
+
+                StrictMock<MockEuroScopeCRadarTargetInterface> radarTarget;
+                StrictMock<MockEuroscopePluginLoopbackInterface> plugin;
+                MockTaskRunnerInterface taskRunner;
+                std::unique_ptr<SectorExitRepository> exitPoints;
                 std::unique_ptr<IntentionCodeEventHandler> handler;
         };
 
@@ -45,128 +84,140 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE("UKCP Intention Code" == this->handler->GetTagItemDescription());
         }
 
-        TEST_F(IntentionCodeEventHandlerTest, GetTagItemDataGeneratesIntentionCodeIfNonePresent)
+        TEST_F(IntentionCodeEventHandlerTest, GetTagItemDataIsBlankUntilACodeHasBeenGenerated)
         {
-            StrictMock<MockEuroscopeExtractedRouteInterface> route;
-            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
-            StrictMock<MockEuroScopeCRadarTargetInterface> radarTarget;
-
-            EXPECT_CALL(flightplan, GetExtractedRoute())
-                .Times(1)
-                .WillOnce(Return(ByRef(route)));
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGLL");
 
-            EXPECT_CALL(flightplan, GetCallsign())
-                .Times(3)
-                .WillRepeatedly(Return("BAW123"));
-
-            EXPECT_CALL(flightplan, GetOrigin())
-                .Times(1)
-                .WillOnce(Return("EGKK"));
-
-            EXPECT_CALL(flightplan, GetDestination())
-                .Times(1)
-                .WillOnce(Return("EGLL"));
+            EXPECT_EQ("", this->handler->GetTagItemData(flightplan, this->radarTarget));
+            EXPECT_EQ("", this->handler->GetTagItemData(flightplan, this->radarTarget));
+        }
 
-            EXPECT_CALL(flightplan, GetCruiseLevel())
-                .Times(1)
-                .WillOnce(Return(8000));
+        TEST_F(IntentionCodeEventHandlerTest, GetTagItemDataSubmitsFlightplansThatHaveNotBeenSeen)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGLL");
 
-            EXPECT_TRUE("LL" == handler->GetTagItemData(flightplan, radarTarget));
+            this->handler->GetTagItemData(flightplan, this->radarTarget);
+            EXPECT_EQ(1, this->taskRunner.CountHeldTasks());
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ("LL", this->handler->GetTagItemData(flightplan, this->radarTarget));
         }
 
-        TEST_F(IntentionCodeEventHandlerTest, GetTagItemDataCachesCodeAndReusesIt)
+        TEST_F(IntentionCodeEventHandlerTest, GetTagItemDataDoesNotGenerateCodes)
         {
-            StrictMock<MockEuroscopeExtractedRouteInterface> route;
             StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
-            StrictMock<MockEuroScopeCRadarTargetInterface> radarTarget;
-
-            EXPECT_CALL(flightplan, GetExtractedRoute())
-                .Times(2)
-                .WillRepeatedly(Return(ByRef(route)));
+            NiceMock<MockEuroScopeCFlightPlanInterface> submittedFlightplan;
+            this->ExpectFlightplan(submittedFlightplan, "EGLL");
+            this->handler->FlightPlanEvent(submittedFlightplan, this->radarTarget);
+            this->taskRunner.RunHeldTasks();
 
             EXPECT_CALL(flightplan, GetCallsign())
-                .Times(6)
+                .Times(2)
                 .WillRepeatedly(Return("BAW123"));
 
-            EXPECT_CALL(flightplan, GetOrigin())
-                .Times(1)
-                .WillOnce(Return("EGKK"));
+            EXPECT_EQ("LL", this->handler->GetTagItemData(flightplan, this->radarTarget));
+            EXPECT_EQ("LL", this->handler->GetTagItemData(flightplan, this->radarTarget));
+        }
 
-            EXPECT_CALL(flightplan, GetDestination())
-                .Times(1)
-                .WillOnce(Return("EGLL"));
+        TEST_F(IntentionCodeEventHandlerTest, WriteTagItemDataWritesIntentionCode)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGLL");
+            this->handler->FlightPlanEvent(flightplan, this->radarTarget);
+            this->taskRunner.RunHeldTasks();
+
+            char itemData[16];
+            EXPECT_TRUE(this->handler->WriteTagItemData(flightplan, this->radarTarget, itemData));
+            EXPECT_EQ(0, strcmp("LL", itemData));
+        }
 
-            EXPECT_CALL(flightplan, GetCruiseLevel())
-                .Times(1)
-                .WillOnce(Return(8000));
+        TEST_F(IntentionCodeEventHandlerTest, FlightplanEventKeepsTheOldCodeUntilTheNewOneIsReady)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            NiceMock<MockEuroScopeCFlightPlanInterface> amendedFlightplan;
+            this->ExpectFlightplan(flightplan, "EGLL");
+            this->ExpectFlightplan(amendedFlightplan, "EGSS");
+
+            this->handler->FlightPlanEvent(flightplan, this->radarTarget);
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ("LL", this->handler->GetTagItemData(flightplan, this->radarTarget));
 
-            this->handler->GetTagItemData(flightplan, radarTarget);
-            EXPECT_TRUE("LL" == handler->GetTagItemData(flightplan, radarTarget));
+            this->handler->FlightPlanEvent(amendedFlightplan, this->radarTarget);
+            EXPECT_EQ("LL", this->handler->GetTagItemData(amendedFlightplan, this->radarTarget));
+
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ("SS", this->handler->GetTagItemData(amendedFlightplan, this->radarTarget));
         }
 
-        // These two tests proves that the cache drops a code if it becomes invalid.
-        TEST_F(IntentionCodeEventHandlerTest, FlightplanEventClearsCache)
+        TEST_F(IntentionCodeEventHandlerTest, FlightplanEventIgnoresUpdatesThatDoNotChangeTheCode)
         {
-            StrictMock<MockEuroscopeExtractedRouteInterface> route;
-            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
-            StrictMock<MockEuroScopeCRadarTargetInterface> radarTarget;
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGLL");
 
-            EXPECT_CALL(flightplan, GetExtractedRoute())
-                .Times(2)
-                .WillRepeatedly(Return(ByRef(route)));
+            this->handler->FlightPlanEvent(flightplan, this->radarTarget);
+            this->taskRunner.RunHeldTasks();
+            this->handler->GetTagItemData(flightplan, this->radarTarget);
 
-            EXPECT_CALL(flightplan, GetCallsign())
-                .Times(7)
-                .WillRepeatedly(Return("BAW123"));
+            this->handler->FlightPlanEvent(flightplan, this->radarTarget);
+            EXPECT_EQ(0, this->taskRunner.CountHeldTasks());
+        }
 
-            EXPECT_CALL(flightplan, GetOrigin())
-                .Times(2)
-                .WillRepeatedly(Return("EGKK"));
+        TEST_F(IntentionCodeEventHandlerTest, FlightplanDisconnectEventClearsCache)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGLL");
 
-            EXPECT_CALL(flightplan, GetDestination())
-                .Times(2)
-                .WillOnce(Return("EGLL"))
-                .WillOnce(Return("EGSS"));
+            this->handler->FlightPlanEvent(flightplan, this->radarTarget);
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ("LL", this->handler->GetTagItemData(flightplan, this->radarTarget));
 
-            EXPECT_CALL(flightplan, GetCruiseLevel())
-                .Times(2)
-                .WillRepeatedly(Return(8000));
+            this->handler->FlightPlanDisconnectEvent(flightplan);
+            EXPECT_EQ("", this->handler->GetTagItemData(flightplan, this->radarTarget));
+        }
 
-            EXPECT_TRUE("LL" == handler->GetTagItemData(flightplan, radarTarget));
-            this->handler->FlightPlanEvent(flightplan, radarTarget);
-            EXPECT_TRUE("SS" == handler->GetTagItemData(flightplan, radarTarget));
+        TEST_F(IntentionCodeEventHandlerTest, FlightplanDisconnectEventDropsCodesStillBeingGenerated)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGLL");
+
+            this->handler->FlightPlanEvent(flightplan, this->radarTarget);
+            this->handler->FlightPlanDisconnectEvent(flightplan);
+            this->taskRunner.RunHeldTasks();
+
+            EXPECT_EQ(1, this->handler->GetPrecomputer().CountPrecomputedCodes());
+            EXPECT_EQ("", this->handler->GetTagItemData(flightplan, this->radarTarget));
+            EXPECT_EQ(0, this->handler->GetPrecomputer().CountPrecomputedCodes());
         }
 
-        TEST_F(IntentionCodeEventHandlerTest, FlightplanDisconnectEventClearsCache)
+        TEST_F(IntentionCodeEventHandlerTest, RadarTargetPositionUpdateIgnoresCodesWithoutAnExitPoint)
         {
-            StrictMock<MockEuroscopeExtractedRouteInterface> route;
-            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
-            StrictMock<MockEuroScopeCRadarTargetInterface> radarTarget;
+            NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGLL");
+            this->handler->FlightPlanEvent(flightplan, this->radarTarget);
+            this->taskRunner.RunHeldTasks();
+            this->handler->GetTagItemData(flightplan, this->radarTarget);
 
-            EXPECT_CALL(flightplan, GetExtractedRoute())
-                .Times(2)
-                .WillRepeatedly(Return(ByRef(route)));
+            EXPECT_CALL(this->radarTarget, GetCallsign())
+                .Times(1)
+                .WillOnce(Return("BAW123"));
 
-            EXPECT_CALL(flightplan, GetCallsign())
-                .Times(7)
-                .WillRepeatedly(Return("BAW123"));
+            EXPECT_CALL(this->plugin, GetFlightplanForCallsign(_))
+                .Times(0);
 
-            EXPECT_CALL(flightplan, GetOrigin())
-                .Times(2)
-                .WillRepeatedly(Return("EGKK"));
+            this->handler->RadarTargetPositionUpdateEvent(this->radarTarget);
+        }
 
-            EXPECT_CALL(flightplan, GetDestination())
-                .Times(2)
-                .WillOnce(Return("EGLL"))
-                .WillOnce(Return("EGSS"));
+        TEST_F(IntentionCodeEventHandlerTest, RadarTargetPositionUpdateIgnoresAircraftWithoutACode)
+        {
+            EXPECT_CALL(this->radarTarget, GetCallsign())
+                .Times(1)
+                .WillOnce(Return("BAW123"));
 
-            EXPECT_CALL(flightplan, GetCruiseLevel())
-                .Times(2)
-                .WillRepeatedly(Return(8000));
+            EXPECT_CALL(this->plugin, GetFlightplanForCallsign(_))
+                .Times(0);
 
-            EXPECT_TRUE("LL" == handler->GetTagItemData(flightplan, radarTarget));
-            handler->FlightPlanDisconnectEvent(flightplan);
-            EXPECT_TRUE("SS" == handler->GetTagItemData(flightplan, radarTarget));
+            this->handler->RadarTargetPositionUpdateEvent(this->radarTarget);
         }
     }  // namespace IntentionCode
 }  // namespace UKControllerPluginTest
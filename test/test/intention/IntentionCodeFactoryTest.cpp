@@ -0,0 +1,123 @@
+#include "pch/pch.h"
+#include "intention/IntentionCodeFactory.h"
+#include "intention/IntentionCodeRuleTable.h"
+#include "intention/IntentionCodeGenerator.h"
+#include "intention/SectorExitRepositoryFactory.h"
+#include "dependency/DependencyConfig.h"
+
+using UKControllerPlugin::IntentionCode::IntentionCodeFactory;
+using UKControllerPlugin::IntentionCode::IntentionCodeRuleTable;
+using UKControllerPlugin::IntentionCode::IntentionCodeGenerator;
+using UKControllerPlugin::IntentionCode::SectorExitRepositoryFactory;
+using UKControllerPlugin::IntentionCode::SectorExitRepository;
+using UKControllerPlugin::Dependency::DependencyConfig;
+
+namespace UKControllerPluginTest {
+    namespace IntentionCode {
+
+        TEST(IntentionCodeFactory, CreateReturnsAGenerator)
+        {
+            std::unique_ptr<SectorExitRepository> exitPoints = SectorExitRepositoryFactory::Create();
+            EXPECT_NE(
+                nullptr,
+                IntentionCodeFactory::Create(DependencyConfig::intentionCodes.defaultValue, *exitPoints)
+            );
+        }
+
+        TEST(IntentionCodeFactory, CreateRuleTableReturnsEmptyTableIfRulesNotArray)
+        {
+            EXPECT_EQ(0, IntentionCodeFactory::CreateRuleTable(nlohmann::json::object())->CountRules());
+        }
+
+        TEST(IntentionCodeFactory, CreateRuleTableSkipsInvalidRules)
+        {
+            nlohmann::json rules = nlohmann::json::array();
+            rules.push_back({{"airfields", {"EHAM"}}, {"code", "AM"}});
+            rules.push_back({{"airfields", {"EHAM"}}});
+            rules.push_back({{"airfield_prefix", "EG"}, {"use_airfield_suffix", true}});
+
+            EXPECT_EQ(2, IntentionCodeFactory::CreateRuleTable(rules)->CountRules());
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsTrueForAirfieldList)
+        {
+            EXPECT_TRUE(IntentionCodeFactory::RuleValid({{"airfields", {"EHAM", "EHRD"}}, {"code", "AM"}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsTrueForPrefix)
+        {
+            EXPECT_TRUE(IntentionCodeFactory::RuleValid({{"airfield_prefix", "EH"}, {"code", "AM"}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsTrueWithViaPoint)
+        {
+            EXPECT_TRUE(IntentionCodeFactory::RuleValid({{"airfields", {"EHAM"}}, {"via", "KOK"}, {"code", "AS"}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsTrueWithAirfieldSuffix)
+        {
+            EXPECT_TRUE(IntentionCodeFactory::RuleValid({{"airfield_prefix", "EG"}, {"use_airfield_suffix", true}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalseNotObject)
+        {
+            EXPECT_FALSE(IntentionCodeFactory::RuleValid(nlohmann::json::array()));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalseNoAirfieldsOrPrefix)
+        {
+            EXPECT_FALSE(IntentionCodeFactory::RuleValid({{"code", "AM"}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalseBothAirfieldsAndPrefix)
+        {
+            EXPECT_FALSE(
+                IntentionCodeFactory::RuleValid({{"airfields", {"EHAM"}}, {"airfield_prefix", "EH"}, {"code", "AM"}})
+            );
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalseAirfieldsEmpty)
+        {
+            EXPECT_FALSE(IntentionCodeFactory::RuleValid({{"airfields", nlohmann::json::array()}, {"code", "AM"}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalseAirfieldNotString)
+        {
+            EXPECT_FALSE(IntentionCodeFactory::RuleValid({{"airfields", {"EHAM", 1}}, {"code", "AM"}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalsePrefixEmpty)
+        {
+            EXPECT_FALSE(IntentionCodeFactory::RuleValid({{"airfield_prefix", ""}, {"code", "AM"}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalseViaNotString)
+        {
+            EXPECT_FALSE(IntentionCodeFactory::RuleValid({{"airfields", {"EHAM"}}, {"via", 1}, {"code", "AS"}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalseNoCode)
+        {
+            EXPECT_FALSE(IntentionCodeFactory::RuleValid({{"airfields", {"EHAM"}}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalseCodeNotString)
+        {
+            EXPECT_FALSE(IntentionCodeFactory::RuleValid({{"airfields", {"EHAM"}}, {"code", 1}}));
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalseCodeAndAirfieldSuffix)
+        {
+            EXPECT_FALSE(
+                IntentionCodeFactory::RuleValid(
+                    {{"airfield_prefix", "EG"}, {"use_airfield_suffix", true}, {"code", "AM"}}
+                )
+            );
+        }
+
+        TEST(IntentionCodeFactory, RuleValidReturnsFalseAirfieldSuffixNotBoolean)
+        {
+            EXPECT_FALSE(IntentionCodeFactory::RuleValid({{"airfield_prefix", "EG"}, {"use_airfield_suffix", 1}}));
+        }
+    }  // namespace IntentionCode
+}  // namespace UKControllerPluginTest
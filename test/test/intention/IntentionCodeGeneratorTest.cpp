@@ -1,14 +1,16 @@
 #include "pch/pch.h"
 #include "intention/IntentionCodeGenerator.h"
-#include "mock/MockAirfieldGroup.h"
+#include "intention/IntentionCodeRule.h"
+#include "intention/IntentionCodeRuleTable.h"
 #include "mock/MockEuroscopeExtractedRouteInterface.h"
 #include "intention/IntentionCodeData.h"
 #include "intention/SectorExitRepositoryFactory.h"
 #include "intention/SectorExitPoint.h"
 
-using UKControllerPlugin::IntentionCode::AirfieldGroup;
 using UKControllerPlugin::IntentionCode::IntentionCodeData;
 using UKControllerPlugin::IntentionCode::IntentionCodeGenerator;
+using UKControllerPlugin::IntentionCode::IntentionCodeRule;
+using UKControllerPlugin::IntentionCode::IntentionCodeRuleTable;
 using UKControllerPluginTest::Euroscope::MockEuroscopeExtractedRouteInterface;
 using UKControllerPlugin::IntentionCode::SectorExitRepositoryFactory;
 using UKControllerPlugin::IntentionCode::SectorExitRepository;
@@ -67,8 +69,8 @@ namespace UKControllerPluginTest {
 
         TEST_F(IntentionCodeGeneratorTest, ReturnsCorrectCodeNoFlightplan)
         {
-            std::vector<std::unique_ptr<AirfieldGroup>> groups;
-            IntentionCodeGenerator intention(std::move(groups), *SectorExitRepositoryFactory::Create());
+            std::vector<IntentionCodeRule> rules;
+            IntentionCodeGenerator intention(IntentionCodeRuleTable(rules), *SectorExitRepositoryFactory::Create());
             NiceMock<MockEuroscopeExtractedRouteInterface> mockFlightPlan;
             IntentionCodeData data = intention.GetIntentionCodeForFlightplan("BAW123", "", "", mockFlightPlan, 0);
             EXPECT_TRUE(data.intentionCode == "--");
@@ -76,16 +78,16 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(IntentionCodeGenerator::invalidExitPointIndex, data.exitPointIndex);
         }
 
-        TEST_F(IntentionCodeGeneratorTest, ReturnsCorrectCodeFromAirfieldGroup)
+        TEST_F(IntentionCodeGeneratorTest, ReturnsCorrectCodeFromDestinationRule)
         {
             NiceMock<MockEuroscopeExtractedRouteInterface> mockFlightPlan;
-            std::vector<std::unique_ptr<AirfieldGroup>> groups;
-            std::unique_ptr<StrictMock<MockAirfieldGroup>> mockAirfieldGroup(new StrictMock<MockAirfieldGroup>);
+            std::vector<IntentionCodeRule> rules;
+            IntentionCodeRule rule;
+            rule.airfields = {"EGLL"};
+            rule.code = "LL";
+            rules.push_back(rule);
 
-            MockAirfieldGroup * mockGroupRaw = mockAirfieldGroup.get();
-
-            groups.push_back(std::move(mockAirfieldGroup));
-            IntentionCodeGenerator intention(std::move(groups), *SectorExitRepositoryFactory::Create());
+            IntentionCodeGenerator intention(IntentionCodeRuleTable(rules), *SectorExitRepositoryFactory::Create());
             IntentionCodeData data = intention.GetIntentionCodeForFlightplan(
                 "BAW123",
                 "OMDB",
@@ -101,7 +103,7 @@ namespace UKControllerPluginTest {
         TEST_F(IntentionCodeGeneratorTest, ReturnsCorrectCodeNormalCase)
         {
             NiceMock<MockEuroscopeExtractedRouteInterface> mockFlightPlan;
-            std::vector<std::unique_ptr<AirfieldGroup>> groups;
+            std::vector<IntentionCodeRule> rules;
 
             ON_CALL(mockFlightPlan, GetPointsNumber())
                 .WillByDefault(Return(3));
@@ -125,7 +127,7 @@ namespace UKControllerPluginTest {
                 .WillByDefault(Return(999));
 
             std::unique_ptr<SectorExitRepository> exitPoints = SectorExitRepositoryFactory::Create();
-            IntentionCodeGenerator intention(std::move(groups), std::move(*exitPoints));
+            IntentionCodeGenerator intention(IntentionCodeRuleTable(rules), std::move(*exitPoints));
             IntentionCodeData data = intention.GetIntentionCodeForFlightplan(
                 "BAW123",
                 "EGKK",
@@ -136,12 +138,13 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE(data.intentionCode == "S3");
             EXPECT_TRUE(data.exitPointValid);
             EXPECT_EQ(1, data.exitPointIndex);
+            EXPECT_EQ(std::hash<std::string>()("BAKUR"), data.exitPointHash);
         }
 
         TEST_F(IntentionCodeGeneratorTest, ReturnsDestinationIcaoNoMatch)
         {
             NiceMock<MockEuroscopeExtractedRouteInterface> mockFlightPlan;
-            std::vector<std::unique_ptr<AirfieldGroup>> groups;
+            std::vector<IntentionCodeRule> rules;
 
             ON_CALL(mockFlightPlan, GetPointsNumber())
                 .WillByDefault(Return(4));
@@ -159,7 +162,7 @@ namespace UKControllerPluginTest {
                 .WillByDefault(Return("KLAS"));
 
             std::unique_ptr<SectorExitRepository> exitPoints = SectorExitRepositoryFactory::Create();
-            IntentionCodeGenerator intention(std::move(groups), std::move(*exitPoints));
+            IntentionCodeGenerator intention(IntentionCodeRuleTable(rules), std::move(*exitPoints));
             IntentionCodeData data = intention.GetIntentionCodeForFlightplan(
                 "BAW123",
                 "EGKK",
@@ -175,7 +178,7 @@ namespace UKControllerPluginTest {
         TEST_F(IntentionCodeGeneratorTest, GetIntentionCodeForFlightPlanIgnoresFixIfTravellingInWrongDirection)
         {
             NiceMock<MockEuroscopeExtractedRouteInterface> mockFlightPlan;
-            std::vector<std::unique_ptr<AirfieldGroup>> groups;
+            std::vector<IntentionCodeRule> rules;
 
             ON_CALL(mockFlightPlan, GetPointsNumber())
                 .WillByDefault(Return(3));
@@ -202,7 +205,7 @@ namespace UKControllerPluginTest {
                 .WillByDefault(Return(999));
 
             std::unique_ptr<SectorExitRepository> exitPoints = SectorExitRepositoryFactory::Create();
-            IntentionCodeGenerator intention(std::move(groups), std::move(*exitPoints));
+            IntentionCodeGenerator intention(IntentionCodeRuleTable(rules), std::move(*exitPoints));
             IntentionCodeData data = intention.GetIntentionCodeForFlightplan(
                 "BAW123",
                 "KLAS",
@@ -218,14 +221,14 @@ namespace UKControllerPluginTest {
         TEST_F(IntentionCodeGeneratorTest, GetIntentionCodeReturnsDifferentCodeIfFlightplanChanges)
         {
             NiceMock<MockEuroscopeExtractedRouteInterface> mockFlightPlan;
-            std::vector<std::unique_ptr<AirfieldGroup>> groups;
-            std::unique_ptr<MockAirfieldGroup> mockAirfieldGroup(new StrictMock<MockAirfieldGroup>);
-
-            MockAirfieldGroup * groupRaw = mockAirfieldGroup.get();
+            std::vector<IntentionCodeRule> rules;
+            IntentionCodeRule rule;
+            rule.airfieldPrefix = "EG";
+            rule.useAirfieldSuffix = true;
+            rules.push_back(rule);
 
-            groups.push_back(std::move(mockAirfieldGroup));
             std::unique_ptr<SectorExitRepository> exitPoints = SectorExitRepositoryFactory::Create();
-            IntentionCodeGenerator intention(std::move(groups), std::move(*exitPoints));
+            IntentionCodeGenerator intention(IntentionCodeRuleTable(rules), std::move(*exitPoints));
             IntentionCodeData data = intention.GetIntentionCodeForFlightplan(
                 "BAW123",
                 "KLAS",
@@ -245,7 +248,7 @@ namespace UKControllerPluginTest {
         TEST_F(IntentionCodeGeneratorTest, GetIntentionCodeReturnsIcaoIfPointPassed)
         {
             NiceMock<MockEuroscopeExtractedRouteInterface> mockFlightPlan;
-            std::vector<std::unique_ptr<AirfieldGroup>> groups;
+            std::vector<IntentionCodeRule> rules;
 
             ON_CALL(mockFlightPlan, GetPointsNumber())
                 .WillByDefault(Return(3));
@@ -274,7 +277,7 @@ namespace UKControllerPluginTest {
                 .WillOnce(Return(-1));
 
             std::unique_ptr<SectorExitRepository> exitPoints = SectorExitRepositoryFactory::Create();
-            IntentionCodeGenerator intention(std::move(groups), std::move(*exitPoints));
+            IntentionCodeGenerator intention(IntentionCodeRuleTable(rules), std::move(*exitPoints));
             IntentionCodeData data = intention.GetIntentionCodeForFlightplan(
                 "BAW123",
                 "EGLL",
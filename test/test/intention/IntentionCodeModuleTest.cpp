@@ -2,12 +2,20 @@
 #include "intention/IntentionCodeModule.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
 #include "tag/TagItemCollection.h"
+#include "euroscope/RadarTargetEventHandlerCollection.h"
 #include "bootstrap/PersistenceContainer.h"
+#include "mock/MockDependencyProvider.h"
+#include "dependency/DependencyConfig.h"
 
 using UKControllerPlugin::IntentionCode::IntentionCodeModule;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
 using UKControllerPlugin::Tag::TagItemCollection;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
+using UKControllerPlugin::Euroscope::RadarTargetEventHandlerCollection;
+using UKControllerPluginTest::Dependency::MockDependencyProvider;
+using UKControllerPlugin::Dependency::DependencyConfig;
+using ::testing::NiceMock;
+using ::testing::Return;
 
 namespace UKControllerPluginTest {
     namespace IntentionCode {
@@ -18,19 +26,57 @@ namespace UKControllerPluginTest {
             PersistenceContainer container;
             container.flightplanHandler.reset(new FlightPlanEventHandlerCollection);
             container.tagHandler.reset(new TagItemCollection);
+            container.radarTargetHandler.reset(new RadarTargetEventHandlerCollection);
+            NiceMock<MockDependencyProvider> dependencyProvider;
+            ON_CALL(dependencyProvider, GetDependency(DependencyConfig::intentionCodes))
+                .WillByDefault(Return(DependencyConfig::intentionCodes.defaultValue));
 
-            IntentionCodeModule::BootstrapPlugin(container);
+            IntentionCodeModule::BootstrapPlugin(dependencyProvider, container);
 
             EXPECT_EQ(1, container.flightplanHandler->CountHandlers());
         }
 
+        TEST(IntentionCodeModule, BootstrapPluginRegistersRadarTargetEvents)
+        {
+            PersistenceContainer container;
+            container.flightplanHandler.reset(new FlightPlanEventHandlerCollection);
+            container.tagHandler.reset(new TagItemCollection);
+            container.radarTargetHandler.reset(new RadarTargetEventHandlerCollection);
+            NiceMock<MockDependencyProvider> dependencyProvider;
+            ON_CALL(dependencyProvider, GetDependency(DependencyConfig::intentionCodes))
+                .WillByDefault(Return(DependencyConfig::intentionCodes.defaultValue));
+
+            IntentionCodeModule::BootstrapPlugin(dependencyProvider, container);
+
+            EXPECT_EQ(1, container.radarTargetHandler->CountHandlers());
+        }
+
+        TEST(IntentionCodeModule, BootstrapPluginCreatesAnIntentionCodeTaskRunner)
+        {
+            PersistenceContainer container;
+            container.flightplanHandler.reset(new FlightPlanEventHandlerCollection);
+            container.tagHandler.reset(new TagItemCollection);
+            container.radarTargetHandler.reset(new RadarTargetEventHandlerCollection);
+            NiceMock<MockDependencyProvider> dependencyProvider;
+            ON_CALL(dependencyProvider, GetDependency(DependencyConfig::intentionCodes))
+                .WillByDefault(Return(DependencyConfig::intentionCodes.defaultValue));
+
+            IntentionCodeModule::BootstrapPlugin(dependencyProvider, container);
+
+            EXPECT_NE(nullptr, container.intentionCodeTaskRunner);
+        }
+
         TEST(IntentionCodeModule, BootstrapPluginRegistersCorrectTagItemEvent)
         {
             PersistenceContainer container;
             container.flightplanHandler.reset(new FlightPlanEventHandlerCollection);
             container.tagHandler.reset(new TagItemCollection);
+            container.radarTargetHandler.reset(new RadarTargetEventHandlerCollection);
+            NiceMock<MockDependencyProvider> dependencyProvider;
+            ON_CALL(dependencyProvider, GetDependency(DependencyConfig::intentionCodes))
+                .WillByDefault(Return(DependencyConfig::intentionCodes.defaultValue));
 
-            IntentionCodeModule::BootstrapPlugin(container);
+            IntentionCodeModule::BootstrapPlugin(dependencyProvider, container);
 
             EXPECT_EQ(1, container.tagHandler->CountHandlers());
             EXPECT_TRUE(container.tagHandler->HasHandlerForItemId(IntentionCodeModule::tagItemId));
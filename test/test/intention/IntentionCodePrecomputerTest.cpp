@@ -0,0 +1,345 @@
+#include "pch/pch.h"
+#include "intention/IntentionCodePrecomputer.h"
+#include "intention/IntentionCodeGenerator.h"
+#include "intention/IntentionCodeFactory.h"
+#include "intention/IntentionCodeData.h"
+#include "intention/SectorExitRepositoryFactory.h"
+#include "dependency/DependencyConfig.h"
+#include "mock/MockTaskRunnerInterface.h"
+#include "mock/MockEuroScopeCFlightplanInterface.h"
+#include "mock/MockEuroscopeExtractedRouteInterface.h"
+
+using UKControllerPlugin::IntentionCode::IntentionCodePrecomputer;
+using UKControllerPlugin::IntentionCode::IntentionCodeGenerator;
+using UKControllerPlugin::IntentionCode::IntentionCodeFactory;
+using UKControllerPlugin::IntentionCode::IntentionCodeData;
+using UKControllerPlugin::IntentionCode::SectorExitRepository;
+using UKControllerPlugin::IntentionCode::SectorExitRepositoryFactory;
+using UKControllerPlugin::Dependency::DependencyConfig;
+using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using UKControllerPluginTest::Euroscope::MockEuroscopeExtractedRouteInterface;
+using EuroScopePlugIn::CPosition;
+using ::testing::NiceMock;
+using ::testing::StrictMock;
+using ::testing::Return;
+using ::testing::AnyNumber;
+using ::testing::Test;
+using ::testing::_;
+
+namespace UKControllerPluginTest {
+    namespace IntentionCode {
+
+        class IntentionCodePrecomputerTest : public Test
+        {
+            public:
+                IntentionCodePrecomputerTest()
+                    : taskRunner(false), exitPoints(SectorExitRepositoryFactory::Create()),
+                    generator(IntentionCodeFactory::Create(DependencyConfig::intentionCodes.defaultValue, *exitPoints)),
+                    precomputer(*generator, taskRunner)
+                {
+
+                }
+
+                void ExpectFlightplan(
+                    StrictMock<MockEuroScopeCFlightPlanInterface> & flightplan,
+                    std::string origin,
+                    std::string destination
+                ) {
+                    EXPECT_CALL(flightplan, GetOrigin())
+                        .WillRepeatedly(Return(origin));
+
+                    EXPECT_CALL(flightplan, GetDestination())
+                        .WillRepeatedly(Return(destination));
+
+                    EXPECT_CALL(flightplan, GetCruiseLevel())
+                        .WillRepeatedly(Return(35000));
+
+                    EXPECT_CALL(flightplan, GetRawRouteString())
+                        .WillRepeatedly(Return("DCT"));
+                }
+
+                // Collects the codes that have been generated
+                std::map<std::string, IntentionCodeData> Collect(void)
+                {
+                    std::map<std::string, IntentionCodeData> collected;
+                    this->precomputer.CollectIntentionCodes(
+                        [&collected](const std::string & callsign, const IntentionCodeData & data) {
+                            collected[callsign] = data;
+                        }
+                    );
+                    return collected;
+                }
+
+                // A route from Gatwick that leaves the FIR westbound at BAKUR
+                void ExpectRouteViaBakur(NiceMock<MockEuroscopeExtractedRouteInterface> & route)
+                {
+                    CPosition exitPosition;
+                    exitPosition.m_Latitude = 53.680000000000000;
+                    exitPosition.m_Longitude = -5.5000000000000000;
+                    CPosition nextFixPosition;
+                    nextFixPosition.m_Latitude = 55.000000000000000;
+                    nextFixPosition.m_Longitude = -15.000000000000000;
+
+                    ON_CALL(route, GetPointsNumber())
+                        .WillByDefault(Return(3));
+
+                    ON_CALL(route, GetPointName(0))
+                        .WillByDefault(Return("EGKK"));
+
+                    ON_CALL(route, GetPointName(1))
+                        .WillByDefault(Return("BAKUR"));
+
+                    ON_CALL(route, GetPointName(2))
+                        .WillByDefault(Return("KFJK"));
+
+                    ON_CALL(route, GetPointPosition(1))
+                        .WillByDefault(Return(exitPosition));
+
+                    ON_CALL(route, GetPointPosition(2))
+                        .WillByDefault(Return(nextFixPosition));
+
+                    ON_CALL(route, GetPointDistanceInMinutes(_))
+                        .WillByDefault(Return(999));
+                }
+
+                NiceMock<MockEuroscopeExtractedRouteInterface> route;
+                MockTaskRunnerInterface taskRunner;
+                std::unique_ptr<SectorExitRepository> exitPoints;
+                std::unique_ptr<IntentionCodeGenerator> generator;
+                IntentionCodePrecomputer precomputer;
+        };
+
+        TEST_F(IntentionCodePrecomputerTest, ItStartsWithNoCodes)
+        {
+            EXPECT_EQ(0, this->precomputer.CountPrecomputedCodes());
+            EXPECT_FALSE(this->precomputer.HasPrecomputedCodes());
+            EXPECT_TRUE(this->Collect().empty());
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItGeneratesCodesInTheBackground)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGKK", "EGLL");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan);
+            EXPECT_EQ(1, this->taskRunner.CountHeldTasks());
+            EXPECT_FALSE(this->precomputer.HasPrecomputedCodes());
+
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ(1, this->precomputer.CountPrecomputedCodes());
+            EXPECT_TRUE(this->precomputer.HasPrecomputedCodes());
+
+            std::map<std::string, IntentionCodeData> codes = this->Collect();
+            ASSERT_EQ(1, codes.count("BAW123"));
+            EXPECT_EQ("LL", codes.at("BAW123").intentionCode);
+            EXPECT_FALSE(codes.at("BAW123").exitPointValid);
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItGeneratesInvalidCodeIfNoFlightplan)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "", "");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan);
+            this->taskRunner.RunHeldTasks();
+
+            std::map<std::string, IntentionCodeData> codes = this->Collect();
+            ASSERT_EQ(1, codes.count("BAW123"));
+            EXPECT_EQ("--", codes.at("BAW123").intentionCode);
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItOnlyQueuesOneTaskForManySubmissions)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan1;
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan2;
+            this->ExpectFlightplan(flightplan1, "EGKK", "EGLL");
+            this->ExpectFlightplan(flightplan2, "EGKK", "EGSS");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan1);
+            this->precomputer.SubmitAircraft("BAW456", flightplan2);
+            EXPECT_EQ(1, this->taskRunner.CountHeldTasks());
+
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ(2, this->precomputer.CountPrecomputedCodes());
+
+            std::map<std::string, IntentionCodeData> codes = this->Collect();
+            EXPECT_EQ("LL", codes.at("BAW123").intentionCode);
+            EXPECT_EQ("SS", codes.at("BAW456").intentionCode);
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItQueuesANewTaskOnceTheLastHasFinished)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan1;
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan2;
+            this->ExpectFlightplan(flightplan1, "EGKK", "EGLL");
+            this->ExpectFlightplan(flightplan2, "EGKK", "EGSS");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan1);
+            this->taskRunner.RunHeldTasks();
+            this->precomputer.SubmitAircraft("BAW123", flightplan2);
+            EXPECT_EQ(1, this->taskRunner.CountHeldTasks());
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItIgnoresUpdatesThatDoNotChangeTheCode)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGKK", "EGLL");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan);
+            this->taskRunner.RunHeldTasks();
+            this->Collect();
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan);
+            EXPECT_EQ(0, this->taskRunner.CountHeldTasks());
+            EXPECT_FALSE(this->precomputer.HasPrecomputedCodes());
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItResubmitsAircraftWhoseFlightplanHasNotChanged)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGKK", "EGLL");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan);
+            this->taskRunner.RunHeldTasks();
+            this->Collect();
+
+            this->precomputer.ResubmitAircraft("BAW123", flightplan);
+            EXPECT_EQ(1, this->taskRunner.CountHeldTasks());
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ("LL", this->Collect().at("BAW123").intentionCode);
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItDoesNotResubmitAircraftWhoseCodeHasNotBeenCollected)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGKK", "EGLL");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan);
+            this->taskRunner.RunHeldTasks();
+
+            this->precomputer.ResubmitAircraft("BAW123", flightplan);
+            EXPECT_EQ(0, this->taskRunner.CountHeldTasks());
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItDoesNotCollectCodesForOldFlightplans)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan1;
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan2;
+            this->ExpectFlightplan(flightplan1, "EGKK", "EGLL");
+            this->ExpectFlightplan(flightplan2, "EGKK", "EGSS");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan1);
+            this->taskRunner.RunHeldTasks();
+            this->precomputer.SubmitAircraft("BAW123", flightplan2);
+            EXPECT_TRUE(this->Collect().empty());
+
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ("SS", this->Collect().at("BAW123").intentionCode);
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItOnlyGeneratesTheLatestSubmissionInABatch)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan1;
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan2;
+            this->ExpectFlightplan(flightplan1, "EGKK", "EGLL");
+            this->ExpectFlightplan(flightplan2, "EGKK", "EGSS");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan1);
+            this->precomputer.SubmitAircraft("BAW123", flightplan2);
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ(1, this->precomputer.CountPrecomputedCodes());
+            EXPECT_EQ("SS", this->Collect().at("BAW123").intentionCode);
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItDoesNotCollectCodesForRemovedAircraft)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGKK", "EGLL");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan);
+            EXPECT_TRUE(this->precomputer.HasSubmittedAircraft("BAW123"));
+            this->taskRunner.RunHeldTasks();
+            this->precomputer.RemoveAircraft("BAW123");
+
+            EXPECT_FALSE(this->precomputer.HasSubmittedAircraft("BAW123"));
+            EXPECT_TRUE(this->Collect().empty());
+            EXPECT_EQ(0, this->precomputer.CountPrecomputedCodes());
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItDoesNotCollectCodesFromBeforeAnAircraftReconnected)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGKK", "EGLL");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan);
+            this->taskRunner.RunHeldTasks();
+            this->precomputer.RemoveAircraft("BAW123");
+            this->precomputer.SubmitAircraft("BAW123", flightplan);
+            EXPECT_TRUE(this->Collect().empty());
+
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ(1, this->Collect().count("BAW123"));
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItOnlyCollectsEachCodeOnce)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGKK", "EGLL");
+
+            this->precomputer.SubmitAircraft("BAW123", flightplan);
+            this->taskRunner.RunHeldTasks();
+            EXPECT_EQ(1, this->Collect().size());
+            EXPECT_TRUE(this->Collect().empty());
+            EXPECT_FALSE(this->precomputer.HasPrecomputedCodes());
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItGeneratesCodesForExitPoints)
+        {
+            this->ExpectRouteViaBakur(this->route);
+
+            this->precomputer.SubmitAircraft("BAW123", "EGKK", "KFJK", 24000, this->route);
+            this->taskRunner.RunHeldTasks();
+
+            IntentionCodeData data = this->Collect().at("BAW123");
+            EXPECT_EQ("S3", data.intentionCode);
+            EXPECT_TRUE(data.exitPointValid);
+            EXPECT_EQ(1, data.exitPointIndex);
+            EXPECT_EQ(std::hash<std::string>()("BAKUR"), data.exitPointHash);
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, ItOnlyCopiesTheRouteDetailNeededForExitPoints)
+        {
+            this->ExpectRouteViaBakur(this->route);
+            EXPECT_CALL(this->route, GetPointPosition(_))
+                .Times(AnyNumber());
+
+            EXPECT_CALL(this->route, GetPointDistanceInMinutes(_))
+                .Times(AnyNumber());
+
+            EXPECT_CALL(this->route, GetPointPosition(0))
+                .Times(0);
+
+            EXPECT_CALL(this->route, GetPointDistanceInMinutes(0))
+                .Times(0);
+
+            this->precomputer.SubmitAircraft("BAW123", "EGKK", "KFJK", 24000, this->route);
+        }
+
+        TEST_F(IntentionCodePrecomputerTest, QueuedTasksDoNothingOnceThePrecomputerIsGone)
+        {
+            StrictMock<MockEuroScopeCFlightPlanInterface> flightplan;
+            this->ExpectFlightplan(flightplan, "EGKK", "EGLL");
+
+            std::unique_ptr<IntentionCodePrecomputer> shortLived = std::make_unique<IntentionCodePrecomputer>(
+                *this->generator,
+                this->taskRunner
+            );
+            shortLived->SubmitAircraft("BAW123", flightplan);
+            shortLived.reset();
+
+            EXPECT_EQ(1, this->taskRunner.CountHeldTasks());
+            EXPECT_NO_THROW(this->taskRunner.RunHeldTasks());
+        }
+    }  // namespace IntentionCode
+}  // namespace UKControllerPluginTest
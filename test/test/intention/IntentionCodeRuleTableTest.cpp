@@ -0,0 +1,315 @@
+#include "pch/pch.h"
+#include "intention/IntentionCodeRuleTable.h"
+#include "intention/IntentionCodeRule.h"
+#include "intention/IntentionCodeFactory.h"
+#include "dependency/DependencyConfig.h"
+#include "mock/MockEuroscopeExtractedRouteInterface.h"
+
+using UKControllerPlugin::IntentionCode::IntentionCodeRuleTable;
+using UKControllerPlugin::IntentionCode::IntentionCodeRule;
+using UKControllerPlugin::IntentionCode::IntentionCodeFactory;
+using UKControllerPlugin::Dependency::DependencyConfig;
+using UKControllerPluginTest::Euroscope::MockEuroscopeExtractedRouteInterface;
+using ::testing::StrictMock;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace IntentionCode {
+
+        class IntentionCodeRuleTableTest : public Test
+        {
+            public:
+                IntentionCodeRuleTableTest()
+                    : defaultRules(IntentionCodeFactory::CreateRuleTable(DependencyConfig::intentionCodes.defaultValue))
+                {
+
+                }
+
+                IntentionCodeRule MakeRule(
+                    std::vector<std::string> airfields,
+                    std::string prefix,
+                    std::string via,
+                    std::string code
+                ) {
+                    IntentionCodeRule rule;
+                    rule.airfields = airfields;
+                    rule.airfieldPrefix = prefix;
+                    rule.via = via;
+                    rule.code = code;
+                    return rule;
+                }
+
+                std::string code;
+                std::unique_ptr<IntentionCodeRuleTable> defaultRules;
+        };
+
+        TEST_F(IntentionCodeRuleTableTest, DefaultRulesAreAllLoaded)
+        {
+            EXPECT_EQ(6, this->defaultRules->CountRules());
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, ReturnsFalseIfNoRuleForDestination)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            EXPECT_FALSE(this->defaultRules->FindIntentionCode("LFPG", route, this->code));
+            EXPECT_EQ("", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, HomeAirfieldsReturnLastTwoLettersOfIcaoWithoutCheckingRoute)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            EXPECT_TRUE(this->defaultRules->FindIntentionCode("EGGD", route, this->code));
+            EXPECT_EQ("GD", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, HomeAirfieldsReturnLastTwoLettersOfIcaoWhenMalformed)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            EXPECT_TRUE(this->defaultRules->FindIntentionCode("EGD", route, this->code));
+            EXPECT_EQ("GD", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, ShannonReturnsCorrectCode)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            EXPECT_TRUE(this->defaultRules->FindIntentionCode("EINN", route, this->code));
+            EXPECT_EQ("NN", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, DublinGroupReturnsCorrectCode)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            EXPECT_TRUE(this->defaultRules->FindIntentionCode("EIDW", route, this->code));
+            EXPECT_EQ("DW", this->code);
+            EXPECT_TRUE(this->defaultRules->FindIntentionCode("EITT", route, this->code));
+            EXPECT_EQ("DW", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, DublinGroupDoesNotMatchUnknownIrishAirfields)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            EXPECT_FALSE(this->defaultRules->FindIntentionCode("EIXX", route, this->code));
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, BrusselsGroupReturnsCodeIfViaKoksy)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+
+            EXPECT_CALL(route, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(3));
+
+            EXPECT_CALL(route, GetPointName(0))
+                .Times(1)
+                .WillOnce(Return("EGKK"));
+
+            EXPECT_CALL(route, GetPointName(1))
+                .Times(1)
+                .WillOnce(Return("KOK"));
+
+            EXPECT_TRUE(this->defaultRules->FindIntentionCode("EBBR", route, this->code));
+            EXPECT_EQ("EB", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, BrusselsGroupDoesNotMatchIfNotViaKoksy)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+
+            EXPECT_CALL(route, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(3));
+
+            EXPECT_CALL(route, GetPointName(0))
+                .Times(1)
+                .WillOnce(Return("EGKK"));
+
+            EXPECT_CALL(route, GetPointName(1))
+                .Times(1)
+                .WillOnce(Return("DVR"));
+
+            EXPECT_CALL(route, GetPointName(2))
+                .Times(1)
+                .WillOnce(Return("EBBR"));
+
+            EXPECT_FALSE(this->defaultRules->FindIntentionCode("EBBR", route, this->code));
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, AmsterdamGroupReturnsSecondaryCodeIfViaKoksy)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+
+            EXPECT_CALL(route, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(3));
+
+            EXPECT_CALL(route, GetPointName(0))
+                .Times(1)
+                .WillOnce(Return("EGKK"));
+
+            EXPECT_CALL(route, GetPointName(1))
+                .Times(1)
+                .WillOnce(Return("KOK"));
+
+            EXPECT_TRUE(this->defaultRules->FindIntentionCode("EHAM", route, this->code));
+            EXPECT_EQ("AS", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, AmsterdamGroupReturnsMainCodeIfNotViaKoksy)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+
+            EXPECT_CALL(route, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(3));
+
+            EXPECT_CALL(route, GetPointName(0))
+                .Times(1)
+                .WillOnce(Return("EGKK"));
+
+            EXPECT_CALL(route, GetPointName(1))
+                .Times(1)
+                .WillOnce(Return("REDFA"));
+
+            EXPECT_CALL(route, GetPointName(2))
+                .Times(1)
+                .WillOnce(Return("EHAM"));
+
+            EXPECT_TRUE(this->defaultRules->FindIntentionCode("EHAM", route, this->code));
+            EXPECT_EQ("AM", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, AmsterdamGroupDoesNotMatchUnknownDutchAirfields)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            EXPECT_FALSE(this->defaultRules->FindIntentionCode("EHXX", route, this->code));
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, RulesAreAppliedInPriorityOrder)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            IntentionCodeRuleTable rules({
+                MakeRule({}, "EG", "", "UK"),
+                MakeRule({"EGLL"}, "", "", "LL"),
+                MakeRule({"EIDW"}, "", "", "DW"),
+                MakeRule({}, "E", "", "EU"),
+            });
+
+            EXPECT_TRUE(rules.FindIntentionCode("EGLL", route, this->code));
+            EXPECT_EQ("UK", this->code);
+            EXPECT_TRUE(rules.FindIntentionCode("EIDW", route, this->code));
+            EXPECT_EQ("DW", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, PrefixRulesMatchAllAirfieldsWithThatPrefix)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            IntentionCodeRuleTable rules({
+                MakeRule({}, "EG", "", "UK"),
+                MakeRule({}, "E", "", "EU"),
+            });
+
+            EXPECT_TRUE(rules.FindIntentionCode("EGLL", route, this->code));
+            EXPECT_EQ("UK", this->code);
+            EXPECT_TRUE(rules.FindIntentionCode("EDDF", route, this->code));
+            EXPECT_EQ("EU", this->code);
+            EXPECT_FALSE(rules.FindIntentionCode("KJFK", route, this->code));
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, LaterPrefixRulesApplyIfEarlierOnesNeedAViaPoint)
+        {
+            NiceMock<MockEuroscopeExtractedRouteInterface> route;
+            IntentionCodeRuleTable rules({
+                MakeRule({}, "E", "KOK", "EU"),
+                MakeRule({}, "EG", "", "UK"),
+            });
+
+            ON_CALL(route, GetPointsNumber())
+                .WillByDefault(Return(0));
+
+            EXPECT_TRUE(rules.FindIntentionCode("EGLL", route, this->code));
+            EXPECT_EQ("UK", this->code);
+            EXPECT_FALSE(rules.FindIntentionCode("EDDF", route, this->code));
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, AllViaPointsAreCheckedInOnePassOfTheRoute)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            IntentionCodeRuleTable rules({
+                MakeRule({"EHAM"}, "", "KOK", "AS"),
+                MakeRule({"EHAM"}, "", "REDFA", "RF"),
+                MakeRule({"EHAM"}, "", "", "AM"),
+            });
+
+            EXPECT_CALL(route, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(3));
+
+            EXPECT_CALL(route, GetPointName(0))
+                .Times(1)
+                .WillOnce(Return("EGKK"));
+
+            EXPECT_CALL(route, GetPointName(1))
+                .Times(1)
+                .WillOnce(Return("REDFA"));
+
+            EXPECT_CALL(route, GetPointName(2))
+                .Times(1)
+                .WillOnce(Return("EHAM"));
+
+            EXPECT_TRUE(rules.FindIntentionCode("EHAM", route, this->code));
+            EXPECT_EQ("RF", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, RouteScanStopsOnceAllViaPointsFound)
+        {
+            StrictMock<MockEuroscopeExtractedRouteInterface> route;
+            IntentionCodeRuleTable rules({
+                MakeRule({"EHAM"}, "", "REDFA", "RF"),
+                MakeRule({"EHAM"}, "", "KOK", "AS"),
+            });
+
+            EXPECT_CALL(route, GetPointsNumber())
+                .Times(1)
+                .WillOnce(Return(4));
+
+            EXPECT_CALL(route, GetPointName(0))
+                .Times(1)
+                .WillOnce(Return("KOK"));
+
+            EXPECT_CALL(route, GetPointName(1))
+                .Times(1)
+                .WillOnce(Return("REDFA"));
+
+            EXPECT_TRUE(rules.FindIntentionCode("EHAM", route, this->code));
+            EXPECT_EQ("RF", this->code);
+        }
+
+        TEST_F(IntentionCodeRuleTableTest, RulesWithTooManyViaPointsAreIgnored)
+        {
+            std::vector<IntentionCodeRule> ruleList;
+            std::vector<std::string> pointNames;
+            for (size_t i = 0; i <= IntentionCodeRuleTable::maxViaPoints; i++) {
+                pointNames.push_back("P" + std::to_string(i));
+                ruleList.push_back(MakeRule({"EHAM"}, "", pointNames.back(), pointNames.back()));
+            }
+            IntentionCodeRuleTable rules(ruleList);
+
+            NiceMock<MockEuroscopeExtractedRouteInterface> route;
+            ON_CALL(route, GetPointsNumber())
+                .WillByDefault(Return(1));
+
+            ON_CALL(route, GetPointName(0))
+                .WillByDefault(Return(pointNames.back().c_str()));
+
+            EXPECT_FALSE(rules.FindIntentionCode("EHAM", route, this->code));
+
+            ON_CALL(route, GetPointName(0))
+                .WillByDefault(Return(pointNames[IntentionCodeRuleTable::maxViaPoints - 1].c_str()));
+
+            EXPECT_TRUE(rules.FindIntentionCode("EHAM", route, this->code));
+            EXPECT_EQ(pointNames[IntentionCodeRuleTable::maxViaPoints - 1], this->code);
+        }
+    }  // namespace IntentionCode
+}  // namespace UKControllerPluginTest
@@ -271,5 +271,44 @@ namespace UKControllerPluginTest {
             SectorExitPoint exit("Test", "T", SectorExitPoint::outNorthEast);
             EXPECT_FALSE(exit.IsCorrectOutDirection(126.0));
         }
+
+        TEST(SectorExitPoint, IsCorrectOutDirectionReturnsFalseNotANumber)
+        {
+            SectorExitPoint exit("Test", "T", SectorExitPoint::outNorth);
+            EXPECT_FALSE(exit.IsCorrectOutDirection(std::nan("")));
+        }
+
+        TEST(SectorExitPoint, IsCorrectOutDirectionHandlesFractionsAtBoundaries)
+        {
+            SectorExitPoint exit("Test", "T", SectorExitPoint::outNorth);
+            EXPECT_TRUE(exit.IsCorrectOutDirection(54.999));
+            EXPECT_TRUE(exit.IsCorrectOutDirection(55.0));
+            EXPECT_FALSE(exit.IsCorrectOutDirection(55.001));
+            EXPECT_FALSE(exit.IsCorrectOutDirection(304.999));
+            EXPECT_TRUE(exit.IsCorrectOutDirection(305.0));
+            EXPECT_TRUE(exit.IsCorrectOutDirection(305.001));
+        }
+
+        TEST(SectorExitPoint, IsCorrectOutDirectionMatchesRangesForEveryDirectionCombination)
+        {
+            for (unsigned int outDirection = 0; outDirection < 256; outDirection++) {
+                SectorExitPoint exit("Test", "T", outDirection);
+                for (double direction = -1.0; direction <= 361.0; direction += 0.125) {
+                    bool expected = direction >= 0.0 && direction <= 360.0 && (
+                        ((outDirection & SectorExitPoint::outNorth) && (direction <= 55.0 || direction >= 305.0)) ||
+                        ((outDirection & SectorExitPoint::outEast) && direction >= 35.0 && direction <= 145.0) ||
+                        ((outDirection & SectorExitPoint::outSouth) && direction >= 125.0 && direction <= 235.0) ||
+                        ((outDirection & SectorExitPoint::outWest) && direction >= 215.0 && direction <= 325.0) ||
+                        ((outDirection & SectorExitPoint::outSouthEast) && direction >= 55.0 && direction <= 180.0) ||
+                        ((outDirection & SectorExitPoint::outSouthWest) && direction >= 180.0 && direction <= 305.0) ||
+                        ((outDirection & SectorExitPoint::outNorthWest) && direction >= 260.0) ||
+                        ((outDirection & SectorExitPoint::outNorthEast) && direction <= 125.0)
+                    );
+
+                    ASSERT_EQ(expected, exit.IsCorrectOutDirection(direction))
+                        << "Direction " << direction << " mask " << outDirection;
+                }
+            }
+        }
     }  // namespace IntentionCode
 }  // namespace UKControllerPluginTest
@@ -5,6 +5,7 @@
 #include "mock/MockEuroscopeExtractedRouteInterface.h"
 
 using UKControllerPluginTest::Euroscope::MockEuroscopeExtractedRouteInterface;
+using UKControllerPlugin::IntentionCode::SectorExitPoint;
 using UKControllerPlugin::IntentionCode::SectorExitRepository;
 using UKControllerPlugin::IntentionCode::SectorExitRepositoryFactory;
 using ::testing::NiceMock;
@@ -18,6 +19,113 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE(SectorExitRepositoryFactory::Create()->HasSectorExitPoint("KOK"));
         }
 
+        TEST(SectorExitRepository, HasSectorExitPointReturnsFalseIfPointDoesNotExist)
+        {
+            EXPECT_FALSE(SectorExitRepositoryFactory::Create()->HasSectorExitPoint("DVR"));
+        }
+
+        TEST(SectorExitRepository, FindSectorExitPointReturnsPointIfExists)
+        {
+            std::unique_ptr<SectorExitRepository> repo = SectorExitRepositoryFactory::Create();
+            ASSERT_NE(nullptr, repo->FindSectorExitPoint("LONAM"));
+            EXPECT_EQ("LONAM", repo->FindSectorExitPoint("LONAM")->GetName());
+        }
+
+        TEST(SectorExitRepository, FindSectorExitPointReturnsNullIfPointDoesNotExist)
+        {
+            EXPECT_EQ(nullptr, SectorExitRepositoryFactory::Create()->FindSectorExitPoint("LAM"));
+        }
+
+        TEST(SectorExitRepository, FindSectorExitPointReturnsNullIfPointNameEmpty)
+        {
+            EXPECT_EQ(nullptr, SectorExitRepositoryFactory::Create()->FindSectorExitPoint(""));
+        }
+
+        TEST(SectorExitRepository, FindSectorExitPointReturnsNullIfPointNameNull)
+        {
+            EXPECT_EQ(nullptr, SectorExitRepositoryFactory::Create()->FindSectorExitPoint(nullptr));
+        }
+
+        TEST(SectorExitRepository, FindSectorExitPointReturnsNullIfPointNameTooLong)
+        {
+            EXPECT_EQ(nullptr, SectorExitRepositoryFactory::Create()->FindSectorExitPoint("LONAMLONAM"));
+        }
+
+        TEST(SectorExitRepository, FindSectorExitPointFindsPointsWithLongNames)
+        {
+            std::map<std::string, std::unique_ptr<SectorExitPoint>> points;
+            points["KOK"] = std::make_unique<SectorExitPoint>("KOK", "D1", SectorExitPoint::outEast);
+            points["LONGEXITPOINT"] = std::make_unique<SectorExitPoint>(
+                "LONGEXITPOINT",
+                "X",
+                SectorExitPoint::outEast
+            );
+
+            SectorExitRepository repo(std::move(points));
+            ASSERT_NE(nullptr, repo.FindSectorExitPoint("LONGEXITPOINT"));
+            EXPECT_EQ("LONGEXITPOINT", repo.FindSectorExitPoint("LONGEXITPOINT")->GetName());
+            EXPECT_TRUE(repo.HasSectorExitPoint("LONGEXITPOINT"));
+            EXPECT_EQ(nullptr, repo.FindSectorExitPoint("LONGEXITPOIN"));
+            EXPECT_EQ("KOK", repo.FindSectorExitPoint("KOK")->GetName());
+        }
+
+        TEST(SectorExitRepository, FindSectorExitPointDoesNotMatchPrefixes)
+        {
+            std::unique_ptr<SectorExitRepository> repo = SectorExitRepositoryFactory::Create();
+            EXPECT_EQ(nullptr, repo->FindSectorExitPoint("KO"));
+            EXPECT_EQ(nullptr, repo->FindSectorExitPoint("KOKA"));
+        }
+
+        TEST(SectorExitRepository, FindSectorExitPointFindsEveryPoint)
+        {
+            std::map<std::string, std::unique_ptr<SectorExitPoint>> points;
+            std::vector<std::string> names;
+            for (char first = 'A'; first <= 'Z'; first++) {
+                for (char second = 'A'; second <= 'Z'; second += 5) {
+                    std::string name = std::string("AB") + first + second + "X";
+                    names.push_back(name);
+                    points[name] = std::make_unique<SectorExitPoint>(name, "X", SectorExitPoint::outEast);
+                }
+            }
+
+            SectorExitRepository repo(std::move(points));
+            for (std::vector<std::string>::const_iterator it = names.cbegin(); it != names.cend(); ++it) {
+                ASSERT_NE(nullptr, repo.FindSectorExitPoint(it->c_str()));
+                EXPECT_EQ(*it, repo.FindSectorExitPoint(it->c_str())->GetName());
+            }
+        }
+
+        TEST(SectorExitRepository, PackPointNamePacksOneCharacterPerByte)
+        {
+            EXPECT_EQ(0x4B4F4B, SectorExitRepository::PackPointName("KOK"));
+        }
+
+        TEST(SectorExitRepository, PackPointNameReturnsInvalidIfTooLong)
+        {
+            EXPECT_EQ(SectorExitRepository::invalidPackedName, SectorExitRepository::PackPointName("ABCDEFGHI"));
+        }
+
+        TEST(SectorExitRepository, FindSectorExitPointScansTypicalRoute)
+        {
+            std::unique_ptr<SectorExitRepository> repo = SectorExitRepositoryFactory::Create();
+            const std::vector<std::string> route = {
+                "EGLL", "CPT", "GIBSO", "SAM", "ORIVI", "ANNET", "TAKAS", "LULOX", "BESIX", "UMLER",
+                "UL155", "REMSI", "VEVAT", "PASAS", "BEXAL", "LOTEE", "MARIO", "LPPT", "BAROK", "SUPAL",
+                "ABOVE", "BUSEN", "NOLSA", "GONAN", "ERDUR", "POVOA", "LIDRO", "BADAL", "VEDEN", "LAMVO",
+                "NARTA", "XAMAX", "TOMPO", "VEBOT", "NOPMI", "ODARO", "OSDOR", "GAVOT", "AMDOK", "GMMN"
+            };
+
+            int found = 0;
+            for (std::vector<std::string>::const_iterator it = route.cbegin(); it != route.cend(); ++it) {
+                if (repo->FindSectorExitPoint(it->c_str()) != nullptr) {
+                    found++;
+                }
+            }
+
+            EXPECT_EQ(40, route.size());
+            EXPECT_EQ(3, found);
+        }
+
         TEST(SectorExitRepository, ConstructorInitialisesSectorExitPoints)
         {
             std::unique_ptr<SectorExitRepository> repo = SectorExitRepositoryFactory::Create();
@@ -458,5 +566,64 @@ namespace UKControllerPluginTest {
             ASSERT_TRUE(repo->GetSectorExitPoint("TAKAS").GetIntentionCode(mockRoute, 0, 37000).compare("A") == 0);
             ASSERT_EQ(repo->outWest | repo->outSouthWest, repo->GetSectorExitPoint("TAKAS").GetOutDirection());
         }
+
+        /*
+            Times scanning a typical 40 point route for exit points, comparing the fix index with the
+            std::map of names that it replaced. Disabled by default as it only reports timings, to run it
+            use --gtest_also_run_disabled_tests.
+        */
+        TEST(SectorExitRepository, DISABLED_FindSectorExitPointIsFasterThanAMapOfNames)
+        {
+            std::unique_ptr<SectorExitRepository> repo = SectorExitRepositoryFactory::Create();
+            const std::vector<std::string> exitPointNames = {
+                "KOK", "TRACA", "MOTOX", "SOMVA", "REDFA", "SASKI", "LONAM", "TOPPA", "ROKAN", "LAMSO", "GODOS",
+                "MOLIX", "VAXIT", "TINAC", "PETIL", "INBOB", "LESRA", "SOPTO", "PEPIN", "ORVIK", "KLONN", "ALOTI",
+                "NIVUN", "RATSU", "MATIK", "OLKER", "GONUT", "LIRKI", "GUNPA", "ATSIX", "BALIX", "ERAKA", "ADODO",
+                "GOMUP", "IBROD", "MIMKU", "NIBOG", "VATRY", "BAKUR", "SLANY", "BANBA", "EVRIN", "MOLAK", "NIPIT",
+                "ERNAN", "DEGOS", "NIMAT", "ANNET", "LIZAD", "GANTO", "SUPAP", "PEMAK", "SALCO", "MANIG", "SKESO",
+                "SKERY", "ORTAC", "LORKU", "LELNA", "NEVIL", "ANGLO", "ETRAT", "VEULE", "PETAX", "BAGSO", "BOYNE",
+                "LIPGO", "MORAG", "NORLA", "MOPAT", "SAMON", "LEDGO", "LESLU", "ARKIL", "LULOX", "TURLU", "GAPLI",
+                "RATKA", "BISKI", "TAKAS"
+            };
+            std::map<std::string, const SectorExitPoint *> namedExitPoints;
+            for (const std::string & name : exitPointNames) {
+                namedExitPoints[name] = repo->FindSectorExitPoint(name.c_str());
+            }
+
+            const std::vector<const char *> route = {
+                "EGLL", "CPT", "GIBSO", "SAM", "ORIVI", "ANNET", "TAKAS", "LULOX", "BESIX", "UMLER", "UL155",
+                "REMSI", "VEVAT", "PASAS", "BEXAL", "LOTEE", "MARIO", "LPPT", "BAROK", "SUPAL", "ABOVE", "BUSEN",
+                "NOLSA", "GONAN", "ERDUR", "POVOA", "LIDRO", "BADAL", "VEDEN", "LAMVO", "NARTA", "XAMAX", "TOMPO",
+                "VEBOT", "NOPMI", "ODARO", "OSDOR", "GAVOT", "AMDOK", "GMMN"
+            };
+
+            const int iterations = 200000;
+            size_t mapFound = 0;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                for (const char * point : route) {
+                    if (namedExitPoints.count(point) == 1 && namedExitPoints.at(point) != nullptr) {
+                        mapFound++;
+                    }
+                }
+            }
+            std::chrono::nanoseconds mapTime = std::chrono::steady_clock::now() - start;
+
+            size_t indexFound = 0;
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                for (const char * point : route) {
+                    if (repo->FindSectorExitPoint(point) != nullptr) {
+                        indexFound++;
+                    }
+                }
+            }
+            std::chrono::nanoseconds indexTime = std::chrono::steady_clock::now() - start;
+
+            RecordProperty("MapNanosecondsPerRoute", static_cast<int>(mapTime.count() / iterations));
+            RecordProperty("IndexNanosecondsPerRoute", static_cast<int>(indexTime.count() / iterations));
+            EXPECT_EQ(mapFound, indexFound);
+            EXPECT_LT(indexTime, mapTime);
+        }
     }  // namespace IntentionCode
 }  // namespace UKControllerPluginTest
@@ -110,6 +110,37 @@ namespace UKControllerPluginTest {
             EXPECT_NE(this->login.GetLoginTime(), this->login.defaultLoginTime);
         }
 
+        TEST_F(LoginTest, InitialControllerLoadEventDoesNothingIfMeNotLoaded) {
+            std::shared_ptr<NiceMock<MockEuroScopeCControllerInterface>> controller =
+                std::make_shared<NiceMock<MockEuroScopeCControllerInterface>>();
+            ON_CALL(*controller, IsCurrentUser())
+                .WillByDefault(Return(false));
+
+            ON_CALL(this->mockLoopback, GetEuroscopeConnectionStatus())
+                .WillByDefault(Return(EuroScopePlugIn::CONNECTION_TYPE_DIRECT));
+
+            this->login.InitialControllerLoadEvent({ controller });
+            EXPECT_EQ(this->login.GetLoginTime(), this->login.defaultLoginTime);
+        }
+
+        TEST_F(LoginTest, InitialControllerLoadEventDoesLoginIfMeLoaded) {
+            std::shared_ptr<NiceMock<MockEuroScopeCControllerInterface>> other =
+                std::make_shared<NiceMock<MockEuroScopeCControllerInterface>>();
+            ON_CALL(*other, IsCurrentUser())
+                .WillByDefault(Return(false));
+
+            std::shared_ptr<NiceMock<MockEuroScopeCControllerInterface>> me =
+                std::make_shared<NiceMock<MockEuroScopeCControllerInterface>>();
+            ON_CALL(*me, IsCurrentUser())
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockLoopback, GetEuroscopeConnectionStatus())
+                .WillByDefault(Return(EuroScopePlugIn::CONNECTION_TYPE_DIRECT));
+
+            this->login.InitialControllerLoadEvent({ other, me });
+            EXPECT_NE(this->login.GetLoginTime(), this->login.defaultLoginTime);
+        }
+
         TEST_F(LoginTest, IsLoggedInDirect) {
             ON_CALL(this->mockLoopback, GetEuroscopeConnectionStatus())
                 .WillByDefault(Return(EuroScopePlugIn::CONNECTION_TYPE_DIRECT));
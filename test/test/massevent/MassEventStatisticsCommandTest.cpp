@@ -0,0 +1,101 @@
+#include "pch/pch.h"
+#include "massevent/MassEventStatisticsCommand.h"
+#include "massevent/MassEvent.h"
+#include "message/UserMessager.h"
+#include "mock/MockEuroscopePluginLoopbackInterface.h"
+#include "mock/MockEuroScopeCFlightplanInterface.h"
+#include "mock/MockEuroScopeCRadarTargetInterface.h"
+#include "mock/MockInitialAltitudeEventHandler.h"
+#include "mock/MockSquawkEventHandler.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "flightplan/StoredFlightplan.h"
+
+using UKControllerPlugin::EventHandler::MassEventStatisticsCommand;
+using UKControllerPlugin::EventHandler::MassEvent;
+using UKControllerPlugin::Message::UserMessager;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
+using UKControllerPluginTest::EventHandler::MockInitialAltitudeEventHandler;
+using UKControllerPluginTest::Squawk::MockSquawkEventHandler;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::Test;
+using ::testing::_;
+
+namespace UKControllerPluginTest {
+    namespace EventHandler {
+
+        class MassEventStatisticsCommandTest : public Test
+        {
+            public:
+                MassEventStatisticsCommandTest(void)
+                    : mockFlightplan(new NiceMock<MockEuroScopeCFlightPlanInterface>),
+                    mockRadarTarget(new NiceMock<MockEuroScopeCRadarTargetInterface>),
+                    squawks(new NiceMock<MockSquawkEventHandler>),
+                    mass(mockPlugin, initialAltitudes, flightplans, squawks),
+                    messager(mockPlugin),
+                    command(mass, messager)
+                {
+                    ON_CALL(this->mockPlugin, GetFlightplanForCallsign(_))
+                        .WillByDefault(Return(this->mockFlightplan));
+
+                    ON_CALL(this->mockPlugin, GetRadarTargetForCallsign(_))
+                        .WillByDefault(Return(this->mockRadarTarget));
+
+                    for (size_t i = 0; i < MassEvent::flightplansPerTick * 2; i++) {
+                        this->flightplans.UpdatePlan(StoredFlightplan("BAW" + std::to_string(i), "EGKK", "EDDM"));
+                    }
+                }
+
+                std::shared_ptr<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+                std::shared_ptr<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+                NiceMock<MockEuroscopePluginLoopbackInterface> mockPlugin;
+                StoredFlightplanCollection flightplans;
+                std::shared_ptr<MockInitialAltitudeEventHandler> initialAltitudes;
+                std::shared_ptr<MockSquawkEventHandler> squawks;
+                MassEvent mass;
+                UserMessager messager;
+                MassEventStatisticsCommand command;
+        };
+
+        TEST_F(MassEventStatisticsCommandTest, ItIgnoresOtherCommands)
+        {
+            EXPECT_FALSE(command.ProcessCommand(".ukcp stats"));
+            EXPECT_FALSE(command.ProcessCommand(".ukcp stats massevents foo"));
+            EXPECT_FALSE(command.ProcessCommand(".ukcp stats tags"));
+        }
+
+        TEST_F(MassEventStatisticsCommandTest, ItReportsWhenNothingIsInProgress)
+        {
+            EXPECT_CALL(mockPlugin, ChatAreaMessage("UKCP_Query", "UKCP", "No mass events in progress", _, _, _, _, _))
+                .Times(1);
+
+            EXPECT_TRUE(command.ProcessCommand(".ukcp stats massevents"));
+        }
+
+        TEST_F(MassEventStatisticsCommandTest, ItReportsTheProgressOfTheQueue)
+        {
+            EXPECT_CALL(
+                mockPlugin,
+                ChatAreaMessage(
+                    "UKCP_Query",
+                    "UKCP",
+                    "Mass events 50% complete, 50 flightplans waiting, peak of 100",
+                    _,
+                    _,
+                    _,
+                    _,
+                    _
+                )
+            )
+                .Times(1);
+
+            mass.SetAllSquawks();
+            mass.TimedEventTrigger();
+            EXPECT_TRUE(command.ProcessCommand(".ukcp stats massevents"));
+        }
+    }  // namespace EventHandler
+}  // namespace UKControllerPluginTest
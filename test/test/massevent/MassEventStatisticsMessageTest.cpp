@@ -0,0 +1,62 @@
+#include "pch/pch.h"
+#include "massevent/MassEventStatisticsMessage.h"
+
+using UKControllerPlugin::EventHandler::MassEventStatisticsMessage;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace EventHandler {
+
+        class MassEventStatisticsMessageTest : public Test
+        {
+            public:
+                MassEventStatisticsMessageTest(void)
+                    : message("No mass events in progress")
+                {
+
+                }
+
+                MassEventStatisticsMessage message;
+        };
+
+        TEST_F(MassEventStatisticsMessageTest, ItUsesAHandler)
+        {
+            EXPECT_EQ("UKCP_Query", this->message.MessageHandler());
+        }
+
+        TEST_F(MassEventStatisticsMessageTest, ItHasASender)
+        {
+            EXPECT_EQ("UKCP", this->message.MessageSender());
+        }
+
+        TEST_F(MassEventStatisticsMessageTest, ItHasAMessage)
+        {
+            EXPECT_EQ("No mass events in progress", this->message.MessageString());
+        }
+
+        TEST_F(MassEventStatisticsMessageTest, ItShowsHandler)
+        {
+            EXPECT_TRUE(this->message.MessageShowHandler());
+        }
+
+        TEST_F(MassEventStatisticsMessageTest, ItMarksMessageAsUnread)
+        {
+            EXPECT_TRUE(this->message.MessageMarkUnread());
+        }
+
+        TEST_F(MassEventStatisticsMessageTest, ItOverridesBusy)
+        {
+            EXPECT_TRUE(this->message.MessageOverrideBusy());
+        }
+
+        TEST_F(MassEventStatisticsMessageTest, ItDoesntFlashTheHandler)
+        {
+            EXPECT_FALSE(this->message.MessageFlashHandler());
+        }
+
+        TEST_F(MassEventStatisticsMessageTest, ItDoesntRequireConfirmation)
+        {
+            EXPECT_FALSE(this->message.MessageRequiresConfirm());
+        }
+    }  // namespace EventHandler
+}  // namespace UKControllerPluginTest
@@ -22,6 +22,8 @@ using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::StrictMock;
 using ::testing::Ref;
+using ::testing::Throw;
+using ::testing::_;
 
 namespace UKControllerPluginTest {
     namespace EventHandler {
@@ -78,6 +80,7 @@ namespace UKControllerPluginTest {
 
             MassEvent mass(mockEuroscopePlugin, initialAltitudeEventHandler, flightplans, mockSquawkEventHandler);
             mass.SetAllInitialAltitudes();
+            mass.TimedEventTrigger();
         }
 
         TEST(MassEvent, SetAllInitialAltitudesSetsDoesNothingIfHandlerNull)
@@ -111,6 +114,7 @@ namespace UKControllerPluginTest {
 
             MassEvent mass(mockEuroscopePlugin, initialAltitudeEventHandler, flightplans, mockSquawkEventHandler);
             mass.SetAllInitialAltitudes();
+            mass.TimedEventTrigger();
         }
 
         TEST(MassEvent, SetAllSquawksSetsAll)
@@ -163,6 +167,7 @@ namespace UKControllerPluginTest {
 
             MassEvent mass(mockEuroscopePlugin, initialAltitudeEventHandler, flightplans, mockSquawkEventHandler);
             mass.SetAllSquawks();
+            mass.TimedEventTrigger();
         }
 
         TEST(MassEvent, SetAllSquawksSetDoesNothingIfHandlerNull)
@@ -195,6 +200,192 @@ namespace UKControllerPluginTest {
 
             MassEvent mass(mockEuroscopePlugin, initialAltitudeEventHandler, flightplans, mockSquawkEventHandler);
             mass.SetAllSquawks();
+            mass.TimedEventTrigger();
+        }
+
+        TEST(MassEvent, SetAllSquawksDoesNothingUntilTimedEventTriggers)
+        {
+            StrictMock<MockEuroscopePluginLoopbackInterface> mockEuroscopePlugin;
+
+            StoredFlightplanCollection flightplans;
+            flightplans.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EDDM"));
+            flightplans.UpdatePlan(StoredFlightplan("EZY456", "EGLL", "EIDW"));
+
+            std::shared_ptr<StrictMock<MockInitialAltitudeEventHandler>> initialAltitudeEventHandler;
+            std::shared_ptr<StrictMock<MockSquawkEventHandler>> mockSquawkEventHandler(
+                new StrictMock<MockSquawkEventHandler>
+            );
+
+            MassEvent mass(mockEuroscopePlugin, initialAltitudeEventHandler, flightplans, mockSquawkEventHandler);
+            mass.SetAllSquawks();
+            EXPECT_TRUE(mass.InProgress());
+            EXPECT_EQ(2, mass.GetPendingFlightplans());
+            EXPECT_EQ(0.0, mass.GetProgress());
+        }
+
+        TEST(MassEvent, TimedEventTriggerProcessesFlightplansInChunks)
+        {
+            std::shared_ptr<MockEuroScopeCFlightPlanInterface> mockFlightplan(
+                new NiceMock<MockEuroScopeCFlightPlanInterface>
+            );
+            std::shared_ptr<MockEuroScopeCRadarTargetInterface> mockRadarTarget(
+                new NiceMock<MockEuroScopeCRadarTargetInterface>
+            );
+
+            NiceMock<MockEuroscopePluginLoopbackInterface> mockEuroscopePlugin;
+            ON_CALL(mockEuroscopePlugin, GetFlightplanForCallsign(_))
+                .WillByDefault(Return(mockFlightplan));
+
+            ON_CALL(mockEuroscopePlugin, GetRadarTargetForCallsign(_))
+                .WillByDefault(Return(mockRadarTarget));
+
+            StoredFlightplanCollection flightplans;
+            for (size_t i = 0; i < MassEvent::flightplansPerTick + 10; i++) {
+                flightplans.UpdatePlan(StoredFlightplan("BAW" + std::to_string(i), "EGKK", "EDDM"));
+            }
+
+            std::shared_ptr<StrictMock<MockInitialAltitudeEventHandler>> initialAltitudeEventHandler;
+            std::shared_ptr<StrictMock<MockSquawkEventHandler>> mockSquawkEventHandler(
+                new StrictMock<MockSquawkEventHandler>
+            );
+
+            MassEvent mass(mockEuroscopePlugin, initialAltitudeEventHandler, flightplans, mockSquawkEventHandler);
+            mass.SetAllSquawks();
+
+            EXPECT_CALL(*mockSquawkEventHandler, FlightPlanEvent(Ref(*mockFlightplan), Ref(*mockRadarTarget)))
+                .Times(MassEvent::flightplansPerTick);
+            mass.TimedEventTrigger();
+            testing::Mock::VerifyAndClearExpectations(mockSquawkEventHandler.get());
+
+            EXPECT_TRUE(mass.InProgress());
+            EXPECT_EQ(10, mass.GetPendingFlightplans());
+            EXPECT_EQ(MassEvent::flightplansPerTick + 10, mass.GetPeakPendingFlightplans());
+            EXPECT_DOUBLE_EQ(
+                static_cast<double>(MassEvent::flightplansPerTick) / (MassEvent::flightplansPerTick + 10),
+                mass.GetProgress()
+            );
+
+            EXPECT_CALL(*mockSquawkEventHandler, FlightPlanEvent(Ref(*mockFlightplan), Ref(*mockRadarTarget)))
+                .Times(10);
+            mass.TimedEventTrigger();
+
+            EXPECT_FALSE(mass.InProgress());
+            EXPECT_EQ(0, mass.GetPendingFlightplans());
+            EXPECT_EQ(0, mass.GetPeakPendingFlightplans());
+            EXPECT_EQ(1.0, mass.GetProgress());
+        }
+
+        TEST(MassEvent, TimedEventTriggerRunsJobsInOrder)
+        {
+            std::shared_ptr<MockEuroScopeCFlightPlanInterface> mockFlightplan(
+                new NiceMock<MockEuroScopeCFlightPlanInterface>
+            );
+            std::shared_ptr<MockEuroScopeCRadarTargetInterface> mockRadarTarget(
+                new NiceMock<MockEuroScopeCRadarTargetInterface>
+            );
+
+            NiceMock<MockEuroscopePluginLoopbackInterface> mockEuroscopePlugin;
+            ON_CALL(mockEuroscopePlugin, GetFlightplanForCallsign("BAW123"))
+                .WillByDefault(Return(mockFlightplan));
+
+            ON_CALL(mockEuroscopePlugin, GetRadarTargetForCallsign("BAW123"))
+                .WillByDefault(Return(mockRadarTarget));
+
+            StoredFlightplanCollection flightplans;
+            flightplans.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EDDM"));
+
+            std::shared_ptr<StrictMock<MockInitialAltitudeEventHandler>> initialAltitudeEventHandler(
+                new StrictMock<MockInitialAltitudeEventHandler>
+            );
+            std::shared_ptr<StrictMock<MockSquawkEventHandler>> mockSquawkEventHandler(
+                new StrictMock<MockSquawkEventHandler>
+            );
+
+            testing::InSequence sequence;
+            EXPECT_CALL(*initialAltitudeEventHandler, FlightPlanEvent(Ref(*mockFlightplan), Ref(*mockRadarTarget)))
+                .Times(1);
+
+            EXPECT_CALL(*mockSquawkEventHandler, FlightPlanEvent(Ref(*mockFlightplan), Ref(*mockRadarTarget)))
+                .Times(1);
+
+            MassEvent mass(mockEuroscopePlugin, initialAltitudeEventHandler, flightplans, mockSquawkEventHandler);
+            mass.SetAllInitialAltitudes();
+            mass.SetAllSquawks();
+            EXPECT_EQ(2, mass.GetPendingFlightplans());
+            mass.TimedEventTrigger();
+            EXPECT_FALSE(mass.InProgress());
+        }
+
+        TEST(MassEvent, SetAllSquawksReplacesWaitingJob)
+        {
+            std::shared_ptr<MockEuroScopeCFlightPlanInterface> mockFlightplan(
+                new NiceMock<MockEuroScopeCFlightPlanInterface>
+            );
+            std::shared_ptr<MockEuroScopeCRadarTargetInterface> mockRadarTarget(
+                new NiceMock<MockEuroScopeCRadarTargetInterface>
+            );
+
+            NiceMock<MockEuroscopePluginLoopbackInterface> mockEuroscopePlugin;
+            ON_CALL(mockEuroscopePlugin, GetFlightplanForCallsign("BAW123"))
+                .WillByDefault(Return(mockFlightplan));
+
+            ON_CALL(mockEuroscopePlugin, GetRadarTargetForCallsign("BAW123"))
+                .WillByDefault(Return(mockRadarTarget));
+
+            StoredFlightplanCollection flightplans;
+            flightplans.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EDDM"));
+
+            std::shared_ptr<StrictMock<MockInitialAltitudeEventHandler>> initialAltitudeEventHandler;
+            std::shared_ptr<StrictMock<MockSquawkEventHandler>> mockSquawkEventHandler(
+                new StrictMock<MockSquawkEventHandler>
+            );
+
+            EXPECT_CALL(*mockSquawkEventHandler, FlightPlanEvent(Ref(*mockFlightplan), Ref(*mockRadarTarget)))
+                .Times(1);
+
+            MassEvent mass(mockEuroscopePlugin, initialAltitudeEventHandler, flightplans, mockSquawkEventHandler);
+            mass.SetAllSquawks();
+            mass.SetAllSquawks();
+            EXPECT_EQ(1, mass.GetPendingFlightplans());
+            EXPECT_EQ(1, mass.GetPeakPendingFlightplans());
+            mass.TimedEventTrigger();
+        }
+
+        TEST(MassEvent, TimedEventTriggerSkipsFlightplansThatHaveGone)
+        {
+            std::shared_ptr<MockEuroScopeCFlightPlanInterface> mockFlightplan(
+                new NiceMock<MockEuroScopeCFlightPlanInterface>
+            );
+            std::shared_ptr<MockEuroScopeCRadarTargetInterface> mockRadarTarget(
+                new NiceMock<MockEuroScopeCRadarTargetInterface>
+            );
+
+            NiceMock<MockEuroscopePluginLoopbackInterface> mockEuroscopePlugin;
+            ON_CALL(mockEuroscopePlugin, GetFlightplanForCallsign("BAW123"))
+                .WillByDefault(Throw(std::invalid_argument("Not found")));
+
+            ON_CALL(mockEuroscopePlugin, GetFlightplanForCallsign("EZY456"))
+                .WillByDefault(Return(mockFlightplan));
+
+            ON_CALL(mockEuroscopePlugin, GetRadarTargetForCallsign("EZY456"))
+                .WillByDefault(Return(mockRadarTarget));
+
+            StoredFlightplanCollection flightplans;
+            flightplans.UpdatePlan(StoredFlightplan("BAW123", "EGKK", "EDDM"));
+            flightplans.UpdatePlan(StoredFlightplan("EZY456", "EGLL", "EIDW"));
+
+            std::shared_ptr<StrictMock<MockInitialAltitudeEventHandler>> initialAltitudeEventHandler;
+            std::shared_ptr<StrictMock<MockSquawkEventHandler>> mockSquawkEventHandler(
+                new StrictMock<MockSquawkEventHandler>
+            );
+
+            EXPECT_CALL(*mockSquawkEventHandler, FlightPlanEvent(Ref(*mockFlightplan), Ref(*mockRadarTarget)))
+                .Times(1);
+
+            MassEvent mass(mockEuroscopePlugin, initialAltitudeEventHandler, flightplans, mockSquawkEventHandler);
+            mass.SetAllSquawks();
+            mass.TimedEventTrigger();
+            EXPECT_FALSE(mass.InProgress());
         }
     }  // namespace EventHandler
 }  // namespace UKControllerPluginTest
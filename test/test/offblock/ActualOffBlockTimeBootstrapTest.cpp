@@ -37,5 +37,11 @@ namespace UKControllerPlugin {
             ActualOffBlockTimeBootstrap::BootstrapPlugin(this->container);
             EXPECT_EQ(1, container.tagHandler->CountHandlers());
         }
+
+        TEST_F(ActualOffBlockTimeBootstrapTest, ItCachesTheTagItem)
+        {
+            ActualOffBlockTimeBootstrap::BootstrapPlugin(this->container);
+            EXPECT_TRUE(container.tagHandler->GetCache().HasItem(ActualOffBlockTimeBootstrap::tagItemId));
+        }
     }  // namespace Datablock
 }  // namespace UKControllerPlugin
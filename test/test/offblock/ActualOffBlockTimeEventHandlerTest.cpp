@@ -11,6 +11,7 @@
 #include "controller/ControllerPosition.h"
 #include "airfield/AirfieldCollection.h"
 #include "airfield/Airfield.h"
+#include "helper/HelperFunctions.h"
 
 using UKControllerPlugin::Datablock::ActualOffBlockTimeEventHandler;
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
@@ -25,6 +26,7 @@ using UKControllerPlugin::Controller::ControllerPosition;
 using UKControllerPlugin::Airfield::AirfieldCollection;
 using UKControllerPlugin::Controller::ControllerPosition;
 using UKControllerPlugin::Datablock::DisplayTime;
+using UKControllerPlugin::HelperFunctions;
 
 using ::testing::Test;
 using ::testing::NiceMock;
@@ -220,5 +222,19 @@ namespace UKControllerPluginTest {
                     this->timeFormat.FromSystemTime()
             );
         }
+
+        TEST_F(ActualOffBlockTimeEventHandlerTest, WriteTagItemDataWritesAobtIfSet)
+        {
+            char itemData[16];
+            ON_CALL(mockFlightplan, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            this->flightplans.GetFlightplanForCallsign("BAW123").SetActualOffBlockTime(
+                HelperFunctions::GetTimeFromNumberString("1234")
+            );
+
+            EXPECT_TRUE(this->handler->WriteTagItemData(this->mockFlightplan, this->mockRadarTarget, itemData));
+            EXPECT_EQ(0, strcmp("12:34", itemData));
+        }
     }  // namespace Datablock
 }  // namespace UKControllerPluginTest
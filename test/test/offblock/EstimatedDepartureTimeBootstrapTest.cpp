@@ -43,5 +43,11 @@ namespace UKControllerPlugin {
             EstimatedDepartureTimeBootstrap::BootstrapPlugin(this->container);
             EXPECT_EQ(1, container.flightplanHandler->CountHandlers());
         }
+
+        TEST_F(EstimatedDepartureTimeBootstrapTest, ItCachesTheTagItem)
+        {
+            EstimatedDepartureTimeBootstrap::BootstrapPlugin(this->container);
+            EXPECT_TRUE(container.tagHandler->GetCache().HasItem(EstimatedDepartureTimeBootstrap::tagItemId));
+        }
     }  // namespace Datablock
 }  // namespace UKControllerPlugin
@@ -93,5 +93,15 @@ TEST_F(EstimatedDepartureTimeEventHandlerTest, TestItReturnsEdt)
     EXPECT_TRUE("19:00" == this->handler.GetTagItemData(this->mockFlightplan, this->mockRadarTarget));
 }
 
+TEST_F(EstimatedDepartureTimeEventHandlerTest, TestItWritesEdt)
+{
+    char itemData[16];
+    StoredFlightplan storedPlan(this->mockFlightplan);
+    storedPlan.SetEstimatedDepartureTime(HelperFunctions::GetTimeFromNumberString("1900"));
+    this->flightplans.UpdatePlan(storedPlan);
+    EXPECT_TRUE(this->handler.WriteTagItemData(this->mockFlightplan, this->mockRadarTarget, itemData));
+    EXPECT_EQ(0, strcmp("19:00", itemData));
+}
+
 }  // namespace Datablock
 }  // namespace UKControllerPluginTest
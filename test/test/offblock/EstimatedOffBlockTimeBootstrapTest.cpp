@@ -37,5 +37,11 @@ namespace UKControllerPlugin {
             EstimatedOffBlockTimeBootstrap::BootstrapPlugin(this->container);
             EXPECT_TRUE(container.tagHandler->HasHandlerForItemId(EstimatedOffBlockTimeBootstrap::tagItemId));
         }
+
+        TEST_F(EstimatedOffBlockTimeBootstrapTest, ItCachesTheTagItem)
+        {
+            EstimatedOffBlockTimeBootstrap::BootstrapPlugin(this->container);
+            EXPECT_TRUE(container.tagHandler->GetCache().HasItem(EstimatedOffBlockTimeBootstrap::tagItemId));
+        }
     }  // namespace Datablock
 }  // namespace UKControllerPlugin
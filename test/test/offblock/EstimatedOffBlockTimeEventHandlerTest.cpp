@@ -77,5 +77,12 @@ TEST_F(EstimatedOffBlockTimeEventHandlerTest, TestItReturnsEobt)
     EXPECT_TRUE("18:45" == this->handler.GetTagItemData(this->mockFlightplan, this->mockRadarTarget));
 }
 
+TEST_F(EstimatedOffBlockTimeEventHandlerTest, TestItWritesUnknownTimeOnNoStoredPlan)
+{
+    char itemData[16];
+    EXPECT_TRUE(this->handler.WriteTagItemData(this->mockFlightplan, this->mockRadarTarget, itemData));
+    EXPECT_EQ(this->timeFormat.GetUnknownTimeFormat(), itemData);
+}
+
 }  // namespace Datablock
 }  // namespace UKControllerPluginTest
@@ -17,6 +17,7 @@
 #include "controller/ActiveCallsign.h"
 #include "mock/MockApiInterface.h"
 #include "api/ApiNotFoundException.h"
+#include "api/ApiUnavailableException.h"
 #include "squawk/ApiSquawkAllocation.h"
 #include "squawk/ApiSquawkAllocationHandler.h"
 
@@ -39,6 +40,7 @@ using UKControllerPlugin::Controller::ActiveCallsign;
 using UKControllerPlugin::Controller::ControllerPosition;
 using UKControllerPluginTest::Api::MockApiInterface;
 using UKControllerPlugin::Api::ApiNotFoundException;
+using UKControllerPlugin::Api::ApiUnavailableException;
 using UKControllerPlugin::Squawk::ApiSquawkAllocation;
 using UKControllerPlugin::Squawk::ApiSquawkAllocationHandler;
 using ::testing::NiceMock;
@@ -219,6 +221,39 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(1, this->squawkAllocationHandler->Count());
         }
 
+        TEST_F(SquawkGeneratorTest, GeneralSquawkDoesntCreateAssignmentIfApiUnavailable)
+        {
+            ON_CALL(*this->mockFlightplan, GetCallsign())
+                .WillByDefault(Return("BAW1252"));
+
+            ON_CALL(*this->mockFlightplan, IsTrackedByUser())
+                .WillByDefault(Return(true));
+
+            ON_CALL(*this->mockFlightplan, HasAssignedSquawk())
+                .WillByDefault(Return(false));
+
+            ON_CALL(*this->mockFlightplan, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            ON_CALL(*this->mockFlightplan, GetDestination())
+                .WillByDefault(Return("EGPF"));
+
+            EXPECT_CALL(*this->mockFlightplan, SetSquawk(this->generator->PROCESS_SQUAWK))
+                .WillRepeatedly(Return());
+
+            EXPECT_CALL(this->api, GetAssignedSquawk("BAW1252"))
+                .Times(1)
+                .WillOnce(Throw(ApiUnavailableException("Unavailable")));
+
+            EXPECT_CALL(this->api, CreateGeneralSquawkAssignment(_, _, _))
+                .Times(0);
+
+            EXPECT_TRUE(
+                this->generator->RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget)
+            );
+            EXPECT_EQ(0, this->squawkAllocationHandler->Count());
+        }
+
         TEST_F(SquawkGeneratorTest, GeneralSquawkForcesSquawkWhereNecessary)
         {
             StoredFlightplan storedPlan("BAW1252", "EGKK", "EGPH");
@@ -409,6 +444,45 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(1, this->squawkAllocationHandler->Count());
         }
 
+        TEST_F(SquawkGeneratorTest, LocalSquawkDoesntCreateAssignmentIfApiUnavailable)
+        {
+            ON_CALL(*this->mockFlightplan, GetCallsign())
+                .WillByDefault(Return("BAW1252"));
+
+            ON_CALL(*this->mockFlightplan, IsTrackedByUser())
+                .WillByDefault(Return(true));
+
+            ON_CALL(*this->mockFlightplan, HasAssignedSquawk())
+                .WillByDefault(Return(false));
+
+            ON_CALL(*this->mockRadarTarget, GetPosition())
+                .WillByDefault(Return(EuroScopePlugIn::CPosition()));
+
+            ON_CALL(*this->mockRadarTarget, GetFlightLevel())
+                .WillByDefault(Return(1));
+
+            ON_CALL(this->pluginLoopback, GetDistanceFromUserVisibilityCentre(_))
+                .WillByDefault(Return(1));
+
+            ON_CALL(*this->mockFlightplan, GetFlightRules())
+                .WillByDefault(Return("I"));
+
+            EXPECT_CALL(*this->mockFlightplan, SetSquawk(this->generator->PROCESS_SQUAWK))
+                .WillRepeatedly(Return());
+
+            EXPECT_CALL(this->api, GetAssignedSquawk("BAW1252"))
+                .Times(1)
+                .WillOnce(Throw(ApiUnavailableException("Unavailable")));
+
+            EXPECT_CALL(this->api, CreateLocalSquawkAssignment(_, _, _))
+                .Times(0);
+
+            EXPECT_TRUE(
+                this->generator->RequestLocalSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget)
+            );
+            EXPECT_EQ(0, this->squawkAllocationHandler->Count());
+        }
+
         TEST_F(SquawkGeneratorTest, LocalSquawkReturnsTrueOnAction)
         {
             ON_CALL(*this->mockFlightplan, GetCallsign())
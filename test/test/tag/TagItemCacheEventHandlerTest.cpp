@@ -0,0 +1,73 @@
+#include "pch/pch.h"
+#include "tag/TagItemCacheEventHandler.h"
+#include "tag/TagItemCache.h"
+#include "mock/MockEuroScopeCFlightplanInterface.h"
+#include "mock/MockEuroScopeCRadarTargetInterface.h"
+#include "mock/MockUserSettingProviderInterface.h"
+#include "euroscope/UserSetting.h"
+
+using UKControllerPlugin::Tag::TagItemCacheEventHandler;
+using UKControllerPlugin::Tag::TagItemCache;
+using UKControllerPlugin::Euroscope::UserSetting;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
+using UKControllerPluginTest::Euroscope::MockUserSettingProviderInterface;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Tag {
+
+        class TagItemCacheEventHandlerTest : public Test
+        {
+            public:
+                TagItemCacheEventHandlerTest(void)
+                    : handler(cache), userSetting(mockUserSettingProvider)
+                {
+                    ON_CALL(mockFlightplan, GetCallsign())
+                        .WillByDefault(Return("BAW123"));
+
+                    cache.AddItem(1);
+                    cache.SetValue(1, "BAW123", "testdata");
+                    cache.SetValue(1, "BAW456", "testdata");
+                }
+
+                char itemData[16];
+                TagItemCache cache;
+                TagItemCacheEventHandler handler;
+                NiceMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+                NiceMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+                NiceMock<MockUserSettingProviderInterface> mockUserSettingProvider;
+                UserSetting userSetting;
+        };
+
+        TEST_F(TagItemCacheEventHandlerTest, FlightplanEventsInvalidateTheAircraft)
+        {
+            handler.FlightPlanEvent(mockFlightplan, mockRadarTarget);
+            EXPECT_FALSE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_TRUE(cache.GetValue(1, "BAW456", itemData));
+        }
+
+        TEST_F(TagItemCacheEventHandlerTest, ControllerDataEventsInvalidateTheAircraft)
+        {
+            handler.ControllerFlightPlanDataEvent(mockFlightplan, 1);
+            EXPECT_FALSE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_TRUE(cache.GetValue(1, "BAW456", itemData));
+        }
+
+        TEST_F(TagItemCacheEventHandlerTest, DisconnectEventsRemoveTheAircraft)
+        {
+            handler.FlightPlanDisconnectEvent(mockFlightplan);
+            EXPECT_EQ(1, cache.CountAircraft());
+            EXPECT_FALSE(cache.GetValue(1, "BAW123", itemData));
+        }
+
+        TEST_F(TagItemCacheEventHandlerTest, UserSettingsUpdatesInvalidateEverything)
+        {
+            handler.UserSettingsUpdated(userSetting);
+            EXPECT_FALSE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_FALSE(cache.GetValue(1, "BAW456", itemData));
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPluginTest
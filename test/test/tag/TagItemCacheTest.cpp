@@ -0,0 +1,199 @@
+#include "pch/pch.h"
+#include "tag/TagItemCache.h"
+
+using UKControllerPlugin::Tag::TagItemCache;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Tag {
+
+        class TagItemCacheTest : public Test
+        {
+            public:
+                TagItemCacheTest(void)
+                {
+                    cache.AddItem(1);
+                    cache.AddItem(5);
+                }
+
+                char itemData[16];
+                TagItemCache cache;
+        };
+
+        TEST_F(TagItemCacheTest, ItHasItems)
+        {
+            EXPECT_TRUE(cache.HasItem(1));
+            EXPECT_TRUE(cache.HasItem(5));
+        }
+
+        TEST_F(TagItemCacheTest, ItDoesntHaveItemsThatArentAdded)
+        {
+            EXPECT_FALSE(cache.HasItem(2));
+            EXPECT_FALSE(cache.HasItem(6));
+            EXPECT_FALSE(cache.HasItem(-1));
+        }
+
+        TEST_F(TagItemCacheTest, ItIgnoresNegativeItems)
+        {
+            cache.AddItem(-1);
+            EXPECT_FALSE(cache.HasItem(-1));
+        }
+
+        TEST_F(TagItemCacheTest, ItStartsWithNoAircraft)
+        {
+            EXPECT_EQ(0, cache.CountAircraft());
+        }
+
+        TEST_F(TagItemCacheTest, ItStartsWithNoHitsOrMisses)
+        {
+            EXPECT_EQ(0, cache.CountHits());
+            EXPECT_EQ(0, cache.CountMisses());
+            EXPECT_EQ(0.0, cache.GetHitRatio());
+        }
+
+        TEST_F(TagItemCacheTest, GetValueMissesIfNothingCached)
+        {
+            EXPECT_FALSE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_EQ(1, cache.CountMisses());
+        }
+
+        TEST_F(TagItemCacheTest, GetValueReturnsCachedValue)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            EXPECT_TRUE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_EQ(0, strcmp("testdata", itemData));
+            EXPECT_EQ(1, cache.CountHits());
+            EXPECT_EQ(1, cache.CountAircraft());
+        }
+
+        TEST_F(TagItemCacheTest, GetValueReturnsWhetherCachedValueIsValid)
+        {
+            bool valid = false;
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.SetValue(5, "BAW123", "INVALID", false);
+            EXPECT_TRUE(cache.GetValue(1, "BAW123", itemData, valid));
+            EXPECT_TRUE(valid);
+            EXPECT_TRUE(cache.GetValue(5, "BAW123", itemData, valid));
+            EXPECT_FALSE(valid);
+            EXPECT_EQ(0, strcmp("INVALID", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, GetValueMissesForOtherItems)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            EXPECT_FALSE(cache.GetValue(5, "BAW123", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, GetValueMissesForOtherAircraft)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            EXPECT_FALSE(cache.GetValue(1, "BAW456", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, ItDoesntCacheItemsThatArentAdded)
+        {
+            cache.SetValue(2, "BAW123", "testdata");
+            EXPECT_FALSE(cache.GetValue(2, "BAW123", itemData));
+            EXPECT_EQ(0, cache.CountAircraft());
+            EXPECT_EQ(0, cache.CountMisses());
+        }
+
+        TEST_F(TagItemCacheTest, SetValueReplacesExistingValue)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.SetValue(1, "BAW123", "newdata");
+            EXPECT_TRUE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_EQ(0, strcmp("newdata", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, ItCachesItemsAddedAfterValuesSet)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.AddItem(10);
+            cache.SetValue(10, "BAW123", "moredata");
+            EXPECT_TRUE(cache.GetValue(10, "BAW123", itemData));
+            EXPECT_EQ(0, strcmp("moredata", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, InvalidateAircraftInvalidatesAllItemsForAircraft)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.SetValue(5, "BAW123", "testdata");
+            cache.SetValue(1, "BAW456", "testdata");
+            cache.InvalidateAircraft("BAW123");
+            EXPECT_FALSE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_FALSE(cache.GetValue(5, "BAW123", itemData));
+            EXPECT_TRUE(cache.GetValue(1, "BAW456", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, ValuesSetAfterAircraftInvalidatedAreValid)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.InvalidateAircraft("BAW123");
+            cache.SetValue(1, "BAW123", "newdata");
+            EXPECT_TRUE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_EQ(0, strcmp("newdata", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, InvalidateItemInvalidatesItemForAllAircraft)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.SetValue(1, "BAW456", "testdata");
+            cache.SetValue(5, "BAW123", "testdata");
+            cache.InvalidateItem(1);
+            EXPECT_FALSE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_FALSE(cache.GetValue(1, "BAW456", itemData));
+            EXPECT_TRUE(cache.GetValue(5, "BAW123", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, InvalidateItemForAircraftInvalidatesOneValue)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.SetValue(1, "BAW456", "testdata");
+            cache.SetValue(5, "BAW123", "testdata");
+            cache.InvalidateItemForAircraft(1, "BAW123");
+            EXPECT_FALSE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_TRUE(cache.GetValue(1, "BAW456", itemData));
+            EXPECT_TRUE(cache.GetValue(5, "BAW123", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, InvalidateAllInvalidatesEverything)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.SetValue(5, "BAW456", "testdata");
+            cache.InvalidateAll();
+            EXPECT_FALSE(cache.GetValue(1, "BAW123", itemData));
+            EXPECT_FALSE(cache.GetValue(5, "BAW456", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, InvalidatingUnknownThingsDoesNothing)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.InvalidateAircraft("BAW456");
+            cache.InvalidateItem(2);
+            cache.InvalidateItemForAircraft(2, "BAW123");
+            cache.InvalidateItemForAircraft(1, "BAW456");
+            EXPECT_TRUE(cache.GetValue(1, "BAW123", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, RemoveAircraftRemovesValues)
+        {
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.RemoveAircraft("BAW123");
+            EXPECT_EQ(0, cache.CountAircraft());
+            EXPECT_FALSE(cache.GetValue(1, "BAW123", itemData));
+        }
+
+        TEST_F(TagItemCacheTest, ItCalculatesHitRatio)
+        {
+            cache.GetValue(1, "BAW123", itemData);
+            cache.SetValue(1, "BAW123", "testdata");
+            cache.GetValue(1, "BAW123", itemData);
+            cache.GetValue(1, "BAW123", itemData);
+            cache.GetValue(1, "BAW123", itemData);
+            EXPECT_EQ(3, cache.CountHits());
+            EXPECT_EQ(1, cache.CountMisses());
+            EXPECT_DOUBLE_EQ(0.75, cache.GetHitRatio());
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPluginTest
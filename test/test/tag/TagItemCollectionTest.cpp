@@ -1,11 +1,14 @@
 #include "pch/pch.h"
 #include "tag/TagItemCollection.h"
 #include "tag/TagItemInterface.h"
+#include "tag/TagItemWriterInterface.h"
 #include "mock/MockEuroScopeCFlightplanInterface.h"
 #include "mock/MockEuroScopeCRadarTargetInterface.h"
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
 #include "mock/MockEuroscopePluginLoopbackInterface.h"
+#include "datablock/DisplayTime.h"
+#include "helper/AllocationCounter.h"
 
 using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
 using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
@@ -13,7 +16,9 @@ using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
 using UKControllerPlugin::Tag::TagItemCollection;
+using UKControllerPlugin::Datablock::DisplayTime;
 using ::testing::StrictMock;
+using ::testing::Return;
 
 namespace UKControllerPluginTest {
     namespace Tag {
@@ -35,12 +40,48 @@ namespace UKControllerPluginTest {
                 std::string GetTagItemData(
                     EuroScopeCFlightPlanInterface & flightPlan, EuroScopeCRadarTargetInterface & radarTarget
                 ) {
+                    this->renders++;
                     return this->data;
                 }
 
                 // Tag item description
                 const std::string desc;
 
+                // How many times the data has been requested
+                int renders = 0;
+
+                // Tag item data
+                const std::string data;
+        };
+
+        class FakeTagItemWriter : public UKControllerPlugin::Tag::TagItemWriterInterface
+        {
+            public:
+                explicit FakeTagItemWriter(std::string data)
+                    : data(data)
+                {
+
+                }
+
+                std::string GetTagItemDescription(void) const
+                {
+                    return "testdesc";
+                }
+
+                std::string GetTagItemData(
+                    EuroScopeCFlightPlanInterface & flightPlan, EuroScopeCRadarTargetInterface & radarTarget
+                ) {
+                    return "stringdata";
+                }
+
+                bool WriteTagItemData(
+                    EuroScopeCFlightPlanInterface & flightPlan,
+                    EuroScopeCRadarTargetInterface & radarTarget,
+                    char itemData[16]
+                ) {
+                    return this->CopyItemData(this->data, itemData);
+                }
+
                 // Tag item data
                 const std::string data;
         };
@@ -144,5 +185,325 @@ namespace UKControllerPluginTest {
             collection.RegisterTagItem(5, std::make_shared<FakeTagItem>("testdesc", "testdata"));
             EXPECT_TRUE(collection.HasHandlerForItemId(5));
         }
+
+        TEST(TagItemCollection, RegisterTagItemThrowsExceptionIfIdNegative)
+        {
+            TagItemCollection collection;
+            EXPECT_THROW(
+                collection.RegisterTagItem(-1, std::make_shared<FakeTagItem>("testdesc", "testdata")),
+                std::invalid_argument
+            );
+            EXPECT_EQ(0, collection.CountHandlers());
+        }
+
+        TEST(TagItemCollection, RegisterTagItemThrowsExceptionIfIdTooLarge)
+        {
+            TagItemCollection collection;
+            EXPECT_THROW(
+                collection.RegisterTagItem(
+                    TagItemCollection::maxTagItemId + 1,
+                    std::make_shared<FakeTagItem>("testdesc", "testdata")
+                ),
+                std::invalid_argument
+            );
+            EXPECT_EQ(0, collection.CountHandlers());
+        }
+
+        TEST(TagItemCollection, TagItemUpdateReturnsErrorIfIdBelowHighestRegistered)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            char test[16];
+            collection.RegisterTagItem(5, std::make_shared<FakeTagItem>("testdesc", "testdata"));
+            collection.TagItemUpdate(3, test, mockFlightplan, mockRadarTarget);
+            EXPECT_EQ(0, collection.errorTagItemText.compare(test));
+        }
+
+        TEST(TagItemCollection, TagItemUpdateReturnsErrorIfIdNegative)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            char test[16];
+            collection.RegisterTagItem(1, std::make_shared<FakeTagItem>("testdesc", "testdata"));
+            collection.TagItemUpdate(-1, test, mockFlightplan, mockRadarTarget);
+            EXPECT_EQ(0, collection.errorTagItemText.compare(test));
+        }
+
+        TEST(TagItemCollection, TagItemUpdateWritesDirectlyIfItemIsWriter)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            char test[16];
+            collection.RegisterTagItem(1, std::make_shared<FakeTagItemWriter>("123456789012345"));
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+
+            EXPECT_EQ(0, strcmp("123456789012345", test));
+        }
+
+        TEST(TagItemCollection, TagItemUpdateDisplaysInvalidIfWriterDataTooLarge)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            char test[16];
+            collection.RegisterTagItem(1, std::make_shared<FakeTagItemWriter>("1234567890123456"));
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+
+            EXPECT_EQ(0, collection.invalidItemText.compare(test));
+        }
+
+        TEST(TagItemCollection, RegisterCachedTagItemAddsItemToCache)
+        {
+            TagItemCollection collection;
+            collection.RegisterCachedTagItem(1, std::make_shared<FakeTagItem>("testdesc", "testdata"));
+            EXPECT_TRUE(collection.HasHandlerForItemId(1));
+            EXPECT_TRUE(collection.GetCache().HasItem(1));
+        }
+
+        TEST(TagItemCollection, RegisterTagItemDoesNotAddItemToCache)
+        {
+            TagItemCollection collection;
+            collection.RegisterTagItem(1, std::make_shared<FakeTagItem>("testdesc", "testdata"));
+            EXPECT_FALSE(collection.GetCache().HasItem(1));
+        }
+
+        TEST(TagItemCollection, TagItemUpdateRendersCachedItemsOnce)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetCallsign())
+                .Times(2)
+                .WillRepeatedly(Return("BAW123"));
+
+            std::shared_ptr<FakeTagItem> item = std::make_shared<FakeTagItem>("testdesc", "testdata");
+            collection.RegisterCachedTagItem(1, item);
+
+            char test[16];
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+            EXPECT_EQ(0, strcmp("testdata", test));
+
+            char test2[16];
+            collection.TagItemUpdate(1, test2, mockFlightplan, mockRadarTarget);
+            EXPECT_EQ(0, strcmp("testdata", test2));
+            EXPECT_EQ(1, item->renders);
+            EXPECT_EQ(1, collection.GetCache().CountHits());
+        }
+
+        TEST(TagItemCollection, TagItemUpdateRendersCachedItemsAgainOnceInvalidated)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetCallsign())
+                .Times(2)
+                .WillRepeatedly(Return("BAW123"));
+
+            std::shared_ptr<FakeTagItem> item = std::make_shared<FakeTagItem>("testdesc", "testdata");
+            collection.RegisterCachedTagItem(1, item);
+
+            char test[16];
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+            collection.GetCache().InvalidateAircraft("BAW123");
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+            EXPECT_EQ(2, item->renders);
+        }
+
+        TEST(TagItemCollection, TagItemUpdateCachesInvalidItems)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetCallsign())
+                .Times(2)
+                .WillRepeatedly(Return("BAW123"));
+
+            collection.RegisterCachedTagItem(
+                1,
+                std::make_shared<FakeTagItem>("testdesc", "thisdataistoolongforthetagitem")
+            );
+
+            char test[16];
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+            char test2[16];
+            collection.TagItemUpdate(1, test2, mockFlightplan, mockRadarTarget);
+            EXPECT_EQ(0, collection.invalidItemText.compare(test2));
+        }
+
+        TEST(TagItemCollection, TagItemUpdateDoesntRecordStatisticsByDefault)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            char test[16];
+            collection.RegisterTagItem(1, std::make_shared<FakeTagItem>("testdesc", "testdata"));
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+
+            EXPECT_TRUE(collection.GetStatistics().GetStatistics().empty());
+        }
+
+        TEST(TagItemCollection, TagItemUpdateRecordsStatisticsIfEnabled)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            char test[16];
+            collection.GetStatistics().Enable();
+            collection.RegisterTagItem(1, std::make_shared<FakeTagItem>("testdesc", "testdata"));
+            collection.RegisterTagItem(2, std::make_shared<FakeTagItemWriter>("1234567890123456"));
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+            collection.TagItemUpdate(2, test, mockFlightplan, mockRadarTarget);
+
+            auto statistics = collection.GetStatistics().GetStatistics();
+            ASSERT_EQ(2, statistics.size());
+            auto item1 = statistics[0].itemId == 1 ? statistics[0] : statistics[1];
+            auto item2 = statistics[0].itemId == 2 ? statistics[0] : statistics[1];
+            EXPECT_EQ(2, item1.calls);
+            EXPECT_EQ(0, item1.invalid);
+            EXPECT_EQ(1, item2.calls);
+            EXPECT_EQ(1, item2.invalid);
+        }
+
+        TEST(TagItemCollection, TagItemUpdateRecordsCachedInvalidItemsAsInvalid)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            EXPECT_CALL(mockFlightplan, GetCallsign())
+                .Times(4)
+                .WillRepeatedly(Return("BAW123"));
+
+            char test[16];
+            collection.GetStatistics().Enable();
+            collection.RegisterCachedTagItem(1, std::make_shared<FakeTagItem>("testdesc", "testdata"));
+            collection.RegisterCachedTagItem(
+                2,
+                std::make_shared<FakeTagItem>("testdesc", "thisdataistoolongforthetagitem")
+            );
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+            collection.TagItemUpdate(1, test, mockFlightplan, mockRadarTarget);
+            collection.TagItemUpdate(2, test, mockFlightplan, mockRadarTarget);
+            collection.TagItemUpdate(2, test, mockFlightplan, mockRadarTarget);
+
+            auto statistics = collection.GetStatistics().GetStatistics();
+            ASSERT_EQ(2, statistics.size());
+            auto item1 = statistics[0].itemId == 1 ? statistics[0] : statistics[1];
+            auto item2 = statistics[0].itemId == 2 ? statistics[0] : statistics[1];
+            EXPECT_EQ(2, item1.calls);
+            EXPECT_EQ(0, item1.invalid);
+            EXPECT_EQ(2, item2.calls);
+            EXPECT_EQ(2, item2.invalid);
+            EXPECT_EQ(2, collection.GetCache().CountHits());
+        }
+
+        /*
+            A time item that formats its time as a string, as the EOBT, AOBT and EDT items did
+            before they could write straight into the buffer.
+        */
+        class FakeTimeStringTagItem : public UKControllerPlugin::Tag::TagItemInterface
+        {
+            public:
+                std::string GetTagItemDescription(void) const
+                {
+                    return "testdesc";
+                }
+
+                std::string GetTagItemData(
+                    EuroScopeCFlightPlanInterface & flightPlan, EuroScopeCRadarTargetInterface & radarTarget
+                ) {
+                    return this->displayTime.FromTimePoint(this->time);
+                }
+
+                DisplayTime displayTime;
+                const std::chrono::system_clock::time_point time = std::chrono::system_clock::from_time_t(1234567);
+        };
+
+        /*
+            A time item that writes its time straight into the buffer.
+        */
+        class FakeTimeWriterTagItem : public UKControllerPlugin::Tag::TagItemWriterInterface
+        {
+            public:
+                std::string GetTagItemDescription(void) const
+                {
+                    return "testdesc";
+                }
+
+                std::string GetTagItemData(
+                    EuroScopeCFlightPlanInterface & flightPlan, EuroScopeCRadarTargetInterface & radarTarget
+                ) {
+                    return this->displayTime.FromTimePoint(this->time);
+                }
+
+                bool WriteTagItemData(
+                    EuroScopeCFlightPlanInterface & flightPlan,
+                    EuroScopeCRadarTargetInterface & radarTarget,
+                    char itemData[16]
+                ) {
+                    this->displayTime.WriteTimePoint(this->time, itemData, itemDataSize);
+                    return true;
+                }
+
+                DisplayTime displayTime;
+                const std::chrono::system_clock::time_point time = std::chrono::system_clock::from_time_t(1234567);
+        };
+
+        /*
+            Counts the allocations and time taken to update a time item through the string path and the
+            writer path. Disabled by default as it only reports measurements, to run it
+            use --gtest_also_run_disabled_tests.
+        */
+        TEST(TagItemCollection, DISABLED_TagItemUpdateAllocatesLessForWriterItems)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            char stringData[16];
+            char writerData[16];
+            collection.RegisterTagItem(1, std::make_shared<FakeTimeStringTagItem>());
+            collection.RegisterTagItem(2, std::make_shared<FakeTimeWriterTagItem>());
+
+            const int iterations = 100000;
+            size_t allocations = CountAllocations();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                collection.TagItemUpdate(1, stringData, mockFlightplan, mockRadarTarget);
+            }
+            std::chrono::nanoseconds stringTime = std::chrono::steady_clock::now() - start;
+            size_t stringAllocations = CountAllocations() - allocations;
+
+            allocations = CountAllocations();
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                collection.TagItemUpdate(2, writerData, mockFlightplan, mockRadarTarget);
+            }
+            std::chrono::nanoseconds writerTime = std::chrono::steady_clock::now() - start;
+            size_t writerAllocations = CountAllocations() - allocations;
+
+            RecordProperty("Updates", iterations);
+            RecordProperty("StringAllocations", static_cast<int>(stringAllocations));
+            RecordProperty("WriterAllocations", static_cast<int>(writerAllocations));
+            RecordProperty("StringNanosecondsPerUpdate", static_cast<int>(stringTime.count() / iterations));
+            RecordProperty("WriterNanosecondsPerUpdate", static_cast<int>(writerTime.count() / iterations));
+            EXPECT_EQ(0, strcmp(stringData, writerData));
+            EXPECT_EQ(0, writerAllocations);
+            EXPECT_LT(writerTime, stringTime);
+        }
+
+        TEST(TagItemCollection, TagItemUpdateDoesntRecordStatisticsForUnknownItems)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            char test[16];
+            collection.GetStatistics().Enable();
+            collection.TagItemUpdate(25, test, mockFlightplan, mockRadarTarget);
+
+            EXPECT_TRUE(collection.GetStatistics().GetStatistics().empty());
+        }
     }  // namespace Tag
 }  // namespace UKControllerPluginTest
@@ -0,0 +1,34 @@
+#include "pch/pch.h"
+#include "tag/TagItemStatisticsBootstrap.h"
+#include "bootstrap/PersistenceContainer.h"
+#include "mock/MockEuroscopePluginLoopbackInterface.h"
+#include "mock/MockWinApi.h"
+
+using UKControllerPlugin::Bootstrap::PersistenceContainer;
+using UKControllerPlugin::Tag::TagItemStatisticsBootstrap;
+using UKControllerPlugin::Tag::TagItemCollection;
+using UKControllerPlugin::Command::CommandHandlerCollection;
+using UKControllerPlugin::Message::UserMessager;
+using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
+using UKControllerPluginTest::Windows::MockWinApi;
+using ::testing::NiceMock;
+
+namespace UKControllerPluginTest {
+    namespace Tag {
+
+        TEST(TagItemStatisticsBootstrap, BootstrapPluginRegistersCommand)
+        {
+            NiceMock<MockEuroscopePluginLoopbackInterface> mockPlugin;
+            PersistenceContainer container;
+            container.tagHandler.reset(new TagItemCollection);
+            container.commandHandlers.reset(new CommandHandlerCollection);
+            container.userMessager.reset(new UserMessager(mockPlugin));
+            container.windows.reset(new NiceMock<MockWinApi>);
+
+            TagItemStatisticsBootstrap::BootstrapPlugin(container);
+            EXPECT_EQ(1, container.commandHandlers->CountHandlers());
+            EXPECT_TRUE(container.commandHandlers->ProcessCommand(".ukcp stats tags on"));
+            EXPECT_TRUE(container.tagHandler->GetStatistics().IsEnabled());
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPluginTest
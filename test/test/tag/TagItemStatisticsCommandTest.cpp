@@ -0,0 +1,131 @@
+#include "pch/pch.h"
+#include "tag/TagItemStatisticsCommand.h"
+#include "tag/TagItemStatistics.h"
+#include "message/UserMessager.h"
+#include "mock/MockEuroscopePluginLoopbackInterface.h"
+#include "mock/MockWinApi.h"
+
+using UKControllerPlugin::Tag::TagItemStatisticsCommand;
+using UKControllerPlugin::Tag::TagItemStatistics;
+using UKControllerPlugin::Message::UserMessager;
+using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
+using UKControllerPluginTest::Windows::MockWinApi;
+using ::testing::NiceMock;
+using ::testing::StrictMock;
+using ::testing::Test;
+using ::testing::_;
+
+namespace UKControllerPluginTest {
+    namespace Tag {
+
+        class TagItemStatisticsCommandTest : public Test
+        {
+            public:
+                TagItemStatisticsCommandTest(void)
+                    : messager(mockPlugin), command(statistics, messager, mockWinApi)
+                {
+
+                }
+
+                TagItemStatistics statistics;
+                NiceMock<MockEuroscopePluginLoopbackInterface> mockPlugin;
+                StrictMock<MockWinApi> mockWinApi;
+                UserMessager messager;
+                TagItemStatisticsCommand command;
+        };
+
+        TEST_F(TagItemStatisticsCommandTest, ItIgnoresOtherCommands)
+        {
+            EXPECT_FALSE(command.ProcessCommand(".ukcp stats"));
+            EXPECT_FALSE(command.ProcessCommand(".ukcp stats tags foo"));
+            EXPECT_FALSE(command.ProcessCommand(".ukcp g"));
+        }
+
+        TEST_F(TagItemStatisticsCommandTest, ItEnablesStatistics)
+        {
+            EXPECT_CALL(mockPlugin, ChatAreaMessage(_, _, "Tag item statistics enabled", _, _, _, _, _))
+                .Times(1);
+
+            EXPECT_TRUE(command.ProcessCommand(".ukcp stats tags on"));
+            EXPECT_TRUE(statistics.IsEnabled());
+        }
+
+        TEST_F(TagItemStatisticsCommandTest, ItDisablesStatistics)
+        {
+            EXPECT_CALL(mockPlugin, ChatAreaMessage(_, _, "Tag item statistics disabled", _, _, _, _, _))
+                .Times(1);
+
+            statistics.Enable();
+            EXPECT_TRUE(command.ProcessCommand(".ukcp stats tags off"));
+            EXPECT_FALSE(statistics.IsEnabled());
+        }
+
+        TEST_F(TagItemStatisticsCommandTest, ItResetsStatistics)
+        {
+            EXPECT_CALL(mockPlugin, ChatAreaMessage(_, _, "Tag item statistics reset", _, _, _, _, _))
+                .Times(1);
+
+            statistics.Record(1, 100, false);
+            EXPECT_TRUE(command.ProcessCommand(".ukcp stats tags reset"));
+            EXPECT_TRUE(statistics.GetStatistics().empty());
+        }
+
+        TEST_F(TagItemStatisticsCommandTest, ItReportsWhenDisabled)
+        {
+            EXPECT_CALL(
+                mockPlugin,
+                ChatAreaMessage(
+                    _,
+                    _,
+                    "Tag item statistics are disabled, use .ukcp stats tags on to enable",
+                    _,
+                    _,
+                    _,
+                    _,
+                    _
+                )
+            )
+                .Times(1);
+
+            EXPECT_TRUE(command.ProcessCommand(".ukcp stats tags"));
+        }
+
+        TEST_F(TagItemStatisticsCommandTest, ItReportsWhenNothingRecorded)
+        {
+            EXPECT_CALL(mockPlugin, ChatAreaMessage(_, _, "No tag item statistics recorded", _, _, _, _, _))
+                .Times(1);
+
+            statistics.Enable();
+            EXPECT_TRUE(command.ProcessCommand(".ukcp stats tags"));
+        }
+
+        TEST_F(TagItemStatisticsCommandTest, ItSendsALinePerItem)
+        {
+            EXPECT_CALL(mockPlugin, ChatAreaMessage("UKCP_Query", "UKCP", _, _, _, _, _, _))
+                .Times(2);
+
+            statistics.Record(1, 100, false);
+            statistics.Record(2, 100, false);
+            EXPECT_TRUE(command.ProcessCommand(".ukcp stats tags"));
+        }
+
+        TEST_F(TagItemStatisticsCommandTest, ItDumpsStatisticsToFile)
+        {
+            statistics.Record(1, 100, false);
+            statistics.Record(2, 50, false);
+            std::string expected = "Item 1: 1 calls, 100ns total, 100ns mean, 100ns p99, 100ns max, 0 invalid\n"
+                "Item 2: 1 calls, 50ns total, 50ns mean, 50ns p99, 50ns max, 0 invalid\n";
+
+            EXPECT_CALL(mockWinApi, WriteToFile("logs/tag-statistics.txt", expected, true))
+                .Times(1);
+
+            EXPECT_CALL(
+                mockPlugin,
+                ChatAreaMessage(_, _, "Tag item statistics written to logs/tag-statistics.txt", _, _, _, _, _)
+            )
+                .Times(1);
+
+            EXPECT_TRUE(command.ProcessCommand(".ukcp stats tags dump"));
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPluginTest
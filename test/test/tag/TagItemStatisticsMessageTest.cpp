@@ -0,0 +1,62 @@
+#include "pch/pch.h"
+#include "tag/TagItemStatisticsMessage.h"
+
+using UKControllerPlugin::Tag::TagItemStatisticsMessage;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Tag {
+
+        class TagItemStatisticsMessageTest : public Test
+        {
+            public:
+                TagItemStatisticsMessageTest(void)
+                    : message("Item 102: 1 calls")
+                {
+
+                }
+
+                TagItemStatisticsMessage message;
+        };
+
+        TEST_F(TagItemStatisticsMessageTest, ItUsesAHandler)
+        {
+            EXPECT_EQ("UKCP_Query", this->message.MessageHandler());
+        }
+
+        TEST_F(TagItemStatisticsMessageTest, ItHasASender)
+        {
+            EXPECT_EQ("UKCP", this->message.MessageSender());
+        }
+
+        TEST_F(TagItemStatisticsMessageTest, ItHasAMessage)
+        {
+            EXPECT_EQ("Item 102: 1 calls", this->message.MessageString());
+        }
+
+        TEST_F(TagItemStatisticsMessageTest, ItShowsHandler)
+        {
+            EXPECT_TRUE(this->message.MessageShowHandler());
+        }
+
+        TEST_F(TagItemStatisticsMessageTest, ItMarksMessageAsUnread)
+        {
+            EXPECT_TRUE(this->message.MessageMarkUnread());
+        }
+
+        TEST_F(TagItemStatisticsMessageTest, ItOverridesBusy)
+        {
+            EXPECT_TRUE(this->message.MessageOverrideBusy());
+        }
+
+        TEST_F(TagItemStatisticsMessageTest, ItDoesntFlashTheHandler)
+        {
+            EXPECT_FALSE(this->message.MessageFlashHandler());
+        }
+
+        TEST_F(TagItemStatisticsMessageTest, ItDoesntRequireConfirmation)
+        {
+            EXPECT_FALSE(this->message.MessageRequiresConfirm());
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPluginTest
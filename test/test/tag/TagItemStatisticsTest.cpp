@@ -0,0 +1,129 @@
+#include "pch/pch.h"
+#include "tag/TagItemStatistics.h"
+
+using UKControllerPlugin::Tag::TagItemStatistics;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Tag {
+
+        class TagItemStatisticsTest : public Test
+        {
+            public:
+                TagItemStatistics statistics;
+        };
+
+        TEST_F(TagItemStatisticsTest, ItStartsDisabled)
+        {
+            EXPECT_FALSE(statistics.IsEnabled());
+        }
+
+        TEST_F(TagItemStatisticsTest, ItCanBeEnabled)
+        {
+            statistics.Enable();
+            EXPECT_TRUE(statistics.IsEnabled());
+        }
+
+        TEST_F(TagItemStatisticsTest, ItCanBeDisabled)
+        {
+            statistics.Enable();
+            statistics.Disable();
+            EXPECT_FALSE(statistics.IsEnabled());
+        }
+
+        TEST_F(TagItemStatisticsTest, ItStartsEmpty)
+        {
+            EXPECT_TRUE(statistics.GetStatistics().empty());
+            EXPECT_TRUE(statistics.Summarise().empty());
+        }
+
+        TEST_F(TagItemStatisticsTest, ItIgnoresNegativeItems)
+        {
+            statistics.Record(-1, 100, false);
+            EXPECT_TRUE(statistics.GetStatistics().empty());
+        }
+
+        TEST_F(TagItemStatisticsTest, ItRecordsCalls)
+        {
+            statistics.Record(102, 100, false);
+            statistics.Record(102, 300, true);
+            statistics.Record(102, 200, false);
+
+            std::vector<TagItemStatistics::ItemStatistics> result = statistics.GetStatistics();
+            ASSERT_EQ(1, result.size());
+            EXPECT_EQ(102, result[0].itemId);
+            EXPECT_EQ(3, result[0].calls);
+            EXPECT_EQ(600, result[0].totalNanoseconds);
+            EXPECT_EQ(300, result[0].maxNanoseconds);
+            EXPECT_EQ(1, result[0].invalid);
+        }
+
+        TEST_F(TagItemStatisticsTest, ItOrdersItemsByTotalTime)
+        {
+            statistics.Record(1, 100, false);
+            statistics.Record(5, 500, false);
+            statistics.Record(3, 300, false);
+
+            std::vector<TagItemStatistics::ItemStatistics> result = statistics.GetStatistics();
+            ASSERT_EQ(3, result.size());
+            EXPECT_EQ(5, result[0].itemId);
+            EXPECT_EQ(3, result[1].itemId);
+            EXPECT_EQ(1, result[2].itemId);
+        }
+
+        TEST_F(TagItemStatisticsTest, ItEstimatesThe99thPercentile)
+        {
+            for (int i = 0; i < 990; i++) {
+                statistics.Record(1, 100, false);
+            }
+
+            for (int i = 0; i < 10; i++) {
+                statistics.Record(1, 100000, false);
+            }
+
+            uint64_t p99 = statistics.GetStatistics()[0].p99Nanoseconds;
+            EXPECT_GE(p99, 100);
+            EXPECT_LE(p99, 125);
+
+            statistics.Record(1, 100000, false);
+            p99 = statistics.GetStatistics()[0].p99Nanoseconds;
+            EXPECT_GE(p99, 100000);
+            EXPECT_LE(p99, 125000);
+        }
+
+        TEST_F(TagItemStatisticsTest, ThePercentileIsNeverMoreThanTheMaximum)
+        {
+            statistics.Record(1, 1025, false);
+            EXPECT_EQ(1025, statistics.GetStatistics()[0].p99Nanoseconds);
+        }
+
+        TEST_F(TagItemStatisticsTest, ItHandlesVeryShortAndVeryLongTimes)
+        {
+            statistics.Record(1, 0, false);
+            statistics.Record(1, UINT64_MAX, false);
+            EXPECT_EQ(UINT64_MAX, statistics.GetStatistics()[0].p99Nanoseconds);
+        }
+
+        TEST_F(TagItemStatisticsTest, ItResets)
+        {
+            statistics.Record(1, 100, false);
+            statistics.Reset();
+            EXPECT_TRUE(statistics.GetStatistics().empty());
+        }
+
+        TEST_F(TagItemStatisticsTest, ItSummarisesEachItem)
+        {
+            statistics.Record(102, 1500, false);
+            statistics.Record(102, 2500, true);
+            statistics.Record(104, 500, false);
+
+            std::vector<std::string> summary = statistics.Summarise();
+            ASSERT_EQ(2, summary.size());
+            EXPECT_EQ(
+                "Item 102: 2 calls, 4.0us total, 2.0us mean, 2.5us p99, 2.5us max, 1 invalid",
+                summary[0]
+            );
+            EXPECT_EQ("Item 104: 1 calls, 500ns total, 500ns mean, 500ns p99, 500ns max, 0 invalid", summary[1]);
+        }
+    }  // namespace Tag
+}  // namespace UKControllerPluginTest
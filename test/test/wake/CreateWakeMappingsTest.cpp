@@ -4,8 +4,10 @@
 #include "message/UserMessager.h"
 #include "mock/MockEuroscopePluginLoopbackInterface.h"
 #include "bootstrap/BootstrapWarningMessage.h"
+#include "helper/AllocationCounter.h"
 
 using UKControllerPlugin::Wake::CreateWakeMappings;
+using UKControllerPlugin::Wake::DecodeWakeMappings;
 using UKControllerPlugin::Wake::WakeCategoryMapper;
 using UKControllerPlugin::Message::UserMessager;
 using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
@@ -65,5 +67,80 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(1, mapper.Count());
         }
 
+        TEST_F(CreateWakeMappingsTest, ItDecodesAMapperFromText)
+        {
+            WakeCategoryMapper mapper = DecodeWakeMappings("{\"A332\": \"H\", \"B738\": \"LM\"}", this->messager);
+            EXPECT_EQ(2, mapper.Count());
+        }
+
+        TEST_F(CreateWakeMappingsTest, ItHandlesInvalidValuesWhenDecoding)
+        {
+            EXPECT_CALL(
+                this->mockPlugin,
+                ChatAreaMessage(
+                    BootstrapWarningMessage::handler,
+                    BootstrapWarningMessage::sender,
+                    "Failed to load 1 wake categories",
+                    true,
+                    true,
+                    true,
+                    true,
+                    true
+                )
+            )
+                .Times(1);
+
+            WakeCategoryMapper mapper = DecodeWakeMappings("{\"A332\": \"H\", \"B738\": [\"LM\"]}", this->messager);
+            EXPECT_EQ(1, mapper.Count());
+        }
+
+        TEST_F(CreateWakeMappingsTest, ItDecodesNothingFromInvalidJson)
+        {
+            WakeCategoryMapper mapper = DecodeWakeMappings("{\"A332\": \"H\", not json}", this->messager);
+            EXPECT_EQ(0, mapper.Count());
+        }
+
+        /*
+            Times decoding 8000 wake categories, comparing decoding while parsing with parsing into a json
+            object and creating the mappings from that. Disabled by default as it only reports measurements,
+            to run it use --gtest_also_run_disabled_tests.
+        */
+        TEST_F(CreateWakeMappingsTest, DISABLED_DecodeWakeMappingsIsFasterThanParsingAJsonObject)
+        {
+            const std::vector<std::string> categories = {"L", "S", "LM", "UM", "H", "J"};
+            nlohmann::json data;
+            for (int i = 0; i < 8000; i++) {
+                data["T" + std::to_string(i)] = categories[i % categories.size()];
+            }
+            const std::string payload = data.dump();
+
+            const int iterations = 50;
+            size_t objectCount = 0;
+            size_t allocations = CountAllocations();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                objectCount = CreateWakeMappings(nlohmann::json::parse(payload), this->messager).Count();
+            }
+            std::chrono::nanoseconds objectTime = std::chrono::steady_clock::now() - start;
+            size_t objectAllocations = CountAllocations() - allocations;
+
+            size_t decodeCount = 0;
+            allocations = CountAllocations();
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                decodeCount = DecodeWakeMappings(payload, this->messager).Count();
+            }
+            std::chrono::nanoseconds decodeTime = std::chrono::steady_clock::now() - start;
+            size_t decodeAllocations = CountAllocations() - allocations;
+
+            RecordProperty("ObjectMicroseconds", static_cast<int>(objectTime.count() / iterations / 1000));
+            RecordProperty("DecodeMicroseconds", static_cast<int>(decodeTime.count() / iterations / 1000));
+            RecordProperty("ObjectAllocations", static_cast<int>(objectAllocations / iterations));
+            RecordProperty("DecodeAllocations", static_cast<int>(decodeAllocations / iterations));
+            EXPECT_EQ(8000, decodeCount);
+            EXPECT_EQ(objectCount, decodeCount);
+            EXPECT_LT(decodeAllocations, objectAllocations);
+            EXPECT_LT(decodeTime, objectTime);
+        }
     }  // namespace Wake
 }  // namespace UKControllerPluginTest
@@ -62,6 +62,14 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE("123456789012/UM" == handler.GetTagItemData(this->flightplanLongType, this->radarTarget));
         }
 
+        TEST_F(WakeCategoryEventHandlerTest, TestItWritesTheTagItem)
+        {
+            char itemData[16];
+            WakeCategoryEventHandler handler(this->mapper);
+            EXPECT_TRUE(handler.WriteTagItemData(this->flightplanLongType, this->radarTarget, itemData));
+            EXPECT_EQ(0, strcmp("123456789012/UM", itemData));
+        }
+
         TEST_F(WakeCategoryEventHandlerTest, TestItCachesTheResponse)
         {
             WakeCategoryEventHandler handler(this->mapper);
@@ -0,0 +1,66 @@
+#include "pch/pch.h"
+#include "wake/WakeMappingDecoder.h"
+#include "wake/WakeCategoryMapper.h"
+
+using UKControllerPlugin::Wake::WakeCategoryMapper;
+using UKControllerPlugin::Wake::WakeMappingDecoder;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Wake {
+
+        class WakeMappingDecoderTest : public Test
+        {
+            public:
+                WakeMappingDecoderTest()
+                    : decoder(mapper)
+                {
+
+                }
+
+                bool Decode(std::string data)
+                {
+                    return nlohmann::json::sax_parse(data, &this->decoder);
+                }
+
+                WakeCategoryMapper mapper;
+                WakeMappingDecoder decoder;
+        };
+
+        TEST_F(WakeMappingDecoderTest, ItDecodesCategories)
+        {
+            EXPECT_TRUE(this->Decode("{\"A332\": \"H\", \"B738\": \"LM\"}"));
+            EXPECT_EQ(2, this->mapper.Count());
+            EXPECT_EQ(0, this->decoder.CountErrors());
+        }
+
+        TEST_F(WakeMappingDecoderTest, ItDecodesAnEmptyObject)
+        {
+            EXPECT_TRUE(this->Decode("{}"));
+            EXPECT_EQ(0, this->mapper.Count());
+        }
+
+        TEST_F(WakeMappingDecoderTest, ItCountsCategoriesThatArentStrings)
+        {
+            EXPECT_TRUE(
+                this->Decode(
+                    "{\"A332\": \"H\", \"B738\": [\"LM\"], \"B744\": {\"category\": \"H\"}, \"A320\": 1, "
+                    "\"A319\": null, \"A321\": true, \"A388\": 1.5}"
+                )
+            );
+            EXPECT_EQ(1, this->mapper.Count());
+            EXPECT_EQ(6, this->decoder.CountErrors());
+        }
+
+        TEST_F(WakeMappingDecoderTest, ItStopsIfNotAnObject)
+        {
+            EXPECT_FALSE(this->Decode("[\"H\"]"));
+            EXPECT_EQ(0, this->mapper.Count());
+        }
+
+        TEST_F(WakeMappingDecoderTest, ItStopsIfNotJson)
+        {
+            EXPECT_FALSE(this->Decode("{\"A332\": \"H\", not json}"));
+        }
+    }  // namespace Wake
+}  // namespace UKControllerPluginTest
@@ -51,5 +51,10 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE(this->container.tagHandler->HasHandlerForItemId(UKControllerPlugin::Wake::tagItemId));
         }
 
+        TEST_F(WakeModuleTest, ItCachesTheTagItem)
+        {
+            BootstrapPlugin(this->container, this->dependencies);
+            EXPECT_TRUE(this->container.tagHandler->GetCache().HasItem(UKControllerPlugin::Wake::tagItemId));
+        }
     }  // namespace Wake
 }  // namespace UKControllerPluginTest